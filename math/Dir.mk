@@ -1,6 +1,6 @@
 # Makefile fragment - requires GNU make
 #
-# Copyright (c) 2019-2023, Arm Limited.
+# Copyright (c) 2019-2026, Arm Limited.
 # SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
 
 S := $(srcdir)/math
@@ -9,6 +9,16 @@ B := build/math
 math-lib-srcs := $(wildcard $(S)/*.[cS])
 math-lib-srcs += $(wildcard $(S)/$(ARCH)/*.[cS])
 
+ifeq ($(ARCH), x86_64)
+# Routines in math/x86_64 are built twice and selected at load time.
+math-x86_64-mv := exp exp2f pow powf
+ifeq ($(WANT_X86_64_MULTIVERSION), 1)
+math-lib-srcs := $(filter-out $(math-x86_64-mv:%=$(S)/%.c), $(math-lib-srcs))
+else
+math-lib-srcs := $(filter-out $(S)/x86_64/%, $(math-lib-srcs))
+endif
+endif
+
 math-test-srcs := \
 	$(S)/test/mathtest.c \
 	$(S)/test/mathbench.c \
@@ -28,6 +38,8 @@ math-tools := \
 	build/bin/mathbench \
 	build/bin/mathbench_libc \
 	build/bin/runulp.sh \
+	build/bin/footprint.sh \
+	build/bin/mca.sh \
 	build/bin/ulp \
 
 math-host-tools := \
@@ -46,19 +58,31 @@ math-files := \
 	$(math-host-tools) \
 	$(math-includes) \
 	$(math-test-includes) \
+	build/math/libmathlib.map \
 
 all-math: $(math-libs) $(math-tools) $(math-includes) $(math-test-includes)
 
 $(math-objs): $(math-includes) $(math-test-includes)
 $(math-objs): CFLAGS_ALL += $(math-cflags)
 $(B)/test/mathtest.o: CFLAGS_ALL += -fmath-errno
+$(B)/x86_64/%_fma.o $(B)/x86_64/%_fma.os: CFLAGS_ALL += -msse4.1 -mfma
 $(math-host-objs): CC = $(HOST_CC)
 $(math-host-objs): CFLAGS_ALL = $(HOST_CFLAGS)
 
 $(B)/test/ulp.o: $(S)/test/ulp.h
 
+ifneq ($(math-routines),)
+build/lib/libmathlib.so: build/math/libmathlib.map
+build/lib/libmathlib.so: LDFLAGS += -Wl,--gc-sections \
+	-Wl,--version-script=build/math/libmathlib.map
+endif
+
+build/math/libmathlib.map: $(wildcard config.mk)
+	{ echo '{ global:'; printf '  %s;\n' $(math-routines); \
+	  echo 'local: *; };'; } > $@
+
 build/lib/libmathlib.so: $(math-lib-objs:%.o=%.os)
-	$(CC) $(CFLAGS_ALL) $(LDFLAGS) -shared -o $@ $^
+	$(CC) $(CFLAGS_ALL) $(LDFLAGS) -shared -o $@ $(filter %.os,$^)
 
 build/lib/libmathlib.a: $(math-lib-objs)
 	rm -f $@
@@ -105,10 +129,16 @@ check-math-rtest: $(math-host-tools) $(math-tools)
 	cat $(math-rtests) | build/bin/rtest | $(EMULATOR) build/bin/mathtest $(math-testflags)
 
 check-math-ulp: $(math-tools)
-	ULPFLAGS="$(math-ulpflags)" WANT_SIMD_EXCEPT="$(WANT_SIMD_EXCEPT)" build/bin/runulp.sh $(EMULATOR)
+	ULPFLAGS="$(math-ulpflags)" WANT_SIMD_EXCEPT="$(WANT_SIMD_EXCEPT)" WANT_SIZE_OPT="$(WANT_SIZE_OPT)" build/bin/runulp.sh $(EMULATOR)
 
 check-math: check-math-test check-math-rtest check-math-ulp
 
+footprint-math: build/lib/libmathlib.a build/bin/footprint.sh
+	build/bin/footprint.sh build/lib/libmathlib.a
+
+mca-math: build/lib/libmathlib.a build/bin/mca.sh
+	build/bin/mca.sh $(mca-flags) build/lib/libmathlib.a
+
 install-math: \
  $(math-libs:build/lib/%=$(DESTDIR)$(libdir)/%) \
  $(math-includes:build/include/%=$(DESTDIR)$(includedir)/%)
@@ -116,4 +146,4 @@ install-math: \
 clean-math:
 	rm -f $(math-files)
 
-.PHONY: all-math check-math-test check-math-rtest check-math-ulp check-math install-math clean-math
+.PHONY: all-math check-math-test check-math-rtest check-math-ulp check-math footprint-math mca-math install-math clean-math
@@ -0,0 +1,129 @@
+/*
+ * Double-precision e^x and e^x - 1 functions with extra precision argument.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <float.h>
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+#include "exp_inline.h"
+
+/* Taylor coefficients of exp(r) - 1 - r for __expm1_dd, these are used
+   instead of the minimax coefficients of exp so the polynomial error is
+   relative to r.  Truncation error is below 2^-63 * |r| for |r| < ln2/2N.  */
+#define E3 0x1.5555555555555p-3
+#define E4 0x1.5555555555555p-5
+#define E5 0x1.1111111111111p-7
+#define E6 0x1.6c16c16c16c17p-10
+
+/* Computes exp(x+xtail) where |xtail| < 2^-8/N and |xtail| <= |x|, useful
+   for implementing pow where more than double precision input is needed.
+   The evaluation is the same as in exp.  Worst-case error is 0.51 ULP.  */
+double
+__exp_dd (double x, double xtail)
+{
+  return exp_inline (x, xtail, 1);
+}
+
+/* Computes exp(x+xtail) - 1 where |xtail| < 2^-8/N and |xtail| <= |x|, so
+   the hi + lo result of __log_dd and __log1p_dd can be passed in directly.
+   The argument reduction is the same as in exp and
+   e^x - 1 = (scale - 1) + scale * (tail + exp(r) - 1)
+   is summed such that there is no cancellation error for small x and the
+   result is correctly rounded in most cases.  Worst-case error is 0.51 ULP,
+   the same with and without fma.  */
+double
+__expm1_dd (double x, double xtail)
+{
+  uint32_t abstop;
+  uint64_t ki, idx, top, sbits;
+  /* double_t for better performance on targets with FLT_EVAL_METHOD==2.  */
+  double_t kd, z, r, rlo, rtail, r2, scale, tail, tmp, hi, lo, v, s, slo;
+
+  abstop = top12 (x) & 0x7ff;
+  if (unlikely (abstop - top12 (0x1p-60) >= top12 (512.0) - top12 (0x1p-60)))
+    {
+      if (abstop - top12 (0x1p-60) >= 0x80000000)
+	/* |x| < 2^-60: e^x - 1 ~= x + xtail, x^2/2 is below 2^-61 * |x|.  */
+	return x + xtail;
+      if (asuint64 (x) >> 63)
+	/* x <= -512 or -inf: e^x < 2^-738 so the result rounds to -1.  */
+	return x != x ? x + x : -1.0;
+      if (abstop >= top12 (1024.0))
+	{
+	  if (abstop >= top12 (INFINITY))
+	    return x + x;
+	  return __math_oflow (0);
+	}
+      /* Large x is special cased below.  */
+      abstop = 0;
+    }
+
+  /* exp(x) = 2^(k/N) * exp(r), with exp(r) in [2^(-1/2N),2^(1/2N)].  */
+  /* x = ln2/N*k + r, with int k and r in [-ln2/2N, ln2/2N].  */
+  z = InvLn2N * x;
+#if TOINT_INTRINSICS
+  kd = roundtoint (z);
+  ki = converttoint (z);
+#elif EXP_USE_TOINT_NARROW
+  /* z - kd is in [-0.5-2^-16, 0.5] in all rounding modes.  */
+  kd = eval_as_double (z + Shift);
+  ki = asuint64 (kd) >> 16;
+  kd = (double_t) (int32_t) ki;
+#else
+  /* z - kd is in [-1, 1] in non-nearest rounding modes.  */
+  kd = eval_as_double (z + Shift);
+  ki = asuint64 (kd);
+  kd -= Shift;
+#endif
+  /* In non-nearest rounding modes k can be non-zero for tiny x, then the
+     sum below would suffer from cancellation.  */
+  if ((top12 (x) & 0x7ff) < top12 (0x1p-9))
+    {
+      kd = 0;
+      ki = 0;
+    }
+  /* r + rtail = x + xtail - kd*ln2/N, the first sum is exact since
+     |r| <= |kd*ln2/N|/2 when k != 0.  */
+  r = x + kd * NegLn2hiN;
+  rlo = kd * NegLn2loN + xtail;
+  rtail = r;
+  r = rtail + rlo;
+  rtail = rtail - r + rlo;
+  /* 2^(k/N) ~= scale * (1 + tail).  */
+  idx = 2 * (ki % N);
+  top = ki << (52 - EXP_TABLE_BITS);
+  tail = asdouble (T[idx]);
+  /* This is only a valid scale when -1023*N < k < 1024*N.  */
+  sbits = T[idx + 1] + top;
+  r2 = r * r;
+  /* tmp = (1 + tail) * exp(r) - 1 - r, ignoring tail * r^2.  */
+  tmp = tail + tail * r + r2 * (0.5 + r * E3)
+	+ r2 * r2 * (E4 + r * E5 + r2 * E6);
+  if (unlikely (abstop == 0))
+    {
+      /* x >= 512, the -1 is negligible.  The exponent of scale might have
+	 overflowed by <= 460.  */
+      sbits -= 1009ull << 52;
+      scale = asdouble (sbits);
+      return check_oflow (
+	  eval_as_double (0x1p1009 * (scale + scale * (r + tmp + rtail))));
+    }
+  scale = asdouble (sbits);
+  /* hi + lo = scale - 1 exactly (2Sum), lo is 0 unless |k| > N.  */
+  hi = scale - 1.0;
+  v = hi - scale;
+  lo = (scale - (hi - v)) + (-1.0 - v);
+  /* e^x - 1 = hi + r + hi * r + scale * (tmp + rtail) + lo * (1 + r), where
+     only the leading sum needs to be exact: |hi| > |r| unless k == 0 when
+     hi is 0, and the rounding error of hi * r is below 2^-61 * |hi|.  */
+  s = hi + r;
+  slo = hi - s + r;
+  return eval_as_double (s + (slo + lo + hi * r + scale * (tmp + rtail)));
+}
+#if USE_GLIBC_ABI
+hidden_alias (__exp_dd, __exp1)
+#endif
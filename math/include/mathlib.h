@@ -24,6 +24,14 @@ double log (double);
 double log2 (double);
 double pow (double, double);
 
+/* Extra precision building blocks: __log_dd and __log1p_dd return the high
+   part of the result and store the low part in *tail, __exp_dd and
+   __expm1_dd take the argument as x + xtail with |xtail| < 2^-15.  */
+double __log_dd (double, double *);
+double __log1p_dd (double, double *);
+double __exp_dd (double, double);
+double __expm1_dd (double, double);
+
 #if __aarch64__
 # if __GNUC__ >= 5
 typedef __Float32x4_t __f32x4_t;
@@ -0,0 +1,131 @@
+/*
+ * Double-precision log(x) and log1p(x) with extra precision result.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include "math_config.h"
+#include "pow_log_inline.h"
+
+/*
+Result is hi + *tail with |*tail| <= ulp(hi)/2, i.e. hi is log(x) rounded to
+nearest (except in rare cases where hi + *tail is within 2^-68 relative error
+of a rounding boundary).
+relerr: 1.3 * 2^-68 (1.5 * 2^-68 without fma) for __log_dd
+relerr: 1.4 * 2^-68 (1.6 * 2^-68 without fma) for __log1p_dd
+*/
+
+/* Handle x <= 0, subnormal x, inf and nan.  Returns 0 and sets *r to the
+   result if x is special, otherwise returns 1 and sets *ix to the normalized
+   bit representation of x.  */
+static inline int
+log_normalize (double x, uint64_t *ix, double *r)
+{
+  uint64_t i = asuint64 (x);
+  if (likely (top12 (x) - 0x001 < 0x7ff - 0x001))
+    {
+      *ix = i;
+      return 1;
+    }
+  if (2 * i == 0)
+    *r = __math_divzero (1);
+  else if (i == asuint64 (INFINITY))
+    *r = x;
+  else if ((i >> 63) || 2 * i > 2 * asuint64 (INFINITY))
+    *r = __math_invalid (x);
+  else
+    {
+      /* Normalize subnormal x so exponent becomes negative.  */
+      i = asuint64 (x * 0x1p52);
+      *ix = i - (52ULL << 52);
+      return 1;
+    }
+  return 0;
+}
+
+/* Computes log(x) as hi + *tail where hi is the returned value.
+   The relative error of hi + *tail is 1.3 * 2^-68, so this can be used to
+   build accurate pow-like kernels and compensated sums of logarithms.  For
+   x <= 0, inf and nan the result is the same as log(x) and *tail is 0.  */
+double
+__log_dd (double x, double *tail)
+{
+  uint64_t ix;
+  double r;
+  if (unlikely (!log_normalize (x, &ix, &r)))
+    {
+      *tail = 0;
+      return r;
+    }
+  double_t lo;
+  double_t hi = log_inline (ix, &lo);
+  *tail = lo;
+  return hi;
+}
+
+/* Computes log1p(x) as hi + *tail where hi is the returned value.
+   1 + x is computed exactly as u + ulo, then
+   log1p(x) = log(u) + log1p(ulo/u) ~= log(u) + ulo/u, which only loses
+   accuracy when |x| is small, where a Taylor expansion is used instead.
+   The relative error of hi + *tail is 1.4 * 2^-68.  For x <= -1, inf and nan
+   the result is the same as log1p(x) and *tail is 0.  */
+double
+__log1p_dd (double x, double *tail)
+{
+  uint32_t abstop = top12 (x) & 0x7ff;
+  double_t hi, lo;
+  if (abstop < top12 (0x1p-20))
+    {
+      /* |x| < 2^-20: log1p(x) = x - x^2/2 + x^3/3 - x^4/4 + x^5/5 with
+	 relative error below 2^-100 in the truncation, the rounding errors
+	 of the tail are below 2^-74 relative to x.  */
+      if (abstop < top12 (0x1p-68))
+	{
+	  /* x^2/2 is below 2^-69 * |x| so log1p(x) rounds to x, but signal
+	     inexact and underflow for subnormal x without spurious underflow
+	     for normal x.  */
+	  if (abstop == 0)
+	    force_eval_double (opt_barrier_double (x) * x);
+	  else
+	    force_eval_double (1.0 + opt_barrier_double (x));
+	  *tail = 0;
+	  return x;
+	}
+      double_t x2 = x * x;
+      lo = x2 * (-0.5 + x * (0x1.5555555555555p-2 + x * (-0.25 + x * 0.2)));
+      hi = x + lo;
+      *tail = x - hi + lo;
+      return hi;
+    }
+  if (unlikely (asuint64 (x) >= asuint64 (-1.0) || abstop >= top12 (0x1p70)))
+    {
+      /* x <= -1, x >= 2^70, inf or nan.  */
+      if (asuint64 (x) == asuint64 (-1.0))
+	{
+	  *tail = 0;
+	  return __math_divzero (1);
+	}
+      if (asuint64 (x) >> 63)
+	{
+	  *tail = 0;
+	  return __math_invalid (x);
+	}
+      /* log1p(x) = log(x) + 1/x - ... and 1/x is below 2^-75 * log(x).  */
+      return __log_dd (x, tail);
+    }
+
+  /* u + ulo = 1 + x exactly (2Sum), u is in [2^-53, 2^70].  */
+  double_t u = 1.0 + x;
+  double_t v = u - x;
+  double_t ulo = (1.0 - v) + (x - (u - v));
+  hi = log_inline (asuint64 (u), &lo);
+  /* |ulo/u| <= 2^-53, so the error of the first order term is below
+     2^-107 and for |x| >= 2^-20 that is below 2^-87 relative to log1p(x).  */
+  lo += ulo / u;
+  double_t y = hi + lo;
+  *tail = hi - y + lo;
+  return y;
+}
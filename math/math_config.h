@@ -1,7 +1,7 @@
 /*
  * Configuration for math routines.
  *
- * Copyright (c) 2017-2023, Arm Limited.
+ * Copyright (c) 2017-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -28,10 +28,17 @@
 /* Set errno to ERANGE if result underflows to 0 (in all rounding modes).  */
 # define WANT_ERRNO_UFLOW (WANT_ROUNDING && WANT_ERRNO)
 #endif
+#ifndef WANT_SIZE_OPT
+/* If defined to 1, use a smaller log lookup table with a higher order
+   polynomial, trading some speed and accuracy for less rodata.  The exp
+   table is shared with exp10 and the double-double routines which need
+   the default size.  */
+# define WANT_SIZE_OPT 0
+#endif
 
 /* Compiler can inline round as a single instruction.  */
 #ifndef HAVE_FAST_ROUND
-# if __aarch64__
+# if __aarch64__ || (__x86_64__ && __SSE4_1__)
 #   define HAVE_FAST_ROUND 1
 # else
 #   define HAVE_FAST_ROUND 0
@@ -49,7 +56,7 @@
 
 /* Compiler can inline fma as a single instruction.  */
 #ifndef HAVE_FAST_FMA
-# if defined FP_FAST_FMA || __aarch64__
+# if defined FP_FAST_FMA || __aarch64__ || __FMA__
 #   define HAVE_FAST_FMA 1
 # else
 #   define HAVE_FAST_FMA 0
@@ -137,13 +144,24 @@
    the semantics documented below.  */
 # define TOINT_INTRINSICS 1
 
+# if __SSE4_1__
+#   include <smmintrin.h>
+# endif
+
 /* Round x to nearest int in all rounding modes, ties have to be rounded
    consistently with converttoint so the results match.  If the result
    would be outside of [-2^31, 2^31-1] then the semantics is unspecified.  */
 static inline double_t
 roundtoint (double_t x)
 {
+# if __SSE4_1__
+  /* SSE4.1 roundsd with a static rounding mode, independent of MXCSR.  */
+  __m128d v = _mm_set_sd (x);
+  v = _mm_round_sd (v, v, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+  return _mm_cvtsd_f64 (v);
+# else
   return round (x);
+# endif
 }
 
 /* Convert x to nearest int in all rounding modes, ties have to be rounded
@@ -152,7 +170,10 @@ roundtoint (double_t x)
 static inline int32_t
 converttoint (double_t x)
 {
-# if HAVE_FAST_LROUND
+# if __SSE4_1__
+  /* The input of cvtsd2si is integral so MXCSR rounding does not matter.  */
+  return _mm_cvtsd_si32 (_mm_set_sd (roundtoint (x)));
+# elif HAVE_FAST_LROUND
   return lround (x);
 # else
   return (long) round (x);
@@ -440,8 +461,13 @@ extern const struct exp_data
   uint64_t tab[2*(1 << EXP_TABLE_BITS)];
 } __exp_data HIDDEN;
 
-#define LOG_TABLE_BITS 7
-#define LOG_POLY_ORDER 6
+#if WANT_SIZE_OPT
+# define LOG_TABLE_BITS 6
+# define LOG_POLY_ORDER 7
+#else
+# define LOG_TABLE_BITS 7
+# define LOG_POLY_ORDER 6
+#endif
 #define LOG_POLY1_ORDER 12
 extern const struct log_data
 {
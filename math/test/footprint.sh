@@ -0,0 +1,40 @@
+#!/bin/bash
+
+# Code and table size report for the routines in a static library.
+#
+# Copyright (c) 2026, Arm Limited.
+# SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+
+# Usage: footprint.sh lib.a [lib2.a ..]
+# Lists the text, rodata and data bytes of every object in the libraries,
+# largest first.  Objects named *_data are lookup tables shared by several
+# routines, their rodata and data bytes are counted as table bytes.
+# Set SIZE to use a different size tool, e.g. for cross builds.
+
+#set -x
+set -eu
+
+size="${SIZE:-size}"
+
+[ $# -gt 0 ] || { echo "usage: $0 lib.a [lib2.a ..]" >&2; exit 1; }
+
+for lib in "$@"
+do
+	echo "$lib:"
+	$size -A "$lib" | awk '
+/\(ex / { obj = $1; sub(/\.o$/, "", obj); sub(/\.os$/, "", obj); objs[obj] = 1; next }
+$1 ~ /^\.text/ { text[obj] += $2 }
+$1 ~ /^\.rodata/ { rodata[obj] += $2 }
+$1 ~ /^\.(data|sdata)/ { data[obj] += $2 }
+END {
+	printf "%-28s %8s %8s %8s %8s\n", "object", "text", "rodata", "data", "table"
+	for (o in objs) {
+		t = (o ~ /_data$/) ? rodata[o] + data[o] : 0
+		printf "%-28s %8d %8d %8d %8d\n", o, text[o], rodata[o], data[o], t \
+			| "sort -k2,2nr -k3,3nr"
+		st += text[o]; sr += rodata[o]; sd += data[o]; stab += t
+	}
+	close("sort -k2,2nr -k3,3nr")
+	printf "%-28s %8d %8d %8d %8d\n", "total", st, sr, sd, stab
+}'
+done
@@ -1,7 +1,7 @@
 /*
  * Microbenchmark for math functions.
  *
- * Copyright (c) 2018-2022, Arm Limited.
+ * Copyright (c) 2018-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -21,6 +21,8 @@
 #define N 8000
 /* Iterations over the array.  */
 #define ITER 125
+/* Bytes written between cold calls to evict the caches.  */
+#define EVICT_SIZE (64 << 20)
 
 static double *Trace;
 static size_t trace_size;
@@ -28,6 +30,7 @@ static double A[N];
 static float Af[N];
 static long measurecount = MEASURE;
 static long itercount = ITER;
+static char *evictbuf;
 
 #ifdef __vpcs
 #include <arm_neon.h>
@@ -301,6 +304,18 @@ runf_latency (float f (float))
     prev = f (Af[i] + prev * z);
 }
 
+static void
+run_cold (double f (double))
+{
+  f (A[0]);
+}
+
+static void
+runf_cold (float f (float))
+{
+  f (Af[0]);
+}
+
 #ifdef __vpcs
 static void
 run_vn_thruput (__vpcs v_double f (v_double))
@@ -335,6 +350,18 @@ runf_vn_latency (__vpcs v_float f (v_float))
   for (int i = 0; i < N; i += v_float_len ())
     prev = f (vbslq_f32 (sel, prev, v_float_load (Af+i)));
 }
+
+static void
+run_vn_cold (__vpcs v_double f (v_double))
+{
+  f (v_double_load (A));
+}
+
+static void
+runf_vn_cold (__vpcs v_float f (v_float))
+{
+  f (v_float_load (Af));
+}
 #endif
 
 #if WANT_SVE_MATH
@@ -371,6 +398,18 @@ runf_sv_latency (sv_float f (sv_float, sv_bool))
   for (int i = 0; i < N; i += sv_float_len ())
     prev = f (svsel_f32 (sel, sv_float_load (Af+i), prev), svptrue_b32 ());
 }
+
+static void
+run_sv_cold (sv_double f (sv_double, sv_bool))
+{
+  f (sv_double_load (A), svptrue_b64 ());
+}
+
+static void
+runf_sv_cold (sv_float f (sv_float, sv_bool))
+{
+  f (sv_float_load (Af), svptrue_b32 ());
+}
 #endif
 
 static uint64_t
@@ -396,12 +435,48 @@ tic (void)
     } \
 } while (0)
 
+/* Write a buffer larger than the last level cache so the code and the
+   lookup tables of the benchmarked function are no longer cached.  */
+static void
+evict (void)
+{
+  if (evictbuf == NULL)
+    {
+      evictbuf = malloc (EVICT_SIZE);
+      if (evictbuf == NULL)
+	{
+	  printf ("out of memory\n");
+	  exit (1);
+	}
+    }
+  for (size_t i = 0; i < EVICT_SIZE; i += 64)
+    evictbuf[i] = (char) i;
+  __asm__ __volatile__ ("" ::: "memory");
+}
+
+/* Time single calls right after evicting the caches, dt0 is the first
+   call after program start, dt the best of the measurements.  */
+#define TIMECOLD(run, f) do { \
+  dt = -1; \
+  for (int j = 0; j < measurecount; j++) \
+    { \
+      evict (); \
+      uint64_t t0 = tic (); \
+      run (f); \
+      uint64_t t1 = tic (); \
+      if (j == 0) \
+	dt0 = t1 - t0; \
+      if (t1 - t0 < dt) \
+	dt = t1 - t0; \
+    } \
+} while (0)
+
 static void
 bench1 (const struct fun *f, int type, double lo, double hi)
 {
-  uint64_t dt = 0;
+  uint64_t dt = 0, dt0 = 0;
   uint64_t ns100;
-  const char *s = type == 't' ? "rthruput" : "latency";
+  const char *s = type == 't' ? "rthruput" : type == 'c' ? "cold" : "latency";
   int vlen = 1;
 
   if (f->vec == 'n')
@@ -417,6 +492,10 @@ bench1 (const struct fun *f, int type, double lo, double hi)
     TIMEIT (runf_thruput, f->fun.f);
   else if (f->prec == 'f' && type == 'l' && f->vec == 0)
     TIMEIT (runf_latency, f->fun.f);
+  else if (f->prec == 'd' && type == 'c' && f->vec == 0)
+    TIMECOLD (run_cold, f->fun.d);
+  else if (f->prec == 'f' && type == 'c' && f->vec == 0)
+    TIMECOLD (runf_cold, f->fun.f);
 #ifdef __vpcs
   else if (f->prec == 'd' && type == 't' && f->vec == 'n')
     TIMEIT (run_vn_thruput, f->fun.vnd);
@@ -426,6 +505,10 @@ bench1 (const struct fun *f, int type, double lo, double hi)
     TIMEIT (runf_vn_thruput, f->fun.vnf);
   else if (f->prec == 'f' && type == 'l' && f->vec == 'n')
     TIMEIT (runf_vn_latency, f->fun.vnf);
+  else if (f->prec == 'd' && type == 'c' && f->vec == 'n')
+    TIMECOLD (run_vn_cold, f->fun.vnd);
+  else if (f->prec == 'f' && type == 'c' && f->vec == 'n')
+    TIMECOLD (runf_vn_cold, f->fun.vnf);
 #endif
 #if WANT_SVE_MATH
   else if (f->prec == 'd' && type == 't' && f->vec == 's')
@@ -436,6 +519,10 @@ bench1 (const struct fun *f, int type, double lo, double hi)
     TIMEIT (runf_sv_thruput, f->fun.svf);
   else if (f->prec == 'f' && type == 'l' && f->vec == 's')
     TIMEIT (runf_sv_latency, f->fun.svf);
+  else if (f->prec == 'd' && type == 'c' && f->vec == 's')
+    TIMECOLD (run_sv_cold, f->fun.svd);
+  else if (f->prec == 'f' && type == 'c' && f->vec == 's')
+    TIMECOLD (runf_sv_cold, f->fun.svf);
 #endif
 
   if (type == 't')
@@ -454,6 +541,10 @@ bench1 (const struct fun *f, int type, double lo, double hi)
 	      (unsigned) (ns100 / 100), (unsigned) (ns100 % 100),
 	      (unsigned long long) dt, lo, hi, vlen);
     }
+  else if (type == 'c')
+    printf ("%9s %8s: first %6llu ns best %6llu ns/call in [%g %g] vlen %d\n",
+	    f->name, s, (unsigned long long) dt0, (unsigned long long) dt, lo,
+	    hi, vlen);
   fflush (stdout);
 }
 
@@ -482,6 +573,9 @@ bench (const struct fun *f, double lo, double hi, int type, int gen)
   if (type == 'b' || type == 'l')
     bench1 (f, 'l', lo, hi);
 
+  if (type == 'c')
+    bench1 (f, 'c', lo, hi);
+
   for (int i = N; i < trace_size; i += N)
     {
       if (f->prec == 'd')
@@ -495,6 +589,9 @@ bench (const struct fun *f, double lo, double hi, int type, int gen)
 
       if (type == 'b' || type == 'l')
 	bench1 (f, 'l', lo, hi);
+
+      if (type == 'c')
+	bench1 (f, 'c', lo, hi);
     }
 }
 
@@ -539,9 +636,9 @@ readtrace (const char *name)
 static void
 usage (void)
 {
-  printf ("usage: ./mathbench [-g rand|linear|trace] [-t latency|thruput|both] "
-	  "[-i low high] [-f tracefile] [-m measurements] [-c iterations] func "
-	  "[func2 ..]\n");
+  printf ("usage: ./mathbench [-g rand|linear|trace] "
+	  "[-t latency|thruput|both|cold] [-i low high] [-f tracefile] "
+	  "[-m measurements] [-c iterations] func [func2 ..]\n");
   printf ("func:\n");
   printf ("%7s [run all benchmarks]\n", "all");
   for (const struct fun *f = funtab; f->name; f++)
@@ -602,7 +699,7 @@ main (int argc, char *argv[])
       else if (argc >= 2 && strcmp (argv[0], "-t") == 0)
 	{
 	  type = argv[1][0];
-	  if (strchr ("ltb", type) == 0)
+	  if (strchr ("ltbc", type) == 0)
 	    usage ();
 	  argv += 2;
 	  argc -= 2;
@@ -17,6 +17,11 @@ D (log2, 0.999, 1.001)
 D (xpow, 0.01, 11.1)
 D (ypow, -9.9, 9.9)
 D (erf, -6.0, 6.0)
+{"__log_dd", 'd', 0, 0.01, 11.1, {.d = log_dd_wrap}},
+{"__log1p_dd", 'd', 0, -0.9, 10.0, {.d = log1p_dd_wrap}},
+{"__exp_dd", 'd', 0, -9.9, 9.9, {.d = exp_dd_wrap}},
+{"__expm1_dd", 'd', 0, -9.9, 9.9, {.d = expm1_dd_wrap}},
+{"__expm1_dd", 'd', 0, -0.01, 0.01, {.d = expm1_dd_wrap}},
 
 F (expf, -9.9, 9.9)
 F (exp2f, -9.9, 9.9)
@@ -44,6 +49,12 @@ F (cosf, 3.3, 33.3)
 F (cosf, 100, 1000)
 F (cosf, 1e6, 1e32)
 F (erff, -4.0, 4.0)
+#if WANT_X86_64_MULTIVERSION
+D (__exp_sse2, -9.9, 9.9)
+{"__pow_sse2", 'd', 0, 0.01, 11.1, {.d = xypow_sse2}},
+F (__exp2f_sse2, -9.9, 9.9)
+{"__powf_sse2", 'f', 0, 0.01, 11.1, {.f = xypowf_sse2}},
+#endif
 #ifdef __vpcs
 VND (_ZGVnN2v_exp, -9.9, 9.9)
 VND (_ZGVnN2v_log, 0.01, 11.1)
@@ -21,6 +21,26 @@ xy_Z_pow (v_double x)
 
 #endif
 
+#if WANT_X86_64_MULTIVERSION
+/* Baseline variants behind the load time dispatch of exp, pow etc.  */
+double __exp_sse2 (double);
+float __exp2f_sse2 (float);
+double __pow_sse2 (double, double);
+float __powf_sse2 (float, float);
+
+static double
+xypow_sse2 (double x)
+{
+  return __pow_sse2 (x, x);
+}
+
+static float
+xypowf_sse2 (float x)
+{
+  return __powf_sse2 (x, x);
+}
+#endif
+
 static double
 xypow (double x)
 {
@@ -57,6 +77,34 @@ ypowf (float x)
   return powf (2.34f, x);
 }
 
+static double
+log_dd_wrap (double x)
+{
+  double lo;
+  double hi = __log_dd (x, &lo);
+  return hi + lo;
+}
+
+static double
+log1p_dd_wrap (double x)
+{
+  double lo;
+  double hi = __log1p_dd (x, &lo);
+  return hi + lo;
+}
+
+static double
+exp_dd_wrap (double x)
+{
+  return __exp_dd (x, x * 0x1p-60);
+}
+
+static double
+expm1_dd_wrap (double x)
+{
+  return __expm1_dd (x, x * 0x1p-60);
+}
+
 static float
 sincosf_wrap (float x)
 {
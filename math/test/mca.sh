@@ -0,0 +1,260 @@
+#!/bin/bash
+
+# Static throughput report for the routines in a library, using llvm-mca.
+#
+# Copyright (c) 2026, Arm Limited.
+# SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+
+# Usage: mca.sh [-c cpu[,cpu..]] [-m bench.out].. lib.a|obj.o [symbol ..]
+# The hot path of every global function of an AArch64 library or object,
+# or of the listed ones, is extracted from the disassembly: the largest
+# innermost loop, or for routines without a loop the straight-line path
+# from the entry to the first return with conditional branches not taken.
+# Aliases, i.e. routines at the same address, share the same hot path.
+# It is run through llvm-mca for each cpu (default MCA_CPUS) and the table
+# lists for every routine and cpu:
+#   kind     loop or body, and the number of instructions of the hot path,
+#   cyc/it   predicted cycles per iteration in the steady state,
+#   crit     cycles of a single iteration, i.e. the critical path,
+#   rthru    reciprocal throughput bound by the resources,
+#   pressure the most used resource and its cycles per iteration,
+#   cyc/el   cycles per element for the vector math routines, with 128-bit
+#            vectors for SVE,
+#   measured the first figure for the routine in the -m files, which can be
+#            mathbench output (rthruput ns/elem) or string benchmark output
+#            (name followed by a value).
+# llvm-mca has no model for some cpus and maps others to the model of an
+# older core, the resource names in the pressure column show which model
+# was used.  Routines using instructions the cpu does not have, e.g. SVE on
+# neoverse-n1, are reported as such.
+# Set OBJDUMP, NM and MCA to use different tools.
+
+#set -x
+set -eu
+
+objdump="${OBJDUMP:-llvm-objdump}"
+nm="${NM:-llvm-nm}"
+mca="${MCA:-llvm-mca}"
+cpus="${MCA_CPUS:-neoverse-n1 neoverse-v1 neoverse-n2 neoverse-v2}"
+mattr="+sve,+sve2,+mops,+mte"
+bench=
+
+usage () {
+	echo "usage: $0 [-c cpu[,cpu..]] [-m bench.out].. lib.a|obj.o [symbol ..]" >&2
+	exit 1
+}
+
+while getopts c:m: opt
+do
+	case $opt in
+	c) cpus="${OPTARG//,/ }" ;;
+	m) bench="$bench $OPTARG" ;;
+	*) usage ;;
+	esac
+done
+shift $((OPTIND - 1))
+[ $# -gt 0 ] || usage
+lib="$1"
+shift
+
+tmp=$(mktemp -d)
+trap 'rm -rf "$tmp"' EXIT
+
+# Drop cpus that llvm-mca does not model, rather than silently using the
+# generic model for them.
+models=
+for cpu in $cpus
+do
+	if echo 'nop' | $mca -mtriple=aarch64 -mcpu="$cpu" 2>&1 >/dev/null \
+		| grep -q 'not a recognized processor'
+	then
+		echo "$0: $mca has no model for $cpu, skipped" >&2
+	else
+		models="$models $cpu"
+	fi
+done
+[ -n "$models" ] || { echo "$0: no cpu to model" >&2; exit 1; }
+
+# Measured figures: mathbench rthruput lines, or lines of a name and a value.
+: > "$tmp/measured"
+for f in $bench
+do
+	awk '
+$2 == "rthruput:" && !($1 in m) { m[$1] = $3 " " $4 }
+NF == 2 && $2 ~ /^[0-9.]+$/ && !($1 in m) { m[$1] = $2 }
+END { for (n in m) print n, m[n] }' "$f" >> "$tmp/measured"
+done
+
+$nm -g --defined-only "$lib" | awk '$2 == "T" { print $3 }' | sort -u > "$tmp/globals"
+if [ $# -gt 0 ]
+then
+	printf '%s\n' "$@" | sort -u | comm -12 - "$tmp/globals" > "$tmp/want"
+else
+	cp "$tmp/globals" "$tmp/want"
+fi
+
+# Split the disassembly into one llvm-mca input per routine.  Branch
+# targets are replaced by a label at the start of the block, llvm-mca does
+# not follow control flow.  Branches with a relocation go to another
+# symbol, e.g. a tail call, even though they disassemble as branches to
+# themselves.  The member, section and address of every routine are listed
+# to find its aliases below.
+$objdump -d -r --no-show-raw-insn --mattr="$mattr" "$lib" | awk -v dir="$tmp" '
+function hex(s,   i, x) {
+	x = 0
+	for (i = 1; i <= length(s); i++)
+		x = x * 16 + index("0123456789abcdef", substr(s, i, 1)) - 1
+	return x
+}
+function hotpath(   i, j, k, t, inner, best, lo, hi, kind, f) {
+	if (!(name in want) || n == 0)
+		return
+	nl = 0
+	for (i = 0; i < n; i++) {
+		if (!(ins[i] ~ /^(b|b\.[a-z]+|cbn?z|tbn?z)[ \t]/))
+			continue
+		if (reloc[i] || !match(ins[i], "(0x)?[0-9a-f]+ <" name "(\\+0x[0-9a-f]+)?>"))
+			continue
+		t = substr(ins[i], RSTART, RLENGTH)
+		sub(/ .*/, "", t); sub(/^0x/, "", t)
+		t = hex(t)
+		if (t > addr[i])
+			continue
+		# A range that returns is a jump back into shared code, not a loop.
+		for (j = i; j > 0 && addr[j] > t; j--)
+			if (ins[j - 1] ~ /^(ret|br)([ \t]|$)/)
+				break
+		if (addr[j] == t)
+			{ ls[nl] = j; le[nl] = i; nl++ }
+	}
+	best = -1
+	for (i = 0; i < nl; i++) {
+		inner = 1
+		for (k = 0; k < nl; k++)
+			if (k != i && ls[k] >= ls[i] && le[k] <= le[i] \
+			    && le[k] - ls[k] < le[i] - ls[i])
+				inner = 0
+		if (inner && (best < 0 || le[i] - ls[i] > hi - lo))
+			{ best = i; lo = ls[i]; hi = le[i] }
+	}
+	if (best < 0) {
+		kind = "body"
+		lo = 0
+		for (hi = 0; hi < n - 1; hi++)
+			if (ins[hi] ~ /^(ret|br|b)([ \t]|$)/)
+				break
+	} else
+		kind = "loop"
+	f = dir "/" name ".s"
+	print ".Lhot:" > f
+	for (i = lo; i <= hi; i++) {
+		if (ins[i] ~ /^(nop|hint|bti)([ \t]|$)/)
+			continue
+		t = ins[i]
+		gsub(/(0x)?[0-9a-f]+ <[^>]*>/, ".Lhot", t)
+		print t > f
+	}
+	close(f)
+	print name, kind > (dir "/list")
+}
+FILENAME != "-" { want[$1] = 1; next }
+/:[ \t]+file format / { member = $1; next }
+/^Disassembly of section / { section = $4; sub(/:$/, "", section); next }
+/^[0-9a-f]+ <.*>:$/ {
+	hotpath()
+	name = $2; gsub(/[<>:]/, "", name)
+	print member, section, hex($1), name > (dir "/labels")
+	n = 0
+	next
+}
+/[ \t]R_AARCH64_/ {
+	if (n > 0)
+		reloc[n - 1] = 1
+	next
+}
+/^ *[0-9a-f]+:[ \t]/ {
+	a = $1; sub(/:$/, "", a)
+	s = $0; sub(/^ *[0-9a-f]+:[ \t]*/, "", s); sub(/[ \t]*\/\/.*$/, "", s)
+	if (s == "" || s ~ /^</)
+		next
+	addr[n] = hex(a); ins[n] = s; reloc[n] = 0; n++
+}
+END { hotpath() }' "$tmp/want" -
+
+[ -f "$tmp/list" ] || { echo "$0: no routines found in $lib" >&2; exit 1; }
+
+# The disassembly only shows one of the symbols at an address, the other
+# wanted routines at the same member, section and address share its hot path.
+$objdump -t "$lib" | awk -v dir="$tmp" '
+function hex(s,   i, x) {
+	x = 0
+	for (i = 1; i <= length(s); i++)
+		x = x * 16 + index("0123456789abcdef", substr(s, i, 1)) - 1
+	return x
+}
+FILENAME != "-" && FILENAME ~ /want$/ { want[$1] = 1; next }
+FILENAME != "-" && FILENAME ~ /labels$/ { label[$1 " " $2 " " $3] = $4; next }
+FILENAME != "-" && FILENAME ~ /list$/ { kind[$1] = $2; next }
+/:[ \t]+file format / { member = $1; next }
+/^[0-9a-f]+ / && ($NF in want) && !($NF in kind) {
+	for (i = 2; i < NF; i++)
+		if ($i ~ /^\./)
+			break
+	k = member " " $i " " hex($1)
+	if ((k in label) && (label[k] in kind))
+		print $NF, label[k], kind[label[k]]
+}' "$tmp/want" "$tmp/labels" "$tmp/list" - | while read -r name alias kind
+do
+	cp "$tmp/$alias.s" "$tmp/$name.s"
+	echo "$name $kind" >> "$tmp/list"
+done
+
+printf "%-28s %-12s %-9s %7s %7s %7s %-18s %7s %s\n" routine cpu kind \
+	cyc/it crit rthru pressure cyc/el measured
+sort "$tmp/list" | while read -r name kind
+do
+	s="$tmp/$name.s"
+	len=$(grep -vc '^\.Lhot:' "$s")
+	# SVE names do not encode the lanes, single precision is told from
+	# the trailing f of the routine name, except for erf.
+	case $name in
+	_ZGVnN[0-9]*) lanes=${name#_ZGVnN}; lanes=${lanes%%[!0-9]*} ;;
+	_ZGVsM*)
+		case ${name#_ZGVsM*_} in
+		erf) lanes=2 ;;
+		*f) lanes=4 ;;
+		*) lanes=2 ;;
+		esac ;;
+	*) lanes= ;;
+	esac
+	measured=$(awk -v n="$name" '$1 == n { $1 = ""; print substr($0, 2); exit }' "$tmp/measured")
+	for cpu in $models
+	do
+		out=$($mca -mtriple=aarch64 -mcpu="$cpu" -mattr="$mattr" \
+			-iterations=100 "$s" 2>&1) || {
+			printf "%-28s %-12s %-9s %s\n" "$name" "$cpu" "$kind/$len" \
+				"$(echo "$out" | awk '/^note: instruction:/ { print "no model for", $3; exit }')"
+			continue
+		}
+		one=$($mca -mtriple=aarch64 -mcpu="$cpu" -mattr="$mattr" \
+			-iterations=1 -resource-pressure=false \
+			-instruction-info=false "$s" 2>/dev/null)
+		echo "$out" | awk -v name="$name" -v cpu="$cpu" -v kind="$kind/$len" \
+			-v lanes="$lanes" -v measured="${measured:--}" \
+			-v crit="$(echo "$one" | awk '/^Total Cycles:/ { print $3 }')" '
+/^Iterations:/ { iters = $2 }
+/^Total Cycles:/ { cycles = $3 }
+/^Block RThroughput:/ { rthru = $3 }
+/^\[[0-9.]+\] +- / { unit[$1] = $3 }
+/^Resource pressure per iteration:/ { getline hdr; getline val; nh = split(hdr, h); split(val, v) }
+END {
+	p = 0; pn = "-"
+	for (i = 1; i <= nh; i++)
+		if (v[i] != "-" && v[i] + 0 > p) { p = v[i] + 0; pn = unit[h[i]] }
+	c = cycles / iters
+	printf "%-28s %-12s %-9s %7.2f %7d %7.2f %-18s %7s %s\n", name, cpu, kind,
+		c, crit, rthru, pn ":" sprintf("%.2f", p),
+		lanes == "" ? "-" : sprintf("%.2f", c / lanes), measured
+}'
+	done
+done
@@ -1,7 +1,7 @@
 /*
  * Function entries for ulp.
  *
- * Copyright (c) 2022-2023, Arm Limited.
+ * Copyright (c) 2022-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 /* clang-format off */
@@ -22,6 +22,12 @@
  D1 (log2)
  D2 (pow)
  D1 (erf)
+ F (__log_dd, log_dd_hi, logl, mpfr_log, 1, 0, d1, 0)
+ F (__log1p_dd, log1p_dd_hi, log1pl, mpfr_log1p, 1, 0, d1, 0)
+ F (__log_dd_hilo, log_dd_hilo, log_dd_hilo_ref, log_dd_hilo_mpfr, 1, 0, d1, 0)
+ F (__log1p_dd_hilo, log1p_dd_hilo, log1p_dd_hilo_ref, log1p_dd_hilo_mpfr, 1, 0, d1, 0)
+ F (__exp_dd, exp_dd, exp_dd_ref, exp_dd_mpfr, 1, 0, d1, 0)
+ F (__expm1_dd, expm1_dd, expm1l, mpfr_expm1, 1, 0, d1, 0)
 #ifdef __vpcs
  F (_ZGVnN4v_sinf, Z_sinf, sin, mpfr_sin, 1, 1, f1, 1)
  F (_ZGVnN4v_cosf, Z_cosf, cos, mpfr_cos, 1, 1, f1, 1)
@@ -1,7 +1,7 @@
 /*
  * Function wrappers for ulp.
  *
- * Copyright (c) 2022-2023, Arm Limited.
+ * Copyright (c) 2022-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -17,6 +17,66 @@ static int sincos_mpfr_sin(mpfr_t y, const mpfr_t x, mpfr_rnd_t r) { mpfr_cos(y,
 static int sincos_mpfr_cos(mpfr_t y, const mpfr_t x, mpfr_rnd_t r) { mpfr_sin(y,x,r); return mpfr_cos(y,x,r); }
 #endif
 
+/* Wrappers for the extra precision functions, the high part is tested.  */
+static double log_dd_hi(double x) {double lo; return __log_dd(x, &lo);}
+static double log1p_dd_hi(double x) {double lo; return __log1p_dd(x, &lo);}
+static double expm1_dd(double x) {return __expm1_dd(x, 0);}
+
+/* hi + tail is tested by subtracting the leading DD_BITS bits of hi, minus
+   one unit in the last of them, exactly from hi before adding tail.  The
+   difference has the sign of hi and 2^(1-DD_BITS)|hi| <= |diff| < 2^(2-DD_BITS)|hi|,
+   so the ulp of the result is 2^(1-DD_BITS) times smaller than the ulp of hi
+   and the ulp error is checked to 2^(-51-DD_BITS) relative error.  The
+   reference computes log(x) minus the same offset, which needs more than 64
+   bits of precision for DD_BITS 16.  */
+#if LDBL_MANT_DIG >= 113 || LDBL_MANT_DIG == DBL_MANT_DIG
+# define DD_BITS 16
+#else
+# define DD_BITS 10
+#endif
+static double dd_off(double hi) {
+  uint64_t e = asuint64(hi) & 0x7ff0000000000000;
+  if (e < asuint64(0x1p-900) || e == 0x7ff0000000000000) return 0;
+  double top = asdouble(asuint64(hi) & -(1ULL << (53 - DD_BITS)));
+  return top - copysign(asdouble(e - ((uint64_t) (DD_BITS - 1) << 52)), hi);
+}
+static double log_dd_hilo(double x) {double lo, hi = __log_dd(x, &lo); return hi - dd_off(hi) + lo;}
+static double log1p_dd_hilo(double x) {double lo, hi = __log1p_dd(x, &lo); return hi - dd_off(hi) + lo;}
+static long double log_dd_hilo_ref(long double x) {double lo, hi = __log_dd(x, &lo); return logl(x) - dd_off(hi);}
+static long double log1p_dd_hilo_ref(long double x) {double lo, hi = __log1p_dd(x, &lo); return log1pl(x) - dd_off(hi);}
+#if USE_MPFR
+static int log_dd_hilo_mpfr(mpfr_t y, const mpfr_t x, mpfr_rnd_t r) {
+  double lo, hi = __log_dd(mpfr_get_d(x, MPFR_RNDN), &lo);
+  int t = mpfr_log(y, x, r);
+  mpfr_sub_d(y, y, dd_off(hi), r);
+  return t;
+}
+static int log1p_dd_hilo_mpfr(mpfr_t y, const mpfr_t x, mpfr_rnd_t r) {
+  double lo, hi = __log1p_dd(mpfr_get_d(x, MPFR_RNDN), &lo);
+  int t = mpfr_log1p(y, x, r);
+  mpfr_sub_d(y, y, dd_off(hi), r);
+  return t;
+}
+#endif
+
+/* __exp_dd is called with a tail in [-ulp(x)/2, ulp(x)/2] made of 10 low bits
+   of x, then x + tail is exact in the reference.  The tail is ignored for
+   |x| >= 1024 and nan.  */
+static double exp_dd_tail(double x) {
+  if (!(fabs(x) < 1024)) return 0;
+  double ulp = asdouble(asuint64(x) + 1) - x;
+  return ulp * ((int) (asuint64(x) >> 3 & 1023) - 512) * 0x1p-10;
+}
+static double exp_dd(double x) {return __exp_dd(x, exp_dd_tail(x));}
+static long double exp_dd_ref(long double x) {return expl(x + exp_dd_tail(x));}
+#if USE_MPFR
+static int exp_dd_mpfr(mpfr_t y, const mpfr_t x, mpfr_rnd_t r) {
+  MPFR_DECL_INIT(t, 128);
+  mpfr_add_d(t, x, exp_dd_tail(mpfr_get_d(x, MPFR_RNDN)), MPFR_RNDN);
+  return mpfr_exp(y, t, r);
+}
+#endif
+
 /* Wrappers for vector functions.  */
 #ifdef __vpcs
 static float Z_sinf(float x) { return _ZGVnN4v_sinf(argf(x))[0]; }
@@ -0,0 +1,48 @@
+/*
+ * Load time selection of the x86_64 math routine variants.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "../math_config.h"
+
+double __exp_sse2 (double);
+double __exp_fma (double);
+float __exp2f_sse2 (float);
+float __exp2f_fma (float);
+double __pow_sse2 (double, double);
+double __pow_fma (double, double);
+float __powf_sse2 (float, float);
+float __powf_fma (float, float);
+
+/* The _fma variants need roundsd (SSE4.1) and vfmadd (FMA3).  */
+static int
+have_fma (void)
+{
+  __builtin_cpu_init ();
+  return __builtin_cpu_supports ("sse4.1") && __builtin_cpu_supports ("fma");
+}
+
+#define DISPATCH(f)                                                           \
+  static __typeof (__##f##_sse2) *f##_resolver (void)                         \
+  {                                                                           \
+    return have_fma () ? __##f##_fma : __##f##_sse2;                          \
+  }                                                                           \
+  __typeof (__##f##_sse2) f __attribute__ ((ifunc (#f "_resolver")));
+
+DISPATCH (exp)
+DISPATCH (exp2f)
+DISPATCH (pow)
+DISPATCH (powf)
+
+#if USE_GLIBC_ABI
+strong_alias (exp, __exp_finite)
+hidden_alias (exp, __ieee754_exp)
+strong_alias (exp2f, __exp2f_finite)
+hidden_alias (exp2f, __ieee754_exp2f)
+strong_alias (pow, __pow_finite)
+hidden_alias (pow, __ieee754_pow)
+strong_alias (powf, __powf_finite)
+hidden_alias (powf, __ieee754_powf)
+#endif
@@ -0,0 +1,12 @@
+/*
+ * Double-precision e^x function for x86_64 with SSE4.1 and FMA3.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+/* Built with -msse4.1 -mfma, selected at load time by dispatch.c.  */
+#define USE_GLIBC_ABI 0
+#include <math.h>
+#define exp __exp_fma
+#include "../exp.c"
@@ -0,0 +1,12 @@
+/*
+ * Double-precision x^y function for baseline x86_64.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+/* Fallback for CPUs without SSE4.1 and FMA3, see dispatch.c.  */
+#define USE_GLIBC_ABI 0
+#include <math.h>
+#define pow __pow_sse2
+#include "../pow.c"
@@ -0,0 +1,20 @@
+/*
+ * Single-precision x^y function for x86_64 with SSE4.1 and FMA3.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+/* Built with -msse4.1 -mfma, selected at load time by dispatch.c.  */
+#define USE_GLIBC_ABI 0
+#include "../math_config.h"
+#define powf __powf_fma
+
+/* The log2 table is scaled by POWF_SCALE, which depends on TOINT_INTRINSICS,
+   so this variant needs its own copy.  */
+#undef __powf_log2_data
+#define __powf_log2_data arm_math_powf_log2_data_fma
+extern const struct powf_log2_data __powf_log2_data HIDDEN;
+#include "../powf_log2_data.c"
+
+#include "../powf.c"
@@ -1,6 +1,6 @@
 # Makefile fragment - requires GNU make
 #
-# Copyright (c) 2019-2023, Arm Limited.
+# Copyright (c) 2019-2026, Arm Limited.
 # SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
 
 PLM := $(srcdir)/pl/math
@@ -18,6 +18,9 @@ math-test-srcs := \
 	$(AOR)/test/mathbench.c \
 	$(AOR)/test/ulp.c \
 
+math-pl-test-srcs := \
+	$(PLM)/test/appbench.c \
+
 math-test-host-srcs := $(wildcard $(AOR)/test/rtest/*.[cS])
 
 math-includes := $(patsubst $(PLM)/%,build/pl/%,$(wildcard $(PLM)/include/*.h))
@@ -28,6 +31,8 @@ math-libs := \
 	build/pl/lib/libmathlib.a \
 
 math-tools := \
+	build/pl/bin/appbench \
+	build/pl/bin/appbench_libc \
 	build/pl/bin/mathtest \
 	build/pl/bin/mathbench \
 	build/pl/bin/mathbench_libc \
@@ -39,6 +44,7 @@ math-host-tools := \
 
 math-lib-objs := $(patsubst $(PLM)/%,$(B)/%.o,$(basename $(math-lib-srcs)))
 math-test-objs := $(patsubst $(AOR)/%,$(B)/%.o,$(basename $(math-test-srcs)))
+math-test-objs += $(patsubst $(PLM)/%,$(B)/%.o,$(basename $(math-pl-test-srcs)))
 math-host-objs := $(patsubst $(AOR)/%,$(B)/%.o,$(basename $(math-test-host-srcs)))
 math-target-objs := $(math-lib-objs) $(math-test-objs)
 math-objs := $(math-target-objs) $(math-target-objs:%.o=%.os) $(math-host-objs)
@@ -131,6 +137,13 @@ build/pl/bin/mathbench: $(B)/test/mathbench.o build/pl/lib/libmathlib.a
 build/pl/bin/mathbench_libc: $(B)/test/mathbench.o build/pl/lib/libmathlib.a
 	$(CC) $(CFLAGS_PL) $(LDFLAGS) -static -o $@ $< $(LDLIBS) -lc build/pl/lib/libmathlib.a -lm
 
+build/pl/bin/appbench: $(B)/test/appbench.o build/pl/lib/libmathlib.a
+	$(CC) $(CFLAGS_PL) $(LDFLAGS) -static -o $@ $^ $(LDLIBS)
+
+# As for mathbench_libc, the scalar calls resolve to libc where it has them.
+build/pl/bin/appbench_libc: $(B)/test/appbench.o build/pl/lib/libmathlib.a
+	$(CC) $(CFLAGS_PL) $(LDFLAGS) -static -o $@ $< $(LDLIBS) -lc build/pl/lib/libmathlib.a -lm
+
 build/pl/bin/ulp: $(B)/test/ulp.o build/pl/lib/libmathlib.a
 	$(CC) $(CFLAGS_PL) $(LDFLAGS) -static -o $@ $^ $(LDLIBS)
 
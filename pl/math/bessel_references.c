@@ -0,0 +1,79 @@
+/*
+ * Extended precision scalar reference functions for modified Bessel
+ * functions i0 and i1, which neither libm nor MPFR provide.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#define _GNU_SOURCE
+#include "math_config.h"
+#include "mathlib.h"
+
+#define TwoPil 0x1.921fb54442d18469898cc51701b8p2L
+
+/* I_nu(|x|) for nu = 0 or 1, using the power series below 40 and the
+   asymptotic expansion otherwise.  All terms of the series are positive, and
+   the asymptotic expansion reaches the working precision long before it
+   diverges, so both are accurate to a few long double ulp.  */
+static long double
+bessel_i (long double ax, int nu)
+{
+  long double s, t;
+  if (ax < 40)
+    {
+      long double h2 = ax * ax / 4;
+      t = nu ? ax / 2 : 1;
+      s = t;
+      for (int k = 1; t > s * 0x1p-70L; k++)
+	{
+	  t *= h2 / (k * (k + nu));
+	  s += t;
+	}
+      return s;
+    }
+  /* e^x overflows long double, and the result overflows any narrower
+     format.  */
+  if (ax > 11000)
+    return INFINITY;
+  long double mu = 4 * nu * nu;
+  t = s = 1;
+  for (int k = 1; fabsl (t) > s * 0x1p-70L; k++)
+    {
+      t *= -(mu - (2 * k - 1) * (2 * k - 1)) / (8 * k * ax);
+      s += t;
+    }
+  /* Split e^x to avoid overflow in the intermediate product.  */
+  s *= expl (ax / 2) / sqrtl (TwoPil * ax);
+  return s * expl (ax / 2);
+}
+
+long double
+i0l (long double x)
+{
+  if (isnan (x))
+    return x;
+  return bessel_i (fabsl (x), 0);
+}
+
+long double
+i1l (long double x)
+{
+  if (isnan (x))
+    return x;
+  long double y = bessel_i (fabsl (x), 1);
+  return signbit (x) ? -y : y;
+}
+
+/* Double-precision references for the single-precision routines.  */
+double
+i0 (double x)
+{
+  return i0l (x);
+}
+
+double
+i1 (double x)
+{
+  return i1l (x);
+}
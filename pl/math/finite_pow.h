@@ -1,13 +1,17 @@
 /*
  * Double-precision x^y function.
  *
- * Copyright (c) 2018-2023, Arm Limited.
+ * Copyright (c) 2018-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
+#ifndef PL_MATH_FINITE_POW_H
+#define PL_MATH_FINITE_POW_H
 
 #include "math_config.h"
 
-/* Scalar version of pow used for fallbacks in vector implementations.  */
+/* Scalar version of pow used for fallbacks in vector implementations.  The
+   fallbacks are marked UNUSED since this header is also included by routines
+   that only need the log or exp core (via v_pow_inline.h).  */
 
 /* Data is defined in v_pow_log_data.c.  */
 #define N_LOG (1 << V_POW_LOG_TABLE_BITS)
@@ -198,7 +202,7 @@ exp_inline (double x, double xtail, uint32_t sign_bias)
 /* Computes exp(x+xtail) where |xtail| < 2^-8/N and |xtail| <= |x|.
    A version of exp_inline that is not inlined and for which sign_bias is
    equal to 0.  */
-static double NOINLINE
+static double NOINLINE UNUSED
 exp_nosignbias (double x, double xtail)
 {
   uint32_t abstop = top12 (x) & 0x7ff;
@@ -266,7 +270,7 @@ zeroinfnan (uint64_t i)
   return 2 * i - 1 >= 2 * asuint64 (INFINITY) - 1;
 }
 
-static double NOINLINE
+static double NOINLINE UNUSED
 __pl_finite_pow (double x, double y)
 {
   uint32_t sign_bias = 0;
@@ -363,3 +367,5 @@ __pl_finite_pow (double x, double y)
   double elo = y * lo + fma (y, hi, -ehi);
   return exp_inline (ehi, elo, sign_bias);
 }
+
+#endif
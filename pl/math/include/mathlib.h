@@ -1,7 +1,7 @@
 /*
  * Public API.
  *
- * Copyright (c) 2015-2023, Arm Limited.
+ * Copyright (c) 2015-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -37,31 +37,61 @@ double asinh (double);
 double atan (double);
 double atan2 (double, double);
 double atanh (double);
+double beta_inc_half (double, double);
+double beta_inc_mean (double, double);
+double beta_inc_sym (double, double);
 double cbrt (double);
+double compoundn (double, long long);
 double cosh (double);
 double cospi (double);
+double digamma (double);
 double erfc (double);
 double erfinv (double);
 double exp10 (double);
 double expm1 (double);
+double gamma_p (double, double);
+double gamma_q (double, double);
+double i0 (double);
+double i1 (double);
 double log10 (double);
 double log1p (double);
+double pown (double, long long);
+double powr (double, double);
+double rootn (double, long long);
 double sinh (double);
 double sinpi (double);
 double tanh (double);
+double trigamma (double);
 
+long double beta_incl (long double, long double, long double);
+long double beta_inc_halfl (long double, long double);
+long double beta_inc_meanl (long double, long double);
+long double beta_inc_syml (long double, long double);
 long double cospil (long double);
+long double digammal (long double);
 long double erfinvl (long double);
 long double exp10l (long double);
+long double gamma_pl (long double, long double);
+long double gamma_ql (long double, long double);
+long double i0l (long double);
+long double i1l (long double);
 long double sinpil (long double);
+long double trigammal (long double);
+
+/* Bit-exact scalar references for the fixed-point routines.  */
+#include <stdint.h>
+int32_t log2_fixed_ref (uint32_t, int, int);
+uint32_t exp2_fixed_ref (int32_t, int, int);
 
 #if __aarch64__
 # if __GNUC__ >= 5
 typedef __Float32x4_t __f32x4_t;
 typedef __Float64x2_t __f64x2_t;
+typedef __Int64x2_t __s64x2_t;
 # elif __clang_major__ * 100 + __clang_minor__ >= 305
 typedef __attribute__ ((__neon_vector_type__ (4))) float __f32x4_t;
 typedef __attribute__ ((__neon_vector_type__ (2))) double __f64x2_t;
+typedef __attribute__ ((__neon_vector_type__ (2))) __INT64_TYPE__ __s64x2_t;
 # else
 #  error Unsupported compiler
 # endif
@@ -94,14 +124,22 @@ __vpcs __f32x4_t _ZGVnN4vv_atan2f (__f32x4_t, __f32x4_t);
 __vpcs __f64x2_t _ZGVnN2vv_atan2 (__f64x2_t, __f64x2_t);
 __vpcs __f32x4_t _ZGVnN4v_atanhf (__f32x4_t);
 __vpcs __f64x2_t _ZGVnN2v_atanh (__f64x2_t);
+__vpcs __f32x4_t _ZGVnN4vvv_beta_incf (__f32x4_t, __f32x4_t, __f32x4_t);
+__vpcs __f64x2_t _ZGVnN2vvv_beta_inc (__f64x2_t, __f64x2_t, __f64x2_t);
 __vpcs __f32x4_t _ZGVnN4v_cbrtf (__f32x4_t);
 __vpcs __f64x2_t _ZGVnN2v_cbrt (__f64x2_t);
 __vpcs __f32x4x2_t _ZGVnN4v_cexpif (__f32x4_t);
 __vpcs __f64x2x2_t _ZGVnN2v_cexpi (__f64x2_t);
+__vpcs __f64x2x2_t _ZGVnN2v_log_dd (__f64x2_t);
+__vpcs __f64x2x2_t _ZGVnN2v_log1p_dd (__f64x2_t);
+__vpcs __f64x2_t _ZGVnN2vv_exp_dd (__f64x2_t, __f64x2_t);
+__vpcs __f64x2_t _ZGVnN2vv_compoundn (__f64x2_t, __s64x2_t);
 __vpcs __f32x4_t _ZGVnN4v_coshf (__f32x4_t);
 __vpcs __f64x2_t _ZGVnN2v_cosh (__f64x2_t);
 __vpcs __f32x4_t _ZGVnN4v_cospif (__f32x4_t);
 __vpcs __f64x2_t _ZGVnN2v_cospi (__f64x2_t);
+__vpcs __f32x4_t _ZGVnN4v_digammaf (__f32x4_t);
+__vpcs __f64x2_t _ZGVnN2v_digamma (__f64x2_t);
 __vpcs __f32x4_t _ZGVnN4v_erff (__f32x4_t);
 __vpcs __f64x2_t _ZGVnN2v_erf (__f64x2_t);
 __vpcs __f32x4_t _ZGVnN4v_erfcf (__f32x4_t);
@@ -113,8 +151,20 @@ __vpcs __f64x2_t _ZGVnN2v_exp10 (__f64x2_t);
 __vpcs __f64x2_t _ZGVnN2v_exp2 (__f64x2_t);
 __vpcs __f32x4_t _ZGVnN4v_expm1f (__f32x4_t);
 __vpcs __f64x2_t _ZGVnN2v_expm1 (__f64x2_t);
+__vpcs __f32x4_t _ZGVnN4vv_gamma_pf (__f32x4_t, __f32x4_t);
+__vpcs __f64x2_t _ZGVnN2vv_gamma_p (__f64x2_t, __f64x2_t);
+__vpcs __f32x4_t _ZGVnN4vv_gamma_qf (__f32x4_t, __f32x4_t);
+__vpcs __f64x2_t _ZGVnN2vv_gamma_q (__f64x2_t, __f64x2_t);
 __vpcs __f32x4_t _ZGVnN4vv_hypotf (__f32x4_t, __f32x4_t);
 __vpcs __f64x2_t _ZGVnN2vv_hypot (__f64x2_t, __f64x2_t);
+__vpcs __f32x4_t _ZGVnN4v_i0f (__f32x4_t);
+__vpcs __f64x2_t _ZGVnN2v_i0 (__f64x2_t);
+__vpcs __f32x4_t _ZGVnN4v_i1f (__f32x4_t);
+__vpcs __f64x2_t _ZGVnN2v_i1 (__f64x2_t);
+__vpcs __f32x4_t _ZGVnN4v_j0f (__f32x4_t);
+__vpcs __f64x2_t _ZGVnN2v_j0 (__f64x2_t);
+__vpcs __f32x4_t _ZGVnN4v_j1f (__f32x4_t);
+__vpcs __f64x2_t _ZGVnN2v_j1 (__f64x2_t);
 __vpcs __f32x4_t _ZGVnN4v_log10f (__f32x4_t);
 __vpcs __f64x2_t _ZGVnN2v_log10 (__f64x2_t);
 __vpcs __f32x4_t _ZGVnN4v_log1pf (__f32x4_t);
@@ -122,6 +172,11 @@ __vpcs __f64x2_t _ZGVnN2v_log1p (__f64x2_t);
 __vpcs __f32x4_t _ZGVnN4v_log2f (__f32x4_t);
 __vpcs __f64x2_t _ZGVnN2v_log2 (__f64x2_t);
 __vpcs __f64x2_t _ZGVnN2vv_pow (__f64x2_t, __f64x2_t);
+__vpcs __f64x2_t _ZGVnN2vv_pown (__f64x2_t, __s64x2_t);
+__vpcs __f64x2_t _ZGVnN2vv_powr (__f64x2_t, __f64x2_t);
+__vpcs __f64x2_t _ZGVnN2vv_rootn (__f64x2_t, __s64x2_t);
+__vpcs __f32x4_t _ZGVnN4v_sincf (__f32x4_t);
+__vpcs __f32x4_t _ZGVnN4v_sincpif (__f32x4_t);
 __vpcs __f32x4_t _ZGVnN4v_sinhf (__f32x4_t);
 __vpcs __f64x2_t _ZGVnN2v_sinh (__f64x2_t);
 __vpcs __f32x4_t _ZGVnN4v_sinpif (__f32x4_t);
@@ -130,11 +185,44 @@ __vpcs __f32x4_t _ZGVnN4v_tanf (__f32x4_t);
 __vpcs __f64x2_t _ZGVnN2v_tan (__f64x2_t);
 __vpcs __f32x4_t _ZGVnN4v_tanhf (__f32x4_t);
 __vpcs __f64x2_t _ZGVnN2v_tanh (__f64x2_t);
+__vpcs __f32x4_t _ZGVnN4v_trigammaf (__f32x4_t);
+__vpcs __f64x2_t _ZGVnN2v_trigamma (__f64x2_t);
+__vpcs __f32x4_t _ZGVnN4v_y0f (__f32x4_t);
+__vpcs __f64x2_t _ZGVnN2v_y0 (__f64x2_t);
+__vpcs __f32x4_t _ZGVnN4v_y1f (__f32x4_t);
+__vpcs __f64x2_t _ZGVnN2v_y1 (__f64x2_t);
 __vpcs void _ZGVnN4vl4l4_sincosf (__f32x4_t, __f32x4_t *, __f32x4_t *);
 __vpcs void _ZGVnN2vl8l8_sincos (__f64x2_t, __f64x2_t *, __f64x2_t *);
 
 # endif
 
+/* Array routines using AdvSIMD.  */
+# include <stddef.h>
+float entropyf (const float *, size_t);
+double entropy (const double *, size_t);
+float cross_entropyf (const float *, const float *, size_t);
+double cross_entropy (const double *, const double *, size_t);
+float kl_divf (const float *, const float *, size_t);
+double kl_div (const double *, const double *, size_t);
+float entropy_countsf (const uint32_t *, size_t);
+double entropy_counts (const uint32_t *, size_t);
+void log2_fixed (int32_t *, const uint32_t *, size_t, int, int);
+void exp2_fixed (uint32_t *, const int32_t *, size_t, int, int);
+enum q8_activation
+{
+  Q8_SIGMOID,
+  Q8_TANH,
+  Q8_GELU,
+  Q8_EXP
+};
+void q8_activation_table (uint8_t *, enum q8_activation, int, float, int32_t,
+			  float, int32_t);
+void q8_lookup (uint8_t *, const uint8_t *, size_t, const uint8_t *);
+void windowed_sincpif_hann (float *, const float *, size_t, float, float);
+void windowed_sincpif_blackman (float *, const float *, size_t, float, float);
+void windowed_sincpif_kaiser (float *, const float *, size_t, float, float,
+			      float);
+
 # if WANT_SVE_MATH
 #  include <arm_sve.h>
 svfloat32_t _ZGVsMxv_acoshf (svfloat32_t, svbool_t);
@@ -151,16 +239,23 @@ svfloat32_t _ZGVsMxvv_atan2f (svfloat32_t, svfloat32_t, svbool_t);
 svfloat32_t _ZGVsMxv_atanf (svfloat32_t, svbool_t);
 svfloat64_t _ZGVsMxv_atan (svfloat64_t, svbool_t);
 svfloat64_t _ZGVsMxvv_atan2 (svfloat64_t, svfloat64_t, svbool_t);
+svfloat32_t _ZGVsMxvvv_beta_incf (svfloat32_t, svfloat32_t, svfloat32_t,
+				  svbool_t);
+svfloat64_t _ZGVsMxvvv_beta_inc (svfloat64_t, svfloat64_t, svfloat64_t,
+				 svbool_t);
 svfloat32_t _ZGVsMxv_cbrtf (svfloat32_t, svbool_t);
 svfloat64_t _ZGVsMxv_cbrt (svfloat64_t, svbool_t);
 svfloat32x2_t _ZGVsMxv_cexpif (svfloat32_t, svbool_t);
 svfloat64x2_t _ZGVsMxv_cexpi (svfloat64_t, svbool_t);
+svfloat64_t _ZGVsMxvv_compoundn (svfloat64_t, svint64_t, svbool_t);
 svfloat32_t _ZGVsMxv_coshf (svfloat32_t, svbool_t);
 svfloat64_t _ZGVsMxv_cosh (svfloat64_t, svbool_t);
 svfloat32_t _ZGVsMxv_cosf (svfloat32_t, svbool_t);
 svfloat32_t _ZGVsMxv_cospif (svfloat32_t, svbool_t);
 svfloat64_t _ZGVsMxv_cos (svfloat64_t, svbool_t);
 svfloat64_t _ZGVsMxv_cospi (svfloat64_t, svbool_t);
+svfloat32_t _ZGVsMxv_digammaf (svfloat32_t, svbool_t);
+svfloat64_t _ZGVsMxv_digamma (svfloat64_t, svbool_t);
 svfloat32_t _ZGVsMxv_erff (svfloat32_t, svbool_t);
 svfloat64_t _ZGVsMxv_erf (svfloat64_t, svbool_t);
 svfloat64_t _ZGVsMxv_erfc (svfloat64_t, svbool_t);
@@ -173,8 +268,20 @@ svfloat32_t _ZGVsMxv_exp2f (svfloat32_t, svbool_t);
 svfloat64_t _ZGVsMxv_exp2 (svfloat64_t, svbool_t);
 svfloat32_t _ZGVsMxv_expm1f (svfloat32_t, svbool_t);
 svfloat64_t _ZGVsMxv_expm1 (svfloat64_t, svbool_t);
+svfloat32_t _ZGVsMxvv_gamma_pf (svfloat32_t, svfloat32_t, svbool_t);
+svfloat64_t _ZGVsMxvv_gamma_p (svfloat64_t, svfloat64_t, svbool_t);
+svfloat32_t _ZGVsMxvv_gamma_qf (svfloat32_t, svfloat32_t, svbool_t);
+svfloat64_t _ZGVsMxvv_gamma_q (svfloat64_t, svfloat64_t, svbool_t);
 svfloat32_t _ZGVsMxvv_hypotf (svfloat32_t, svfloat32_t, svbool_t);
 svfloat64_t _ZGVsMxvv_hypot (svfloat64_t, svfloat64_t, svbool_t);
+svfloat32_t _ZGVsMxv_i0f (svfloat32_t, svbool_t);
+svfloat64_t _ZGVsMxv_i0 (svfloat64_t, svbool_t);
+svfloat32_t _ZGVsMxv_i1f (svfloat32_t, svbool_t);
+svfloat64_t _ZGVsMxv_i1 (svfloat64_t, svbool_t);
+svfloat32_t _ZGVsMxv_j0f (svfloat32_t, svbool_t);
+svfloat64_t _ZGVsMxv_j0 (svfloat64_t, svbool_t);
+svfloat32_t _ZGVsMxv_j1f (svfloat32_t, svbool_t);
+svfloat64_t _ZGVsMxv_j1 (svfloat64_t, svbool_t);
 svfloat32_t _ZGVsMxv_logf (svfloat32_t, svbool_t);
 svfloat64_t _ZGVsMxv_log (svfloat64_t, svbool_t);
 svfloat32_t _ZGVsMxv_log10f (svfloat32_t, svbool_t);
@@ -187,6 +294,11 @@ svfloat32_t _ZGVsMxvv_powi (svfloat32_t, svint32_t, svbool_t);
 svfloat64_t _ZGVsMxvv_powk (svfloat64_t, svint64_t, svbool_t);
 svfloat32_t _ZGVsMxvv_powf (svfloat32_t, svfloat32_t, svbool_t);
 svfloat64_t _ZGVsMxvv_pow (svfloat64_t, svfloat64_t, svbool_t);
+svfloat64_t _ZGVsMxvv_pown (svfloat64_t, svint64_t, svbool_t);
+svfloat64_t _ZGVsMxvv_powr (svfloat64_t, svfloat64_t, svbool_t);
+svfloat64_t _ZGVsMxvv_rootn (svfloat64_t, svint64_t, svbool_t);
+svfloat32_t _ZGVsMxv_sincf (svfloat32_t, svbool_t);
+svfloat32_t _ZGVsMxv_sincpif (svfloat32_t, svbool_t);
 svfloat32_t _ZGVsMxv_sinhf (svfloat32_t, svbool_t);
 svfloat64_t _ZGVsMxv_sinh (svfloat64_t, svbool_t);
 svfloat32_t _ZGVsMxv_sinf (svfloat32_t, svbool_t);
@@ -197,6 +309,12 @@ svfloat32_t _ZGVsMxv_tanhf (svfloat32_t, svbool_t);
 svfloat64_t _ZGVsMxv_tanh (svfloat64_t, svbool_t);
 svfloat32_t _ZGVsMxv_tanf (svfloat32_t, svbool_t);
 svfloat64_t _ZGVsMxv_tan (svfloat64_t, svbool_t);
+svfloat32_t _ZGVsMxv_trigammaf (svfloat32_t, svbool_t);
+svfloat64_t _ZGVsMxv_trigamma (svfloat64_t, svbool_t);
+svfloat32_t _ZGVsMxv_y0f (svfloat32_t, svbool_t);
+svfloat64_t _ZGVsMxv_y0 (svfloat64_t, svbool_t);
+svfloat32_t _ZGVsMxv_y1f (svfloat32_t, svbool_t);
+svfloat64_t _ZGVsMxv_y1 (svfloat64_t, svbool_t);
 void _ZGVsMxvl4l4_sincosf (svfloat32_t, float *, float *, svbool_t);
 void _ZGVsMxvl8l8_sincos (svfloat64_t, double *, double *, svbool_t);
 # endif
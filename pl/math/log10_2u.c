@@ -1,7 +1,7 @@
 /*
  * Double-precision log10(x) function.
  *
- * Copyright (c) 2020-2023, Arm Limited.
+ * Copyright (c) 2020-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -9,15 +9,15 @@
 #include "pl_sig.h"
 #include "pl_test.h"
 
-/* Polynomial coefficients and lookup tables.  */
-#define T __log10_data.tab
-#define T2 __log10_data.tab2
-#define B __log10_data.poly1
+/* Polynomial coefficients and lookup tables, the tables are shared with log.  */
+#define T __log_data.tab
+#define T2 __log_data.tab2
+#define B __log_data.poly1
 #define A __log10_data.poly
-#define Ln2hi __log10_data.ln2hi
-#define Ln2lo __log10_data.ln2lo
+#define Ln2hi __log_data.ln2hi
+#define Ln2lo __log_data.ln2lo
 #define InvLn10 __log10_data.invln10
-#define N (1 << LOG10_TABLE_BITS)
+#define N (1 << LOG_TABLE_BITS)
 #define OFF 0x3fe6000000000000
 #define LO asuint64 (1.0 - 0x1p-4)
 #define HI asuint64 (1.0 + 0x1.09p-4)
@@ -96,7 +96,7 @@ log10 (double x)
      The range is split into N subintervals.
      The ith subinterval contains z and c is near its center.  */
   tmp = ix - OFF;
-  i = (tmp >> (52 - LOG10_TABLE_BITS)) % N;
+  i = (tmp >> (52 - LOG_TABLE_BITS)) % N;
   k = (int64_t) tmp >> 52; /* arithmetic shift.  */
   iz = ix - (tmp & 0xfffULL << 52);
   invc = T[i].invc;
@@ -0,0 +1,81 @@
+/*
+ * Scalar reference functions for fixed-point log2 and exp2.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "math_config.h"
+#include "mathlib.h"
+
+/* Scalar equivalents of the AdvSIMD rounding doubling multiply high, and of
+   the rounding shifts, for Q31 and Q30 operands.  */
+static inline int32_t
+qrdmulh (int32_t a, int32_t b)
+{
+  return (int32_t) ((2 * (int64_t) a * b + (1ll << 31)) >> 32);
+}
+
+static inline int32_t
+rshr (int64_t x, int s)
+{
+  return (int32_t) ((x + (1ll << (s - 1))) >> s);
+}
+
+/* Bit-exact scalar version of log2_fixed, see v_log2_fixed.c.  */
+int32_t
+log2_fixed_ref (uint32_t x, int qin, int qout)
+{
+  const struct v_log2_fixed_data *d = &__v_log2_fixed_data;
+  if (x == 0)
+    return INT32_MIN;
+
+  int c = __builtin_clz (x);
+  uint32_t m = x << c;
+  int hi = m >= 0x80000000 + 0x33000000;
+  uint32_t z = hi ? (uint32_t) (((uint64_t) m + 1) >> 1) : m;
+  uint32_t i = ((m - 0x33000000) >> 27) % (1 << V_LOG2_FIXED_TABLE_BITS);
+
+  int64_t t = (int64_t) ((uint64_t) z * d->tab[i].invc - (1ull << 62));
+  int32_t r = rshr (t, 31);
+  int32_t p = d->poly[0];
+  p = d->poly[1] + qrdmulh (r, p);
+  p = d->poly[2] + qrdmulh (r, p);
+  p = d->poly[3] + qrdmulh (r, p);
+  p = d->tab[i].logc + qrdmulh (r, p);
+
+  int32_t k = 31 - c + hi - qin;
+  /* The sum may wrap before p is added, as in the vector code.  */
+  return (int32_t) (((uint32_t) k << qout) + (uint32_t) rshr (p, 30 - qout));
+}
+
+/* Bit-exact scalar version of exp2_fixed, see v_exp2_fixed.c.  */
+uint32_t
+exp2_fixed_ref (int32_t x, int qin, int qout)
+{
+  const struct v_exp2_fixed_data *d = &__v_exp2_fixed_data;
+
+  int32_t n = x >> qin;
+  uint32_t f = ((uint32_t) x << (31 - qin)) & 0x7fffffff;
+  uint32_t u = f + (1 << 25);
+  uint32_t i = (u >> 26) % (1 << V_EXP2_FIXED_TABLE_BITS);
+  n += u >> 31;
+  int32_t r = (int32_t) (f - (u & ~((1u << 26) - 1)));
+
+  int32_t q = d->poly[0];
+  q = d->poly[1] + qrdmulh (r, q);
+  q = d->poly[2] + qrdmulh (r, q);
+  q = qrdmulh (r, q);
+  int32_t s = d->tab[i];
+  s += qrdmulh (s, q);
+
+  n = n > 64 ? 64 : n < -64 ? -64 : n;
+  int sh = n + qout - 30;
+  if (sh < -32)
+    return 0;
+  if (sh < 0)
+    return (uint32_t) (((uint64_t) s + (1ull << (-sh - 1))) >> -sh);
+  if (sh >= 32 || ((uint64_t) s << sh) > UINT32_MAX)
+    return UINT32_MAX;
+  return (uint32_t) s << sh;
+}
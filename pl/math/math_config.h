@@ -1,7 +1,7 @@
 /*
  * Configuration for math routines.
  *
- * Copyright (c) 2017-2023, Arm Limited.
+ * Copyright (c) 2017-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -380,27 +380,13 @@ extern const struct logf_data
   double poly[LOGF_POLY_ORDER - 1]; /* First order coefficient is 1.  */
 } __logf_data HIDDEN;
 
-/* Data for low accuracy log10 (with 1/ln(10) included in coefficients).  */
-#define LOG10_TABLE_BITS 7
+/* Data for low accuracy log10 (with 1/ln(10) included in coefficients).
+   The lookup tables, ln2 and poly1 are shared with log, see __log_data.  */
 #define LOG10_POLY_ORDER 6
-#define LOG10_POLY1_ORDER 12
 extern const struct log10_data
 {
-  double ln2hi;
-  double ln2lo;
   double invln10;
   double poly[LOG10_POLY_ORDER - 1]; /* First coefficient is 1/log(10).  */
-  double poly1[LOG10_POLY1_ORDER - 1];
-  struct
-  {
-    double invc, logc;
-  } tab[1 << LOG10_TABLE_BITS];
-#if !HAVE_FAST_FMA
-  struct
-  {
-    double chi, clo;
-  } tab2[1 << LOG10_TABLE_BITS];
-#endif
 } __log10_data HIDDEN;
 
 #define EXP_TABLE_BITS 7
@@ -425,9 +411,9 @@ extern const struct exp_data
   uint64_t tab[2 * (1 << EXP_TABLE_BITS)];
 } __exp_data HIDDEN;
 
-/* Copied from math/v_exp.h for use in vector exp_tail.  */
-#define V_EXP_TAIL_TABLE_BITS 8
-extern const uint64_t __v_exp_tail_data[1 << V_EXP_TAIL_TABLE_BITS] HIDDEN;
+/* Table for vector exp_tail, same as the one used by vector pow.  */
+#define V_EXP_TAIL_TABLE_BITS V_POW_EXP_TABLE_BITS
+#define __v_exp_tail_data __v_pow_exp_data.sbits
 
 /* Copied from math/v_exp.h for use in vector exp2.  */
 #define V_EXP_TABLE_BITS 7
@@ -621,4 +607,42 @@ extern const struct v_pow_log_data
   double logctail[1 << V_POW_LOG_TABLE_BITS];
 } __v_pow_log_data HIDDEN;
 
+/* Tables for AdvSIMD and SVE Bessel functions, see v_bessel_data.c.  */
+#define V_BESSEL_POLY_ORDER 11
+#define V_BESSEL_ENTRY_LEN (V_BESSEL_POLY_ORDER + 3)
+extern const struct v_bessel_data
+{
+  double j0[64][V_BESSEL_ENTRY_LEN], j1[64][V_BESSEL_ENTRY_LEN];
+  double y0[56][V_BESSEL_ENTRY_LEN], y1[56][V_BESSEL_ENTRY_LEN];
+  double i0[64][V_BESSEL_ENTRY_LEN], i1[64][V_BESSEL_ENTRY_LEN];
+} __v_bessel_data HIDDEN;
+
+/* Tables for AdvSIMD and SVE digamma and trigamma, see v_digamma_data.c.  */
+#define V_DIGAMMA_POLY_ORDER 11
+#define V_DIGAMMA_ENTRY_LEN (V_DIGAMMA_POLY_ORDER + 3)
+extern const struct v_digamma_data
+{
+  double digamma[64][V_DIGAMMA_ENTRY_LEN], trigamma[64][V_DIGAMMA_ENTRY_LEN];
+} __v_digamma_data HIDDEN;
+
+/* Tables for AdvSIMD fixed-point log2 and exp2, see
+   v_log2_exp2_fixed_data.c.  */
+#define V_LOG2_FIXED_TABLE_BITS 4
+#define V_EXP2_FIXED_TABLE_BITS 5
+extern const struct v_log2_fixed_data
+{
+  struct
+  {
+    uint32_t invc;
+    int32_t logc;
+  } tab[1 << V_LOG2_FIXED_TABLE_BITS];
+  int32_t poly[4];
+} __v_log2_fixed_data HIDDEN;
+
+extern const struct v_exp2_fixed_data
+{
+  int32_t tab[1 << V_EXP2_FIXED_TABLE_BITS];
+  int32_t poly[3];
+} __v_exp2_fixed_data HIDDEN;
+
 #endif
@@ -2,7 +2,7 @@
  * Helpers for evaluating polynomials with various schemes - specific to SVE
  * but precision-agnostic.
  *
- * Copyright (c) 2023, Arm Limited.
+ * Copyright (c) 2023-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -171,20 +171,17 @@ static inline VTYPE VWRAP (horner_9) (svbool_t pg, VTYPE x, const STYPE *poly)
 {
   return svmad_x (pg, x, VWRAP (horner_8) (pg, x, poly + 1), poly[0]);
 }
-static inline VTYPE
-sv_horner_10_f32_x (svbool_t pg, VTYPE x, const STYPE *poly)
+static inline VTYPE VWRAP (horner_10) (svbool_t pg, VTYPE x, const STYPE *poly)
 {
   return svmad_x (pg, x, VWRAP (horner_9) (pg, x, poly + 1), poly[0]);
 }
-static inline VTYPE
-sv_horner_11_f32_x (svbool_t pg, VTYPE x, const STYPE *poly)
+static inline VTYPE VWRAP (horner_11) (svbool_t pg, VTYPE x, const STYPE *poly)
 {
-  return svmad_x (pg, x, sv_horner_10_f32_x (pg, x, poly + 1), poly[0]);
+  return svmad_x (pg, x, VWRAP (horner_10) (pg, x, poly + 1), poly[0]);
 }
-static inline VTYPE
-sv_horner_12_f32_x (svbool_t pg, VTYPE x, const STYPE *poly)
+static inline VTYPE VWRAP (horner_12) (svbool_t pg, VTYPE x, const STYPE *poly)
 {
-  return svmad_x (pg, x, sv_horner_11_f32_x (pg, x, poly + 1), poly[0]);
+  return svmad_x (pg, x, VWRAP (horner_11) (pg, x, poly + 1), poly[0]);
 }
 
 static inline VTYPE VWRAP (pw_horner_4) (svbool_t pg, VTYPE x, VTYPE x2,
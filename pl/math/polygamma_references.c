@@ -0,0 +1,132 @@
+/*
+ * Extended precision scalar reference functions for digamma and trigamma,
+ * which libm does not provide.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#define _GNU_SOURCE
+#include "math_config.h"
+#include "mathlib.h"
+
+#define Pil 0x1.921fb54442d18469898cc51701b8p1L
+/* The positive zero of digamma, as the sum of two long doubles.  */
+#define X0hi 0x1.762d86356be3f6e2p+0L
+#define X0lo -0x1.58dde687d6c4p-66L
+
+/* Coefficients of the asymptotic expansions, B_2k / 2k for digamma and B_2k
+   for trigamma, k = 1, ..., 10.  */
+static const long double digamma_coeffs[]
+    = { 1.0L / 12,	 -1.0L / 120,	  1.0L / 252,	   -1.0L / 240,
+	1.0L / 132,	 -691.0L / 32760, 1.0L / 12,	   -3617.0L / 8160,
+	43867.0L / 14364, -174611.0L / 6600 };
+static const long double trigamma_coeffs[]
+    = { 1.0L / 6,	-1.0L / 30,	1.0L / 42,     -1.0L / 30,
+	5.0L / 66,	-691.0L / 2730, 7.0L / 6,      -3617.0L / 510,
+	43867.0L / 798, -174611.0L / 330 };
+
+/* Shift x up to at least 20 with the recurrences, then use the asymptotic
+   expansion, whose first omitted term is below 2^-85 relative to the result.
+   For digamma this cancels close to the positive zero, see
+   digamma_near_zero.  */
+static long double
+digamma_pos (long double x)
+{
+  long double s = 0;
+  for (; x < 20; x++)
+    s += 1 / x;
+  long double z = 1 / (x * x), p = 0;
+  for (int k = 9; k >= 0; k--)
+    p = p * z + digamma_coeffs[k];
+  return logl (x) - 0.5L / x - p * z - s;
+}
+
+static long double
+trigamma_pos (long double x)
+{
+  long double s = 0;
+  for (; x < 20; x++)
+    s += 1 / (x * x);
+  long double z = 1 / (x * x), p = 0;
+  for (int k = 9; k >= 0; k--)
+    p = p * z + trigamma_coeffs[k];
+  return s + 1 / x + 0.5L * z + p * z / x;
+}
+
+/* digamma(x) for 1 <= x <= 2, as digamma(x) - digamma(x0) where x0 is the
+   positive zero.  Each difference in the shifted sum and the asymptotic
+   expansion is factored as d = x - x0 times a positive term, so there is no
+   cancellation and the relative error stays small right up to the zero.  */
+static long double
+digamma_near_zero (long double x)
+{
+  long double d = (x - X0hi) - X0lo;
+  long double s = 0;
+  for (int k = 0; k < 19; k++)
+    s += 1 / ((x + k) * (X0hi + k));
+  long double t = x + 19, t0 = X0hi + 19;
+  /* z^(k+1) - z0^(k+1) = (z - z0) h_k, with h_k = sum z^i z0^(k-i).  */
+  long double z = 1 / (t * t), z0 = 1 / (t0 * t0), zk = 1, h = 0, p = 0;
+  for (int k = 0; k < 10; k++)
+    {
+      h = h * z + zk;
+      zk *= z0;
+      p += digamma_coeffs[k] * h;
+    }
+  long double dz = -d * (t + t0) * z * z0;
+  return d * s + log1pl (d / t0) + 0.5L * d / (t * t0) - p * dz;
+}
+
+long double
+digammal (long double x)
+{
+  if (isnan (x))
+    return x;
+  if (x == 0)
+    return -1 / x;
+  if (isinf (x))
+    return x > 0 ? x : __math_invalid (x);
+  if (x >= 1 && x <= 2)
+    return digamma_near_zero (x);
+  if (x > 0)
+    return digamma_pos (x);
+  /* Reflection, digamma(x) = digamma(1 - x) - pi cot(pi x).  r is exact, so
+     this is accurate except close to the zeros, where it cancels.  */
+  long double r = x - rintl (x);
+  if (r == 0)
+    return __math_invalid (x);
+  return digamma_pos (1 - x) - Pil / tanl (Pil * r);
+}
+
+long double
+trigammal (long double x)
+{
+  if (isnan (x))
+    return x;
+  if (x == 0)
+    return INFINITY;
+  if (isinf (x))
+    return x > 0 ? 0 : __math_invalid (x);
+  if (x > 0)
+    return trigamma_pos (x);
+  /* Reflection, trigamma(x) = pi^2 / sin(pi x)^2 - trigamma(1 - x).  */
+  long double r = x - rintl (x);
+  if (r == 0)
+    return INFINITY;
+  long double s = sinl (Pil * r);
+  return Pil * Pil / (s * s) - trigamma_pos (1 - x);
+}
+
+/* Double-precision references for the single-precision routines.  */
+double
+digamma (double x)
+{
+  return digammal (x);
+}
+
+double
+trigamma (double x)
+{
+  return trigammal (x);
+}
@@ -0,0 +1,115 @@
+/*
+ * Helpers for double-precision scalar pown, powr, rootn and compoundn.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+#ifndef PL_MATH_POWN_COMMON_H
+#define PL_MATH_POWN_COMMON_H
+
+#include "math_config.h"
+#include "finite_pow.h"
+
+/* Repeated squaring is used for |n| <= PownMaxSquaring, if all intermediate
+   powers of the base b are known to be in [2^-PownSquaringBound,
+   2^PownSquaringBound], which holds when |n| (|e| + 1) is below the bound,
+   with e the exponent of b.  This ensures the low parts of the
+   double-double products are normal.  */
+#define PownMaxSquaring 64
+#define PownSquaringBound 900
+
+/* Returns 1 if b^n can be computed by repeated squaring.  */
+static inline int
+pown_use_squaring (double b, int64_t n)
+{
+  uint64_t an = n < 0 ? -(uint64_t) n : n;
+  int e = (asuint64 (b) >> 52 & 0x7ff) - 0x3ff;
+  uint64_t ae = e < 0 ? -e : e;
+  return an <= PownMaxSquaring && an * (ae + 1) <= PownSquaringBound;
+}
+
+/* (bh + bl)^n by repeated squaring in double-double arithmetic, with the
+   same right to left scheme as SVE powi.  The relative error before the final
+   rounding is below 2^-95, so the result is accurate to about 0.5 ULP.  */
+static inline double
+pown_squaring (double bh, double bl, int64_t n)
+{
+  uint64_t m = n;
+  if (n < 0)
+    {
+      /* 1 / (bh + bl) ~= r + r (1 - r bh - r bl) / (r bh).  */
+      double r = 1 / bh;
+      bl = (fma (-r, bh, 1.0) - r * bl) / bh;
+      bh = r;
+      m = -m;
+    }
+  double yh = 1.0, yl = 0.0;
+  while (1)
+    {
+      if (m & 1)
+	{
+	  double h = yh * bh;
+	  yl = fma (yh, bh, -h) + (yh * bl + yl * bh);
+	  yh = h;
+	}
+      m >>= 1;
+      if (m == 0)
+	break;
+      double h = bh * bh;
+      bl = fma (bh, bh, -h) + 2 * bh * bl;
+      bh = h;
+    }
+  return yh + yl;
+}
+
+/* Split n as nh + *nl so that both are exact doubles and nh is n unless
+   |n| > 2^53.  */
+static inline double
+pown_split (int64_t n, double *nl)
+{
+  int64_t nh = n;
+  if (n > (1LL << 53) || n < -(1LL << 53))
+    nh = n & ~(int64_t) 0x7ff;
+  *nl = n - nh;
+  return nh;
+}
+
+/* sign * exp(hi + lo), with lo the tail of a double-double, for any hi.
+   Unlike exp_inline this signals overflow or underflow for |hi| >= 1024.  */
+static inline double
+pown_exp (double hi, double lo, uint32_t sign_bias)
+{
+  if (unlikely (fabs (hi) >= 1024))
+    return hi > 0 ? __math_oflow (sign_bias) : __math_uflow (sign_bias);
+  double y = hi + lo;
+  lo = hi - y + lo;
+  return exp_inline (y, lo, sign_bias);
+}
+
+/* sign * exp(n (lh + ll)), where lh + ll is a log as returned by
+   log_inline.  */
+static inline double
+pown_exp_mul (int64_t n, double lh, double ll, uint32_t sign_bias)
+{
+  double nl, nh = pown_split (n, &nl);
+  double hi = nh * lh;
+  double lo = fma (nh, lh, -hi) + (nh * ll + nl * lh);
+  return pown_exp (hi, lo, sign_bias);
+}
+
+/* Normalize the bit representation of positive x, as expected by
+   log_inline.  */
+static inline uint64_t
+pown_log_arg (double x)
+{
+  uint64_t ix = asuint64 (x);
+  if (ix < 0x0010000000000000)
+    {
+      /* Normalize subnormal x so exponent becomes negative.  */
+      ix = asuint64 (x * 0x1p52);
+      ix -= 52ULL << 52;
+    }
+  return ix;
+}
+
+#endif
@@ -0,0 +1,77 @@
+/*
+ * Double-precision powr(x, y) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "mathlib.h"
+#include "pown_common.h"
+#include "pl_test.h"
+
+/* x^y as specified by C23, that is exp(y log(x)), which unlike pow is invalid
+   for x < 0, 1^inf, 0^0 and inf^0 and does not treat integer y specially.
+   The core algorithm is the same as pow.
+   Maximum measured error is 1.04 ULPs:
+   powr(0x1.1da32a38c4607p+6, 0x1.74cef8766a9dp+5)
+     got 0x1.f5e4453bf9d73p+286
+    want 0x1.f5e4453bf9d74p+286.  */
+double
+powr (double x, double y)
+{
+  uint64_t ix = asuint64 (x);
+  uint64_t iy = asuint64 (y);
+  uint32_t topy = top12 (y) & 0x7ff;
+
+  if (unlikely (zeroinfnan (ix) || ix >> 63
+		|| topy - SmallPowY >= ThresPowY))
+    {
+      /* Special cases: x <= 0, inf or nan, or
+	 (|y| < 0x1p-65 or |y| >= 0x1p63 or nan).  */
+      if (isnan (x) || isnan (y))
+	return x + y;
+      if (ix >> 63 && 2 * ix != 0)
+	/* x < 0.  */
+	return __math_invalid (x);
+      /* -0 is treated as +0.  */
+      ix &= 0x7fffffffffffffff;
+      if (2 * iy == 0)
+	return ix == 0 || ix == asuint64 (INFINITY) ? __math_invalid (y) : 1.0;
+      if (isinf (y))
+	{
+	  if (ix == asuint64 (1.0))
+	    return __math_invalid (y);
+	  return (ix < asuint64 (1.0)) == !(iy >> 63) ? 0.0 : INFINITY;
+	}
+      if (ix == 0 || ix == asuint64 (INFINITY))
+	{
+	  if (ix == 0 && iy >> 63)
+	    return __math_divzero (0);
+	  return (ix == 0) == !(iy >> 63) ? 0.0 : INFINITY;
+	}
+      if (topy - SmallPowY >= ThresPowY)
+	{
+	  if (ix == asuint64 (1.0))
+	    return 1.0;
+	  /* |y| < 2^-65, x^y ~= 1 + y*log(x).  */
+	  if (topy < SmallPowY)
+	    return 1.0;
+	  return (ix > asuint64 (1.0)) == !(iy >> 63) ? __math_oflow (0)
+						       : __math_uflow (0);
+	}
+    }
+
+  double lo, hi = log_inline (pown_log_arg (x), &lo);
+  double ehi = y * hi;
+  double elo = y * lo + fma (y, hi, -ehi);
+  return pown_exp (ehi, elo, 0);
+}
+
+PL_TEST_ULP (powr, 0.55)
+#define POWR_INTERVAL2(xlo, xhi, ylo, yhi, n)                                 \
+  PL_TEST_INTERVAL2 (powr, xlo, xhi, ylo, yhi, n)                             \
+  PL_TEST_INTERVAL2 (powr, xlo, xhi, -ylo, -yhi, n)
+POWR_INTERVAL2 (0, inf, 0, inf, 40000)
+POWR_INTERVAL2 (0x1p-10, 0x1p10, 0, 1000, 40000)
+POWR_INTERVAL2 (0x1.fp-1, 0x1.1p0, 0, 0x1p20, 40000)
+POWR_INTERVAL2 (-0, -inf, 0, 10, 1000)
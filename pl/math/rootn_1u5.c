@@ -0,0 +1,55 @@
+/*
+ * Double-precision rootn(x, n) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "mathlib.h"
+#include "pown_common.h"
+#include "pl_test.h"
+
+/* x^(1/n) for integer n, as specified by C23, computed as exp(log(x) / n)
+   with the extra precision log and exp of pow.  The quotient is evaluated as
+   a double-double, with n split exactly as nh + nl.
+   Maximum measured error is 1.04 ULPs:
+   rootn(0x1.b45131d753d1bp+995, -968)
+     got 0x1.f5eb71c511596p-2
+    want 0x1.f5eb71c511597p-2.  */
+double
+rootn (double x, long long n)
+{
+  uint64_t ix = asuint64 (x);
+  uint32_t sign_bias = (ix >> 63) && (n & 1) ? SignBias : 0;
+
+  if (unlikely (n == 0 || isnan (x)))
+    return __math_invalid (x);
+  if (unlikely ((ix >> 63) && !(n & 1) && 2 * ix != 0))
+    return __math_invalid (x);
+  if (unlikely (zeroinfnan (ix)))
+    {
+      /* x is +-0 or +-inf, the result is +-0 or +-inf with the sign of x
+	 if n is odd.  */
+      if (n < 0 && 2 * ix == 0)
+	return __math_divzero (sign_bias);
+      double y = n < 0 ? 0.0 : fabs (x);
+      return sign_bias ? -y : y;
+    }
+
+  double lo, hi = log_inline (pown_log_arg (fabs (x)), &lo);
+  /* (hi + lo) / (nh + nl) ~= qh + (hi - qh nh + lo - qh nl) / nh.  */
+  double nl, nh = pown_split (n, &nl);
+  double qh = hi / nh;
+  double ql = (fma (-qh, nh, hi) + lo - qh * nl) / nh;
+  return pown_exp (qh, ql, sign_bias);
+}
+
+PL_TEST_ULP (rootn, 0.55)
+#define ROOTN_INTERVAL2(xlo, xhi, ylo, yhi, n)                                \
+  PL_TEST_INTERVAL2 (rootn, xlo, xhi, ylo, yhi, n)                            \
+  PL_TEST_INTERVAL2 (rootn, xlo, xhi, -ylo, -yhi, n)                          \
+  PL_TEST_INTERVAL2 (rootn, -xlo, -xhi, ylo, yhi, n)                          \
+  PL_TEST_INTERVAL2 (rootn, -xlo, -xhi, -ylo, -yhi, n)
+ROOTN_INTERVAL2 (0, inf, 0, 64, 40000)
+ROOTN_INTERVAL2 (0x1p-10, 0x1p10, 0, 1000, 40000)
+ROOTN_INTERVAL2 (0, inf, 0, 0x1p62, 10000)
@@ -0,0 +1,296 @@
+/*
+ * Core approximations for double-precision SVE Bessel functions
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+#ifndef PL_MATH_SV_BESSEL_COMMON_H
+#define PL_MATH_SV_BESSEL_COMMON_H
+
+#include "sv_math.h"
+#include "poly_sve_f64.h"
+#include "sv_sincos_common.h"
+
+/* The shortcut in sv_log1p_inline only applies when no lane needs the
+   reduction, which loses accuracy in mixed vectors close to the zero of y.  */
+#define WANT_SV_LOG1P_K0_SHORTCUT 0
+#include "sv_log1p_inline.h"
+
+/* Same algorithm as v_bessel_common.h, see there for details.  */
+static const struct sv_bessel_consts
+{
+  double m[2][8], phi[2][10], phi_a[2];
+  double i[2][13];
+  double s[2][13], j[2][13], z[2][2], zinv[2], zhalf[2];
+  double pio4[3], two_over_pi, inv_2pi, ln2_hi, ln2_lo;
+  double table_bound, y_table_start, asymptotic_bound, range_val, y_min;
+  double i_bound, i_scale_bound, i_scale_hi, i_scale_lo, i_scale;
+  double exp_poly[4], inv_ln2, exp_shift;
+} sv_bessel_consts = {
+  /* Coefficients of PM and Pphi on [0, 1/16^2], for nu = 0 and 1, computed
+     by Chebyshev interpolation in quad precision.  */
+  .m = { { -0x1.fffffffffffdep-5, 0x1.a7ffffff7648ep-4, -0x1.15effe9294cabp-1,
+	   0x1.764fa2cf9f4fdp+2, -0x1.ab2d1dc02456bp+6, 0x1.6c4b48c2c4fcfp+11,
+	   -0x1.805c6dfeb4f7p+16, 0x1.395abe0664096p+21 },
+	 { 0x1.7fffffffffff6p-3, -0x1.8bffffffb1d47p-3, 0x1.9c4ffe61372acp-1,
+	   -0x1.ef59c08166b81p+2, 0x1.095032760d419p+7, -0x1.b34aba86ceb88p+11,
+	   0x1.c0ab0ca91c5c4p+16, -0x1.695d58fbdd921p+21 } },
+  .phi = { { 0x1.0aaaaaaaaaaaap-4, -0x1.ad3333332f0f3p-3, 0x1.a358491350b8p+0,
+	     -0x1.779a117af9678p+4, 0x1.0bcf0984e4cdfp+9, -0x1.1658b824cb614p+14,
+	     0x1.87baa857ee907p+19, -0x1.4ab983488f9b9p+25, 0x1.056b28daa604bp+31,
+	     -0x1.eca93854f41e7p+35 },
+	   { -0x1.5p-3, 0x1.7bccccccca8p-2, -0x1.2f486dad45d1fp+1,
+	     0x1.e9fbe45e01212p+4, -0x1.49946efcef2b4p+9, 0x1.4a2ab30697292p+14,
+	     -0x1.c544195b9851fp+19, 0x1.78826c8c2011p+25, -0x1.26ce5f843e32bp+31,
+	     0x1.1466dd40d1e7fp+36 } },
+  .phi_a = { -0x1p-3, 0x1.8p-2 },
+  /* Coefficients of P on [0, 1/16], for nu = 0 and 1.  */
+  .i = { { 0x1.0000000000002p-3, 0x1.1ffffffff983dp-4, 0x1.2c00001686e38p-4,
+	   0x1.cb5fe174b50bdp-4, 0x1.d128add3d60dbp-3, 0x1.240503157304p-1,
+	   0x1.df328446fff0bp+0, -0x1.36c79224dd3d9p-2, 0x1.ab1880f58d799p+7,
+	   -0x1.c50222d30bc06p+11, 0x1.75b540dec59b3p+15,
+	   -0x1.53424c0a342f5p+18, 0x1.24aa79e710a5ap+20 },
+	 { -0x1.8000000000001p-2, -0x1.dffffffff925fp-4, -0x1.a4000017cd012p-4,
+	   -0x1.274fefdd7669bp-3, -0x1.1c42a40b3d76p-2, -0x1.594091bd2a416p-1,
+	   -0x1.12a8afe2c7a4fp+1, -0x1.3042e072440ecp-3, -0x1.c6033dc1649ddp+7,
+	   0x1.dda42e6d883cap+11, -0x1.8abc698256906p+15,
+	   0x1.661ef017fb26dp+18, -0x1.353e455a01b8fp+20 } },
+  /* S(x) / (x + z) and j(x) / x^nu as polynomials in x^2 on [0, 4].  For
+     nu = 1, S(x) is divided by x instead of multiplied.  */
+  .s = { { 0x1.750811790a13cp-3, -0x1.12583f4a4abcfp-6, 0x1.268a9aaaeb0c7p-11,
+	   -0x1.4c030d99a8676p-17, 0x1.cf0413da6a194p-24,
+	   -0x1.b797036d6f92p-31, 0x1.2eb3f46ce6dd4p-38,
+	   -0x1.3c55dc0296d8dp-46, 0x1.037f954c07db5p-54,
+	   -0x1.57258e8506b75p-63, 0x1.758cc75e0adp-72, -0x1.5470f1d18b13bp-81,
+	   0x1.fe68b8d89d89ep-91 },
+	 { 0x1.0e14beba09e96p-3, 0x1.069922dcaf0ep-6, -0x1.7c2ca06d8e36p-10,
+	   0x1.5ba2f20a55ab6p-15, -0x1.4f2940694cd22p-21,
+	   0x1.96551dc3d73efp-28, -0x1.549cf8971bf69p-35,
+	   0x1.a3ab334fb6cf1p-43, -0x1.8cada87f89449p-51,
+	   0x1.2905e3226d256p-59, -0x1.6944e39ea6c95p-68,
+	   0x1.6bdde2f910276p-77, -0x1.29f3e7a889d8ap-86 } },
+  .j = { { 0x1p+0, -0x1p-2, 0x1p-6, -0x1.c71c71c71c71cp-12,
+	   0x1.c71c71c71c71cp-18, -0x1.23456789abcddp-24,
+	   0x1.02e85c0898a79p-31, -0x1.522a43f6492efp-39,
+	   0x1.522a43f0a7832p-47, -0x1.0b3130969318dp-55,
+	   0x1.5600a0c23e89ap-64, -0x1.6985384224p-73, 0x1.357314d2cec4fp-82 },
+	 { 0x1p-1, -0x1p-4, 0x1.5555555555555p-9, -0x1.c71c71c71c71cp-15,
+	   0x1.6c16c16c16c17p-21, -0x1.845c8a0ce5128p-28,
+	   0x1.27e4fb7789ecep-35, -0x1.522a43f64e07ep-43,
+	   0x1.2c9758d7b5cf6p-51, -0x1.ab81e83a63995p-60,
+	   0x1.f1758e9fa77d9p-69, -0x1.e2140c2061d8ap-78,
+	   0x1.7de953893b13bp-87 } },
+  /* First zeros of y0 and y1, in two parts.  */
+  .z = { { 0x1.c982eb8d417eap-1, 0x1.ea9d270347f83p-56 },
+	 { 0x1.193bed4dff243p+1, -0x1.bd1e50d219bfdp-55 } },
+  .zinv = { 0x1.1e7d3131dd6bbp+0, 0x1.d20f658382cf2p-2 },
+  .zhalf = { 0x1.c982eb8d417eap-2, 0x1.193bed4dff243p+0 },
+  .pio4 = { 0x1.921fb50000000p-1, 0x1.110b460000000p-27,
+	    0x1.1a62633145c07p-55 },
+  .two_over_pi = 0x1.45f306dc9c883p-1,
+  .inv_2pi = 0x1.45f306dc9c883p-3,
+  .ln2_hi = 0x1.62e42fefa3800p-1,
+  .ln2_lo = 0x1.ef35793c76730p-45,
+  .table_bound = 0x1.fffffffffffffp+3,
+  .y_table_start = 2,
+  .asymptotic_bound = 16,
+  .range_val = 0x1p23,
+  .y_min = 0x1p-1022,
+  .i_bound = 720,
+  .i_scale_bound = 700,
+  .i_scale_hi = 0x1.62e42fefa3800p+5,
+  .i_scale_lo = 0x1.ef35793c76730p-39,
+  .i_scale = 0x1p64,
+  /* Same polynomial and reduction as SVE exp.  */
+  .exp_poly = { 0x1.fffffffffdbcdp-2, 0x1.555555555444cp-3,
+		0x1.555573c6a9f7dp-5, 0x1.1111266d28935p-7 },
+  .inv_ln2 = 0x1.71547652b82fep+0,
+  /* 1.5*2^46+1023, see sv_exp_1u5.c.  */
+  .exp_shift = 0x1.800000000ffc0p+46,
+};
+
+#define SV_BESSEL_TABLE_SCALE 4
+
+/* Evaluate the table entry covering x for each lane.  Lanes outside the
+   table, including NaNs, are clamped to the first or last entry.  */
+static inline svfloat64_t
+sv_bessel_lookup (svbool_t pg, const double (*tab)[V_BESSEL_ENTRY_LEN],
+		  svfloat64_t x, double start,
+		  const struct sv_bessel_consts *d)
+{
+  svfloat64_t xc = svminnm_x (pg, svmaxnm_x (pg, x, start), d->table_bound);
+  svuint64_t i = svcvt_u64_x (
+      pg, svmul_x (pg, svsub_x (pg, xc, start), SV_BESSEL_TABLE_SCALE));
+  i = svmul_x (pg, i, V_BESSEL_ENTRY_LEN);
+
+  const double *e = tab[0];
+  svfloat64_t t = svsub_x (pg, svsub_x (pg, x, svld1_gather_index (pg, e, i)),
+			   svld1_gather_index (pg, e + 1, i));
+  svfloat64_t p = svld1_gather_index (pg, e + V_BESSEL_ENTRY_LEN - 1, i);
+  for (int k = V_BESSEL_ENTRY_LEN - 2; k >= 2; k--)
+    p = svmad_x (pg, p, t, svld1_gather_index (pg, e + k, i));
+  return p;
+}
+
+/* Helper for approximating exp(x + xtail). Copied from sv_exp, with no
+   special-case handling, so only valid for |x| <= 0x1.6p9.  */
+static inline svfloat64_t
+sv_bessel_exp (svbool_t pg, svfloat64_t x, svfloat64_t xtail,
+	       const struct sv_bessel_consts *d)
+{
+  svfloat64_t z = svmla_x (pg, sv_f64 (d->exp_shift), x, d->inv_ln2);
+  svuint64_t u = svreinterpret_u64 (z);
+  svfloat64_t n = svsub_x (pg, z, d->exp_shift);
+
+  svfloat64_t r = svmls_x (pg, x, n, d->ln2_hi);
+  r = svmls_x (pg, r, n, d->ln2_lo);
+  r = svadd_x (pg, r, xtail);
+
+  svfloat64_t r2 = svmul_x (pg, r, r);
+  svfloat64_t p01 = svmla_x (pg, sv_f64 (d->exp_poly[0]), r, d->exp_poly[1]);
+  svfloat64_t p23 = svmla_x (pg, sv_f64 (d->exp_poly[2]), r, d->exp_poly[3]);
+  svfloat64_t p04 = svmla_x (pg, p01, r2, p23);
+  svfloat64_t y = svmla_x (pg, r, r2, p04);
+
+  svfloat64_t s = svexpa (u);
+  return svmla_x (pg, s, s, y);
+}
+
+/* Hankel expansion of j (y = 0) or y (y = 1), for x >= 16.  */
+static inline svfloat64_t
+sv_bessel_jy_asymptotic (svbool_t pg, svfloat64_t x, int nu, int y,
+			 const struct sv_bessel_consts *d)
+{
+  svfloat64_t ix = svdivr_x (pg, x, 1.0);
+  svfloat64_t u = svmul_x (pg, ix, ix);
+
+  /* phi = phi_hi + phi_lo, where phi_hi = a / x rounded.  */
+  svfloat64_t phi_hi = svmul_x (pg, ix, d->phi_a[nu]);
+  svfloat64_t phi_lo
+      = svmul_x (pg, svmls_x (pg, sv_f64 (d->phi_a[nu]), phi_hi, x), ix);
+  svfloat64_t pphi
+      = svmul_x (pg, u, sv_horner_9_f64_x (pg, u, d->phi[nu]));
+  phi_lo = svmla_x (pg, phi_lo, pphi, ix);
+
+  svfloat64_t m = svsqrt_x (pg, svmul_x (pg, ix, d->two_over_pi));
+  svfloat64_t pm = sv_horner_7_f64_x (pg, u, d->m[nu]);
+  m = svmul_x (pg, m, svmla_x (pg, sv_f64 (1), u, pm));
+
+  /* theta = x + phi - (2 nu + 1) pi/4 = r + q pi/2, with q the nearest
+     integer, hence x + phi = r + k pi/4 with k = 2q + 2 nu + 1.  */
+  svfloat64_t q = svrintn_x (pg, svmla_x (pg, sv_f64 (-nu - 0.5),
+					  svadd_x (pg, x, phi_hi),
+					  d->two_over_pi));
+  svfloat64_t k = svmla_x (pg, sv_f64 (2 * nu + 1), q, 2);
+  /* Close to a zero of the function r is tiny, and x - k pi/4 ~= -phi.  The
+     first step is exact, and the rounding error of adding phi_hi is kept,
+     so that the cancellation is exact.  */
+  svfloat64_t r0 = svmls_x (pg, x, k, d->pio4[0]);
+  svfloat64_t r = svadd_x (pg, r0, phi_hi);
+  svfloat64_t b = svsub_x (pg, r, r0);
+  svfloat64_t e = svadd_x (pg, svsub_x (pg, r0, svsub_x (pg, r, b)),
+			   svsub_x (pg, phi_hi, b));
+  r = svmls_x (pg, r, k, d->pio4[1]);
+  r = svmls_x (pg, r, k, d->pio4[2]);
+  r = svadd_x (pg, r, svadd_x (pg, e, phi_lo));
+
+  svfloat64x2_t sc = sv_sincos_reduced_inline (
+      pg, r, svcvt_s64_x (pg, q), ptr_barrier (&sv_sincos_data));
+  return svmul_x (pg, m, y ? svget2 (sc, 0) : svget2 (sc, 1));
+}
+
+/* y0 or y1 for normal x < 2.  log(x/z) is computed as log1p((x - z) / z)
+   close to z, otherwise as e ln2 + log1p(m / z - 1) with x = 2^e m.  */
+static inline svfloat64_t
+sv_bessel_y_small (svbool_t pg, svfloat64_t x, int nu,
+		   const struct sv_bessel_consts *d)
+{
+  svfloat64_t w = svmul_x (pg, x, x);
+  svfloat64_t t = svsub_x (pg, svsub_x (pg, x, d->z[nu][0]), d->z[nu][1]);
+
+  svuint64_t ux = svreinterpret_u64 (x);
+  svfloat64_t e = svcvt_f64_x (
+      pg, svsub_x (pg, svreinterpret_s64 (svlsr_x (pg, ux, 52)), 1023));
+  svfloat64_t mant = svreinterpret_f64 (
+      svorr_x (pg, svand_x (pg, ux, 0x000fffffffffffff), 0x3ff0000000000000));
+  svfloat64_t arg = svmad_x (pg, mant, d->zinv[nu], -1);
+
+  svbool_t near = svcmpge (pg, x, d->zhalf[nu]);
+  arg = svsel (near, svmul_x (pg, t, d->zinv[nu]), arg);
+  e = svsel (near, sv_f64 (0), e);
+
+  svfloat64_t l = sv_log1p_inline (arg, pg);
+  l = svmla_x (pg, svmla_x (pg, l, e, d->ln2_lo), e, d->ln2_hi);
+
+  svfloat64_t j = sv_horner_12_f64_x (pg, w, d->j[nu]);
+  svfloat64_t s = sv_horner_12_f64_x (pg, w, d->s[nu]);
+  s = svmul_x (pg, s, svmul_x (pg, t, svadd_x (pg, x, d->z[nu][0])));
+  l = svmul_x (pg, l, d->two_over_pi);
+  if (nu)
+    return svmla_x (pg, svdiv_x (pg, s, x), l, svmul_x (pg, x, j));
+  return svmla_x (pg, s, l, j);
+}
+
+/* j0 or j1 of |x|, for |x| < 2^23 or NaN.  */
+static inline svfloat64_t
+sv_bessel_j_inline (svbool_t pg, svfloat64_t ax, int nu,
+		    const struct sv_bessel_consts *d)
+{
+  svbool_t large = svcmpge (pg, ax, d->asymptotic_bound);
+  svfloat64_t y = sv_f64 (0);
+  if (likely (svptest_any (pg, svnot_z (pg, large))))
+    y = sv_bessel_lookup (pg, nu ? __v_bessel_data.j1 : __v_bessel_data.j0, ax,
+			  0, d);
+  if (unlikely (svptest_any (pg, large)))
+    y = svsel (large, sv_bessel_jy_asymptotic (pg, ax, nu, 0, d), y);
+  return y;
+}
+
+/* y0 or y1 of x, for normal positive x < 2^23.  */
+static inline svfloat64_t
+sv_bessel_y_inline (svbool_t pg, svfloat64_t x, int nu,
+		    const struct sv_bessel_consts *d)
+{
+  svbool_t large = svcmpge (pg, x, d->asymptotic_bound);
+  svbool_t small = svcmplt (pg, x, d->y_table_start);
+  svfloat64_t y = sv_f64 (0);
+  if (likely (svptest_any (pg, svnor_z (pg, large, small))))
+    y = sv_bessel_lookup (pg, nu ? __v_bessel_data.y1 : __v_bessel_data.y0, x,
+			  d->y_table_start, d);
+  if (unlikely (svptest_any (pg, small)))
+    y = svsel (small, sv_bessel_y_small (pg, x, nu, d), y);
+  if (unlikely (svptest_any (pg, large)))
+    y = svsel (large, sv_bessel_jy_asymptotic (pg, x, nu, 1, d), y);
+  return y;
+}
+
+/* i0 or i1 of |x|.  Overflows to infinity and propagates NaN.  */
+static inline svfloat64_t
+sv_bessel_i_inline (svbool_t pg, svfloat64_t ax, int nu,
+		    const struct sv_bessel_consts *d)
+{
+  svbool_t large = svcmpge (pg, ax, d->asymptotic_bound);
+  svfloat64_t y = sv_f64 (0);
+  if (likely (svptest_any (pg, svnot_z (pg, large))))
+    y = sv_bessel_lookup (pg, nu ? __v_bessel_data.i1 : __v_bessel_data.i0, ax,
+			  0, d);
+  if (unlikely (svptest_any (pg, large)))
+    {
+      svfloat64_t x = svmin_x (pg, ax, d->i_bound);
+      svfloat64_t v = svdivr_x (pg, x, 1.0);
+      svfloat64_t p
+	  = svmla_x (pg, sv_f64 (1), v, sv_horner_12_f64_x (pg, v, d->i[nu]));
+      p = svmul_x (pg, p, svsqrt_x (pg, svmul_x (pg, v, d->inv_2pi)));
+
+      /* e^x = e^(x - s) * 2^64, with s = 64 ln2, above i_scale_bound.  */
+      svbool_t scale = svcmpgt (pg, x, d->i_scale_bound);
+      svfloat64_t ex = sv_bessel_exp (pg, svsub_m (scale, x, d->i_scale_hi),
+				      svdup_f64_z (scale, -d->i_scale_lo), d);
+      p = svmul_x (pg, ex, p);
+      p = svmul_m (scale, p, d->i_scale);
+      y = svsel (large, p, y);
+    }
+  return y;
+}
+
+#endif
@@ -0,0 +1,171 @@
+/*
+ * Core approximation for double-precision SVE regularised incomplete beta
+ * function
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+#ifndef PL_MATH_SV_BETA_INC_COMMON_H
+#define PL_MATH_SV_BETA_INC_COMMON_H
+
+#include "sv_gamma_inc_common.h"
+
+/* Same algorithm as v_beta_inc_common.h, see there for details.  */
+
+/* The d_k of the continued fraction, for k = 2m and k = 2m + 1.  */
+static inline svfloat64_t
+sv_beta_inc_d_even (svbool_t pg, svfloat64_t a, svfloat64_t b, svfloat64_t x,
+		    double m)
+{
+  svfloat64_t a2m = svadd_x (pg, a, 2 * m);
+  svfloat64_t num = svmul_x (pg, svmul_x (pg, svsub_x (pg, b, m), m), x);
+  return svdiv_x (pg, num, svmul_x (pg, svsub_x (pg, a2m, 1.0), a2m));
+}
+
+static inline svfloat64_t
+sv_beta_inc_d_odd (svbool_t pg, svfloat64_t a, svfloat64_t ab, svfloat64_t x,
+		   double m)
+{
+  svfloat64_t a2m = svadd_x (pg, a, 2 * m);
+  svfloat64_t num = svmul_x (
+      pg, svmul_x (pg, svadd_x (pg, a, m), svadd_x (pg, ab, m)),
+      svneg_x (pg, x));
+  return svdiv_x (pg, num, svmul_x (pg, a2m, svadd_x (pg, a2m, 1.0)));
+}
+
+/* One step of the modified Lentz algorithm.  */
+static inline void
+sv_beta_inc_lentz (svbool_t pg, svfloat64_t dk, svfloat64_t *dn,
+		   svfloat64_t *c, svfloat64_t *h, svfloat64_t *w)
+{
+  *w = svmul_x (pg, *w, svmul_x (pg, dk, *dn));
+  *dn = svdivr_x (pg, svmla_x (pg, sv_f64 (1), dk, *dn), 1.0);
+  *c = svadd_x (pg, svdiv_x (pg, dk, *c), 1.0);
+  *h = svmul_x (pg, *h, svmul_x (pg, *dn, *c));
+  *w = svmul_x (pg, *w, *dn);
+}
+
+/* 1 / (1 + d_1 / (1 + d_2 / ...)) for the lanes set in pg, with a + b passed
+   in ab.  */
+static inline svfloat64_t
+sv_beta_inc_cf (svbool_t pg, svfloat64_t a, svfloat64_t b, svfloat64_t ab,
+		svfloat64_t x, double eps, int max_iter)
+{
+  svfloat64_t dn = sv_f64 (1), c = sv_f64 (0x1p1000), h = dn, w = dn;
+  sv_beta_inc_lentz (pg, sv_beta_inc_d_odd (pg, a, ab, x, 0), &dn, &c, &h,
+		     &w);
+  svbool_t active = pg;
+  int n = 0;
+  while (n < max_iter && svptest_any (pg, active))
+    {
+      n++;
+      sv_beta_inc_lentz (pg, sv_beta_inc_d_even (pg, a, b, x, n), &dn, &c, &h,
+			 &w);
+      sv_beta_inc_lentz (pg, sv_beta_inc_d_odd (pg, a, ab, x, n), &dn, &c, &h,
+			 &w);
+      active = svacgt (active, w, svmul_x (pg, h, eps));
+    }
+  svfloat64_t t = sv_f64 (0);
+  for (; n > 0; n--)
+    {
+      t = svdiv_x (pg, sv_beta_inc_d_odd (pg, a, ab, x, n),
+		   svadd_x (pg, t, 1.0));
+      t = svdiv_x (pg, sv_beta_inc_d_even (pg, a, b, x, n),
+		   svadd_x (pg, t, 1.0));
+    }
+  t = svdiv_x (pg, sv_beta_inc_d_odd (pg, a, ab, x, 0), svadd_x (pg, t, 1.0));
+  return svdivr_x (pg, svadd_x (pg, t, 1.0), 1.0);
+}
+
+/* I(a, b, x) for a and b positive and finite and 0 < x < 1.  */
+static inline svfloat64_t
+sv_beta_inc_inline (svbool_t pg, svfloat64_t a, svfloat64_t b, svfloat64_t x,
+		    double eps, int max_iter,
+		    const struct sv_gamma_inc_consts *d)
+{
+  svfloat64_t e, yl, yh = sv_two_sum_f64 (pg, sv_f64 (1), svneg_x (pg, x), &yl);
+  svfloat64_t ab = svadd_x (pg, a, b);
+
+  /* prefix = x^a (1 - x)^b / B(a, b).  */
+  svfloat64_t lxl, lxh = sv_log_dd_inline (pg, x, &lxl);
+  svfloat64_t lyl, lyh = sv_log_dd_inline (pg, yh, &lyl);
+  lyl = svadd_x (pg, lyl, svdiv_x (pg, yl, yh));
+  svfloat64_t hi = svmul_x (pg, a, lxh);
+  svfloat64_t lo = svmla_x (pg, svnmls_x (pg, hi, a, lxh), a, lxl);
+  svfloat64_t t = svmul_x (pg, b, lyh);
+  lo = svadd_x (pg, lo, svmla_x (pg, svnmls_x (pg, t, b, lyh), b, lyl));
+  hi = sv_two_sum_f64 (pg, hi, t, &e);
+  lo = svadd_x (pg, lo, e);
+
+  svfloat64_t gl, gh = sv_lgamma_dd_inline (pg, a, sv_f64 (0), &gl, d);
+  hi = sv_two_sum_f64 (pg, hi, svneg_x (pg, gh), &e);
+  lo = svsub_x (pg, svadd_x (pg, lo, e), gl);
+  gh = sv_lgamma_dd_inline (pg, b, sv_f64 (0), &gl, d);
+  hi = sv_two_sum_f64 (pg, hi, svneg_x (pg, gh), &e);
+  lo = svsub_x (pg, svadd_x (pg, lo, e), gl);
+  svfloat64_t abl, abh = sv_two_sum_f64 (pg, a, b, &abl);
+  gh = sv_lgamma_dd_inline (pg, abh, abl, &gl, d);
+  hi = sv_two_sum_f64 (pg, hi, gh, &e);
+  lo = svadd_x (pg, svadd_x (pg, lo, e), gl);
+  hi = sv_two_sum_f64 (pg, hi, lo, &lo);
+  svfloat64_t prefix = sv_pow_exp_inline (pg, hi, lo, sv_u64 (0));
+
+  /* Evaluate the continued fraction for I(a, b, x), or for I(b, a, 1 - x) if
+     x >= (a + 1) / (a + b + 2).  */
+  svbool_t swap = svcmpgt (pg, svmul_x (pg, x, svadd_x (pg, ab, 2.0)),
+			   svadd_x (pg, a, 1.0));
+  svfloat64_t as = svsel (swap, b, a);
+  svfloat64_t cf = sv_beta_inc_cf (pg, as, svsel (swap, a, b), ab,
+				   svsel (swap, yh, x), eps, max_iter);
+  svfloat64_t y = svdiv_x (pg, svmul_x (pg, prefix, cf), as);
+
+  /* If y = I(b, a, 1 - x) is close to 1, the continued fraction for
+     I(a, b, x) can be more accurate, see v_beta_inc_inline.  */
+  svfloat64_t omy = svsubr_x (pg, y, 1.0);
+  svbool_t redo
+      = svcmplt (swap, svmul_x (pg, svmul_x (pg, omy, omy), a),
+		 svmul_x (pg, svmul_x (pg, y, y), b));
+  if (unlikely (svptest_any (pg, redo)))
+    {
+      swap = sveor_z (pg, swap, redo);
+      svfloat64_t ar = svsel (swap, b, a);
+      cf = sv_beta_inc_cf (redo, ar, svsel (swap, a, b), ab,
+			   svsel (swap, yh, x), eps, max_iter);
+      y = svsel (redo, svdiv_x (redo, svmul_x (redo, prefix, cf), ar), y);
+    }
+  return svsel (swap, svsubr_x (pg, y, 1.0), y);
+}
+
+/* I(a, b, x) for any a, b and x.  I(a, b, 0) = 0 and I(a, b, 1) = 1, and the
+   result is NaN if a or b is not positive and finite or x is not in
+   [0, 1].  */
+static inline svfloat64_t
+sv_beta_inc (svbool_t pg, svfloat64_t a, svfloat64_t b, svfloat64_t x,
+	     double eps, int max_iter)
+{
+  const struct sv_gamma_inc_consts *d = ptr_barrier (&sv_gamma_inc_consts);
+  /* Lanes where a or b is not positive and finite, or x is not in (0, 1).  */
+  svbool_t special = svorr_z (
+      pg,
+      svcmpge (pg, svsub_x (pg, svreinterpret_u64 (a), 1),
+	       0x7fefffffffffffff),
+      svcmpge (pg, svsub_x (pg, svreinterpret_u64 (b), 1),
+	       0x7fefffffffffffff));
+  special = svorr_z (pg, special,
+		     svcmpge (pg, svsub_x (pg, svreinterpret_u64 (x), 1),
+			      0x3fefffffffffffff));
+  if (likely (!svptest_any (pg, special)))
+    return sv_beta_inc_inline (pg, a, b, x, eps, max_iter, d);
+  /* Replace special lanes with arguments which converge immediately.  */
+  svfloat64_t y = sv_beta_inc_inline (
+      pg, svsel (special, sv_f64 (1), a), svsel (special, sv_f64 (1), b),
+      svsel (special, sv_f64 (0.5), x), eps, max_iter, d);
+  svbool_t valid = svcmpgt (svcmpgt (pg, a, 0.0), b, 0.0);
+  valid = svcmple (svcmpge (valid, x, 0.0), x, 1.0);
+  valid = svcmplt (valid, svmax_x (pg, a, b), INFINITY);
+  svfloat64_t ys = svsel (svcmpeq (pg, x, 1.0), sv_f64 (1), sv_f64 (0));
+  ys = svsel (valid, ys, sv_f64 (NAN));
+  return svsel (special, ys, y);
+}
+
+#endif
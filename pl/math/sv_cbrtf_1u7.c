@@ -1,7 +1,7 @@
 /*
  * Single-precision SVE cbrt(x) function.
  *
- * Copyright (c) 2023, Arm Limited.
+ * Copyright (c) 2023-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -40,7 +40,8 @@ special_case (svfloat32_t x, svfloat32_t y, svbool_t special)
 static inline svfloat32_t
 shifted_lookup (const svbool_t pg, const float32_t *table, svint32_t i)
 {
-  return svld1_gather_index (pg, table, svadd_x (pg, i, 2));
+  return sv_lookup_f32_x (pg, table, 5,
+			  svreinterpret_u32 (svadd_x (pg, i, 2)));
 }
 
 /* Approximation for vector single-precision cbrt(x) using Newton iteration
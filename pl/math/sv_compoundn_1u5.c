@@ -0,0 +1,74 @@
+/*
+ * Double-precision SVE compoundn(x, n) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "mathlib.h"
+#include "sv_pown_common.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+/* SVE (1 + x)^n for integer n.  1 + x is computed exactly as u + ulo, then the
+   result is evaluated as in the scalar compoundn, by repeated squaring or as
+   exp(n log1p(x)).  x <= -1, infinite and nan x fall back to scalar
+   compoundn.
+   Maximum measured error is 1.04 ULPs:
+   _ZGVsMxvv_compoundn(0x1.1d9eb93a680c7p-7, -6232)
+     got 0x1.f5e3dd2f7649ep-79
+    want 0x1.f5e3dd2f7649fp-79.  */
+svfloat64_t SV_NAME_D2 (compoundn) (svfloat64_t x, svint64_t n,
+				    const svbool_t pg)
+{
+  /* x <= -1, inf or nan.  */
+  svbool_t special = svorr_z (
+      pg, svcmpge (pg, svreinterpret_u64 (x), 0xbff0000000000000),
+      svcmpge (pg, svreinterpret_u64 (svabs_x (pg, x)), 0x7ff0000000000000));
+  svfloat64_t z = svsel (special, sv_f64 (0.0), x);
+
+  /* u + ulo = 1 + z exactly.  */
+  svfloat64_t u = svadd_x (pg, z, 1.0);
+  svfloat64_t v = svsub_x (pg, u, z);
+  svfloat64_t ulo = svadd_x (pg, svsubr_x (pg, v, 1.0),
+			     svsub_x (pg, z, svsub_x (pg, u, v)));
+
+  svbool_t sq = sv_pown_use_squaring (pg, u, n);
+  svbool_t other = svnot_z (pg, sq);
+  svfloat64_t y;
+  if (likely (!svptest_any (pg, other)))
+    y = sv_pown_squaring (pg, u, ulo, n);
+  else
+    {
+      y = sv_pown_squaring (pg, u, ulo, svsel (sq, n, sv_s64 (0)));
+      svfloat64_t ll, lh = sv_pow_log_inline (pg, svreinterpret_u64 (u), &ll);
+      /* log1p(x) ~= log(u) + t - t^2/2, t = th + tl = ulo/u.  */
+      svfloat64_t th = svdiv_x (pg, ulo, u);
+      svfloat64_t tl = svdiv_x (pg, svmls_x (pg, ulo, th, u), u);
+      svfloat64_t hi = svadd_x (pg, lh, th);
+      svfloat64_t lo = svsel (svacge (pg, lh, th),
+			      svadd_x (pg, svsub_x (pg, lh, hi), th),
+			      svadd_x (pg, svsub_x (pg, th, hi), lh));
+      lo = svadd_x (pg, lo, svadd_x (pg, ll, tl));
+      lo = svmls_x (pg, lo, svmul_x (pg, th, 0.5), th);
+      y = svsel (sq, y, sv_pown_exp_mul (pg, n, hi, lo));
+    }
+
+  if (unlikely (svptest_any (pg, special)))
+    return sv_call_pown (compoundn, x, n, y, special);
+  return y;
+}
+
+PL_TEST_ULP (SV_NAME_D2 (compoundn), 0.55)
+#define SV_COMPOUNDN_INTERVAL2(xlo, xhi, ylo, yhi, n)                         \
+  PL_TEST_INTERVAL2 (SV_NAME_D2 (compoundn), xlo, xhi, ylo, yhi, n)           \
+  PL_TEST_INTERVAL2 (SV_NAME_D2 (compoundn), xlo, xhi, -ylo, -yhi, n)
+SV_COMPOUNDN_INTERVAL2 (0, 0x1p-20, 0, 64, 40000)
+SV_COMPOUNDN_INTERVAL2 (-0, -1, 0, 64, 40000)
+SV_COMPOUNDN_INTERVAL2 (0x1p-20, inf, 0, 64, 40000)
+SV_COMPOUNDN_INTERVAL2 (0, 0x1p-2, 0, 1000, 40000)
+SV_COMPOUNDN_INTERVAL2 (-0, -0x1p-2, 0, 1000, 40000)
+SV_COMPOUNDN_INTERVAL2 (0, 0x1p-20, 0, 0x1p30, 40000)
+SV_COMPOUNDN_INTERVAL2 (-0, -0x1p-20, 0, 0x1p30, 40000)
+SV_COMPOUNDN_INTERVAL2 (0, inf, 0, 0x1p62, 10000)
+SV_COMPOUNDN_INTERVAL2 (-0, -1, 0, 0x1p62, 10000)
@@ -1,7 +1,7 @@
 /*
  * Double-precision SVE cosh(x) function.
  *
- * Copyright (c) 2023, Arm Limited.
+ * Copyright (c) 2023-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -11,21 +11,20 @@
 
 static const struct data
 {
-  float64_t poly[3];
-  float64_t inv_ln2, ln2_hi, ln2_lo, shift, thres;
-  uint64_t index_mask, special_bound;
+  float64_t poly[4];
+  float64_t inv_ln2, ln2_hi, ln2_lo, shift;
+  uint64_t special_bound;
 } data = {
-  .poly = { 0x1.fffffffffffd4p-2, 0x1.5555571d6b68cp-3,
-	    0x1.5555576a59599p-5, },
+  /* Same polynomial and reduction as SVE exp.  */
+  .poly = { 0x1.fffffffffdbcdp-2, 0x1.555555555444cp-3, 0x1.555573c6a9f7dp-5,
+	    0x1.1111266d28935p-7 },
 
-  .inv_ln2 = 0x1.71547652b82fep8, /* N/ln2.  */
-  /* -ln2/N.  */
-  .ln2_hi = -0x1.62e42fefa39efp-9,
-  .ln2_lo = -0x1.abc9e3b39803f3p-64,
-  .shift = 0x1.8p+52,
-  .thres = 704.0,
+  .inv_ln2 = 0x1.71547652b82fep+0,
+  .ln2_hi = 0x1.62e42fefa3800p-1,
+  .ln2_lo = 0x1.ef35793c76730p-45,
+  /* 1.5*2^46+1023, see sv_exp_1u5.c.  */
+  .shift = 0x1.800000000ffc0p+46,
 
-  .index_mask = 0xff,
   /* 0x1.6p9, above which exp overflows.  */
   .special_bound = 0x4086000000000000,
 };
@@ -36,30 +35,29 @@ special_case (svfloat64_t x, svfloat64_t y, svbool_t special)
   return sv_call_f64 (cosh, x, y, special);
 }
 
-/* Helper for approximating exp(x). Copied from sv_exp_tail, with no
-   special-case handling or tail.  */
+/* Helper for approximating exp(x). Copied from sv_exp, with no special-case
+   handling. The scale 2^n, n multiple of 1/64, is computed by FEXPA, which
+   avoids the table lookup.  */
 static inline svfloat64_t
 exp_inline (svfloat64_t x, const svbool_t pg, const struct data *d)
 {
   /* Calculate exp(x).  */
   svfloat64_t z = svmla_x (pg, sv_f64 (d->shift), x, d->inv_ln2);
+  svuint64_t u = svreinterpret_u64 (z);
   svfloat64_t n = svsub_x (pg, z, d->shift);
 
-  svfloat64_t r = svmla_x (pg, x, n, d->ln2_hi);
-  r = svmla_x (pg, r, n, d->ln2_lo);
-
-  svuint64_t u = svreinterpret_u64 (z);
-  svuint64_t e = svlsl_x (pg, u, 52 - V_EXP_TAIL_TABLE_BITS);
-  svuint64_t i = svand_x (pg, u, d->index_mask);
+  svfloat64_t r = svmls_x (pg, x, n, d->ln2_hi);
+  r = svmls_x (pg, r, n, d->ln2_lo);
 
-  svfloat64_t y = svmla_x (pg, sv_f64 (d->poly[1]), r, d->poly[2]);
-  y = svmla_x (pg, sv_f64 (d->poly[0]), r, y);
-  y = svmla_x (pg, sv_f64 (1.0), r, y);
-  y = svmul_x (pg, r, y);
+  svfloat64_t r2 = svmul_x (pg, r, r);
+  svfloat64_t p01 = svmla_x (pg, sv_f64 (d->poly[0]), r, d->poly[1]);
+  svfloat64_t p23 = svmla_x (pg, sv_f64 (d->poly[2]), r, d->poly[3]);
+  svfloat64_t p04 = svmla_x (pg, p01, r2, p23);
+  svfloat64_t y = svmla_x (pg, r, r2, p04);
 
-  /* s = 2^(n/N).  */
-  u = svld1_gather_index (pg, __v_exp_tail_data, i);
-  svfloat64_t s = svreinterpret_f64 (svadd_x (pg, u, e));
+  /* s = 2^n.  |x| <= 0x1.6p9 in the non-special region, so the exponent of s
+     is always in range.  */
+  svfloat64_t s = svexpa (u);
 
   return svmla_x (pg, s, s, y);
 }
@@ -71,9 +69,9 @@ exp_inline (svfloat64_t x, const svbool_t pg, const struct data *d)
    _ZGVsMxv_cosh (0x1.628ad45039d2fp+9) got 0x1.fd774e958236dp+1021
 				       want 0x1.fd774e958236fp+1021.
 
-   The greatest observed error in the non-special region is 1.54 ULP:
-   _ZGVsMxv_cosh (0x1.ba5651dd4486bp+2) got 0x1.f5e2bb8d5c98fp+8
-				       want 0x1.f5e2bb8d5c991p+8.  */
+   The greatest observed error in the non-special region is 1.50 ULP:
+   _ZGVsMxv_cosh (0x1.7d9d59457b3abp+2) got 0x1.84abfe9640f17p+7
+				       want 0x1.84abfe9640f16p+7.  */
 svfloat64_t SV_NAME_D1 (cosh) (svfloat64_t x, const svbool_t pg)
 {
   const struct data *d = ptr_barrier (&data);
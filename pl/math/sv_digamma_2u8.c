@@ -0,0 +1,46 @@
+/*
+ * Double-precision SVE digamma(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_digamma_common.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+/* SVE approximation for double-precision digamma(x), see
+   sv_digamma_common.h.  Maximum measured error is 2.75 ULP, just below the
+   powers of 2 where the rounding error of log(x) is doubled:
+   _ZGVsMxv_digamma(0x1.b6612a3e87832p+5) got 0x1.ff4b7d891e727p+1
+		    want 0x1.ff4b7d891e72ap+1.
+   For x < 0 the two terms of the reflection cancel close to the zeros of
+   digamma, and the absolute error is below
+   3.6 2^-52 max(1, |digamma(1 - x)|, |pi cot(pi x)|).  The error in ULP is
+   largest close to those zeros and grows with |x|, to about 30 ULP near
+   2^41.  Where |digamma(x)| > 2 the largest observed errors are 4.03 ULP for
+   x in (-2^-8, 0) and 10.8 ULP at
+   _ZGVsMxv_digamma(-0x1.7f8ab3dca2c5fp+6) got -0x1.e4064fa83dc16p+1
+					   want -0x1.e4064fa83dc21p+1.
+   The negative axis is therefore tested for absolute error by
+   _ZGVsMxv_digamma_abs, see test/ulp_wrappers.h.  */
+svfloat64_t SV_NAME_D1 (digamma) (svfloat64_t x, const svbool_t pg)
+{
+  const struct sv_digamma_consts *d = ptr_barrier (&sv_digamma_consts);
+  return sv_digamma_inline (pg, x, d);
+}
+
+PL_SIG (SV, D, 1, digamma, -10.0, 10.0)
+PL_TEST_ULP (SV_NAME_D1 (digamma), 2.3)
+PL_TEST_INTERVAL (SV_NAME_D1 (digamma), 0, 0x1p-1022, 1000)
+PL_TEST_INTERVAL (SV_NAME_D1 (digamma), 0x1p-1022, 1, 100000)
+PL_TEST_INTERVAL (SV_NAME_D1 (digamma), 1, 2, 100000)
+PL_TEST_INTERVAL (SV_NAME_D1 (digamma), 2, 8, 100000)
+PL_TEST_INTERVAL (SV_NAME_D1 (digamma), 8, 0x1p30, 100000)
+PL_TEST_INTERVAL (SV_NAME_D1 (digamma), 0x1p30, inf, 1000)
+PL_TEST_INTERVAL (SV_NAME_D1 (digamma), -0x1p52, -inf, 1000)
+PL_TEST_ULP (_ZGVsMxv_digamma_abs, 0.7)
+PL_TEST_INTERVAL (_ZGVsMxv_digamma_abs, -0, -0x1p-8, 10000)
+PL_TEST_INTERVAL (_ZGVsMxv_digamma_abs, -0x1p-8, -1, 100000)
+PL_TEST_INTERVAL (_ZGVsMxv_digamma_abs, -1, -100, 100000)
+PL_TEST_INTERVAL (_ZGVsMxv_digamma_abs, -100, -0x1p52, 10000)
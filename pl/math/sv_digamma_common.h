@@ -0,0 +1,164 @@
+/*
+ * Core approximations for double-precision SVE digamma and trigamma
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_math.h"
+#include "poly_sve_f64.h"
+#include "sv_log_inline.h"
+
+/* Same algorithm as v_digamma_common.h, see there for details.  */
+static const struct sv_digamma_consts
+{
+  double digamma_poly[7], trigamma_poly[7], sinpi_poly[10];
+  double table_bound, asymptotic_bound, pi;
+} sv_digamma_consts = {
+  /* Coefficients of P and P1 on [0, 1/8^2], computed by Chebyshev
+     interpolation in quad precision.  */
+  .digamma_poly = { 0x1.5555555555555p-4, -0x1.11111111095e6p-7,
+		    0x1.041040c62923cp-8, -0x1.1110b33fc17d6p-8,
+		    0x1.f037df4b69ba2p-8, -0x1.531da6b6dedcp-6,
+		    0x1.0497fbf0fa8adp-4 },
+  .trigamma_poly = { 0x1.5555555555551p-3, -0x1.11111110f37eep-5,
+		     0x1.86186098270b1p-6, -0x1.11105c888595ep-5,
+		     0x1.360bc3ac05fb3p-4, -0x1.f9d9c7216c73ap-3,
+		     0x1.b7a5f47721ecbp-1 },
+  /* sin(pi r) / r as a polynomial in r^2, same coefficients as sinpi.  */
+  .sinpi_poly = { 0x1.921fb54442d184p1, -0x1.4abbce625be53p2,
+		  0x1.466bc6775ab16p1, -0x1.32d2cce62dc33p-1,
+		  0x1.507834891188ep-4, -0x1.e30750a28c88ep-8,
+		  0x1.e8f48308acda4p-12, -0x1.6fc0032b3c29fp-16,
+		  0x1.af86ae521260bp-21, -0x1.012a9870eeb7dp-25 },
+  .table_bound = 0x1.fffffffffffffp+2,
+  .asymptotic_bound = 8,
+  .pi = 0x1.921fb54442d18p+1,
+};
+
+#define SV_DIGAMMA_TABLE_SCALE 8
+
+/* Evaluate the table entry covering x for each lane.  Lanes outside the
+   table, including NaNs, are clamped to the first or last entry.  */
+static inline svfloat64_t
+sv_digamma_lookup (svbool_t pg, const double (*tab)[V_DIGAMMA_ENTRY_LEN],
+		   svfloat64_t x, const struct sv_digamma_consts *d)
+{
+  svfloat64_t xc = svminnm_x (pg, svmaxnm_x (pg, x, 0.0), d->table_bound);
+  svuint64_t i = svcvt_u64_x (pg, svmul_x (pg, xc, SV_DIGAMMA_TABLE_SCALE));
+  i = svmul_x (pg, i, V_DIGAMMA_ENTRY_LEN);
+
+  const double *e = tab[0];
+  svfloat64_t t = svsub_x (pg, svsub_x (pg, x, svld1_gather_index (pg, e, i)),
+			   svld1_gather_index (pg, e + 1, i));
+  svfloat64_t p = svld1_gather_index (pg, e + V_DIGAMMA_ENTRY_LEN - 1, i);
+  for (int k = V_DIGAMMA_ENTRY_LEN - 2; k >= 2; k--)
+    p = svmad_x (pg, p, t, svld1_gather_index (pg, e + k, i));
+  return p;
+}
+
+/* sin(pi r) / r, for |r| <= 1/2.  */
+static inline svfloat64_t
+sv_digamma_sinpi (svbool_t pg, svfloat64_t r,
+		  const struct sv_digamma_consts *d)
+{
+  svfloat64_t r2 = svmul_x (pg, r, r);
+  svfloat64_t r4 = svmul_x (pg, r2, r2);
+  return sv_pw_horner_9_f64_x (pg, r2, r4, d->sinpi_poly);
+}
+
+/* digamma(x) for x >= 0 or NaN.  Infinity is not handled.  */
+static inline svfloat64_t
+sv_digamma_pos (svbool_t pg, svfloat64_t x, const struct sv_digamma_consts *d)
+{
+  svbool_t large = svcmpge (pg, x, d->asymptotic_bound);
+  svbool_t table = svnot_z (pg, large);
+  svfloat64_t y = sv_f64 (0);
+  if (svptest_any (pg, table))
+    {
+      y = sv_digamma_lookup (table, __v_digamma_data.digamma, x, d);
+      svbool_t small = svcmplt (table, x, 1.0);
+      y = svsub_m (small, y, svdivr_x (small, x, 1.0));
+    }
+  if (svptest_any (pg, large))
+    {
+      svfloat64_t ix = svdivr_x (large, x, 1.0);
+      svfloat64_t z = svmul_x (large, ix, ix);
+      svfloat64_t p = svmul_x (
+	  large, z, sv_horner_6_f64_x (large, z, d->digamma_poly));
+      p = svmla_x (large, p, ix, 0.5);
+      y = svsel (large, svsub_x (large, sv_log_inline (large, x), p), y);
+    }
+  return y;
+}
+
+/* trigamma(x) for x >= 0 or NaN.  */
+static inline svfloat64_t
+sv_trigamma_pos (svbool_t pg, svfloat64_t x,
+		 const struct sv_digamma_consts *d)
+{
+  svbool_t large = svcmpge (pg, x, d->asymptotic_bound);
+  svbool_t table = svnot_z (pg, large);
+  svfloat64_t y = sv_f64 (0);
+  if (svptest_any (pg, table))
+    {
+      y = sv_digamma_lookup (table, __v_digamma_data.trigamma, x, d);
+      svbool_t small = svcmplt (table, x, 1.0);
+      /* 1/x^2 as (1/x)/x, which does not underflow for tiny x.  */
+      y = svadd_m (small, y,
+		   svdiv_x (small, svdivr_x (small, x, 1.0), x));
+    }
+  if (svptest_any (pg, large))
+    {
+      svfloat64_t ix = svdivr_x (large, x, 1.0);
+      svfloat64_t z = svmul_x (large, ix, ix);
+      svfloat64_t p = svmla_x (large, sv_f64 (0.5), ix,
+			       sv_horner_6_f64_x (large, z, d->trigamma_poly));
+      y = svsel (large, svmla_x (large, ix, z, p), y);
+    }
+  return y;
+}
+
+/* digamma(x) for any x.  */
+static inline svfloat64_t
+sv_digamma_inline (svbool_t pg, svfloat64_t x,
+		   const struct sv_digamma_consts *d)
+{
+  svbool_t neg = svcmplt (pg, x, 0.0);
+  svfloat64_t y = sv_digamma_pos (pg, svsubr_m (neg, x, 1.0), d);
+  if (unlikely (svptest_any (pg, neg)))
+    {
+      /* pi cot(pi x) = pi sin(pi s) / sin(pi r), with r = x - rint(x) and
+	 s = 1/2 - |r|.  digamma is NaN at negative integers, where r is 0,
+	 and for -inf, where r is NaN.  */
+      svfloat64_t r = svsub_x (neg, x, svrinta_x (neg, x));
+      svfloat64_t s = svsubr_x (neg, svabs_x (neg, r), 0.5);
+      svfloat64_t c = svmul_x (neg, svmul_x (neg, s, d->pi),
+			       sv_digamma_sinpi (neg, s, d));
+      c = svdiv_x (neg, c, svmul_x (neg, r, sv_digamma_sinpi (neg, r, d)));
+      y = svsub_m (neg, y, c);
+      y = svsel (svcmpeq (neg, r, 0.0), sv_f64 (NAN), y);
+    }
+  /* The log helper does not handle infinity.  */
+  return svsel (svcmpeq (pg, x, INFINITY), x, y);
+}
+
+/* trigamma(x) for any x.  */
+static inline svfloat64_t
+sv_trigamma_inline (svbool_t pg, svfloat64_t x,
+		    const struct sv_digamma_consts *d)
+{
+  svbool_t neg = svcmplt (pg, x, 0.0);
+  svfloat64_t y = sv_trigamma_pos (pg, svsubr_m (neg, x, 1.0), d);
+  if (unlikely (svptest_any (pg, neg)))
+    {
+      /* pi^2 / sin(pi x)^2, with sin(pi x) = +-sin(pi r), r = x - rint(x).
+	 This is infinity at negative integers, where r is 0, and NaN for
+	 -inf.  */
+      svfloat64_t r = svsub_x (neg, x, svrinta_x (neg, x));
+      svfloat64_t c = svdivr_x (
+	  neg, svmul_x (neg, r, sv_digamma_sinpi (neg, r, d)), d->pi);
+      y = svnmls_m (neg, y, c, c);
+    }
+  return y;
+}
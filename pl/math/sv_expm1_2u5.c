@@ -1,7 +1,7 @@
 /*
  * Double-precision vector exp(x) - 1 function.
  *
- * Copyright (c) 2023, Arm Limited.
+ * Copyright (c) 2023-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -11,7 +11,6 @@
 #include "pl_test.h"
 
 #define SpecialBound 0x1.62b7d369a5aa9p+9
-#define ExponentBias 0x3ff0000000000000
 
 static const struct data
 {
@@ -30,7 +29,9 @@ static const struct data
   .inv_ln2 = 0x1.71547652b82fep0,
   .ln2_hi = 0x1.62e42fefa39efp-1,
   .ln2_lo = 0x1.abc9e3b39803fp-56,
-  .shift = 0x1.8p52,
+  /* 1.5*2^52+1023, such that bits 10:0 of asuint(shift + i) are the biased
+     exponent of 2^i.  */
+  .shift = 0x1.80000000003ffp52,
 };
 
 static svfloat64_t NOINLINE
@@ -56,8 +57,9 @@ svfloat64_t SV_NAME_D1 (expm1) (svfloat64_t x, svbool_t pg)
      exp(x) - 1 = 2^i * (expm1(f) + 1) - 1
      where 2^i is exact because i is an integer.  */
   svfloat64_t shift = sv_f64 (d->shift);
-  svfloat64_t n = svsub_x (pg, svmla_x (pg, shift, x, d->inv_ln2), shift);
-  svint64_t i = svcvt_s64_x (pg, n);
+  svfloat64_t z = svmla_x (pg, shift, x, d->inv_ln2);
+  svuint64_t u = svreinterpret_u64 (z);
+  svfloat64_t n = svsub_x (pg, z, shift);
   svfloat64_t ln2 = svld1rq (svptrue_b64 (), &d->ln2_hi);
   svfloat64_t f = svmls_lane (x, n, ln2, 0);
   f = svmls_lane (f, n, ln2, 1);
@@ -75,9 +77,9 @@ svfloat64_t SV_NAME_D1 (expm1) (svfloat64_t x, svbool_t pg)
 
   /* Assemble the result.
    expm1(x) ~= 2^i * (p + 1) - 1
-   Let t = 2^i.  */
-  svint64_t u = svadd_x (pg, svlsl_x (pg, i, 52), ExponentBias);
-  svfloat64_t t = svreinterpret_f64 (u);
+   Let t = 2^i, computed using FEXPA with index 0, for which the table entry
+   is exactly 1, and the biased exponent of 2^i in bits 16:6.  */
+  svfloat64_t t = svexpa (svlsl_x (pg, u, 6));
 
   /* expm1(x) ~= p * t + (t - 1).  */
   svfloat64_t y = svmla_x (pg, svsub_x (pg, t, 1), p, t);
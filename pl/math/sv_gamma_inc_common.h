@@ -0,0 +1,347 @@
+/*
+ * Core approximations for double-precision SVE regularised incomplete gamma
+ * functions
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+#ifndef PL_MATH_SV_GAMMA_INC_COMMON_H
+#define PL_MATH_SV_GAMMA_INC_COMMON_H
+
+#include "sv_math.h"
+#include "poly_sve_f64.h"
+#include "sv_pow_inline.h"
+
+/* Same algorithm as v_gamma_inc_common.h, see there for details.  */
+static const struct sv_gamma_inc_consts
+{
+  double stirling_poly[7], lgamma1p_poly[13];
+  double neg_euler_hi, neg_euler_lo, half_ln2pi_hi, half_ln2pi_lo;
+} sv_gamma_inc_consts = {
+  /* B_2k / (2k (2k - 1)) for k = 1, ..., 7.  */
+  .stirling_poly = { 0x1.5555555555555p-4, -0x1.6c16c16c16c17p-9,
+		     0x1.a01a01a01a01ap-11, -0x1.3813813813814p-11,
+		     0x1.b951e2b18ff23p-11, -0x1.f6ab0d9993c7dp-10,
+		     0x1.a41a41a41a41ap-8 },
+  /* (-1)^k zeta(k) / k for k = 2, ..., 14.  */
+  .lgamma1p_poly = { 0x1.a51a6625307d3p-1, -0x1.9a4d55beab2d7p-2,
+		     0x1.151322ac7d848p-2, -0x1.a8b9c17aa6149p-3,
+		     0x1.5b40cb100c306p-3, -0x1.2703a1dcea3aep-3,
+		     0x1.010b36af86397p-3, -0x1.c806706d57db4p-4,
+		     0x1.9a01e385d5f8fp-4, -0x1.748c33114c6d6p-4,
+		     0x1.556ad63243bc4p-4, -0x1.3b1d971fc5985p-4,
+		     0x1.2496df8320c5fp-4 },
+  /* -euler_gamma.  */
+  .neg_euler_hi = -0x1.2788cfc6fb619p-1,
+  .neg_euler_lo = 0x1.6cb90701fbfabp-58,
+  /* log(2 pi) / 2.  */
+  .half_ln2pi_hi = 0x1.d67f1c864beb5p-1,
+  .half_ln2pi_lo = -0x1.65b5a1b7ff5dfp-55,
+};
+
+#define SV_GAMMA_INC_SHIFT 16
+#define SV_GAMMA_INC_EXPM1_TERMS 20
+#define SV_GAMMA_INC_SMALL_TERMS 18
+#define SV_GAMMA_INC_MAX_ITER (1 << 16)
+
+/* s + e = a + b exactly.  */
+static inline svfloat64_t
+sv_two_sum_f64 (svbool_t pg, svfloat64_t a, svfloat64_t b, svfloat64_t *e)
+{
+  svfloat64_t s = svadd_x (pg, a, b);
+  svfloat64_t bb = svsub_x (pg, s, a);
+  *e = svadd_x (pg, svsub_x (pg, a, svsub_x (pg, s, bb)),
+		svsub_x (pg, b, bb));
+  return s;
+}
+
+/* log(x) as hi + *lo for x positive and finite, including subnormals.  */
+static inline svfloat64_t
+sv_log_dd_inline (svbool_t pg, svfloat64_t x, svfloat64_t *lo)
+{
+  svuint64_t ix = svreinterpret_u64 (x);
+  svbool_t sub = svcmplt (pg, x, 0x1p-1022);
+  if (unlikely (svptest_any (pg, sub)))
+    {
+      /* Normalize subnormal x so exponent becomes negative, as in pow.  */
+      svuint64_t in = svreinterpret_u64 (svmul_x (sub, x, 0x1p52));
+      ix = svsel (sub, svsub_x (sub, in, 52ULL << 52), ix);
+    }
+  return sv_pow_log_inline (pg, ix, lo);
+}
+
+/* lgamma(ah + al) as hi + *lo, for ah > 0 finite and |al| <= ulp(ah).  */
+static inline svfloat64_t
+sv_lgamma_dd_inline (svbool_t pg, svfloat64_t ah, svfloat64_t al,
+		     svfloat64_t *lo, const struct sv_gamma_inc_consts *d)
+{
+  /* lgamma(a) = lgamma(z) - log(a (a + 1) ... (a + n - 1)), with z = a + n
+     and n = ceil(16 - a).  */
+  svfloat64_t n = svmaxnm_x (
+      pg, svrintp_x (pg, svsubr_x (pg, ah, SV_GAMMA_INC_SHIFT)), 0.0);
+  svfloat64_t ph = sv_f64 (1), pl = sv_f64 (0);
+  for (int k = 0; k < SV_GAMMA_INC_SHIFT; k++)
+    {
+      svbool_t m = svcmpgt (pg, n, k);
+      if (!svptest_any (pg, m))
+	break;
+      svfloat64_t tl, th = sv_two_sum_f64 (m, ah, sv_f64 (k), &tl);
+      th = svsel (m, th, sv_f64 (1));
+      tl = svsel (m, svadd_x (m, tl, al), sv_f64 (0));
+      svfloat64_t h = svmul_x (pg, ph, th);
+      svfloat64_t e = svnmls_x (pg, h, ph, th);
+      e = svmla_x (pg, svmla_x (pg, e, ph, tl), pl, th);
+      ph = svadd_x (pg, h, e);
+      pl = svsub_x (pg, e, svsub_x (pg, ph, h));
+    }
+
+  /* Stirling's series for z >= 16,
+     lgamma(z) = (z - 1/2) log(z) - z + log(2 pi) / 2 + S(1/z).  */
+  svfloat64_t zl, zh = sv_two_sum_f64 (pg, ah, n, &zl);
+  zl = svadd_x (pg, zl, al);
+  svfloat64_t lzl, lzh = sv_log_dd_inline (pg, zh, &lzl);
+  lzl = svadd_x (pg, lzl, svdiv_x (pg, zl, zh));
+  svfloat64_t m = svsub_x (pg, zh, 0.5);
+  svfloat64_t hi = svmul_x (pg, m, lzh);
+  svfloat64_t l = svnmls_x (pg, hi, m, lzh);
+  l = svmla_x (pg, svmla_x (pg, l, m, lzl), zl, lzh);
+  svfloat64_t e;
+  hi = sv_two_sum_f64 (pg, hi, svneg_x (pg, zh), &e);
+  l = svadd_x (pg, l, svsub_x (pg, e, zl));
+  hi = sv_two_sum_f64 (pg, hi, sv_f64 (d->half_ln2pi_hi), &e);
+  l = svadd_x (pg, l, svadd_x (pg, e, d->half_ln2pi_lo));
+  svfloat64_t iz = svdivr_x (pg, zh, 1.0);
+  svfloat64_t s = svmul_x (
+      pg, iz, sv_horner_6_f64_x (pg, svmul_x (pg, iz, iz), d->stirling_poly));
+  l = svadd_x (pg, l, s);
+
+  svfloat64_t lpl, lph = sv_log_dd_inline (pg, ph, &lpl);
+  lpl = svadd_x (pg, lpl, svdiv_x (pg, pl, ph));
+  hi = sv_two_sum_f64 (pg, hi, svneg_x (pg, lph), &e);
+  l = svsub_x (pg, svadd_x (pg, l, e), lpl);
+  return sv_two_sum_f64 (pg, hi, l, lo);
+}
+
+/* -expm1(t) - (1 + expm1(t)) a S(a, x), with t = th + tl, which is Q(a, x)
+   for small a and x < 0.75, see v_gamma_q_small_a.  */
+static inline svfloat64_t
+sv_gamma_q_small_a (svbool_t pg, svfloat64_t a, svfloat64_t x, svfloat64_t th,
+		    svfloat64_t tl)
+{
+  svfloat64_t e;
+  /* expm1(t) = t + t^2 (1/2 + t/6 + ...), with the leading term exact.  */
+  svfloat64_t p = sv_f64 (1);
+  for (int k = SV_GAMMA_INC_EXPM1_TERMS; k >= 3; k--)
+    p = svmla_x (pg, sv_f64 (1), p, svmul_x (pg, th, 1.0 / k));
+  svfloat64_t t2 = svmul_x (pg, th, th);
+  svfloat64_t t2l = svnmls_x (pg, t2, th, th);
+  p = svmul_x (pg, p, 0.5);
+  svfloat64_t em1 = sv_two_sum_f64 (pg, th, svmul_x (pg, t2, p), &e);
+  svfloat64_t em1l = svmla_x (pg, e, t2l, p);
+  em1l = svmla_x (pg, em1l, tl, svadd_x (pg, em1, 1.0));
+
+  /* S = sum_n (-x)^n / (n! (a + n)) for n >= 1, with corrected ratios
+     1 / (a + n) and the leading term as a double-double.  */
+  svfloat64_t s
+      = svdivr_x (pg, svadd_x (pg, a, SV_GAMMA_INC_SMALL_TERMS), 1.0);
+  for (int k = SV_GAMMA_INC_SMALL_TERMS - 1; k >= 2; k--)
+    {
+      svfloat64_t akl, akh = sv_two_sum_f64 (pg, a, sv_f64 (k), &akl);
+      svfloat64_t r = svdivr_x (pg, akh, 1.0);
+      r = svmls_x (pg, r, svmul_x (pg, r, r), akl);
+      s = svmls_x (pg, r, svmul_x (pg, x, 1.0 / (k + 1)), s);
+    }
+  svfloat64_t akl, akh = sv_two_sum_f64 (pg, a, sv_f64 (1), &akl);
+  svfloat64_t r = svdivr_x (pg, akh, 1.0);
+  svfloat64_t rl = svmls_x (pg, svmls_x (pg, sv_f64 (1), r, akh), r, akl);
+  rl = svdiv_x (pg, rl, akh);
+  svfloat64_t hx = svmul_x (pg, x, 0.5);
+  svfloat64_t u = svmul_x (pg, hx, s);
+  svfloat64_t ul = svnmls_x (pg, u, hx, s);
+  s = sv_two_sum_f64 (pg, r, svneg_x (pg, u), &e);
+  svfloat64_t sl = svsub_x (pg, svadd_x (pg, e, rl), ul);
+
+  /* -a S = a x s = m + ml, with a x split exactly.  */
+  svfloat64_t ax = svmul_x (pg, a, x);
+  svfloat64_t axl = svnmls_x (pg, ax, a, x);
+  svfloat64_t m = svmul_x (pg, ax, s);
+  svfloat64_t ml = svnmls_x (pg, m, ax, s);
+  ml = svmla_x (pg, svmla_x (pg, ml, ax, sl), axl, s);
+
+  /* (1 + em1) (m + ml) - em1.  */
+  svfloat64_t y = sv_two_sum_f64 (pg, m, svneg_x (pg, em1), &e);
+  svfloat64_t yl = svsub_x (pg, svadd_x (pg, e, ml), em1l);
+  yl = svmla_x (pg, yl, em1, svadd_x (pg, m, ml));
+  return svadd_x (pg, y, yl);
+}
+
+/* P(a, x), or Q(a, x) if upper is set, for a and x positive and finite.  */
+static inline svfloat64_t
+sv_gamma_inc_inline (svbool_t pg, svfloat64_t a, svfloat64_t x, int upper,
+		     double eps, int max_iter,
+		     const struct sv_gamma_inc_consts *d)
+{
+  /* prefix = x^a e^-x / Gamma(a).  */
+  svfloat64_t gl, gh = sv_lgamma_dd_inline (pg, a, sv_f64 (0), &gl, d);
+  svfloat64_t lxl, lxh = sv_log_dd_inline (pg, x, &lxl);
+  svfloat64_t alh = svmul_x (pg, a, lxh);
+  svfloat64_t all = svmla_x (pg, svnmls_x (pg, alh, a, lxh), a, lxl);
+  svfloat64_t e, lo = all;
+  svfloat64_t hi = sv_two_sum_f64 (pg, alh, svneg_x (pg, x), &e);
+  lo = svadd_x (pg, lo, e);
+  hi = sv_two_sum_f64 (pg, hi, svneg_x (pg, gh), &e);
+  lo = svsub_x (pg, svadd_x (pg, lo, e), gl);
+  hi = sv_two_sum_f64 (pg, hi, lo, &lo);
+  svfloat64_t prefix = sv_pow_exp_inline (pg, hi, lo, sv_u64 (0));
+
+  /* The continued fraction is used for x >= max (a, 0.75), the separate
+     series for Q with small a and x < 0.75 where it is accurate, and the
+     series of P otherwise.  */
+  svbool_t cf = svcmpge (svcmpge (pg, x, 0.75), x, a);
+  svbool_t small = svpfalse ();
+  if (upper)
+    {
+      svbool_t tiny_x = svcmplt (pg, x, 0.5);
+      small = svsel (tiny_x, svcmpge (pg, alh, -0.8), svcmple (pg, a, x));
+      small = svbic_z (pg, small, cf);
+    }
+  svbool_t series = svnor_z (pg, cf, small);
+  svfloat64_t ys = sv_f64 (0), yc = sv_f64 (0), yq = sv_f64 (0);
+
+  /* Forward passes find the number of terms needed in each lane, then the
+     series and the continued fraction are summed backwards.  */
+  if (svptest_any (pg, series))
+    {
+      /* P = prefix / a * (1 + x / (a + 1) (1 + x / (a + 2) (1 + ...))).  */
+      svfloat64_t t = sv_f64 (1), sum = sv_f64 (1), an = a;
+      svbool_t active = series;
+      int n = 0;
+      while (n < max_iter && svptest_any (pg, active))
+	{
+	  n++;
+	  an = svadd_x (series, an, 1.0);
+	  t = svmul_x (series, t, svdiv_x (series, x, an));
+	  sum = svadd_x (series, sum, t);
+	  active = svcmpgt (active, t, svmul_x (series, sum, eps));
+	}
+      /* The ratios x / (a + n) are corrected for the rounding error of
+	 a + n.  1/x is kept finite for subnormal x, where the correction is
+	 negligible.  */
+      svfloat64_t s = sv_f64 (1);
+      svfloat64_t ix = svdivr_x (series, svmax_x (series, x, 0x1p-1022), 1.0);
+      for (; n > 0; n--)
+	{
+	  svfloat64_t ahl, ah = sv_two_sum_f64 (series, a, sv_f64 (n), &ahl);
+	  svfloat64_t r = svdiv_x (series, x, ah);
+	  r = svmls_x (series, r, r,
+		       svmul_x (series, svmul_x (series, ahl, r), ix));
+	  s = svmla_x (series, sv_f64 (1), s, r);
+	}
+      ys = svmul_x (series, prefix, svdiv_x (series, s, a));
+    }
+
+  if (svptest_any (pg, cf))
+    {
+      /* Q = prefix / (b_0 + a_1 / (b_1 + a_2 / (b_2 + ...))), with
+	 a_i = i (a - i) and b_i = x - a + 2i + 1, using the modified Lentz
+	 algorithm and the differences w_i between successive convergents
+	 for the convergence test.  */
+      double cf_eps = eps * 0x1p-8;
+      svfloat64_t b = svsub_x (cf, svadd_x (cf, x, 1.0), a);
+      svfloat64_t dn = svdivr_x (cf, b, 1.0);
+      svfloat64_t c = sv_f64 (0x1p1000), h = dn, w = dn;
+      svbool_t active = cf;
+      int n = 0;
+      while (n < max_iter && svptest_any (pg, active))
+	{
+	  n++;
+	  double fn = n;
+	  svfloat64_t an = svmul_x (cf, svsub_x (cf, a, fn), fn);
+	  b = svadd_x (cf, b, 2.0);
+	  w = svmul_x (cf, w, svmul_x (cf, an, dn));
+	  dn = svdivr_x (cf, svmla_x (cf, b, an, dn), 1.0);
+	  c = svadd_x (cf, b, svdiv_x (cf, an, c));
+	  h = svmul_x (cf, h, svmul_x (cf, dn, c));
+	  w = svmul_x (cf, w, dn);
+	  active = svacgt (active, w, svmul_x (cf, h, cf_eps));
+	}
+      svfloat64_t xa = svsub_x (cf, x, a), t = sv_f64 (0);
+      for (; n > 0; n--)
+	{
+	  double fn = n;
+	  svfloat64_t an = svmul_x (cf, svsub_x (cf, a, fn), fn);
+	  t = svdiv_x (
+	      cf, an, svadd_x (cf, svadd_x (cf, xa, (double) (2 * n + 1)), t));
+	}
+      yc = svdiv_x (cf, prefix, svadd_x (cf, svadd_x (cf, xa, 1.0), t));
+    }
+
+  if (upper && svptest_any (pg, small))
+    {
+      /* t = log(x^a / Gamma(1 + a)) as a double-double, with the Taylor
+	 series of lgamma(1 + a) for a < 1/16.  */
+      svfloat64_t al, ah = sv_two_sum_f64 (small, sv_f64 (1), a, &al);
+      gh = sv_lgamma_dd_inline (small, ah, al, &gl, d);
+      svbool_t tiny_a = svcmplt (small, a, 0x1p-4);
+      if (svptest_any (small, tiny_a))
+	{
+	  svfloat64_t a2 = svmul_x (tiny_a, a, a);
+	  svfloat64_t p = svmul_x (
+	      tiny_a, a2,
+	      sv_pw_horner_12_f64_x (tiny_a, a, a2, d->lgamma1p_poly));
+	  svfloat64_t th = svmul_x (tiny_a, a, d->neg_euler_hi);
+	  svfloat64_t tl = svnmls_x (tiny_a, th, a, d->neg_euler_hi);
+	  tl = svadd_x (tiny_a, tl, svmla_x (tiny_a, p, a, d->neg_euler_lo));
+	  gh = svsel (tiny_a, th, gh);
+	  gl = svsel (tiny_a, tl, gl);
+	}
+      lo = all;
+      hi = sv_two_sum_f64 (small, alh, svneg_x (small, gh), &e);
+      lo = svsub_x (small, svadd_x (small, lo, e), gl);
+      hi = sv_two_sum_f64 (small, hi, lo, &lo);
+      yq = sv_gamma_q_small_a (small, a, x, hi, lo);
+    }
+
+  if (upper)
+    return svsel (cf, yc,
+		  svsel (small, yq, svsubr_x (pg, ys, 1.0)));
+  return svsel (cf, svsubr_x (pg, yc, 1.0), ys);
+}
+
+/* Results for lanes where a or x is not positive and finite: P(a, 0) = 0,
+   P(a, inf) = 1 and P(inf, x) = 0, and NaN for invalid arguments.  */
+static inline svfloat64_t
+sv_gamma_inc_special (svbool_t pg, svfloat64_t a, svfloat64_t x, int upper)
+{
+  svbool_t xinf = svcmpeq (pg, x, INFINITY);
+  svbool_t valid = svcmpge (svcmpgt (pg, a, 0.0), x, 0.0);
+  valid = svbic_z (pg, valid, svcmpeq (xinf, a, INFINITY));
+  svfloat64_t y = svsel (xinf, sv_f64 (1), sv_f64 (0));
+  if (upper)
+    y = svsubr_x (pg, y, 1.0);
+  return svsel (valid, y, sv_f64 (NAN));
+}
+
+/* P(a, x) or Q(a, x) for any a and x.  */
+static inline svfloat64_t
+sv_gamma_inc (svbool_t pg, svfloat64_t a, svfloat64_t x, int upper,
+	      double eps, int max_iter)
+{
+  const struct sv_gamma_inc_consts *d = ptr_barrier (&sv_gamma_inc_consts);
+  /* Lanes where a or x is zero, negative, infinite or NaN.  */
+  svbool_t special = svorr_z (
+      pg,
+      svcmpge (pg, svsub_x (pg, svreinterpret_u64 (a), 1),
+	       0x7fefffffffffffff),
+      svcmpge (pg, svsub_x (pg, svreinterpret_u64 (x), 1),
+	       0x7fefffffffffffff));
+  if (likely (!svptest_any (pg, special)))
+    return sv_gamma_inc_inline (pg, a, x, upper, eps, max_iter, d);
+  /* Replace special lanes with arguments which converge immediately.  */
+  svfloat64_t y = sv_gamma_inc_inline (pg, svsel (special, sv_f64 (1), a),
+				       svsel (special, sv_f64 (1), x), upper,
+				       eps, max_iter, d);
+  return svsel (special, sv_gamma_inc_special (pg, a, x, upper), y);
+}
+
+#endif
@@ -0,0 +1,31 @@
+/*
+ * Double-precision SVE regularised upper incomplete gamma function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_gamma_inc_common.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+/* SVE approximation for the regularised upper incomplete gamma function
+   Q(a, x), see v_gamma_inc_common.h.  The error grows slowly with a,
+   from 5.3 ULP for a < 100 to 7.17 ULP for a < 1000, close to x = a:
+   _ZGVsMxvv_gamma_q(0x1.e64b4742a4969p+9, 0x1.e62e88cbd85d1p+9)
+     got 0x1.fe9341df1d1aep-2
+    want 0x1.fe9341df1d1a7p-2.  */
+svfloat64_t SV_NAME_D2 (gamma_q) (svfloat64_t a, svfloat64_t x,
+				    const svbool_t pg)
+{
+  return sv_gamma_inc (pg, a, x, 1, 0x1p-54, SV_GAMMA_INC_MAX_ITER);
+}
+
+PL_SIG (SV, D, 2, gamma_q, 0.1, 10.0)
+PL_TEST_ULP (SV_NAME_D2 (gamma_q), 6.7)
+PL_TEST_INTERVAL2 (SV_NAME_D2 (gamma_q), 0x1p-10, 1, 0, 0x1p-10, 10000)
+PL_TEST_INTERVAL2 (SV_NAME_D2 (gamma_q), 0x1p-10, 1, 0x1p-10, 4, 100000)
+PL_TEST_INTERVAL2 (SV_NAME_D2 (gamma_q), 1, 10, 0, 20, 100000)
+PL_TEST_INTERVAL2 (SV_NAME_D2 (gamma_q), 10, 100, 0, 200, 100000)
+PL_TEST_INTERVAL2 (SV_NAME_D2 (gamma_q), 100, 1000, 50, 2000, 10000)
+PL_TEST_INTERVAL2 (SV_NAME_D2 (gamma_q), 0x1p-10, 100, 100, inf, 10000)
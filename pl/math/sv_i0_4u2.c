@@ -0,0 +1,28 @@
+/*
+ * Double-precision SVE i0(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_bessel_common.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+/* SVE approximation for the double-precision modified Bessel function of the
+   first kind of order 0, see sv_bessel_common.h.
+   Maximum measured error is 4.13 ULP:
+   _ZGVsMxv_i0(0x1.23122a38702a4p+9) got 0x1.e9830b3d97f7p+833
+				     want 0x1.e9830b3d97f6cp+833.  */
+svfloat64_t SV_NAME_D1 (i0) (svfloat64_t x, const svbool_t pg)
+{
+  const struct sv_bessel_consts *d = ptr_barrier (&sv_bessel_consts);
+  svfloat64_t y = sv_bessel_i_inline (pg, svabs_x (pg, x), 0, d);
+  return y;
+}
+
+PL_SIG (SV, D, 1, i0, -10.0, 10.0)
+PL_TEST_ULP (SV_NAME_D1 (i0), 3.69)
+PL_TEST_SYM_INTERVAL (SV_NAME_D1 (i0), 0, 16, 100000)
+PL_TEST_SYM_INTERVAL (SV_NAME_D1 (i0), 16, 0x1.65p9, 100000)
+PL_TEST_SYM_INTERVAL (SV_NAME_D1 (i0), 0x1.65p9, inf, 1000)
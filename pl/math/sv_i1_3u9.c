@@ -0,0 +1,31 @@
+/*
+ * Double-precision SVE i1(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_bessel_common.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+/* SVE approximation for the double-precision modified Bessel function of the
+   first kind of order 1, see sv_bessel_common.h.
+   Maximum measured error is 3.85 ULP:
+   _ZGVsMxv_i1(0x1.2cce28851423cp+9) got 0x1.ff2b18390b9dp+861
+				     want 0x1.ff2b18390b9ccp+861.  */
+svfloat64_t SV_NAME_D1 (i1) (svfloat64_t x, const svbool_t pg)
+{
+  const struct sv_bessel_consts *d = ptr_barrier (&sv_bessel_consts);
+  svfloat64_t y = sv_bessel_i_inline (pg, svabs_x (pg, x), 1, d);
+  /* i1 is odd.  */
+  svuint64_t sign = svand_x (pg, svreinterpret_u64 (x), 0x8000000000000000);
+  y = svreinterpret_f64 (sveor_x (pg, svreinterpret_u64 (y), sign));
+  return y;
+}
+
+PL_SIG (SV, D, 1, i1, -10.0, 10.0)
+PL_TEST_ULP (SV_NAME_D1 (i1), 3.40)
+PL_TEST_SYM_INTERVAL (SV_NAME_D1 (i1), 0, 16, 100000)
+PL_TEST_SYM_INTERVAL (SV_NAME_D1 (i1), 16, 0x1.65p9, 100000)
+PL_TEST_SYM_INTERVAL (SV_NAME_D1 (i1), 0x1.65p9, inf, 1000)
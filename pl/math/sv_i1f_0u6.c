@@ -0,0 +1,39 @@
+/*
+ * Single-precision SVE i1(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_bessel_common.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+/* SVE approximation for the single-precision modified Bessel function of
+   the first kind of order 1, see sv_bessel_common.h.  The input is widened
+   and the double-precision approximation used, so the result is correctly
+   rounded except in rare double rounding cases.  Maximum measured error is
+   0.50 ULP.  */
+svfloat32_t SV_NAME_F1 (i1) (svfloat32_t x, const svbool_t pg)
+{
+  const struct sv_bessel_consts *d = ptr_barrier (&sv_bessel_consts);
+  svfloat32_t ax = svabs_x (pg, x);
+
+  /* Widen to double precision, which the core approximation needs anyway for
+     the phase, and evaluate on both halves of the vector.  */
+  svfloat64_t lo
+      = sv_bessel_i_inline (svunpklo (pg), sv_widen_lo_f32 (ax), 1, d);
+  svfloat64_t hi
+      = sv_bessel_i_inline (svunpkhi (pg), sv_widen_hi_f32 (ax), 1, d);
+  svfloat32_t y = sv_narrow_f64 (lo, hi);
+  /* i1f is odd.  */
+  svuint32_t sign = svand_x (pg, svreinterpret_u32 (x), 0x80000000);
+  y = svreinterpret_f32 (sveor_x (pg, svreinterpret_u32 (y), sign));
+  return y;
+}
+
+PL_SIG (SV, F, 1, i1, -10.0, 10.0)
+PL_TEST_ULP (SV_NAME_F1 (i1), 0.01)
+PL_TEST_SYM_INTERVAL (SV_NAME_F1 (i1), 0, 16, 100000)
+PL_TEST_SYM_INTERVAL (SV_NAME_F1 (i1), 16, 0x1.7p6, 100000)
+PL_TEST_SYM_INTERVAL (SV_NAME_F1 (i1), 0x1.7p6, inf, 1000)
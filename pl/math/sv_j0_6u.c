@@ -0,0 +1,45 @@
+/*
+ * Double-precision SVE j0(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_bessel_common.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+static svfloat64_t NOINLINE
+special_case (svfloat64_t x, svfloat64_t y, svbool_t special)
+{
+  return sv_call_f64 (j0, x, y, special);
+}
+
+/* SVE approximation for the double-precision Bessel function of the first kind
+   of order 0, see sv_bessel_common.h.
+   Maximum measured error away from the zeros above 16 is 5.98 ULP:
+   _ZGVsMxv_j0(0x1.dd2c888dbe35bp+7) got 0x1.e564dad0ebfc2p-6
+				     want 0x1.e564dad0ebfc8p-6.
+   Close to those zeros the absolute error is below 2^-66.5 sqrt(2/(pi x)),
+   so the error in ULP is unbounded:
+   _ZGVsMxv_j0(0x1.212313f8a19f6p+4) got 0x1.a212680e2cfdp-53
+				     want 0x1.a2122af76659ep-53.  */
+svfloat64_t SV_NAME_D1 (j0) (svfloat64_t x, const svbool_t pg)
+{
+  const struct sv_bessel_consts *d = ptr_barrier (&sv_bessel_consts);
+  svfloat64_t ax = svabs_x (pg, x);
+  /* No argument reduction for the phase above 2^23, including infinity.  */
+  svbool_t special = svcmpge (pg, ax, d->range_val);
+
+  svfloat64_t y = sv_bessel_j_inline (pg, ax, 0, d);
+
+  if (unlikely (svptest_any (pg, special)))
+    return special_case (x, y, special);
+  return y;
+}
+
+PL_SIG (SV, D, 1, j0, -10.0, 10.0)
+PL_TEST_ULP (SV_NAME_D1 (j0), 5.54)
+PL_TEST_SYM_INTERVAL (SV_NAME_D1 (j0), 0, 16, 100000)
+PL_TEST_SYM_INTERVAL (SV_NAME_D1 (j0), 16, 0x1p23, 100000)
+PL_TEST_SYM_INTERVAL (SV_NAME_D1 (j0), 0x1p23, inf, 1000)
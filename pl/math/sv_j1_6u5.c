@@ -0,0 +1,48 @@
+/*
+ * Double-precision SVE j1(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_bessel_common.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+static svfloat64_t NOINLINE
+special_case (svfloat64_t x, svfloat64_t y, svbool_t special)
+{
+  return sv_call_f64 (j1, x, y, special);
+}
+
+/* SVE approximation for the double-precision Bessel function of the first kind
+   of order 1, see sv_bessel_common.h.
+   Maximum measured error away from the zeros above 16 is 6.34 ULP:
+   _ZGVsMxv_j1(0x1.8b6012360b2aap+21) got 0x1.fdab118e63d5p-13
+				      want 0x1.fdab118e63d56p-13.
+   Close to those zeros the absolute error is below 2^-65.5 sqrt(2/(pi x)),
+   so the error in ULP is unbounded:
+   _ZGVsMxv_j1(0x1.0787b360508c4p+4) got 0x1.b6001feb8d2dfp-52
+				     want 0x1.b5ffd9d9e72bp-52.  */
+svfloat64_t SV_NAME_D1 (j1) (svfloat64_t x, const svbool_t pg)
+{
+  const struct sv_bessel_consts *d = ptr_barrier (&sv_bessel_consts);
+  svfloat64_t ax = svabs_x (pg, x);
+  /* No argument reduction for the phase above 2^23, including infinity.  */
+  svbool_t special = svcmpge (pg, ax, d->range_val);
+
+  svfloat64_t y = sv_bessel_j_inline (pg, ax, 1, d);
+  /* j1 is odd.  */
+  svuint64_t sign = svand_x (pg, svreinterpret_u64 (x), 0x8000000000000000);
+  y = svreinterpret_f64 (sveor_x (pg, svreinterpret_u64 (y), sign));
+
+  if (unlikely (svptest_any (pg, special)))
+    return special_case (x, y, special);
+  return y;
+}
+
+PL_SIG (SV, D, 1, j1, -10.0, 10.0)
+PL_TEST_ULP (SV_NAME_D1 (j1), 5.90)
+PL_TEST_SYM_INTERVAL (SV_NAME_D1 (j1), 0, 16, 100000)
+PL_TEST_SYM_INTERVAL (SV_NAME_D1 (j1), 16, 0x1p23, 100000)
+PL_TEST_SYM_INTERVAL (SV_NAME_D1 (j1), 0x1p23, inf, 1000)
@@ -0,0 +1,50 @@
+/*
+ * Helper for SVE double-precision routines which calculate log(x) and do not
+ * need special-case handling
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+#ifndef PL_MATH_SV_LOG_INLINE_H
+#define PL_MATH_SV_LOG_INLINE_H
+
+#include "sv_math.h"
+
+/* Same algorithm as SVE log, without the special-case handling, so only valid
+   for positive normal finite x.  */
+static inline svfloat64_t
+sv_log_inline (svbool_t pg, svfloat64_t x)
+{
+  svuint64_t ix = svreinterpret_u64 (x);
+
+  /* x = 2^k z; where z is in range [Off,2*Off) and exact.
+     The range is split into N subintervals.
+     The ith subinterval contains z and c is near its center.  */
+  svuint64_t tmp = svsub_x (pg, ix, 0x3fe6900900000000);
+  /* Calculate table index = (tmp >> (52 - V_LOG_TABLE_BITS)) % N.
+     The actual value of i is double this due to table layout.  */
+  svuint64_t i = svand_x (pg, svlsr_x (pg, tmp, (51 - V_LOG_TABLE_BITS)),
+			  ((1 << V_LOG_TABLE_BITS) - 1) << 1);
+  svint64_t k = svasr_x (pg, svreinterpret_s64 (tmp), 52);
+  svuint64_t iz = svsub_x (pg, ix, svand_x (pg, tmp, 0xfffULL << 52));
+  svfloat64_t z = svreinterpret_f64 (iz);
+  svfloat64_t invc = svld1_gather_index (pg, &__v_log_data.table[0].invc, i);
+  svfloat64_t logc = svld1_gather_index (pg, &__v_log_data.table[0].logc, i);
+
+  /* log(x) = log1p(z/c-1) + log(c) + k*Ln2.  */
+  svfloat64_t r = svmad_x (pg, invc, z, -1);
+  svfloat64_t kd = svcvt_f64_x (pg, k);
+  /* hi = r + log(c) + k*Ln2.  */
+  svfloat64_t hi = svmla_x (pg, svadd_x (pg, logc, r), kd, __v_log_data.ln2);
+  /* y = r2*(A0 + r*A1 + r2*(A2 + r*A3 + r2*A4)) + hi.  */
+  svfloat64_t r2 = svmul_x (pg, r, r);
+  svfloat64_t y = svmla_x (pg, sv_f64 (__v_log_data.poly[2]), r,
+			   __v_log_data.poly[3]);
+  svfloat64_t p = svmla_x (pg, sv_f64 (__v_log_data.poly[0]), r,
+			   __v_log_data.poly[1]);
+  y = svmla_x (pg, y, r2, __v_log_data.poly[4]);
+  y = svmla_x (pg, p, r2, y);
+  return svmla_x (pg, hi, r2, y);
+}
+
+#endif
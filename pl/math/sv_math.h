@@ -1,7 +1,7 @@
 /*
  * Wrapper functions for SVE ACLE.
  *
- * Copyright (c) 2019-2023, Arm Limited.
+ * Copyright (c) 2019-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -128,6 +128,52 @@ sv_call2_f32 (float (*f) (float, float), svfloat32_t x1, svfloat32_t x2,
     }
   return y;
 }
+
+/* Return table[i] for a table of n entries.  If the table fits in one vector
+   register it is loaded contiguously and indexed with TBL, which avoids the
+   gather, and with SVE2 the same is done for tables that fit in two registers
+   with TBL2.  Otherwise, at short vector lengths, fall back to a gather.
+   Active lanes of i must be in [0, n), inactive lanes may be any value.  */
+static inline svfloat32_t
+sv_lookup_f32_x (svbool_t pg, const float *table, uint32_t n, svuint32_t i)
+{
+  uint32_t vl = svcntw ();
+  if (n <= vl)
+    return svtbl (svld1 (svwhilelt_b32_u32 (0, n), table), i);
+# if __ARM_FEATURE_SVE2
+  if (n <= 2 * vl)
+    {
+      svfloat32_t t0 = svld1 (svptrue_b32 (), table);
+      svfloat32_t t1 = svld1_vnum (svwhilelt_b32_u32 (vl, n), table, 1);
+      return svtbl2 (svcreate2 (t0, t1), i);
+    }
+# endif
+  return svld1_gather_index (pg, table, i);
+}
+
+/* Convert the low or high half of x to double precision, and back, for
+   single-precision routines which evaluate a double-precision approximation
+   on each half.  As in sv_powf, all lanes are converted.  */
+static inline svfloat64_t
+sv_widen_lo_f32 (svfloat32_t x)
+{
+  return svcvt_f64_x (svptrue_b64 (),
+		      svreinterpret_f32 (svunpklo (svreinterpret_u32 (x))));
+}
+
+static inline svfloat64_t
+sv_widen_hi_f32 (svfloat32_t x)
+{
+  return svcvt_f64_x (svptrue_b64 (),
+		      svreinterpret_f32 (svunpkhi (svreinterpret_u32 (x))));
+}
+
+static inline svfloat32_t
+sv_narrow_f64 (svfloat64_t lo, svfloat64_t hi)
+{
+  const svbool_t ptrue = svptrue_b64 ();
+  return svuzp1 (svcvt_f32_x (ptrue, lo), svcvt_f32_x (ptrue, hi));
+}
 #endif
 
 #endif
@@ -0,0 +1,239 @@
+/*
+ * Core log and exp approximations shared by double-precision SVE pow and the
+ * SVE routines which need extra precision.
+ *
+ * Copyright (c) 2022-2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+#ifndef PL_MATH_SV_POW_INLINE_H
+#define PL_MATH_SV_POW_INLINE_H
+
+#include "sv_math.h"
+
+/* Defines parameters of the log approximation and scalar fallback.  */
+#include "finite_pow.h"
+
+/* The exp scale is computed by FEXPA, which has a hardwired table of 2^(i/64)
+   for i = 0:63.  */
+#define SvExpN 64
+#define SvSignBias 0x8000000000000000
+#define SvHugeExp 0x409 /* top12(1024.).  */
+
+static const struct sv_pow_data
+{
+  double exp_poly[4];
+  double inv_ln2, ln2_hi, ln2_lo, shift;
+} sv_pow_data = {
+  .exp_poly = { 0x1.fffffffffdbcdp-2, 0x1.555555555444cp-3,
+		0x1.555573c6a9f7dp-5, 0x1.1111266d28935p-7 },
+  .inv_ln2 = 0x1.71547652b82fep+0,
+  .ln2_hi = 0x1.62e42fefa3800p-1,
+  .ln2_lo = 0x1.ef35793c76730p-45,
+  /* 1.5*2^46+1023, see sv_exp_1u5.c.  */
+  .shift = 0x1.800000000ffc0p+46,
+};
+
+/* Top 12 bits (sign and exponent of each double float lane).  */
+static inline svuint64_t
+sv_top12 (svfloat64_t x)
+{
+  return svlsr_x (svptrue_b64 (), svreinterpret_u64 (x), 52);
+}
+
+/* Handle cases that may overflow or underflow when computing the result that
+   is scale*(1+TMP) without intermediate rounding.  The bit representation of
+   scale is in SBITS, however it has a computed exponent that may have
+   overflown into the sign bit so that needs to be adjusted before using it as
+   a double.  (int32_t)KI is the k used in the argument reduction and exponent
+   adjustment of scale, positive k here means the result may overflow and
+   negative k means the result may underflow.  */
+static inline double
+specialcase (double tmp, uint64_t sbits, uint64_t ki)
+{
+  double scale;
+  if ((ki & 0x80000000) == 0)
+    {
+      /* k > 0, the exponent of scale might have overflowed by <= 460.  */
+      sbits -= 1009ull << 52;
+      scale = asdouble (sbits);
+      return 0x1p1009 * (scale + scale * tmp);
+    }
+  /* k < 0, need special care in the subnormal range.  */
+  sbits += 1022ull << 52;
+  /* Note: sbits is signed scale.  */
+  scale = asdouble (sbits);
+  double y = scale + scale * tmp;
+  return 0x1p-1022 * y;
+}
+
+/* Scalar fallback for special cases of SVE pow's exp.  */
+static inline svfloat64_t
+sv_call_specialcase (svfloat64_t x1, svuint64_t u1, svuint64_t u2,
+		     svfloat64_t y, svbool_t cmp)
+{
+  svbool_t p = svpfirst (cmp, svpfalse ());
+  while (svptest_any (cmp, p))
+    {
+      double sx1 = svclastb (p, 0, x1);
+      uint64_t su1 = svclastb (p, 0, u1);
+      uint64_t su2 = svclastb (p, 0, u2);
+      double elem = specialcase (sx1, su1, su2);
+      svfloat64_t y2 = sv_f64 (elem);
+      y = svsel (p, y2, y);
+      p = svpnext_b64 (cmp, p);
+    }
+  return y;
+}
+
+/* Compute y+TAIL = log(x) where the rounded result is y and TAIL has about
+   additional 15 bits precision.  IX is the bit representation of x, but
+   normalized in the subnormal range using the sign bit for the exponent.  */
+static inline svfloat64_t
+sv_pow_log_inline (svbool_t pg, svuint64_t ix, svfloat64_t *tail)
+{
+  /* x = 2^k z; where z is in range [Off,2*Off) and exact.
+     The range is split into N subintervals.
+     The ith subinterval contains z and c is near its center.  */
+  svuint64_t tmp = svsub_x (pg, ix, Off);
+  svuint64_t i = svand_x (pg, svlsr_x (pg, tmp, 52 - V_POW_LOG_TABLE_BITS),
+			  sv_u64 (N_LOG - 1));
+  svint64_t k = svasr_x (pg, svreinterpret_s64 (tmp), 52);
+  svuint64_t iz = svsub_x (pg, ix, svand_x (pg, tmp, sv_u64 (0xfffULL << 52)));
+  svfloat64_t z = svreinterpret_f64 (iz);
+  svfloat64_t kd = svcvt_f64_x (pg, k);
+
+  /* log(x) = k*Ln2 + log(c) + log1p(z/c-1).  */
+  /* SVE lookup requires 3 separate lookup tables, as opposed to scalar version
+     that uses array of structures. We also do the lookup earlier in the code to
+     make sure it finishes as early as possible.  */
+  svfloat64_t invc = svld1_gather_index (pg, __v_pow_log_data.invc, i);
+  svfloat64_t logc = svld1_gather_index (pg, __v_pow_log_data.logc, i);
+  svfloat64_t logctail = svld1_gather_index (pg, __v_pow_log_data.logctail, i);
+
+  /* Note: 1/c is j/N or j/N/2 where j is an integer in [N,2N) and
+     |z/c - 1| < 1/N, so r = z/c - 1 is exactly representible.  */
+  svfloat64_t r = svmad_x (pg, z, invc, -1.0);
+  /* k*Ln2 + log(c) + r.  */
+  svfloat64_t t1 = svmla_x (pg, logc, kd, __v_pow_log_data.ln2_hi);
+  svfloat64_t t2 = svadd_x (pg, t1, r);
+  svfloat64_t lo1 = svmla_x (pg, logctail, kd, __v_pow_log_data.ln2_lo);
+  svfloat64_t lo2 = svadd_x (pg, svsub_x (pg, t1, t2), r);
+
+  /* Evaluation is optimized assuming superscalar pipelined execution.  */
+  svfloat64_t ar = svmul_x (pg, r, -0.5); /* As[0] = -0.5.  */
+  svfloat64_t ar2 = svmul_x (pg, r, ar);
+  svfloat64_t ar3 = svmul_x (pg, r, ar2);
+  /* k*Ln2 + log(c) + r + As[0]*r*r.  */
+  svfloat64_t hi = svadd_x (pg, t2, ar2);
+  svfloat64_t lo3 = svmla_x (pg, svneg_x (pg, ar2), ar, r);
+  svfloat64_t lo4 = svadd_x (pg, svsub_x (pg, t2, hi), ar2);
+  /* p = log1p(r) - r - As[0]*r*r.  */
+  /* p = (ar3 * (As[1] + r * As[2] + ar2 * (As[3] + r * As[4] + ar2 * (As[5]
+     + r * As[6])))).  */
+  svfloat64_t a56 = svmla_x (pg, sv_f64 (As[5]), r, As[6]);
+  svfloat64_t a34 = svmla_x (pg, sv_f64 (As[3]), r, As[4]);
+  svfloat64_t a12 = svmla_x (pg, sv_f64 (As[1]), r, As[2]);
+  svfloat64_t p = svmla_x (pg, a34, ar2, a56);
+  p = svmla_x (pg, a12, ar2, p);
+  p = svmul_x (pg, ar3, p);
+  svfloat64_t lo = svadd_x (
+      pg, svadd_x (pg, svadd_x (pg, svadd_x (pg, lo1, lo2), lo3), lo4), p);
+  svfloat64_t y = svadd_x (pg, hi, lo);
+  *tail = svadd_x (pg, svsub_x (pg, hi, y), lo);
+  return y;
+}
+
+/* Computes sign*exp(x+xtail) where |xtail| < 2^-8/N and |xtail| <= |x|.
+   The sign_bias argument is SvSignBias or 0 and sets the sign to -1 or 1.
+   The scale 2^(k/N) from FEXPA has no tail, the maximum measured error of
+   the result is about 0.52 ULP.  */
+static inline svfloat64_t
+sv_pow_exp_inline (svbool_t pg, svfloat64_t x, svfloat64_t xtail,
+		   svuint64_t sign_bias)
+{
+  const struct sv_pow_data *d = ptr_barrier (&sv_pow_data);
+  /* 3 types of special cases: tiny (uflow and spurious uflow), huge (oflow)
+     and other cases of large values of x (scale * (1 + TMP) oflow).  */
+  svuint64_t abstop = svand_x (pg, sv_top12 (x), 0x7ff);
+  /* |x| is large (|x| >= 512) or tiny (|x| <= 0x1p-54).  */
+  svbool_t uoflow = svcmpge (pg, svsub_x (pg, abstop, SmallExp), ThresExp);
+
+  /* Conditions special, uflow and oflow are all expressed as uoflow &&
+     something, hence do not bother computing anything if no lane in uoflow is
+     true.  */
+  svbool_t special = svpfalse_b ();
+  svbool_t uflow = svpfalse_b ();
+  svbool_t oflow = svpfalse_b ();
+  if (unlikely (svptest_any (pg, uoflow)))
+    {
+      /* |x| is tiny (|x| <= 0x1p-54).  */
+      uflow = svcmpge (pg, svsub_x (pg, abstop, SmallExp), 0x80000000);
+      uflow = svand_z (pg, uoflow, uflow);
+      /* |x| is huge (|x| >= 1024).  */
+      oflow = svcmpge (pg, abstop, SvHugeExp);
+      oflow = svand_z (pg, uoflow, svbic_z (pg, oflow, uflow));
+      /* For large |x| values (512 < |x| < 1024) scale * (1 + TMP) can overflow
+	 or underflow.  */
+      special = svbic_z (pg, uoflow, svorr_z (pg, uflow, oflow));
+    }
+
+  /* exp(x) = 2^(k/N) * exp(r), with exp(r) in [2^(-1/2N),2^(1/2N)].  */
+  /* x = ln2/N*k + r, with int k and r in [-ln2/2N, ln2/2N].
+     z = Shift + k/N, where bits 5:0 of asuint(z) are k mod N and bits 16:6
+     are the biased exponent of 2^(k/N), as expected by FEXPA.  */
+  svfloat64_t z = svmla_x (pg, sv_f64 (d->shift), x, d->inv_ln2);
+  svuint64_t ki = svreinterpret_u64 (z);
+  /* kd = k/N.  */
+  svfloat64_t kd = svsub_x (pg, z, d->shift);
+  svfloat64_t r = x;
+  r = svmls_x (pg, r, kd, d->ln2_hi);
+  r = svmls_x (pg, r, kd, d->ln2_lo);
+  /* The code assumes 2^-200 < |xtail| < 2^-8/N.  */
+  r = svadd_x (pg, r, xtail);
+  /* exp(x) = 2^(k/N) * exp(r) ~= scale + scale * (exp(r) - 1).  */
+  svfloat64_t r2 = svmul_x (pg, r, r);
+  svfloat64_t p01 = svmla_x (pg, sv_f64 (d->exp_poly[0]), r, d->exp_poly[1]);
+  svfloat64_t p23 = svmla_x (pg, sv_f64 (d->exp_poly[2]), r, d->exp_poly[3]);
+  svfloat64_t tmp = svmla_x (pg, p01, r2, p23);
+  tmp = svmla_x (pg, r, r2, tmp);
+  /* 2^(k/N) ~= scale, only valid when |x| < 512, other lanes are fixed up
+     below.  FEXPA clears the sign bit, so it is set afterwards.  */
+  svuint64_t sbits = svreinterpret_u64 (svexpa (ki));
+  sbits = svorr_x (pg, sbits, sign_bias);
+  svfloat64_t scale = svreinterpret_f64 (sbits);
+  /* Note: tmp == 0 or |tmp| > 2^-200 and scale > 2^-739, so there
+     is no spurious underflow here even without fma.  */
+  z = svmla_x (pg, scale, scale, tmp);
+
+  /* Update result with special and large cases.  */
+  if (unlikely (svptest_any (pg, special)))
+    {
+      /* The exponent of scale is out of range for FEXPA, so rebuild sbits
+	 with a computed exponent that may overflow into the sign bit, as
+	 expected by specialcase.  Removing the 1023 bias from ki leaves k in
+	 the low 32 bits, the bits of Shift above do not affect the result.  */
+      svuint64_t k = svsub_x (pg, ki, 0x3ff << 6);
+      svuint64_t t = svorr_x (pg, svand_x (pg, k, SvExpN - 1), 0x3ff << 6);
+      sbits = svreinterpret_u64 (svexpa (t));
+      svuint64_t top = svreinterpret_u64 (
+	  svlsl_x (pg, svasr_x (pg, svreinterpret_s64 (k), 6), 52));
+      sbits = svadd_x (pg, sbits, svadd_x (pg, top, sign_bias));
+      z = sv_call_specialcase (tmp, sbits, k, z, special);
+    }
+
+  /* Handle underflow and overflow.  */
+  svuint64_t sign_bit = svlsr_x (pg, svreinterpret_u64 (x), 63);
+  svbool_t x_is_neg = svcmpne (pg, sign_bit, 0);
+  svfloat64_t res_uoflow = svsel (x_is_neg, sv_f64 (0.0), sv_f64 (INFINITY));
+  res_uoflow = svreinterpret_f64 (
+      svorr_x (pg, svreinterpret_u64 (res_uoflow), sign_bias));
+  z = svsel (oflow, res_uoflow, z);
+  /* Avoid spurious underflow for tiny x.  */
+  svfloat64_t res_spurious_uflow
+      = svreinterpret_f64 (svorr_x (pg, sign_bias, 0x3ff0000000000000));
+  z = svsel (uflow, res_spurious_uflow, z);
+
+  return z;
+}
+
+#endif
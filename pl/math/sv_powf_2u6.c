@@ -1,7 +1,7 @@
 /*
  * Single-precision SVE powf function.
  *
- * Copyright (c) 2023, Arm Limited.
+ * Copyright (c) 2023-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -13,9 +13,10 @@
    and special case detection.  */
 #define Tinvc __v_powf_data.invc
 #define Tlogc __v_powf_data.logc
-#define Texp __v_powf_data.scale
 #define SignBias (1 << (V_POWF_EXP2_TABLE_BITS + 11))
-#define Shift 0x1.8p52
+/* 1.5*2^52 + 1023*N, such that the low bits of asuint(Shift + k) are
+   k + 1023*N.  */
+#define Shift 0x1.8000000007fe0p52
 #define Norm 0x1p23f /* 0x4b000000.  */
 
 /* Overall ULP error bound for pow is 2.6 ulp
@@ -184,11 +185,14 @@ sv_powf_core_ext (const svbool_t pg, svuint64_t i, svfloat64_t z, svint64_t k,
 
   r = svsub_x (pg, *pylogx, kd);
 
-  /* exp2(x) = 2^(k/N) * 2^r ~= s * (C0*r^3 + C1*r^2 + C2*r + 1).  */
-  svuint64_t t
-      = svld1_gather_index (pg, Texp, svand_x (pg, ki, V_POWF_EXP2_N - 1));
-  svuint64_t ski = svadd_x (pg, ki, sign_bias);
-  t = svadd_x (pg, t, svlsl_x (pg, ski, 52 - V_POWF_EXP2_TABLE_BITS));
+  /* exp2(x) = 2^(k/N) * 2^r ~= s * (C0*r^3 + C1*r^2 + C2*r + 1).
+     s is computed by FEXPA, whose table of 2^(i/64) contains 2^(i/N) at
+     even indices: bits 5:0 of ki << 1 hold 2 * (k mod N) and bits 16:6 hold
+     the biased exponent k/N + 1023 (rounded down).  The exponent is in range
+     whenever the result is not handled as underflow or overflow.  FEXPA
+     clears the sign bit, so it is set afterwards.  */
+  svuint64_t t = svreinterpret_u64 (svexpa (svlsl_x (pg, ki, 1)));
+  t = svorr_x (pg, t, svlsl_x (pg, sign_bias, 52 - V_POWF_EXP2_TABLE_BITS));
   svfloat64_t s = svreinterpret_f64 (t);
 
   svfloat64_t p = C (0);
@@ -341,6 +345,9 @@ SV_POWF_INTERVAL2 (0x1p-500, 0x1p500, 0x1p-1, 0x1p1, 10000)
 /* around estimated argmaxs of ULP error.  */
 SV_POWF_INTERVAL2 (0x1p-300, 0x1p-200, 0x1p-20, 0x1p-10, 10000)
 SV_POWF_INTERVAL2 (0x1p50, 0x1p100, 0x1p-20, 0x1p-10, 10000)
+/* Results close to overflow or subnormal, at the limits of the exponent
+   range of FEXPA.  */
+SV_POWF_INTERVAL2 (0x1p1, 0x1p2, 0x1p6, 0x1p8, 10000)
 /* x is negative, y is odd or even integer, or y is real not integer.  */
 PL_TEST_INTERVAL2 (SV_NAME_F2 (pow), -0.0, -10.0, 3.0, 3.0, 10000)
 PL_TEST_INTERVAL2 (SV_NAME_F2 (pow), -0.0, -10.0, 4.0, 4.0, 10000)
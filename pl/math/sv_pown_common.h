@@ -0,0 +1,124 @@
+/*
+ * Helpers for double-precision SVE pown, rootn and compoundn.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+#ifndef PL_MATH_SV_POWN_COMMON_H
+#define PL_MATH_SV_POWN_COMMON_H
+
+#include "sv_math.h"
+#include "sv_pow_inline.h"
+#include "pown_common.h"
+
+/* Lanes of b for which b^n can be computed by repeated squaring, see
+   pown_use_squaring.  */
+static inline svbool_t
+sv_pown_use_squaring (svbool_t pg, svfloat64_t b, svint64_t n)
+{
+  svuint64_t an = svreinterpret_u64 (svabs_x (pg, n));
+  svint64_t e = svreinterpret_s64 (
+      svand_x (pg, svlsr_x (pg, svreinterpret_u64 (b), 52), 0x7ff));
+  e = svabs_x (pg, svsub_x (pg, e, 0x3ff));
+  svfloat64_t bound = svmul_x (pg, svcvt_f64_x (pg, an),
+			       svcvt_f64_x (pg, svadd_x (pg, e, 1)));
+  return svand_z (pg, svcmple (pg, an, PownMaxSquaring),
+		  svcmple (pg, bound, PownSquaringBound));
+}
+
+/* (bh + bl)^n by repeated squaring in double-double arithmetic, with the same
+   right to left scheme as SVE powk.  Predication selects the lanes which
+   multiply at each step, until the largest |n| is exhausted.  */
+static inline svfloat64_t
+sv_pown_squaring (svbool_t pg, svfloat64_t bh, svfloat64_t bl, svint64_t n)
+{
+  svbool_t neg = svcmplt (pg, n, 0);
+  if (unlikely (svptest_any (pg, neg)))
+    {
+      /* 1 / (bh + bl) ~= r + r (1 - r bh - r bl) / (r bh).  */
+      svfloat64_t r = svdivr_x (pg, bh, 1.0);
+      svfloat64_t rl = svmls_x (pg, svmls_x (pg, sv_f64 (1.0), r, bh), r, bl);
+      bl = svsel (neg, svdiv_x (pg, rl, bh), bl);
+      bh = svsel (neg, r, bh);
+    }
+  svuint64_t m = svreinterpret_u64 (svabs_x (pg, n));
+  uint64_t max_m = svmaxv (pg, m);
+  svfloat64_t yh = sv_f64 (1.0), yl = sv_f64 (0.0);
+  while (true)
+    {
+      svbool_t odd = svcmpne (pg, svand_x (pg, m, 1), 0);
+      svfloat64_t h = svmul_x (pg, yh, bh);
+      svfloat64_t l = svnmls_x (pg, h, yh, bh);
+      l = svadd_x (pg, l, svmla_x (pg, svmul_x (pg, yl, bh), yh, bl));
+      yh = svsel (odd, h, yh);
+      yl = svsel (odd, l, yl);
+      max_m >>= 1;
+      if (max_m == 0)
+	break;
+      m = svlsr_x (pg, m, 1);
+      h = svmul_x (pg, bh, bh);
+      bl = svmla_x (pg, svnmls_x (pg, h, bh, bh), svadd_x (pg, bh, bh), bl);
+      bh = h;
+    }
+  return svadd_x (pg, yh, yl);
+}
+
+/* Split n as nh + *nl exactly, as in pown_split.  */
+static inline svfloat64_t
+sv_pown_split (svbool_t pg, svint64_t n, svfloat64_t *nl)
+{
+  svbool_t big = svacge (pg, svcvt_f64_x (pg, n), 0x1p53);
+  svint64_t nh = svsel (big, svand_x (pg, n, ~0x7ffLL), n);
+  *nl = svcvt_f64_x (pg, svsub_x (pg, n, nh));
+  return svcvt_f64_x (pg, nh);
+}
+
+/* exp(hi + lo), with lo the tail of a double-double.  */
+static inline svfloat64_t
+sv_pown_exp (svbool_t pg, svfloat64_t hi, svfloat64_t lo)
+{
+  svfloat64_t y = svadd_x (pg, hi, lo);
+  lo = svadd_x (pg, svsub_x (pg, hi, y), lo);
+  return sv_pow_exp_inline (pg, y, lo, sv_u64 (0));
+}
+
+/* exp(n (lh + ll)), where lh + ll is a log as returned by
+   sv_pow_log_inline.  */
+static inline svfloat64_t
+sv_pown_exp_mul (svbool_t pg, svint64_t n, svfloat64_t lh, svfloat64_t ll)
+{
+  svfloat64_t nl, nh = sv_pown_split (pg, n, &nl);
+  svfloat64_t hi = svmul_x (pg, nh, lh);
+  svfloat64_t lo = svnmls_x (pg, hi, nh, lh);
+  lo = svadd_x (pg, lo, svmla_x (pg, svmul_x (pg, nl, lh), nh, ll));
+  return sv_pown_exp (pg, hi, lo);
+}
+
+/* Lanes which need special treatment: x is +-0, subnormal, +-inf or nan.  */
+static inline svbool_t
+sv_pown_special (svbool_t pg, svfloat64_t x)
+{
+  svuint64_t abstop
+      = svand_x (pg, svlsr_x (pg, svreinterpret_u64 (x), 52), 0x7ff);
+  return svcmpge (pg, svsub_x (pg, abstop, 1), 0x7fe);
+}
+
+/* Call scalar f on the lanes of x and n selected by cmp.  */
+static inline svfloat64_t
+sv_call_pown (double (*f) (double, long long), svfloat64_t x, svint64_t n,
+	      svfloat64_t y, svbool_t cmp)
+{
+  svbool_t p = svpfirst (cmp, svpfalse ());
+  while (svptest_any (cmp, p))
+    {
+      double elem1 = svclastb (p, 0, x);
+      int64_t elem2 = svclastb (p, 0, n);
+      double ret = (*f) (elem1, elem2);
+      svfloat64_t y2 = sv_f64 (ret);
+      y = svsel (p, y2, y);
+      p = svpnext_b64 (cmp, p);
+    }
+  return y;
+}
+
+#endif
@@ -0,0 +1,56 @@
+/*
+ * Double-precision SVE rootn(x, n) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "mathlib.h"
+#include "sv_pown_common.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+/* SVE x^(1/n) for integer n, computed as exp(log|x| / n) with the log and
+   exp of pow, as in the scalar rootn.  n = 0, zero, subnormal, infinite and
+   nan x, and negative x with even n fall back to scalar rootn.
+   Maximum measured error is 1.04 ULPs:
+   _ZGVsMxvv_rootn(0x1.e82d8933f3eacp+995, -968)
+     got 0x1.f5dc898c35275p-2
+    want 0x1.f5dc898c35276p-2.  */
+svfloat64_t SV_NAME_D2 (rootn) (svfloat64_t x, svint64_t n, const svbool_t pg)
+{
+  svuint64_t ix = svreinterpret_u64 (x);
+  svuint64_t odd = svlsl_x (pg, svreinterpret_u64 (n), 63);
+  svbool_t special = svorr_z (pg, sv_pown_special (pg, x), svcmpeq (pg, n, 0));
+  /* x < 0 and n is even.  */
+  special = svorr_z (
+      pg, special,
+      svcmplt (pg, svreinterpret_s64 (svbic_x (pg, ix, odd)), 0));
+
+  svfloat64_t ax = svsel (special, sv_f64 (1.0), svabs_x (pg, x));
+  svint64_t m = svsel (special, sv_s64 (1), n);
+  svfloat64_t lo, hi = sv_pow_log_inline (pg, svreinterpret_u64 (ax), &lo);
+  /* (hi + lo) / (nh + nl) ~= qh + (hi - qh nh + lo - qh nl) / nh.  */
+  svfloat64_t nl, nh = sv_pown_split (pg, m, &nl);
+  svfloat64_t qh = svdiv_x (pg, hi, nh);
+  svfloat64_t ql = svadd_x (pg, svmls_x (pg, hi, qh, nh), lo);
+  ql = svdiv_x (pg, svmls_x (pg, ql, qh, nl), nh);
+  svfloat64_t y = sv_pown_exp (pg, qh, ql);
+  /* Negate if x < 0 and n is odd.  */
+  y = svreinterpret_f64 (
+      sveor_x (pg, svreinterpret_u64 (y), svand_x (pg, odd, ix)));
+
+  if (unlikely (svptest_any (pg, special)))
+    return sv_call_pown (rootn, x, n, y, special);
+  return y;
+}
+
+PL_TEST_ULP (SV_NAME_D2 (rootn), 0.55)
+#define SV_ROOTN_INTERVAL2(xlo, xhi, ylo, yhi, n)                             \
+  PL_TEST_INTERVAL2 (SV_NAME_D2 (rootn), xlo, xhi, ylo, yhi, n)               \
+  PL_TEST_INTERVAL2 (SV_NAME_D2 (rootn), xlo, xhi, -ylo, -yhi, n)             \
+  PL_TEST_INTERVAL2 (SV_NAME_D2 (rootn), -xlo, -xhi, ylo, yhi, n)             \
+  PL_TEST_INTERVAL2 (SV_NAME_D2 (rootn), -xlo, -xhi, -ylo, -yhi, n)
+SV_ROOTN_INTERVAL2 (0, inf, 0, 64, 40000)
+SV_ROOTN_INTERVAL2 (0x1p-10, 0x1p10, 0, 1000, 40000)
+SV_ROOTN_INTERVAL2 (0, inf, 0, 0x1p62, 10000)
@@ -0,0 +1,93 @@
+/*
+ * Single-precision SVE sinc(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "mathlib.h"
+#include "sv_math.h"
+#include "poly_sve_f32.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+static const struct data
+{
+  float poly[4];
+  /* Pi-related values to be loaded as one quad-word and used with
+     svmla_lane.  */
+  float negpi1, negpi2, negpi3, invpi;
+  float shift;
+} data = {
+  /* Coefficients of P, with sin(r) / r ~= 1 + r^2 P(r^2) in [-pi/2, pi/2],
+     see v_sincf_3u.c.  */
+  .poly = { -0x1.55554cp-3f, 0x1.110ed4p-7f, -0x1.9f6ffep-13f,
+	    0x1.5dbdf2p-19f },
+  .negpi1 = -0x1.921fb6p+1f,
+  .negpi2 = 0x1.777a5cp-24f,
+  .negpi3 = 0x1.ee59dap-49f,
+  .invpi = 0x1.45f306p-2f,
+  .shift = 0x1.8p+23f
+};
+
+#define RangeVal 0x49800000 /* asuint32 (0x1p20f).  */
+
+static float
+sincf_scalar (float x)
+{
+  return sinf (x) / x;
+}
+
+static svfloat32_t NOINLINE
+special_case (svfloat32_t x, svfloat32_t y, svbool_t cmp)
+{
+  return sv_call_f32 (sincf_scalar, x, y, cmp);
+}
+
+/* A fast SVE implementation of sinc(x) = sin(x) / x, with sinc(0) = 1.  The
+   argument is reduced as in sinf, to r = |x| - n pi in [-pi/2, pi/2], and
+   sin(r) = r + r^3 P(r^2) is divided by |x|.  For n = 0, r = |x| and the
+   result is 1 + r^2 P(r^2), with no division.
+   Maximum error: 2.84 ULP:
+   _ZGVsMxv_sincf(0x1.36b78ep+17) got 0x1.b456bp-28
+				 want 0x1.b456aap-28.  */
+svfloat32_t SV_NAME_F1 (sinc) (svfloat32_t x, const svbool_t pg)
+{
+  const struct data *d = ptr_barrier (&data);
+
+  svfloat32_t ax = svabs_x (pg, x);
+  svbool_t cmp = svcmpge (pg, svreinterpret_u32 (ax), RangeVal);
+
+  /* pi_vals are a quad-word of helper values - the first 3 elements contain
+     -pi in extended precision, the last contains 1 / pi.  */
+  svfloat32_t pi_vals = svld1rq (svptrue_b32 (), &d->negpi1);
+
+  /* n = rint(|x|/pi).  */
+  svfloat32_t n = svmla_lane (sv_f32 (d->shift), ax, pi_vals, 3);
+  svuint32_t odd = svlsl_x (pg, svreinterpret_u32 (n), 31);
+  n = svsub_x (pg, n, d->shift);
+
+  /* r = |x| - n*pi  (range reduction into -pi/2 .. pi/2).  */
+  svfloat32_t r;
+  r = svmla_lane (ax, n, pi_vals, 0);
+  r = svmla_lane (r, n, pi_vals, 1);
+  r = svmla_lane (r, n, pi_vals, 2);
+
+  svfloat32_t r2 = svmul_x (pg, r, r);
+  svfloat32_t p = sv_horner_3_f32_x (pg, r2, d->poly);
+  svfloat32_t small = svmad_x (pg, r2, p, 1.0f);
+
+  svfloat32_t y = svmla_x (pg, r, svmul_x (pg, r, r2), p);
+  y = svreinterpret_f32 (sveor_x (pg, svreinterpret_u32 (y), odd));
+  y = svsel (svcmpeq (pg, n, 0), small, svdiv_x (pg, y, ax));
+
+  if (unlikely (svptest_any (pg, cmp)))
+    return special_case (x, y, cmp);
+  return y;
+}
+
+PL_TEST_ULP (SV_NAME_F1 (sinc), 2.35)
+PL_TEST_SYM_INTERVAL (SV_NAME_F1 (sinc), 0, 0x1p-31, 5000)
+PL_TEST_SYM_INTERVAL (SV_NAME_F1 (sinc), 0x1p-31, 0x1.921fb6p0, 50000)
+PL_TEST_SYM_INTERVAL (SV_NAME_F1 (sinc), 0x1.921fb6p0, 0x1p20, 100000)
+PL_TEST_SYM_INTERVAL (SV_NAME_F1 (sinc), 0x1p20, inf, 10000)
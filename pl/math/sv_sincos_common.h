@@ -1,7 +1,7 @@
 /*
  * Core approximation for double-precision vector sincos
  *
- * Copyright (c) 2023, Arm Limited.
+ * Copyright (c) 2023-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -35,25 +35,13 @@ check_ge_rangeval (svbool_t pg, svfloat64_t x, const struct sv_sincos_data *d)
   return svnot_z (pg, in_bounds);
 }
 
-/* Double-precision vector function allowing calculation of both sin and cos in
-   one function call, using shared argument reduction and separate polynomials.
-   Largest observed error is for sin, 3.22 ULP:
-   v_sincos_sin (0x1.d70eef40f39b1p+12) got -0x1.ffe9537d5dbb7p-3
-				       want -0x1.ffe9537d5dbb4p-3.  */
+/* Evaluate sin and cos of r + n * pi/2, given r in [-pi/4, pi/4].  The
+   argument reduction is left to the caller, so that this can be shared by
+   routines which reduce a different argument.  */
 static inline svfloat64x2_t
-sv_sincos_inline (svbool_t pg, svfloat64_t x, const struct sv_sincos_data *d)
+sv_sincos_reduced_inline (svbool_t pg, svfloat64_t r, svint64_t n,
+			  const struct sv_sincos_data *d)
 {
-  /* q = nearest integer to 2 * x / pi.  */
-  svfloat64_t q = svsub_x (pg, svmla_x (pg, sv_f64 (d->shift), x, d->inv_pio2),
-			   d->shift);
-  svint64_t n = svcvt_s64_x (pg, q);
-
-  /* Reduce x such that r is in [ -pi/4, pi/4 ].  */
-  svfloat64_t r = x;
-  r = svmls_x (pg, r, q, d->pio2[0]);
-  r = svmls_x (pg, r, q, d->pio2[1]);
-  r = svmls_x (pg, r, q, d->pio2[2]);
-
   svfloat64_t r2 = svmul_x (pg, r, r), r3 = svmul_x (pg, r2, r),
 	      r4 = svmul_x (pg, r2, r2);
 
@@ -83,3 +71,25 @@ sv_sincos_inline (svbool_t pg, svfloat64_t x, const struct sv_sincos_data *d)
 
   return svcreate2 (ss, cc);
 }
+
+/* Double-precision vector function allowing calculation of both sin and cos in
+   one function call, using shared argument reduction and separate polynomials.
+   Largest observed error is for sin, 3.22 ULP:
+   v_sincos_sin (0x1.d70eef40f39b1p+12) got -0x1.ffe9537d5dbb7p-3
+				       want -0x1.ffe9537d5dbb4p-3.  */
+static inline svfloat64x2_t
+sv_sincos_inline (svbool_t pg, svfloat64_t x, const struct sv_sincos_data *d)
+{
+  /* q = nearest integer to 2 * x / pi.  */
+  svfloat64_t q = svsub_x (pg, svmla_x (pg, sv_f64 (d->shift), x, d->inv_pio2),
+			   d->shift);
+  svint64_t n = svcvt_s64_x (pg, q);
+
+  /* Reduce x such that r is in [ -pi/4, pi/4 ].  */
+  svfloat64_t r = x;
+  r = svmls_x (pg, r, q, d->pio2[0]);
+  r = svmls_x (pg, r, q, d->pio2[1]);
+  r = svmls_x (pg, r, q, d->pio2[2]);
+
+  return sv_sincos_reduced_inline (pg, r, n, d);
+}
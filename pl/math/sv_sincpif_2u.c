@@ -0,0 +1,57 @@
+/*
+ * Single-precision SVE sinc(pi x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "mathlib.h"
+#include "sv_math.h"
+#include "poly_sve_f32.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+static const struct data
+{
+  float poly[5];
+} data = {
+  /* Coefficients of S, with sin(pi r) / (pi r) ~= 1 + r^2 S(r^2) in
+     [-1/2, 1/2], see v_sincpif_inline.h.  */
+  .poly = { -0x1.a51a66p+0f, 0x1.9f9cacp-1f, -0x1.86a6dcp-3f, 0x1.abe8c2p-6f,
+	    -0x1.253824p-9f },
+};
+
+/* A fast SVE implementation of sincpi(x) = sin(pi x) / (pi x), with
+   sincpi(0) = 1.  With n = rint(|x|) and r = |x| - n, the result is
+   (-1)^n (r + r^3 S(r^2)) / |x| for n != 0, and 1 + r^2 S(r^2) for n = 0, so
+   it is exact close to 0.  No special-case handling is needed.
+   Maximum error: 2.00 ULP:
+   _ZGVsMxv_sincpif(0x1.453c16p+1) got 0x1.fce554p-4
+				  want 0x1.fce55p-4.  */
+svfloat32_t SV_NAME_F1 (sincpi) (svfloat32_t x, const svbool_t pg)
+{
+  const struct data *d = ptr_barrier (&data);
+
+  svfloat32_t ax = svabs_x (pg, x);
+  svfloat32_t n = svrinta_x (pg, ax);
+  svfloat32_t r = svsub_x (pg, ax, n);
+
+  /* Result should be negated based on if n is odd or not.  */
+  svuint32_t intn = svreinterpret_u32 (svcvt_s32_x (pg, n));
+  svuint32_t odd = svlsl_x (pg, intn, 31);
+
+  svfloat32_t r2 = svmul_x (pg, r, r);
+  svfloat32_t p = sv_horner_4_f32_x (pg, r2, d->poly);
+  svfloat32_t small = svmad_x (pg, r2, p, 1.0f);
+
+  svfloat32_t y = svmla_x (pg, r, svmul_x (pg, r, r2), p);
+  y = svreinterpret_f32 (sveor_x (pg, svreinterpret_u32 (y), odd));
+  return svsel (svcmpeq (pg, n, 0), small, svdiv_x (pg, y, ax));
+}
+
+PL_TEST_ULP (SV_NAME_F1 (sincpi), 1.51)
+PL_TEST_SYM_INTERVAL (SV_NAME_F1 (sincpi), 0, 0x1p-31, 5000)
+PL_TEST_SYM_INTERVAL (SV_NAME_F1 (sincpi), 0x1p-31, 0.5, 50000)
+PL_TEST_SYM_INTERVAL (SV_NAME_F1 (sincpi), 0.5, 0x1p10, 50000)
+PL_TEST_SYM_INTERVAL (SV_NAME_F1 (sincpi), 0x1p10, 0x1p23, 10000)
+PL_TEST_SYM_INTERVAL (SV_NAME_F1 (sincpi), 0x1p23, inf, 10000)
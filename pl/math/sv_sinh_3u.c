@@ -1,7 +1,7 @@
 /*
  * Double-precision SVE sinh(x) function.
  *
- * Copyright (c) 2023, Arm Limited.
+ * Copyright (c) 2023-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -28,7 +28,9 @@ static const struct data
   .inv_ln2 = 0x1.71547652b82fep0,
   .m_ln2_hi = -0x1.62e42fefa39efp-1,
   .m_ln2_lo = -0x1.abc9e3b39803fp-56,
-  .shift = 0x1.8p52,
+  /* 1.5*2^52+1023, such that bits 10:0 of asuint(shift + i) are the biased
+     exponent of 2^i.  */
+  .shift = 0x1.80000000003ffp52,
 
   .halff = 0x3fe0000000000000,
   .onef = 0x3ff0000000000000,
@@ -45,9 +47,9 @@ expm1_inline (svfloat64_t x, svbool_t pg)
      exp(x) - 1 = 2^i * (expm1(f) + 1) - 1
      where i = round(x / ln2)
      and   f = x - i * ln2 (f in [-ln2/2, ln2/2]).  */
-  svfloat64_t j
-      = svsub_x (pg, svmla_x (pg, sv_f64 (d->shift), x, d->inv_ln2), d->shift);
-  svint64_t i = svcvt_s64_x (pg, j);
+  svfloat64_t z = svmla_x (pg, sv_f64 (d->shift), x, d->inv_ln2);
+  svuint64_t u = svreinterpret_u64 (z);
+  svfloat64_t j = svsub_x (pg, z, d->shift);
   svfloat64_t f = svmla_x (pg, x, j, d->m_ln2_hi);
   f = svmla_x (pg, f, j, d->m_ln2_lo);
   /* Approximate expm1(f) using polynomial.  */
@@ -56,8 +58,8 @@ expm1_inline (svfloat64_t x, svbool_t pg)
   svfloat64_t f8 = svmul_x (pg, f4, f4);
   svfloat64_t p
       = svmla_x (pg, f, f2, sv_estrin_10_f64_x (pg, f, f2, f4, f8, d->poly));
-  /* t = 2^i.  */
-  svfloat64_t t = svscale_x (pg, sv_f64 (1), i);
+  /* t = 2^i, computed using FEXPA with index 0 (table entry 1.0).  */
+  svfloat64_t t = svexpa (svlsl_x (pg, u, 6));
   /* expm1(x) ~= p * t + (t - 1).  */
   return svmla_x (pg, svsub_x (pg, t, 1.0), p, t);
 }
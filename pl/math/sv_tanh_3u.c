@@ -1,6 +1,6 @@
 /*
  * Double-precision SVE tanh(x) function.
- * Copyright (c) 2023, Arm Limited.
+ * Copyright (c) 2023-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -26,7 +26,9 @@ static const struct data
   .inv_ln2 = 0x1.71547652b82fep0,
   .ln2_hi = -0x1.62e42fefa39efp-1,
   .ln2_lo = -0x1.abc9e3b39803fp-56,
-  .shift = 0x1.8p52,
+  /* 1.5*2^52+1023, such that bits 10:0 of asuint(shift + i) are the biased
+     exponent of 2^i.  */
+  .shift = 0x1.80000000003ffp52,
 
   .tiny_bound = 0x3e40000000000000, /* asuint64 (0x1p-27).  */
   /* asuint64(0x1.241bf835f9d5fp+4) - asuint64(tiny_bound).  */
@@ -40,9 +42,9 @@ expm1_inline (svfloat64_t x, const svbool_t pg, const struct data *d)
      the scalar variant of tanh.  */
 
   /* Reduce argument: f in [-ln2/2, ln2/2], i is exact.  */
-  svfloat64_t j
-      = svsub_x (pg, svmla_x (pg, sv_f64 (d->shift), x, d->inv_ln2), d->shift);
-  svint64_t i = svcvt_s64_x (pg, j);
+  svfloat64_t z = svmla_x (pg, sv_f64 (d->shift), x, d->inv_ln2);
+  svuint64_t u = svreinterpret_u64 (z);
+  svfloat64_t j = svsub_x (pg, z, d->shift);
   svfloat64_t f = svmla_x (pg, x, j, d->ln2_hi);
   f = svmla_x (pg, f, j, d->ln2_lo);
 
@@ -53,8 +55,8 @@ expm1_inline (svfloat64_t x, const svbool_t pg, const struct data *d)
       pg, f, f2,
       sv_estrin_10_f64_x (pg, f, f2, f4, svmul_x (pg, f4, f4), d->poly));
 
-  /* t = 2 ^ i.  */
-  svfloat64_t t = svscale_x (pg, sv_f64 (1), i);
+  /* t = 2^i, computed using FEXPA with index 0 (table entry 1.0).  */
+  svfloat64_t t = svexpa (svlsl_x (pg, u, 6));
   /* expm1(x) = p * t + (t - 1).  */
   return svmla_x (pg, svsub_x (pg, t, 1), p, t);
 }
@@ -0,0 +1,47 @@
+/*
+ * Double-precision SVE y0(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_bessel_common.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+static svfloat64_t NOINLINE
+special_case (svfloat64_t x, svfloat64_t y, svbool_t special)
+{
+  return sv_call_f64 (y0, x, y, special);
+}
+
+/* SVE approximation for the double-precision Bessel function of the second
+   kind of order 0, see sv_bessel_common.h.
+   Maximum measured error away from the zeros above 16 is 6.17 ULP:
+   _ZGVsMxv_y0(0x1.deb3583ef27ecp+5) got 0x1.f8b9a25664422p-5
+				     want 0x1.f8b9a25664428p-5.
+   Close to those zeros the absolute error is below 2^-66.5 sqrt(2/(pi x)),
+   so the error in ULP is unbounded:
+   _ZGVsMxv_y0(0x1.0803c74003214p+4) got 0x1.cd82d691c1122p-53
+				     want 0x1.cd827f6c074a2p-53.  */
+svfloat64_t SV_NAME_D1 (y0) (svfloat64_t x, const svbool_t pg)
+{
+  const struct sv_bessel_consts *d = ptr_barrier (&sv_bessel_consts);
+  /* Fall back to scalar for x <= 0, subnormal x, x >= 2^23 and NaN.  */
+  svbool_t special = svnot_z (pg, svand_z (pg, svcmpge (pg, x, d->y_min),
+					  svcmplt (pg, x, d->range_val)));
+
+  svfloat64_t y = sv_bessel_y_inline (pg, x, 0, d);
+
+  if (unlikely (svptest_any (pg, special)))
+    return special_case (x, y, special);
+  return y;
+}
+
+PL_SIG (SV, D, 1, y0, 0.01, 10.0)
+PL_TEST_ULP (SV_NAME_D1 (y0), 5.73)
+PL_TEST_INTERVAL (SV_NAME_D1 (y0), 0, 2, 100000)
+PL_TEST_INTERVAL (SV_NAME_D1 (y0), 2, 16, 100000)
+PL_TEST_INTERVAL (SV_NAME_D1 (y0), 16, 0x1p23, 100000)
+PL_TEST_INTERVAL (SV_NAME_D1 (y0), 0x1p23, inf, 1000)
+PL_TEST_INTERVAL (SV_NAME_D1 (y0), -0, -inf, 1000)
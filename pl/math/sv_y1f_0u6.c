@@ -0,0 +1,50 @@
+/*
+ * Single-precision SVE y1(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "sv_bessel_common.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+static svfloat32_t NOINLINE
+special_case (svfloat32_t x, svfloat32_t y, svbool_t special)
+{
+  return sv_call_f32 (y1f, x, y, special);
+}
+
+/* SVE approximation for the single-precision Bessel function of the second
+   kind of order 1, see sv_bessel_common.h.  The input is widened and the
+   double-precision approximation used, so the result is correctly rounded
+   except in rare double rounding cases.  Maximum measured error is 0.50
+   ULP.  */
+svfloat32_t SV_NAME_F1 (y1) (svfloat32_t x, const svbool_t pg)
+{
+  const struct sv_bessel_consts *d = ptr_barrier (&sv_bessel_consts);
+  /* Fall back to scalar for x <= 0, x >= 2^23 and NaN.  Subnormal inputs
+     are normal in double precision.  */
+  svbool_t special = svnot_z (
+      pg, svand_z (pg, svcmpgt (pg, x, 0), svcmplt (pg, x, 0x1p23f)));
+
+  /* Widen to double precision, which the core approximation needs anyway for
+     the phase, and evaluate on both halves of the vector.  */
+  svfloat64_t lo
+      = sv_bessel_y_inline (svunpklo (pg), sv_widen_lo_f32 (x), 1, d);
+  svfloat64_t hi
+      = sv_bessel_y_inline (svunpkhi (pg), sv_widen_hi_f32 (x), 1, d);
+  svfloat32_t y = sv_narrow_f64 (lo, hi);
+
+  if (unlikely (svptest_any (pg, special)))
+    return special_case (x, y, special);
+  return y;
+}
+
+PL_SIG (SV, F, 1, y1, 0.01, 10.0)
+PL_TEST_ULP (SV_NAME_F1 (y1), 0.01)
+PL_TEST_INTERVAL (SV_NAME_F1 (y1), 0, 2, 100000)
+PL_TEST_INTERVAL (SV_NAME_F1 (y1), 2, 16, 100000)
+PL_TEST_INTERVAL (SV_NAME_F1 (y1), 16, 0x1p23, 100000)
+PL_TEST_INTERVAL (SV_NAME_F1 (y1), 0x1p23, inf, 1000)
+PL_TEST_INTERVAL (SV_NAME_F1 (y1), -0, -inf, 1000)
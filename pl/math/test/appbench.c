@@ -0,0 +1,934 @@
+/*
+ * Benchmark of numeric mini-applications.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+/* Each application is implemented once with scalar calls, once with the
+   AdvSIMD routines and once with the SVE routines of the library, and the
+   results are checked against a long double reference.  The scalar variants
+   call the routines by their libm names, so in appbench they resolve to
+   this library where it provides them and to libm otherwise, and in
+   appbench_libc they all resolve to libm, so that the reported speedups are
+   relative to the system libm.  */
+
+#undef _GNU_SOURCE
+#define _GNU_SOURCE 1
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#include "mathlib.h"
+
+#ifdef __vpcs
+# include <arm_neon.h>
+#endif
+#if WANT_SVE_MATH
+# include <arm_sve.h>
+#endif
+
+/* Number of measurements, best result is reported.  */
+#define MEASURE 20
+/* Iterations of an application per measurement.  */
+#define ITER 10
+/* Number of elements of the applications.  */
+#define N 4096
+
+static long measurecount = MEASURE;
+static long itercount = ITER;
+
+/* Outputs of the variants and of the reference.  */
+static double Y[3 * N];
+static float Yf[3 * N];
+static long double R[3 * N];
+
+static inline double
+asdouble (uint64_t i)
+{
+  union
+  {
+    uint64_t i;
+    double f;
+  } u = {i};
+  return u.f;
+}
+
+static uint64_t seed = 0x0123456789abcdef;
+
+static double
+frand (double lo, double hi)
+{
+  seed = 6364136223846793005ULL * seed + 1;
+  return lo + (hi - lo) * (asdouble (seed >> 12 | 0x3ffULL << 52) - 1.0);
+}
+
+#ifdef __vpcs
+/* There is no AdvSIMD exp, expf or log in this library, so the nearest
+   routines are used, with an extra error of a few ULP from the scaling.  */
+static inline float64x2_t
+v_exp (float64x2_t x)
+{
+  return _ZGVnN2v_exp2 (vmulq_n_f64 (x, 0x1.71547652b82fep0));
+}
+
+static inline float64x2_t
+v_log (float64x2_t x)
+{
+  return vmulq_n_f64 (_ZGVnN2v_log2 (x), 0x1.62e42fefa39efp-1);
+}
+
+static inline float32x4_t
+v_expf (float32x4_t x)
+{
+  return _ZGVnN4v_exp10f (vmulq_n_f32 (x, 0x1.bcb7b2p-2f));
+}
+#endif
+
+/* European call options with the Black-Scholes formula,
+     C = S N(d1) - K exp(-r T) N(d2),
+     d1 = (log(S / K) + (r + v^2 / 2) T) / (v sqrt(T)),
+     d2 = d1 - v sqrt(T),
+   with N(x) = erfc(-x / sqrt(2)) / 2.  */
+#define BS_RATE 0.02
+static double bs_s[N], bs_k[N], bs_t[N], bs_v[N];
+
+static void
+bs_init (void)
+{
+  for (int i = 0; i < N; i++)
+    {
+      bs_s[i] = frand (50, 150);
+      bs_k[i] = frand (50, 150);
+      bs_t[i] = frand (0.1, 2);
+      bs_v[i] = frand (0.1, 0.5);
+    }
+}
+
+static void
+bs_ref (void)
+{
+  long double c = sqrtl (0.5L);
+  for (int i = 0; i < N; i++)
+    {
+      long double v = bs_v[i], t = bs_t[i], sq = v * sqrtl (t);
+      long double d1 = (logl ((long double) bs_s[i] / bs_k[i])
+			+ (BS_RATE + 0.5L * v * v) * t)
+		       / sq;
+      long double d2 = d1 - sq;
+      long double df = expl (-BS_RATE * t);
+      R[i] = 0.5L
+	     * (bs_s[i] * erfcl (-d1 * c) - bs_k[i] * df * erfcl (-d2 * c));
+    }
+}
+
+static void
+bs_scalar (void)
+{
+  for (int i = 0; i < N; i++)
+    {
+      double v = bs_v[i], t = bs_t[i], sq = v * sqrt (t);
+      double d1 = (log (bs_s[i] / bs_k[i]) + (BS_RATE + 0.5 * v * v) * t) / sq;
+      double d2 = d1 - sq;
+      double df = exp (-BS_RATE * t);
+      Y[i] = 0.5
+	     * (bs_s[i] * erfc (-d1 * M_SQRT1_2)
+		- bs_k[i] * df * erfc (-d2 * M_SQRT1_2));
+    }
+}
+
+#ifdef __vpcs
+static void
+bs_advsimd (void)
+{
+  for (int i = 0; i < N; i += 2)
+    {
+      float64x2_t s = vld1q_f64 (bs_s + i), k = vld1q_f64 (bs_k + i);
+      float64x2_t t = vld1q_f64 (bs_t + i), v = vld1q_f64 (bs_v + i);
+      float64x2_t sq = vmulq_f64 (v, vsqrtq_f64 (t));
+      float64x2_t a
+	  = vfmaq_f64 (vdupq_n_f64 (BS_RATE), vmulq_f64 (v, v), vdupq_n_f64 (0.5));
+      float64x2_t d1 = vfmaq_f64 (v_log (vdivq_f64 (s, k)), a, t);
+      d1 = vdivq_f64 (d1, sq);
+      float64x2_t d2 = vsubq_f64 (d1, sq);
+      float64x2_t df = v_exp (vmulq_n_f64 (t, -BS_RATE));
+      float64x2_t n1 = _ZGVnN2v_erfc (vmulq_n_f64 (d1, -M_SQRT1_2));
+      float64x2_t n2 = _ZGVnN2v_erfc (vmulq_n_f64 (d2, -M_SQRT1_2));
+      float64x2_t c = vfmsq_f64 (vmulq_f64 (s, n1), vmulq_f64 (k, df), n2);
+      vst1q_f64 (Y + i, vmulq_n_f64 (c, 0.5));
+    }
+}
+#endif
+
+#if WANT_SVE_MATH
+static void
+bs_sve (void)
+{
+  for (int i = 0; i < N; i += svcntd ())
+    {
+      svbool_t pg = svwhilelt_b64 (i, N);
+      svfloat64_t s = svld1 (pg, bs_s + i), k = svld1 (pg, bs_k + i);
+      svfloat64_t t = svld1 (pg, bs_t + i), v = svld1 (pg, bs_v + i);
+      svfloat64_t sq = svmul_x (pg, v, svsqrt_x (pg, t));
+      svfloat64_t a = svmla_n_f64_x (pg, svdup_f64 (BS_RATE), svmul_x (pg, v, v),
+				     0.5);
+      svfloat64_t d1 = svmla_x (pg, _ZGVsMxv_log (svdiv_x (pg, s, k), pg), a, t);
+      d1 = svdiv_x (pg, d1, sq);
+      svfloat64_t d2 = svsub_x (pg, d1, sq);
+      svfloat64_t df = _ZGVsMxv_exp (svmul_n_f64_x (pg, t, -BS_RATE), pg);
+      svfloat64_t n1 = _ZGVsMxv_erfc (svmul_n_f64_x (pg, d1, -M_SQRT1_2), pg);
+      svfloat64_t n2 = _ZGVsMxv_erfc (svmul_n_f64_x (pg, d2, -M_SQRT1_2), pg);
+      svfloat64_t c = svmls_x (pg, svmul_x (pg, s, n1), svmul_x (pg, k, df), n2);
+      svst1 (pg, Y + i, svmul_n_f64_x (pg, c, 0.5));
+    }
+}
+#endif
+
+/* Rows of activations normalised to zero mean and unit variance, then
+   mapped to probabilities:
+     z = (x - mean) / sqrt(var + eps),
+     y = exp(z - max(z)) / sum(exp(z - max(z))).  */
+#define SM_COLS 256
+#define SM_ROWS (N / SM_COLS)
+#define SM_EPS 0x1p-16f
+static float sm_x[N];
+
+static void
+sm_init (void)
+{
+  for (int i = 0; i < N; i++)
+    sm_x[i] = frand (-4, 4);
+}
+
+static void
+sm_ref (void)
+{
+  for (int r = 0; r < SM_ROWS; r++)
+    {
+      const float *x = sm_x + r * SM_COLS;
+      long double *y = R + r * SM_COLS;
+      long double mean = 0, var = 0, max = -INFINITY, sum = 0;
+      for (int j = 0; j < SM_COLS; j++)
+	mean += x[j];
+      mean /= SM_COLS;
+      for (int j = 0; j < SM_COLS; j++)
+	var += (x[j] - mean) * (x[j] - mean);
+      long double inv = 1 / sqrtl (var / SM_COLS + SM_EPS);
+      for (int j = 0; j < SM_COLS; j++)
+	{
+	  y[j] = (x[j] - mean) * inv;
+	  max = fmaxl (max, y[j]);
+	}
+      for (int j = 0; j < SM_COLS; j++)
+	{
+	  y[j] = expl (y[j] - max);
+	  sum += y[j];
+	}
+      for (int j = 0; j < SM_COLS; j++)
+	y[j] /= sum;
+    }
+}
+
+static void
+sm_scalar (void)
+{
+  for (int r = 0; r < SM_ROWS; r++)
+    {
+      const float *x = sm_x + r * SM_COLS;
+      float *y = Yf + r * SM_COLS;
+      float mean = 0, var = 0, max = -INFINITY, sum = 0;
+      for (int j = 0; j < SM_COLS; j++)
+	mean += x[j];
+      mean /= SM_COLS;
+      for (int j = 0; j < SM_COLS; j++)
+	var += (x[j] - mean) * (x[j] - mean);
+      float inv = 1 / sqrtf (var / SM_COLS + SM_EPS);
+      for (int j = 0; j < SM_COLS; j++)
+	{
+	  y[j] = (x[j] - mean) * inv;
+	  max = fmaxf (max, y[j]);
+	}
+      for (int j = 0; j < SM_COLS; j++)
+	{
+	  y[j] = expf (y[j] - max);
+	  sum += y[j];
+	}
+      float rsum = 1 / sum;
+      for (int j = 0; j < SM_COLS; j++)
+	y[j] *= rsum;
+    }
+}
+
+#ifdef __vpcs
+static void
+sm_advsimd (void)
+{
+  for (int r = 0; r < SM_ROWS; r++)
+    {
+      const float *x = sm_x + r * SM_COLS;
+      float *y = Yf + r * SM_COLS;
+      float32x4_t s = vdupq_n_f32 (0);
+      for (int j = 0; j < SM_COLS; j += 4)
+	s = vaddq_f32 (s, vld1q_f32 (x + j));
+      float32x4_t mean = vdupq_n_f32 (vaddvq_f32 (s) / SM_COLS);
+      s = vdupq_n_f32 (0);
+      for (int j = 0; j < SM_COLS; j += 4)
+	{
+	  float32x4_t d = vsubq_f32 (vld1q_f32 (x + j), mean);
+	  s = vfmaq_f32 (s, d, d);
+	}
+      float inv = 1 / sqrtf (vaddvq_f32 (s) / SM_COLS + SM_EPS);
+      float32x4_t max = vdupq_n_f32 (-INFINITY);
+      for (int j = 0; j < SM_COLS; j += 4)
+	{
+	  float32x4_t z = vmulq_n_f32 (vsubq_f32 (vld1q_f32 (x + j), mean), inv);
+	  vst1q_f32 (y + j, z);
+	  max = vmaxq_f32 (max, z);
+	}
+      max = vdupq_n_f32 (vmaxvq_f32 (max));
+      s = vdupq_n_f32 (0);
+      for (int j = 0; j < SM_COLS; j += 4)
+	{
+	  float32x4_t e = v_expf (vsubq_f32 (vld1q_f32 (y + j), max));
+	  vst1q_f32 (y + j, e);
+	  s = vaddq_f32 (s, e);
+	}
+      float rsum = 1 / vaddvq_f32 (s);
+      for (int j = 0; j < SM_COLS; j += 4)
+	vst1q_f32 (y + j, vmulq_n_f32 (vld1q_f32 (y + j), rsum));
+    }
+}
+#endif
+
+#if WANT_SVE_MATH
+static void
+sm_sve (void)
+{
+  svbool_t ptrue = svptrue_b32 ();
+  for (int r = 0; r < SM_ROWS; r++)
+    {
+      const float *x = sm_x + r * SM_COLS;
+      float *y = Yf + r * SM_COLS;
+      svfloat32_t s = svdup_f32 (0);
+      for (int j = 0; j < SM_COLS; j += svcntw ())
+	{
+	  svbool_t pg = svwhilelt_b32 (j, SM_COLS);
+	  s = svadd_m (pg, s, svld1 (pg, x + j));
+	}
+      svfloat32_t mean = svdup_f32 (svaddv (ptrue, s) / SM_COLS);
+      s = svdup_f32 (0);
+      for (int j = 0; j < SM_COLS; j += svcntw ())
+	{
+	  svbool_t pg = svwhilelt_b32 (j, SM_COLS);
+	  svfloat32_t d = svsub_x (pg, svld1 (pg, x + j), mean);
+	  s = svmla_m (pg, s, d, d);
+	}
+      float inv = 1 / sqrtf (svaddv (ptrue, s) / SM_COLS + SM_EPS);
+      svfloat32_t max = svdup_f32 (-INFINITY);
+      for (int j = 0; j < SM_COLS; j += svcntw ())
+	{
+	  svbool_t pg = svwhilelt_b32 (j, SM_COLS);
+	  svfloat32_t z
+	      = svmul_n_f32_x (pg, svsub_x (pg, svld1 (pg, x + j), mean), inv);
+	  svst1 (pg, y + j, z);
+	  max = svmax_m (pg, max, z);
+	}
+      max = svdup_f32 (svmaxv (ptrue, max));
+      s = svdup_f32 (0);
+      for (int j = 0; j < SM_COLS; j += svcntw ())
+	{
+	  svbool_t pg = svwhilelt_b32 (j, SM_COLS);
+	  svfloat32_t e = _ZGVsMxv_expf (svsub_x (pg, svld1 (pg, y + j), max), pg);
+	  svst1 (pg, y + j, e);
+	  s = svadd_m (pg, s, e);
+	}
+      float rsum = 1 / svaddv (ptrue, s);
+      for (int j = 0; j < SM_COLS; j += svcntw ())
+	{
+	  svbool_t pg = svwhilelt_b32 (j, SM_COLS);
+	  svst1 (pg, y + j, svmul_n_f32_x (pg, svld1 (pg, y + j), rsum));
+	}
+    }
+}
+#endif
+
+/* A fully connected layer with GELU activation, y = gelu(x W + b), for a
+   batch of MLP_B inputs, with gelu(x) = x/2 (1 + erf(x / sqrt(2))).  W is
+   stored by rows of MLP_M outputs.  */
+#define MLP_K 32
+#define MLP_M 256
+#define MLP_B (N / MLP_M)
+static float mlp_x[MLP_B * MLP_K], mlp_w[MLP_K * MLP_M], mlp_b[MLP_M];
+
+static void
+mlp_init (void)
+{
+  for (int i = 0; i < MLP_B * MLP_K; i++)
+    mlp_x[i] = frand (-1, 1);
+  for (int i = 0; i < MLP_K * MLP_M; i++)
+    mlp_w[i] = frand (-0.5, 0.5);
+  for (int i = 0; i < MLP_M; i++)
+    mlp_b[i] = frand (-1, 1);
+}
+
+static void
+mlp_ref (void)
+{
+  long double c = sqrtl (0.5L);
+  for (int b = 0; b < MLP_B; b++)
+    for (int m = 0; m < MLP_M; m++)
+      {
+	long double y = mlp_b[m];
+	for (int k = 0; k < MLP_K; k++)
+	  y += (long double) mlp_x[b * MLP_K + k] * mlp_w[k * MLP_M + m];
+	R[b * MLP_M + m] = 0.5L * y * (1 + erfl (y * c));
+      }
+}
+
+static void
+mlp_scalar (void)
+{
+  for (int b = 0; b < MLP_B; b++)
+    {
+      float *y = Yf + b * MLP_M;
+      for (int m = 0; m < MLP_M; m++)
+	y[m] = mlp_b[m];
+      for (int k = 0; k < MLP_K; k++)
+	{
+	  float xk = mlp_x[b * MLP_K + k];
+	  for (int m = 0; m < MLP_M; m++)
+	    y[m] += xk * mlp_w[k * MLP_M + m];
+	}
+      for (int m = 0; m < MLP_M; m++)
+	y[m] = 0.5f * y[m] * (1 + erff (y[m] * (float) M_SQRT1_2));
+    }
+}
+
+#ifdef __vpcs
+static void
+mlp_advsimd (void)
+{
+  for (int b = 0; b < MLP_B; b++)
+    for (int m = 0; m < MLP_M; m += 16)
+      {
+	float32x4_t y[4];
+	for (int i = 0; i < 4; i++)
+	  y[i] = vld1q_f32 (mlp_b + m + 4 * i);
+	for (int k = 0; k < MLP_K; k++)
+	  {
+	    float xk = mlp_x[b * MLP_K + k];
+	    for (int i = 0; i < 4; i++)
+	      y[i] = vfmaq_n_f32 (y[i], vld1q_f32 (mlp_w + k * MLP_M + m + 4 * i),
+				  xk);
+	  }
+	for (int i = 0; i < 4; i++)
+	  {
+	    float32x4_t h = vmulq_n_f32 (y[i], 0.5f);
+	    float32x4_t t = _ZGVnN4v_erff (vmulq_n_f32 (y[i], M_SQRT1_2));
+	    vst1q_f32 (Yf + b * MLP_M + m + 4 * i, vfmaq_f32 (h, h, t));
+	  }
+      }
+}
+#endif
+
+#if WANT_SVE_MATH
+static void
+mlp_sve (void)
+{
+  for (int b = 0; b < MLP_B; b++)
+    for (int m = 0; m < MLP_M; m += svcntw ())
+      {
+	svbool_t pg = svwhilelt_b32 (m, MLP_M);
+	svfloat32_t y = svld1 (pg, mlp_b + m);
+	for (int k = 0; k < MLP_K; k++)
+	  y = svmla_n_f32_x (pg, y, svld1 (pg, mlp_w + k * MLP_M + m),
+			     mlp_x[b * MLP_K + k]);
+	svfloat32_t h = svmul_n_f32_x (pg, y, 0.5f);
+	svfloat32_t t = _ZGVsMxv_erff (svmul_n_f32_x (pg, y, M_SQRT1_2), pg);
+	svst1 (pg, Yf + b * MLP_M + m, svmla_x (pg, h, h, t));
+      }
+}
+#endif
+
+/* Accelerations of NB bodies under gravity, with softening eps:
+     a_i = sum_j m_j (p_j - p_i) / (|p_j - p_i|^2 + eps^2)^(3/2).
+   The x, y and z components are in consecutive blocks of NB outputs.  The
+   vector variants use the reciprocal square root estimate with two
+   Newton-Raphson steps.  */
+#define NB 512
+#define NB_EPS2 0x1p-10f
+static float nb_x[NB], nb_y[NB], nb_z[NB], nb_m[NB];
+
+static void
+nb_init (void)
+{
+  for (int i = 0; i < NB; i++)
+    {
+      nb_x[i] = frand (-1, 1);
+      nb_y[i] = frand (-1, 1);
+      nb_z[i] = frand (-1, 1);
+      nb_m[i] = frand (0.5, 1);
+    }
+}
+
+static void
+nb_ref (void)
+{
+  for (int i = 0; i < NB; i++)
+    {
+      long double ax = 0, ay = 0, az = 0;
+      for (int j = 0; j < NB; j++)
+	{
+	  long double dx = (long double) nb_x[j] - nb_x[i];
+	  long double dy = (long double) nb_y[j] - nb_y[i];
+	  long double dz = (long double) nb_z[j] - nb_z[i];
+	  long double r2 = dx * dx + dy * dy + dz * dz + NB_EPS2;
+	  long double s = nb_m[j] / (r2 * sqrtl (r2));
+	  ax += s * dx;
+	  ay += s * dy;
+	  az += s * dz;
+	}
+      R[i] = ax;
+      R[NB + i] = ay;
+      R[2 * NB + i] = az;
+    }
+}
+
+static void
+nb_scalar (void)
+{
+  for (int i = 0; i < NB; i++)
+    {
+      float ax = 0, ay = 0, az = 0;
+      for (int j = 0; j < NB; j++)
+	{
+	  float dx = nb_x[j] - nb_x[i];
+	  float dy = nb_y[j] - nb_y[i];
+	  float dz = nb_z[j] - nb_z[i];
+	  float r2 = dx * dx + dy * dy + dz * dz + NB_EPS2;
+	  float r = 1 / sqrtf (r2);
+	  float s = nb_m[j] * r * r * r;
+	  ax += s * dx;
+	  ay += s * dy;
+	  az += s * dz;
+	}
+      Yf[i] = ax;
+      Yf[NB + i] = ay;
+      Yf[2 * NB + i] = az;
+    }
+}
+
+#ifdef __vpcs
+static inline float32x4_t
+v_rsqrt (float32x4_t x)
+{
+  float32x4_t r = vrsqrteq_f32 (x);
+  r = vmulq_f32 (r, vrsqrtsq_f32 (vmulq_f32 (x, r), r));
+  return vmulq_f32 (r, vrsqrtsq_f32 (vmulq_f32 (x, r), r));
+}
+
+static void
+nb_advsimd (void)
+{
+  for (int i = 0; i < NB; i++)
+    {
+      float32x4_t ax = vdupq_n_f32 (0), ay = ax, az = ax;
+      float32x4_t xi = vdupq_n_f32 (nb_x[i]), yi = vdupq_n_f32 (nb_y[i]);
+      float32x4_t zi = vdupq_n_f32 (nb_z[i]);
+      for (int j = 0; j < NB; j += 4)
+	{
+	  float32x4_t dx = vsubq_f32 (vld1q_f32 (nb_x + j), xi);
+	  float32x4_t dy = vsubq_f32 (vld1q_f32 (nb_y + j), yi);
+	  float32x4_t dz = vsubq_f32 (vld1q_f32 (nb_z + j), zi);
+	  float32x4_t r2 = vfmaq_f32 (vdupq_n_f32 (NB_EPS2), dx, dx);
+	  r2 = vfmaq_f32 (vfmaq_f32 (r2, dy, dy), dz, dz);
+	  float32x4_t r = v_rsqrt (r2);
+	  float32x4_t s
+	      = vmulq_f32 (vmulq_f32 (vld1q_f32 (nb_m + j), r), vmulq_f32 (r, r));
+	  ax = vfmaq_f32 (ax, s, dx);
+	  ay = vfmaq_f32 (ay, s, dy);
+	  az = vfmaq_f32 (az, s, dz);
+	}
+      Yf[i] = vaddvq_f32 (ax);
+      Yf[NB + i] = vaddvq_f32 (ay);
+      Yf[2 * NB + i] = vaddvq_f32 (az);
+    }
+}
+#endif
+
+#if WANT_SVE_MATH
+static inline svfloat32_t
+sv_rsqrt (svbool_t pg, svfloat32_t x)
+{
+  svfloat32_t r = svrsqrte (x);
+  r = svmul_x (pg, r, svrsqrts (svmul_x (pg, x, r), r));
+  return svmul_x (pg, r, svrsqrts (svmul_x (pg, x, r), r));
+}
+
+static void
+nb_sve (void)
+{
+  svbool_t ptrue = svptrue_b32 ();
+  for (int i = 0; i < NB; i++)
+    {
+      svfloat32_t ax = svdup_f32 (0), ay = ax, az = ax;
+      for (int j = 0; j < NB; j += svcntw ())
+	{
+	  svbool_t pg = svwhilelt_b32 (j, NB);
+	  svfloat32_t dx = svsub_n_f32_x (pg, svld1 (pg, nb_x + j), nb_x[i]);
+	  svfloat32_t dy = svsub_n_f32_x (pg, svld1 (pg, nb_y + j), nb_y[i]);
+	  svfloat32_t dz = svsub_n_f32_x (pg, svld1 (pg, nb_z + j), nb_z[i]);
+	  svfloat32_t r2 = svmla_x (pg, svdup_f32 (NB_EPS2), dx, dx);
+	  r2 = svmla_x (pg, svmla_x (pg, r2, dy, dy), dz, dz);
+	  svfloat32_t r = sv_rsqrt (pg, r2);
+	  svfloat32_t s = svmul_x (pg, svmul_x (pg, svld1 (pg, nb_m + j), r),
+				   svmul_x (pg, r, r));
+	  ax = svmla_m (pg, ax, s, dx);
+	  ay = svmla_m (pg, ay, s, dy);
+	  az = svmla_m (pg, az, s, dz);
+	}
+      Yf[i] = svaddv (ptrue, ax);
+      Yf[NB + i] = svaddv (ptrue, ay);
+      Yf[2 * NB + i] = svaddv (ptrue, az);
+    }
+}
+#endif
+
+/* Twiddle factors of a complex FFT of size N, w_k = exp(-2 pi i k / N),
+   with the real parts in the first N outputs and the imaginary parts in
+   the next N.  */
+#define TW_STEP (2 * M_PI / N)
+
+static void
+tw_init (void)
+{
+}
+
+static void
+tw_ref (void)
+{
+  long double pi = acosl (-1);
+  for (int k = 0; k < N; k++)
+    {
+      R[k] = cosl (2 * pi * k / N);
+      R[N + k] = -sinl (2 * pi * k / N);
+    }
+}
+
+static void
+tw_scalar (void)
+{
+  for (int k = 0; k < N; k++)
+    {
+      double x = k * TW_STEP;
+      Y[k] = cos (x);
+      Y[N + k] = -sin (x);
+    }
+}
+
+#ifdef __vpcs
+static void
+tw_advsimd (void)
+{
+  float64x2_t k = { 0, 1 };
+  for (int i = 0; i < N; i += 2, k = vaddq_f64 (k, vdupq_n_f64 (2)))
+    {
+      float64x2_t s, c;
+      _ZGVnN2vl8l8_sincos (vmulq_n_f64 (k, TW_STEP), &s, &c);
+      vst1q_f64 (Y + i, c);
+      vst1q_f64 (Y + N + i, vnegq_f64 (s));
+    }
+}
+#endif
+
+#if WANT_SVE_MATH
+static void
+tw_sve (void)
+{
+  for (int i = 0; i < N; i += svcntd ())
+    {
+      svbool_t pg = svwhilelt_b64 (i, N);
+      svfloat64_t k = svcvt_f64_x (pg, svindex_s64 (i, 1));
+      _ZGVsMxvl8l8_sincos (svmul_n_f64_x (pg, k, TW_STEP), Y + N + i, Y + i,
+			   pg);
+      svst1 (pg, Y + N + i, svneg_x (pg, svld1 (pg, Y + N + i)));
+    }
+}
+#endif
+
+/* Paths of a geometric Brownian motion, with normal increments from the
+   Box-Muller transform:
+     z1, z2 = sqrt(-2 log(u1)) (cos(2 pi u2), sin(2 pi u2)),
+     S_t+1 = S_t exp((mu - sigma^2 / 2) dt + sigma sqrt(dt) z),
+   for daily steps, with mu = 0.05 and sigma = 0.2.  Output t * MC_PATHS + p
+   is the value of path p after step t.  */
+#define MC_STEPS 8
+#define MC_PATHS (N / MC_STEPS)
+#define MC_S0 100.0
+#define MC_DRIFT ((0.05 - 0.5 * 0.2 * 0.2) / 252)
+#define MC_VOL 0x1.9cd5f3d3ac1bp-7 /* 0.2 / sqrt(252).  */
+static double mc_u1[N / 2], mc_u2[N / 2];
+
+static void
+mc_init (void)
+{
+  for (int i = 0; i < N / 2; i++)
+    {
+      mc_u1[i] = frand (0x1p-30, 1);
+      mc_u2[i] = frand (0, 1);
+    }
+}
+
+static void
+mc_ref (void)
+{
+  long double pi = acosl (-1);
+  for (int p = 0; p < MC_PATHS; p++)
+    {
+      long double s = MC_S0;
+      for (int q = 0; q < MC_STEPS / 2; q++)
+	{
+	  long double r = sqrtl (-2 * logl (mc_u1[q * MC_PATHS + p]));
+	  long double t = 2 * pi * mc_u2[q * MC_PATHS + p];
+	  s *= expl (MC_DRIFT + MC_VOL * r * cosl (t));
+	  R[2 * q * MC_PATHS + p] = s;
+	  s *= expl (MC_DRIFT + MC_VOL * r * sinl (t));
+	  R[(2 * q + 1) * MC_PATHS + p] = s;
+	}
+    }
+}
+
+static void
+mc_scalar (void)
+{
+  for (int p = 0; p < MC_PATHS; p++)
+    {
+      double s = MC_S0;
+      for (int q = 0; q < MC_STEPS / 2; q++)
+	{
+	  double r = sqrt (-2 * log (mc_u1[q * MC_PATHS + p]));
+	  double t = 2 * M_PI * mc_u2[q * MC_PATHS + p];
+	  s *= exp (MC_DRIFT + MC_VOL * r * cos (t));
+	  Y[2 * q * MC_PATHS + p] = s;
+	  s *= exp (MC_DRIFT + MC_VOL * r * sin (t));
+	  Y[(2 * q + 1) * MC_PATHS + p] = s;
+	}
+    }
+}
+
+#ifdef __vpcs
+static void
+mc_advsimd (void)
+{
+  for (int p = 0; p < MC_PATHS; p += 2)
+    {
+      float64x2_t s = vdupq_n_f64 (MC_S0);
+      for (int q = 0; q < MC_STEPS / 2; q++)
+	{
+	  float64x2_t u1 = vld1q_f64 (mc_u1 + q * MC_PATHS + p);
+	  float64x2_t u2 = vld1q_f64 (mc_u2 + q * MC_PATHS + p);
+	  float64x2_t r = vsqrtq_f64 (vmulq_n_f64 (v_log (u1), -2));
+	  float64x2_t sn, cs;
+	  _ZGVnN2vl8l8_sincos (vmulq_n_f64 (u2, 2 * M_PI), &sn, &cs);
+	  r = vmulq_n_f64 (r, MC_VOL);
+	  s = vmulq_f64 (s, v_exp (vfmaq_f64 (vdupq_n_f64 (MC_DRIFT), r, cs)));
+	  vst1q_f64 (Y + 2 * q * MC_PATHS + p, s);
+	  s = vmulq_f64 (s, v_exp (vfmaq_f64 (vdupq_n_f64 (MC_DRIFT), r, sn)));
+	  vst1q_f64 (Y + (2 * q + 1) * MC_PATHS + p, s);
+	}
+    }
+}
+#endif
+
+#if WANT_SVE_MATH
+static double mc_sin[MC_PATHS], mc_cos[MC_PATHS];
+
+static void
+mc_sve (void)
+{
+  for (int p = 0; p < MC_PATHS; p += svcntd ())
+    {
+      svbool_t pg = svwhilelt_b64 (p, MC_PATHS);
+      svfloat64_t s = svdup_f64 (MC_S0);
+      for (int q = 0; q < MC_STEPS / 2; q++)
+	{
+	  svfloat64_t u1 = svld1 (pg, mc_u1 + q * MC_PATHS + p);
+	  svfloat64_t u2 = svld1 (pg, mc_u2 + q * MC_PATHS + p);
+	  svfloat64_t r
+	      = svsqrt_x (pg, svmul_n_f64_x (pg, _ZGVsMxv_log (u1, pg), -2));
+	  _ZGVsMxvl8l8_sincos (svmul_n_f64_x (pg, u2, 2 * M_PI), mc_sin + p,
+			       mc_cos + p, pg);
+	  r = svmul_n_f64_x (pg, r, MC_VOL);
+	  svfloat64_t z = svmla_x (pg, svdup_f64 (MC_DRIFT), r,
+				   svld1 (pg, mc_cos + p));
+	  s = svmul_x (pg, s, _ZGVsMxv_exp (z, pg));
+	  svst1 (pg, Y + 2 * q * MC_PATHS + p, s);
+	  z = svmla_x (pg, svdup_f64 (MC_DRIFT), r, svld1 (pg, mc_sin + p));
+	  s = svmul_x (pg, s, _ZGVsMxv_exp (z, pg));
+	  svst1 (pg, Y + (2 * q + 1) * MC_PATHS + p, s);
+	}
+    }
+}
+#endif
+
+#ifdef __vpcs
+# define ADVSIMD(f) f
+#else
+# define ADVSIMD(f) 0
+#endif
+#if WANT_SVE_MATH
+# define SVE(f) f
+#else
+# define SVE(f) 0
+#endif
+
+static const char *const variants[] = { "scalar", "advsimd", "sve" };
+
+static const struct app
+{
+  const char *name;
+  /* Routines used by the application.  */
+  const char *uses;
+  int prec;
+  /* Elements per run, for the ns/elem figures, and number of outputs.  */
+  int n, nout;
+  /* Limit of the normwise relative error max|y - r| / max|r|.  */
+  double tol;
+  void (*init) (void);
+  void (*ref) (void);
+  void (*run[3]) (void);
+} apps[] = {
+  { "blackscholes", "exp log erfc", 'd', N, N, 0x1p-40, bs_init, bs_ref,
+    { bs_scalar, ADVSIMD (bs_advsimd), SVE (bs_sve) } },
+  { "softmax_layernorm", "expf", 'f', N, N, 0x1p-16, sm_init, sm_ref,
+    { sm_scalar, ADVSIMD (sm_advsimd), SVE (sm_sve) } },
+  { "gelu_mlp", "erff", 'f', N, N, 0x1p-16, mlp_init, mlp_ref,
+    { mlp_scalar, ADVSIMD (mlp_advsimd), SVE (mlp_sve) } },
+  { "nbody", "rsqrt", 'f', NB * NB, 3 * NB, 0x1p-16, nb_init, nb_ref,
+    { nb_scalar, ADVSIMD (nb_advsimd), SVE (nb_sve) } },
+  { "fft_twiddle", "sincos", 'd', N, 2 * N, 0x1p-40, tw_init, tw_ref,
+    { tw_scalar, ADVSIMD (tw_advsimd), SVE (tw_sve) } },
+  { "montecarlo", "log sincos exp", 'd', N, N, 0x1p-40, mc_init, mc_ref,
+    { mc_scalar, ADVSIMD (mc_advsimd), SVE (mc_sve) } },
+  { 0 },
+};
+
+static uint64_t
+tic (void)
+{
+  struct timespec ts;
+  if (clock_gettime (CLOCK_REALTIME, &ts))
+    abort ();
+  return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static uint64_t
+timeit (void (*run) (void))
+{
+  uint64_t dt = -1;
+  run (); /* Warm up.  */
+  for (int j = 0; j < measurecount; j++)
+    {
+      uint64_t t0 = tic ();
+      for (int i = 0; i < itercount; i++)
+	run ();
+      uint64_t t1 = tic ();
+      if (t1 - t0 < dt)
+	dt = t1 - t0;
+    }
+  return dt;
+}
+
+/* Normwise relative error of the outputs of the last run.  */
+static double
+error (const struct app *a)
+{
+  long double maxerr = 0, maxref = 0;
+  for (int i = 0; i < a->nout; i++)
+    {
+      long double y = a->prec == 'd' ? Y[i] : Yf[i];
+      maxerr = fmaxl (maxerr, fabsl (y - R[i]));
+      maxref = fmaxl (maxref, fabsl (R[i]));
+    }
+  return maxerr / maxref;
+}
+
+static int
+bench (const struct app *a)
+{
+  uint64_t dt0 = 0;
+  int fail = 0;
+
+  a->init ();
+  a->ref ();
+  for (int v = 0; v < 3; v++)
+    {
+      if (!a->run[v])
+	continue;
+      memset (Y, 0, sizeof (Y));
+      memset (Yf, 0, sizeof (Yf));
+      uint64_t dt = timeit (a->run[v]);
+      if (v == 0)
+	dt0 = dt;
+      double err = error (a);
+      uint64_t ns100 = (100 * dt + itercount * a->n / 2) / (itercount * a->n);
+      printf ("%17s %7s: %4u.%02u ns/elem %5.2fx err %.3g (limit %.3g) %s\n",
+	      a->name, variants[v], (unsigned) (ns100 / 100),
+	      (unsigned) (ns100 % 100), (double) dt0 / dt, err, a->tol,
+	      err <= a->tol ? "" : "FAIL");
+      fflush (stdout);
+      fail |= !(err <= a->tol);
+    }
+  return fail;
+}
+
+static void
+usage (void)
+{
+  printf ("usage: ./appbench [-m measurements] [-c iterations] [app ..]\n");
+  printf ("app:\n");
+  printf ("%17s [run all applications, the default]\n", "all");
+  for (const struct app *a = apps; a->name; a++)
+    printf ("%17s [%s]\n", a->name, a->uses);
+  exit (1);
+}
+
+int
+main (int argc, char *argv[])
+{
+  int fail = 0;
+
+  argv++;
+  argc--;
+  for (; argc > 0 && argv[0][0] == '-';)
+    {
+      if (argc >= 2 && strcmp (argv[0], "-m") == 0)
+	measurecount = strtol (argv[1], 0, 0);
+      else if (argc >= 2 && strcmp (argv[0], "-c") == 0)
+	itercount = strtol (argv[1], 0, 0);
+      else
+	usage ();
+      argv += 2;
+      argc -= 2;
+    }
+  if (argc == 0)
+    {
+      argv[0] = "all";
+      argc = 1;
+    }
+  for (; argc > 0; argv++, argc--)
+    {
+      int found = 0;
+      for (const struct app *a = apps; a->name; a++)
+	if (strcmp (argv[0], "all") == 0 || strcmp (argv[0], a->name) == 0)
+	  {
+	    found = 1;
+	    fail |= bench (a);
+	  }
+      if (!found)
+	usage ();
+    }
+  return fail;
+}
@@ -2,7 +2,7 @@
 /*
  * Function entries for mathbench.
  *
- * Copyright (c) 2022-2023, Arm Limited.
+ * Copyright (c) 2022-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -53,6 +53,13 @@
 {"atan2f", 'f', 0, -10.0, 10.0, {.f = atan2f_wrap}},
 {"atan2",  'd', 0, -10.0, 10.0, {.d = atan2_wrap}},
 {"powi",   'd', 0,  0.01, 11.1, {.d = powi_wrap}},
+{"pown",   'd', 0,  0.01, 11.1, {.d = pown_wrap}},
+{"pown_pow", 'd', 0, 0.01, 11.1, {.d = pown_pow_wrap}},
+{"rootn",  'd', 0,  0.01, 11.1, {.d = rootn_wrap}},
+{"rootn_pow", 'd', 0, 0.01, 11.1, {.d = rootn_pow_wrap}},
+{"compoundn", 'd', 0, -0.01, 0.01, {.d = compoundn_wrap}},
+{"compoundn_pow", 'd', 0, -0.01, 0.01, {.d = compoundn_pow_wrap}},
+{"powr",   'd', 0,  0.01, 11.1, {.d = powr_wrap}},
 
 {"_ZGVnN4vv_atan2f", 'f', 'n', -10.0, 10.0, {.vnf = _Z_atan2f_wrap}},
 {"_ZGVnN2vv_atan2",  'd', 'n', -10.0, 10.0, {.vnd = _Z_atan2_wrap}},
@@ -61,16 +68,59 @@
 {"_ZGVnN2vv_pow",    'd', 'n', -10.0, 10.0, {.vnd = xy_Z_pow}},
 {"x_ZGVnN2vv_pow",   'd', 'n', -10.0, 10.0, {.vnd = x_Z_pow}},
 {"y_ZGVnN2vv_pow",   'd', 'n', -10.0, 10.0, {.vnd = y_Z_pow}},
+{"_ZGVnN2vv_pown",   'd', 'n', 0.01, 11.1, {.vnd = _Z_pown_wrap}},
+{"pown_ZGVnN2vv_pow", 'd', 'n', 0.01, 11.1, {.vnd = pown_Z_pow}},
+{"_ZGVnN2vv_rootn",  'd', 'n', 0.01, 11.1, {.vnd = _Z_rootn_wrap}},
+{"rootn_ZGVnN2vv_pow", 'd', 'n', 0.01, 11.1, {.vnd = rootn_Z_pow}},
+{"_ZGVnN2vv_compoundn", 'd', 'n', -0.01, 0.01, {.vnd = _Z_compoundn_wrap}},
+{"compoundn_ZGVnN2vv_pow", 'd', 'n', -0.01, 0.01, {.vnd = compoundn_Z_pow}},
+{"_ZGVnN2vv_powr",   'd', 'n', 0.01, 11.1, {.vnd = xy_Z_powr}},
+{"_ZGVnN4v_sincf", 'f', 'n', -10.0, 10.0, {.vnf = _ZGVnN4v_sincf}},
+{"_ZGVnN4v_sincpif", 'f', 'n', -10.0, 10.0, {.vnf = _ZGVnN4v_sincpif}},
+{"sincpif_ZGVnN4v_sinpif", 'f', 'n', -10.0, 10.0, {.vnf = sincpif_Z_sinpif}},
+{"windowed_sincpif_hann", 'f', 'n', -8.0, 8.0, {.vnf = _Z_windowed_sincpif_hann_wrap}},
+{"windowed_sincpif_hann_ZGVnN4v_cospif", 'f', 'n', -8.0, 8.0, {.vnf = windowed_sincpif_hann_Z_cospif}},
+{"windowed_sincpif_blackman", 'f', 'n', -8.0, 8.0, {.vnf = _Z_windowed_sincpif_blackman_wrap}},
+{"windowed_sincpif_blackman_ZGVnN4v_cospif", 'f', 'n', -8.0, 8.0, {.vnf = windowed_sincpif_blackman_Z_cospif}},
+{"windowed_sincpif_kaiser", 'f', 'n', -8.0, 8.0, {.vnf = _Z_windowed_sincpif_kaiser_wrap}},
+{"windowed_sincpif_kaiser_ZGVnN4v_i0f", 'f', 'n', -8.0, 8.0, {.vnf = windowed_sincpif_kaiser_Z_i0f}},
+{"log2_fixed", 'f', 'n', 0.01, 11.1, {.vnf = _Z_log2_fixed_wrap}},
+{"log2_fixed_ZGVnN4v_log2f", 'f', 'n', 0.01, 11.1, {.vnf = log2_fixed_Z_log2f}},
+{"exp2_fixed", 'f', 'n', -9.9, 9.9, {.vnf = _Z_exp2_fixed_wrap}},
+{"exp2_fixed_exp2f", 'f', 'n', -9.9, 9.9, {.vnf = exp2_fixed_exp2f}},
+{"q8_lookup", 'f', 'n', -10.0, 10.0, {.vnf = _Z_q8_lookup_wrap}},
+{"q8_lookup_ZGVnN4v_tanhf", 'f', 'n', -10.0, 10.0, {.vnf = q8_lookup_Z_tanhf}},
+{"entropyf", 'f', 0, 0.01, 1.0, {.f = entropyf_wrap}},
+{"entropyf_logf", 'f', 0, 0.01, 1.0, {.f = entropyf_logf_wrap}},
+{"kl_divf", 'f', 0, 0.01, 1.0, {.f = kl_divf_wrap}},
+{"entropy", 'd', 0, 0.01, 1.0, {.d = entropy_wrap}},
+{"entropy_log", 'd', 0, 0.01, 1.0, {.d = entropy_log_wrap}},
+{"kl_div", 'd', 0, 0.01, 1.0, {.d = kl_div_wrap}},
 {"_ZGVnN4vl4l4_sincosf", 'f', 'n', -3.1, 3.1, {.vnf = _Z_sincosf_wrap}},
 {"_ZGVnN2vl8l8_sincos", 'd', 'n', -3.1, 3.1, {.vnd = _Z_sincos_wrap}},
 {"_ZGVnN4v_cexpif", 'f', 'n', -3.1, 3.1, {.vnf = _Z_cexpif_wrap}},
 {"_ZGVnN2v_cexpi", 'd', 'n', -3.1, 3.1, {.vnd = _Z_cexpi_wrap}},
+{"_ZGVnN2v_log_dd", 'd', 'n', 0.01, 11.1, {.vnd = _Z_log_dd_wrap}},
+{"_ZGVnN2v_log1p_dd", 'd', 'n', -0.9, 10.0, {.vnd = _Z_log1p_dd_wrap}},
+{"_ZGVnN2vv_exp_dd", 'd', 'n', -9.9, 9.9, {.vnd = _Z_exp_dd_wrap}},
+{"_ZGVnN4vv_gamma_pf", 'f', 'n', 0.1, 10.0, {.vnf = _Z_gamma_pf_wrap}},
+{"_ZGVnN2vv_gamma_p",  'd', 'n', 0.1, 10.0, {.vnd = _Z_gamma_p_wrap}},
+{"_ZGVnN4vv_gamma_qf", 'f', 'n', 0.1, 10.0, {.vnf = _Z_gamma_qf_wrap}},
+{"_ZGVnN2vv_gamma_q",  'd', 'n', 0.1, 10.0, {.vnd = _Z_gamma_q_wrap}},
+{"_ZGVnN4vvv_beta_incf", 'f', 'n', 0.01, 0.99, {.vnf = _Z_beta_incf_wrap}},
+{"_ZGVnN2vvv_beta_inc",  'd', 'n', 0.01, 0.99, {.vnd = _Z_beta_inc_wrap}},
 
 #if WANT_SVE_MATH
 {"_ZGVsMxvv_atan2f", 'f', 's', -10.0, 10.0, {.svf = _Z_sv_atan2f_wrap}},
 {"_ZGVsMxvv_atan2",  'd', 's', -10.0, 10.0, {.svd = _Z_sv_atan2_wrap}},
 {"_ZGVsMxvv_hypotf", 'f', 's', -10.0, 10.0, {.svf = _Z_sv_hypotf_wrap}},
 {"_ZGVsMxvv_hypot",  'd', 's', -10.0, 10.0, {.svd = _Z_sv_hypot_wrap}},
+{"_ZGVsMxvv_gamma_pf", 'f', 's', 0.1, 10.0, {.svf = _Z_sv_gamma_pf_wrap}},
+{"_ZGVsMxvv_gamma_p",  'd', 's', 0.1, 10.0, {.svd = _Z_sv_gamma_p_wrap}},
+{"_ZGVsMxvv_gamma_qf", 'f', 's', 0.1, 10.0, {.svf = _Z_sv_gamma_qf_wrap}},
+{"_ZGVsMxvv_gamma_q",  'd', 's', 0.1, 10.0, {.svd = _Z_sv_gamma_q_wrap}},
+{"_ZGVsMxvvv_beta_incf", 'f', 's', 0.01, 0.99, {.svf = _Z_sv_beta_incf_wrap}},
+{"_ZGVsMxvvv_beta_inc",  'd', 's', 0.01, 0.99, {.svd = _Z_sv_beta_inc_wrap}},
 {"_ZGVsMxvv_powi",   'f', 's', -10.0, 10.0, {.svf = _Z_sv_powi_wrap}},
 {"_ZGVsMxvv_powk",   'd', 's', -10.0, 10.0, {.svd = _Z_sv_powk_wrap}},
 {"_ZGVsMxvv_powf",   'f', 's', -10.0, 10.0, {.svf = xy_Z_sv_powf}},
@@ -79,6 +129,17 @@
 {"_ZGVsMxvv_pow",    'd', 's', -10.0, 10.0, {.svd = xy_Z_sv_pow}},
 {"x_ZGVsMxvv_pow",   'd', 's', -10.0, 10.0, {.svd = x_Z_sv_pow}},
 {"y_ZGVsMxvv_pow",   'd', 's', -10.0, 10.0, {.svd = y_Z_sv_pow}},
+{"_ZGVsMxvv_pown",   'd', 's', 0.01, 11.1, {.svd = _Z_sv_pown_wrap}},
+{"pown_ZGVsMxvv_pow", 'd', 's', 0.01, 11.1, {.svd = pown_Z_sv_pow}},
+{"_ZGVsMxvv_rootn",  'd', 's', 0.01, 11.1, {.svd = _Z_sv_rootn_wrap}},
+{"rootn_ZGVsMxvv_pow", 'd', 's', 0.01, 11.1, {.svd = rootn_Z_sv_pow}},
+{"_ZGVsMxvv_compoundn", 'd', 's', -0.01, 0.01, {.svd = _Z_sv_compoundn_wrap}},
+{"compoundn_ZGVsMxvv_pow", 'd', 's', -0.01, 0.01, {.svd = compoundn_Z_sv_pow}},
+{"_ZGVsMxvv_powr",   'd', 's', 0.01, 11.1, {.svd = xy_Z_sv_powr}},
+{"_ZGVsMxv_sincf", 'f', 's', -10.0, 10.0, {.svf = _ZGVsMxv_sincf}},
+{"sincf_ZGVsMxv_sinf", 'f', 's', -10.0, 10.0, {.svf = sincf_Z_sv_sinf}},
+{"_ZGVsMxv_sincpif", 'f', 's', -10.0, 10.0, {.svf = _ZGVsMxv_sincpif}},
+{"sincpif_ZGVsMxv_sinpif", 'f', 's', -10.0, 10.0, {.svf = sincpif_Z_sv_sinpif}},
 {"_ZGVsMxvl4l4_sincosf", 'f', 's', -3.1, 3.1, {.svf = _Z_sv_sincosf_wrap}},
 {"_ZGVsMxvl8l8_sincos", 'd', 's', -3.1, 3.1, {.svd = _Z_sv_sincos_wrap}},
 {"_ZGVsMxv_cexpif", 'f', 's', -3.1, 3.1, {.svf = _Z_sv_cexpif_wrap}},
@@ -1,7 +1,7 @@
 /*
  * Function wrappers for mathbench.
  *
- * Copyright (c) 2022-2023, Arm Limited.
+ * Copyright (c) 2022-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -23,6 +23,50 @@ powi_wrap (double x)
   return __builtin_powi (x, (int) round (x));
 }
 
+/* pown, rootn and compoundn are benchmarked against the equivalent call to
+   pow.  */
+static double
+pown_wrap (double x)
+{
+  return pown (x, 12);
+}
+
+static double
+pown_pow_wrap (double x)
+{
+  return pow (x, 12.0);
+}
+
+static double
+rootn_wrap (double x)
+{
+  return rootn (x, 3);
+}
+
+static double
+rootn_pow_wrap (double x)
+{
+  return pow (x, 1.0 / 3);
+}
+
+static double
+compoundn_wrap (double x)
+{
+  return compoundn (x, 360);
+}
+
+static double
+compoundn_pow_wrap (double x)
+{
+  return pow (1 + x, 360.0);
+}
+
+static double
+powr_wrap (double x)
+{
+  return powr (x, x);
+}
+
 #if __aarch64__ && defined(__vpcs)
 
 __vpcs static v_double
@@ -67,6 +111,239 @@ y_Z_pow (v_double x)
   return _ZGVnN2vv_pow (v_double_dup (2.34), x);
 }
 
+__vpcs static v_double
+_Z_pown_wrap (v_double x)
+{
+  return _ZGVnN2vv_pown (x, vdupq_n_s64 (12));
+}
+
+__vpcs static v_double
+pown_Z_pow (v_double x)
+{
+  return _ZGVnN2vv_pow (x, v_double_dup (12.0));
+}
+
+__vpcs static v_double
+_Z_rootn_wrap (v_double x)
+{
+  return _ZGVnN2vv_rootn (x, vdupq_n_s64 (3));
+}
+
+__vpcs static v_double
+rootn_Z_pow (v_double x)
+{
+  return _ZGVnN2vv_pow (x, v_double_dup (1.0 / 3));
+}
+
+__vpcs static v_double
+_Z_compoundn_wrap (v_double x)
+{
+  return _ZGVnN2vv_compoundn (x, vdupq_n_s64 (360));
+}
+
+__vpcs static v_double
+compoundn_Z_pow (v_double x)
+{
+  return _ZGVnN2vv_pow (x + 1, v_double_dup (360.0));
+}
+
+__vpcs static v_double
+xy_Z_powr (v_double x)
+{
+  return _ZGVnN2vv_powr (x, x);
+}
+
+/* sincpif is benchmarked against the equivalent call to sinpif followed by
+   a division, and the windowed sinc kernels against sinpif and the window
+   evaluated with cospif or i0f.  The kernels use c = 0.75 and hw = 8, and
+   are called on one vector.  */
+__vpcs static v_float
+sincpif_Z_sinpif (v_float x)
+{
+  return _ZGVnN4v_sinpif (x) / (v_float_dup (0x1.921fb6p+1f) * x);
+}
+
+#define WINDOW_WRAP(w, ...)                                                   \
+  __vpcs static v_float _Z_windowed_sincpif_##w##_wrap (v_float x)            \
+  {                                                                           \
+    float in[4], out[4];                                                      \
+    vst1q_f32 (in, x);                                                        \
+    windowed_sincpif_##w (out, in, 4, 0.75f, 8.0f, ##__VA_ARGS__);            \
+    return vld1q_f32 (out);                                                   \
+  }
+WINDOW_WRAP (hann)
+WINDOW_WRAP (blackman)
+WINDOW_WRAP (kaiser, 8.6f)
+
+__vpcs static v_float
+windowed_sincpif_hann_Z_cospif (v_float x)
+{
+  v_float u = x * v_float_dup (0.125f);
+  return sincpif_Z_sinpif (x * v_float_dup (0.75f))
+	 * (v_float_dup (0.5f) + v_float_dup (0.5f) * _ZGVnN4v_cospif (u));
+}
+
+__vpcs static v_float
+windowed_sincpif_blackman_Z_cospif (v_float x)
+{
+  v_float u = x * v_float_dup (0.125f);
+  return sincpif_Z_sinpif (x * v_float_dup (0.75f))
+	 * (v_float_dup (0.42f) + v_float_dup (0.5f) * _ZGVnN4v_cospif (u)
+	    + v_float_dup (0.08f) * _ZGVnN4v_cospif (u + u));
+}
+
+__vpcs static v_float
+windowed_sincpif_kaiser_Z_i0f (v_float x)
+{
+  v_float u = x * v_float_dup (0.125f);
+  v_float t = v_float_dup (8.6f) * vsqrtq_f32 (v_float_dup (1.0f) - u * u);
+  /* 1 / i0(8.6).  */
+  return sincpif_Z_sinpif (x * v_float_dup (0.75f)) * _ZGVnN4v_i0f (t)
+	 * v_float_dup (0x1.5d4f80p-10f);
+}
+
+/* The fixed-point routines are called on one vector in Q16, and compared
+   with the conversion to floating point around log2f, or exp2f, which is
+   what they replace.  The inputs are converted from float in all cases.  */
+__vpcs static v_float
+_Z_log2_fixed_wrap (v_float x)
+{
+  uint32_t in[4];
+  int32_t out[4];
+  vst1q_u32 (in, vcvtq_n_u32_f32 (x, 16));
+  log2_fixed (out, in, 4, 16, 16);
+  return vcvtq_n_f32_s32 (vld1q_s32 (out), 16);
+}
+
+__vpcs static v_float
+log2_fixed_Z_log2f (v_float x)
+{
+  v_float y = _ZGVnN4v_log2f (vcvtq_n_f32_u32 (vcvtq_n_u32_f32 (x, 16), 16));
+  return vcvtq_n_f32_s32 (vcvtq_n_s32_f32 (y, 16), 16);
+}
+
+__vpcs static v_float
+_Z_exp2_fixed_wrap (v_float x)
+{
+  int32_t in[4];
+  uint32_t out[4];
+  vst1q_s32 (in, vcvtq_n_s32_f32 (x, 16));
+  exp2_fixed (out, in, 4, 16, 16);
+  return vcvtq_n_f32_u32 (vld1q_u32 (out), 16);
+}
+
+/* There is no AdvSIMD exp2f in pl/math, so the lanes call scalar exp2f.  */
+__vpcs static v_float
+exp2_fixed_exp2f (v_float x)
+{
+  float t[4];
+  vst1q_f32 (t, vcvtq_n_f32_s32 (vcvtq_n_s32_f32 (x, 16), 16));
+  for (int i = 0; i < 4; i++)
+    t[i] = exp2f (t[i]);
+  return vcvtq_n_f32_u32 (vcvtq_n_u32_f32 (vld1q_f32 (t), 16), 16);
+}
+
+/* The quantised lookup is called on the 16 bytes of one vector, and
+   compared with dequantising them and calling tanhf, with the parameters of
+   the ulp tests.  The contents of the table do not affect the timing.  */
+static uint8_t q8_tab[256];
+
+__vpcs static v_float
+_Z_q8_lookup_wrap (v_float x)
+{
+  uint8_t b[16];
+  vst1q_u8 (b, vreinterpretq_u8_f32 (x));
+  q8_lookup (b, b, 16, q8_tab);
+  return vreinterpretq_f32_u8 (vld1q_u8 (b));
+}
+
+__vpcs static v_float
+q8_lookup_Z_tanhf (v_float x)
+{
+  int8x16_t b = vreinterpretq_s8_f32 (x);
+  int16x8_t lo = vmovl_s8 (vget_low_s8 (b)), hi = vmovl_high_s8 (b);
+  int32x4_t q[4] = { vmovl_s16 (vget_low_s16 (lo)), vmovl_high_s16 (lo),
+		     vmovl_s16 (vget_low_s16 (hi)), vmovl_high_s16 (hi) };
+  for (int i = 0; i < 4; i++)
+    {
+      v_float y = _ZGVnN4v_tanhf (vcvtq_f32_s32 (q[i]) * v_float_dup (0x1p-5f));
+      q[i] = vcvtnq_s32_f32 (y * v_float_dup (0x1p7f));
+    }
+  lo = vcombine_s16 (vqmovn_s32 (q[0]), vqmovn_s32 (q[1]));
+  hi = vcombine_s16 (vqmovn_s32 (q[2]), vqmovn_s32 (q[3]));
+  return vreinterpretq_f32_s8 (vcombine_s8 (vqmovn_s16 (lo), vqmovn_s16 (hi)));
+}
+
+/* The reductions are called on a fixed array of 256 probabilities, and
+   compared with the equivalent loop around scalar logf or log.  x does not
+   affect the timing.  */
+#define REDUCE_N 256
+static float reduce_pf[REDUCE_N], reduce_qf[REDUCE_N];
+static double reduce_p[REDUCE_N], reduce_q[REDUCE_N];
+
+static void
+reduce_init (void)
+{
+  if (reduce_p[0] != 0)
+    return;
+  for (int i = 0; i < REDUCE_N; i++)
+    {
+      /* The probabilities are proportional to i + 1.  */
+      reduce_p[i] = (i + 1) * (2.0 / (REDUCE_N * (REDUCE_N + 1)));
+      reduce_pf[i] = reduce_p[i];
+      reduce_q[REDUCE_N - 1 - i] = reduce_p[i];
+      reduce_qf[REDUCE_N - 1 - i] = reduce_pf[i];
+    }
+}
+
+static float
+entropyf_wrap (float x)
+{
+  reduce_init ();
+  return entropyf (reduce_pf, REDUCE_N) + x;
+}
+
+static float
+entropyf_logf_wrap (float x)
+{
+  float s = 0;
+  reduce_init ();
+  for (int i = 0; i < REDUCE_N; i++)
+    s -= reduce_pf[i] * logf (reduce_pf[i]);
+  return s + x;
+}
+
+static float
+kl_divf_wrap (float x)
+{
+  reduce_init ();
+  return kl_divf (reduce_pf, reduce_qf, REDUCE_N) + x;
+}
+
+static double
+entropy_wrap (double x)
+{
+  reduce_init ();
+  return entropy (reduce_p, REDUCE_N) + x;
+}
+
+static double
+entropy_log_wrap (double x)
+{
+  double s = 0;
+  reduce_init ();
+  for (int i = 0; i < REDUCE_N; i++)
+    s -= reduce_p[i] * log (reduce_p[i]);
+  return s + x;
+}
+
+static double
+kl_div_wrap (double x)
+{
+  reduce_init ();
+  return kl_div (reduce_p, reduce_q, REDUCE_N) + x;
+}
+
 __vpcs static v_float
 _Z_sincosf_wrap (v_float x)
 {
@@ -97,6 +374,62 @@ _Z_cexpi_wrap (v_double x)
   return sc.val[0] + sc.val[1];
 }
 
+__vpcs static v_double
+_Z_log_dd_wrap (v_double x)
+{
+  __f64x2x2_t y = _ZGVnN2v_log_dd (x);
+  return y.val[0] + y.val[1];
+}
+
+__vpcs static v_double
+_Z_log1p_dd_wrap (v_double x)
+{
+  __f64x2x2_t y = _ZGVnN2v_log1p_dd (x);
+  return y.val[0] + y.val[1];
+}
+
+__vpcs static v_double
+_Z_exp_dd_wrap (v_double x)
+{
+  return _ZGVnN2vv_exp_dd (x, x * 0x1p-60);
+}
+
+__vpcs static v_float
+_Z_gamma_pf_wrap (v_float x)
+{
+  return _ZGVnN4vv_gamma_pf (v_float_dup (5.0f), x);
+}
+
+__vpcs static v_double
+_Z_gamma_p_wrap (v_double x)
+{
+  return _ZGVnN2vv_gamma_p (v_double_dup (5.0), x);
+}
+
+__vpcs static v_float
+_Z_gamma_qf_wrap (v_float x)
+{
+  return _ZGVnN4vv_gamma_qf (v_float_dup (5.0f), x);
+}
+
+__vpcs static v_double
+_Z_gamma_q_wrap (v_double x)
+{
+  return _ZGVnN2vv_gamma_q (v_double_dup (5.0), x);
+}
+
+__vpcs static v_float
+_Z_beta_incf_wrap (v_float x)
+{
+  return _ZGVnN4vvv_beta_incf (v_float_dup (5.0f), v_float_dup (2.5f), x);
+}
+
+__vpcs static v_double
+_Z_beta_inc_wrap (v_double x)
+{
+  return _ZGVnN2vvv_beta_inc (v_double_dup (5.0), v_double_dup (2.5), x);
+}
+
 #endif // __arch64__ && __vpcs
 
 #if WANT_SVE_MATH
@@ -125,6 +458,42 @@ _Z_sv_hypot_wrap (sv_double x, sv_bool pg)
   return _ZGVsMxvv_hypot (x, svdup_f64 (5.0), pg);
 }
 
+static sv_float
+_Z_sv_gamma_pf_wrap (sv_float x, sv_bool pg)
+{
+  return _ZGVsMxvv_gamma_pf (svdup_f32 (5.0f), x, pg);
+}
+
+static sv_double
+_Z_sv_gamma_p_wrap (sv_double x, sv_bool pg)
+{
+  return _ZGVsMxvv_gamma_p (svdup_f64 (5.0), x, pg);
+}
+
+static sv_float
+_Z_sv_gamma_qf_wrap (sv_float x, sv_bool pg)
+{
+  return _ZGVsMxvv_gamma_qf (svdup_f32 (5.0f), x, pg);
+}
+
+static sv_double
+_Z_sv_gamma_q_wrap (sv_double x, sv_bool pg)
+{
+  return _ZGVsMxvv_gamma_q (svdup_f64 (5.0), x, pg);
+}
+
+static sv_float
+_Z_sv_beta_incf_wrap (sv_float x, sv_bool pg)
+{
+  return _ZGVsMxvvv_beta_incf (svdup_f32 (5.0f), svdup_f32 (2.5f), x, pg);
+}
+
+static sv_double
+_Z_sv_beta_inc_wrap (sv_double x, sv_bool pg)
+{
+  return _ZGVsMxvvv_beta_inc (svdup_f64 (5.0), svdup_f64 (2.5), x, pg);
+}
+
 static sv_float
 _Z_sv_powi_wrap (sv_float x, sv_bool pg)
 {
@@ -173,6 +542,61 @@ y_Z_sv_pow (sv_double x, sv_bool pg)
   return _ZGVsMxvv_pow (svdup_f64 (2.34), x, pg);
 }
 
+static sv_double
+_Z_sv_pown_wrap (sv_double x, sv_bool pg)
+{
+  return _ZGVsMxvv_pown (x, svdup_s64 (12), pg);
+}
+
+static sv_double
+pown_Z_sv_pow (sv_double x, sv_bool pg)
+{
+  return _ZGVsMxvv_pow (x, svdup_f64 (12.0), pg);
+}
+
+static sv_double
+_Z_sv_rootn_wrap (sv_double x, sv_bool pg)
+{
+  return _ZGVsMxvv_rootn (x, svdup_s64 (3), pg);
+}
+
+static sv_double
+rootn_Z_sv_pow (sv_double x, sv_bool pg)
+{
+  return _ZGVsMxvv_pow (x, svdup_f64 (1.0 / 3), pg);
+}
+
+static sv_double
+_Z_sv_compoundn_wrap (sv_double x, sv_bool pg)
+{
+  return _ZGVsMxvv_compoundn (x, svdup_s64 (360), pg);
+}
+
+static sv_double
+compoundn_Z_sv_pow (sv_double x, sv_bool pg)
+{
+  return _ZGVsMxvv_pow (svadd_x (pg, x, 1.0), svdup_f64 (360.0), pg);
+}
+
+static sv_double
+xy_Z_sv_powr (sv_double x, sv_bool pg)
+{
+  return _ZGVsMxvv_powr (x, x, pg);
+}
+
+static sv_float
+sincf_Z_sv_sinf (sv_float x, sv_bool pg)
+{
+  return svdiv_x (pg, _ZGVsMxv_sinf (x, pg), x);
+}
+
+static sv_float
+sincpif_Z_sv_sinpif (sv_float x, sv_bool pg)
+{
+  return svdiv_x (pg, _ZGVsMxv_sinpif (x, pg),
+		  svmul_x (pg, x, 0x1.921fb6p+1f));
+}
+
 static sv_float
 _Z_sv_sincosf_wrap (sv_float x, sv_bool pg)
 {
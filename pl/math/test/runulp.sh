@@ -2,7 +2,7 @@
 
 # ULP error check script.
 #
-# Copyright (c) 2019-2023, Arm Limited.
+# Copyright (c) 2019-2026, Arm Limited.
 # SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
 
 #set -x
@@ -65,6 +65,35 @@ check -q -f -e 0 _ZGVsMxvv_powk  0  inf x -0 -1000 100000 && runsv=1
 check -q -f -e 0 _ZGVsMxvv_powk -0 -inf x -0 -1000 100000 && runsv=1
 fi
 
+# The fixed-point routines are regression-tested for exactness w.r.t. the
+# scalar references in log2_exp2_fixed_references.c,
+check -q -f -e 0 log2_fixed_q16 0 1 10
+check -q -f -e 0 log2_fixed_q16 1 0x1.fffffffep31 100000
+check -q -f -e 0 log2_fixed_q24 0 1 10
+check -q -f -e 0 log2_fixed_q24 1 0x1.fffffffep31 100000
+check -q -f -e 0 exp2_fixed_q16  1  0x1.fffffffcp30 100000
+check -q -f -e 0 exp2_fixed_q16 -0 -0x1p31 100000
+check -q -f -e 0 exp2_fixed_q24  1  0x1.fffffffcp30 100000
+check -q -f -e 0 exp2_fixed_q24 -0 -0x1p31 100000
+# and for accuracy w.r.t. the real functions, with the error in LSB.  exp2 is
+# only checked for results below 2^29, above which its error is relative.
+check -q -f -e 0 log2_fixed_q16_lsb 1 0x1.fffffffep31 100000
+check -q -f -e 0.03 log2_fixed_q24_lsb 1 0x1.fffffffep31 100000
+check -q -f -e 0.43 exp2_fixed_q16_lsb  1  0x1.9fffep19 100000
+check -q -f -e 0.43 exp2_fixed_q16_lsb -0 -0x1p31 100000
+check -q -f -e 0.43 exp2_fixed_q24_lsb  1  0x1.3fffffcp26 100000
+check -q -f -e 0.43 exp2_fixed_q24_lsb -0 -0x1p31 100000
+
+# The quantised activation kernels are checked for exactness w.r.t. the
+# float routines in ulp_wrappers.h
+for f in q8_sigmoid q8_tanh q8_gelu; do
+check -q -f -e 0 $f  0  1 10
+check -q -f -e 0 $f  1  127 10000
+check -q -f -e 0 $f -1 -128 10000
+done
+check -q -f -e 0 q8_exp 0 1 10
+check -q -f -e 0 q8_exp 1 255 10000
+
 while read F LO HI N C
 do
 	t $F $LO $HI $N $C
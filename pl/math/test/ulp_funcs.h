@@ -1,7 +1,7 @@
 /*
  * Function entries for ulp.
  *
- * Copyright (c) 2022-2023, Arm Limited.
+ * Copyright (c) 2022-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -44,6 +44,11 @@
 
 #include "ulp_funcs_gen.h"
 
+F (pown, pown_wrap, ref_pown, wrap_mpfr_pown, 2, 0, d2, 0)
+F (powr, powr, ref_powr, wrap_mpfr_powr, 2, 0, d2, 0)
+F (rootn, rootn_wrap, ref_rootn, wrap_mpfr_rootn, 2, 0, d2, 0)
+F (compoundn, compoundn_wrap, ref_compoundn, wrap_mpfr_compoundn, 2, 0, d2, 0)
+
 F (_ZGVnN4v_sincosf_sin, v_sincosf_sin, sin, mpfr_sin, 1, 1, f1, 0)
 F (_ZGVnN4v_sincosf_cos, v_sincosf_cos, cos, mpfr_cos, 1, 1, f1, 0)
 F (_ZGVnN4v_cexpif_sin, v_cexpif_sin, sin, mpfr_sin, 1, 1, f1, 0)
@@ -53,10 +58,57 @@ F (_ZGVnN2v_sincos_sin, v_sincos_sin, sinl, mpfr_sin, 1, 0, d1, 0)
 F (_ZGVnN2v_sincos_cos, v_sincos_cos, cosl, mpfr_cos, 1, 0, d1, 0)
 F (_ZGVnN2v_cexpi_sin, v_cexpi_sin, sinl, mpfr_sin, 1, 0, d1, 0)
 F (_ZGVnN2v_cexpi_cos, v_cexpi_cos, cosl, mpfr_cos, 1, 0, d1, 0)
+F (_ZGVnN2v_log_dd_hi, v_log_dd_hi, logl, mpfr_log, 1, 0, d1, 0)
+F (_ZGVnN2v_log1p_dd_hi, v_log1p_dd_hi, log1pl, mpfr_log1p, 1, 0, d1, 0)
+F (_ZGVnN2v_log_dd_hilo, v_log_dd_hilo, v_log_dd_hilo_ref, v_log_dd_hilo_mpfr, 1, 0, d1, 0)
+F (_ZGVnN2v_log1p_dd_hilo, v_log1p_dd_hilo, v_log1p_dd_hilo_ref, v_log1p_dd_hilo_mpfr, 1, 0, d1, 0)
+F (_ZGVnN2vv_exp_dd, v_exp_dd, v_exp_dd_ref, v_exp_dd_mpfr, 1, 0, d1, 0)
+F (_ZGVnN2v_digamma_abs, v_digamma_abs, ref_digamma_abs, mpfr_digamma_abs, 1, 0, d1, 0)
+F (_ZGVnN4vv_beta_incf_sym, v_beta_incf_sym, beta_inc_sym, mpfr_beta_inc_sym, 2, 1, f2, 0)
+F (_ZGVnN4vv_beta_incf_half, v_beta_incf_half, beta_inc_half, mpfr_beta_inc_half, 2, 1, f2, 0)
+F (_ZGVnN4vv_beta_incf_mean, v_beta_incf_mean, beta_inc_mean, mpfr_beta_inc_mean, 2, 1, f2, 0)
+F (_ZGVnN2vv_beta_inc_sym, v_beta_inc_sym, beta_inc_syml, mpfr_beta_inc_sym, 2, 0, d2, 0)
+F (_ZGVnN2vv_beta_inc_half, v_beta_inc_half, beta_inc_halfl, mpfr_beta_inc_half, 2, 0, d2, 0)
+F (_ZGVnN2vv_beta_inc_mean, v_beta_inc_mean, beta_inc_meanl, mpfr_beta_inc_mean, 2, 0, d2, 0)
+F (_ZGVnN2vv_pown, v_pown, ref_pown, wrap_mpfr_pown, 2, 0, d2, 0)
+F (_ZGVnN2vv_powr, v_powr, ref_powr, wrap_mpfr_powr, 2, 0, d2, 0)
+F (_ZGVnN2vv_rootn, v_rootn, ref_rootn, wrap_mpfr_rootn, 2, 0, d2, 0)
+F (_ZGVnN2vv_compoundn, v_compoundn, ref_compoundn, wrap_mpfr_compoundn, 2, 0, d2, 0)
+F (_ZGVnN4v_sincf, v_sincf, ref_sinc, wrap_mpfr_sinc, 1, 1, f1, 0)
+F (_ZGVnN4v_sincpif, v_sincpif, ref_sincpi, wrap_mpfr_sincpi, 1, 1, f1, 0)
+F (windowed_sincpif_hann, windowed_sincpif_hann_wrap, ref_windowed_sincpi_hann, wrap_mpfr_windowed_sincpi_hann, 1, 1, f1, 0)
+F (windowed_sincpif_blackman, windowed_sincpif_blackman_wrap, ref_windowed_sincpi_blackman, wrap_mpfr_windowed_sincpi_blackman, 1, 1, f1, 0)
+F (windowed_sincpif_kaiser, windowed_sincpif_kaiser_wrap, ref_windowed_sincpi_kaiser, wrap_mpfr_windowed_sincpi_kaiser, 1, 1, f1, 0)
+F (log2_fixed_q16, log2_fixed_q16, ref_log2_fixed_q16, wrap_mpfr_log2_fixed_q16, 1, 0, d1, 0)
+F (log2_fixed_q24, log2_fixed_q24, ref_log2_fixed_q24, wrap_mpfr_log2_fixed_q24, 1, 0, d1, 0)
+F (exp2_fixed_q16, exp2_fixed_q16, ref_exp2_fixed_q16, wrap_mpfr_exp2_fixed_q16, 1, 0, d1, 0)
+F (exp2_fixed_q24, exp2_fixed_q24, ref_exp2_fixed_q24, wrap_mpfr_exp2_fixed_q24, 1, 0, d1, 0)
+F (log2_fixed_q16_lsb, log2_fixed_q16_lsb, ref_log2_fixed_q16_lsb, wrap_mpfr_log2_fixed_q16_lsb, 1, 0, d1, 0)
+F (log2_fixed_q24_lsb, log2_fixed_q24_lsb, ref_log2_fixed_q24_lsb, wrap_mpfr_log2_fixed_q24_lsb, 1, 0, d1, 0)
+F (exp2_fixed_q16_lsb, exp2_fixed_q16_lsb, ref_exp2_fixed_q16_lsb, wrap_mpfr_exp2_fixed_q16_lsb, 1, 0, d1, 0)
+F (exp2_fixed_q24_lsb, exp2_fixed_q24_lsb, ref_exp2_fixed_q24_lsb, wrap_mpfr_exp2_fixed_q24_lsb, 1, 0, d1, 0)
+F (q8_sigmoid, q8_sigmoid, ref_q8_sigmoid, wrap_mpfr_q8_sigmoid, 1, 1, f1, 0)
+F (q8_tanh, q8_tanh, ref_q8_tanh, wrap_mpfr_q8_tanh, 1, 1, f1, 0)
+F (q8_gelu, q8_gelu, ref_q8_gelu, wrap_mpfr_q8_gelu, 1, 1, f1, 0)
+F (q8_exp, q8_exp, ref_q8_exp, wrap_mpfr_q8_exp, 1, 1, f1, 0)
+F (entropyf, entropyf_wrap, ref_entropyf, wrap_mpfr_entropyf, 1, 1, f1, 0)
+F (entropy, entropy_wrap, ref_entropy, wrap_mpfr_entropy, 1, 0, d1, 0)
+F (cross_entropyf, cross_entropyf_wrap, ref_cross_entropyf, wrap_mpfr_cross_entropyf, 1, 1, f1, 0)
+F (cross_entropy, cross_entropy_wrap, ref_cross_entropy, wrap_mpfr_cross_entropy, 1, 0, d1, 0)
+F (kl_divf, kl_divf_wrap, ref_kl_divf, wrap_mpfr_kl_divf, 1, 1, f1, 0)
+F (kl_div, kl_div_wrap, ref_kl_div, wrap_mpfr_kl_div, 1, 0, d1, 0)
+F (entropy_countsf, entropy_countsf_wrap, ref_entropy_countsf, wrap_mpfr_entropy_counts, 1, 1, f1, 0)
+F (entropy_counts, entropy_counts_wrap, ref_entropy_counts, wrap_mpfr_entropy_counts, 1, 0, d1, 0)
 
 #if WANT_SVE_MATH
 F (_ZGVsMxvv_powk, Z_sv_powk, ref_powi, mpfr_powi, 2, 0, d2, 0)
 F (_ZGVsMxvv_powi, Z_sv_powi, ref_powif, mpfr_powi, 2, 1, f2, 0)
+F (_ZGVsMxvv_pown, Z_sv_pown, ref_pown, wrap_mpfr_pown, 2, 0, d2, 0)
+F (_ZGVsMxvv_powr, Z_sv_powr, ref_powr, wrap_mpfr_powr, 2, 0, d2, 0)
+F (_ZGVsMxvv_rootn, Z_sv_rootn, ref_rootn, wrap_mpfr_rootn, 2, 0, d2, 0)
+F (_ZGVsMxvv_compoundn, Z_sv_compoundn, ref_compoundn, wrap_mpfr_compoundn, 2, 0, d2, 0)
+F (_ZGVsMxv_sincf, Z_sv_sincf, ref_sinc, wrap_mpfr_sinc, 1, 1, f1, 0)
+F (_ZGVsMxv_sincpif, Z_sv_sincpif, ref_sincpi, wrap_mpfr_sincpi, 1, 1, f1, 0)
 
 F (_ZGVsMxv_sincosf_sin, sv_sincosf_sin, sin, mpfr_sin, 1, 1, f1, 0)
 F (_ZGVsMxv_sincosf_cos, sv_sincosf_cos, cos, mpfr_cos, 1, 1, f1, 0)
@@ -67,4 +119,11 @@ F (_ZGVsMxv_sincos_sin, sv_sincos_sin, sinl, mpfr_sin, 1, 0, d1, 0)
 F (_ZGVsMxv_sincos_cos, sv_sincos_cos, cosl, mpfr_cos, 1, 0, d1, 0)
 F (_ZGVsMxv_cexpi_sin, sv_cexpi_sin, sinl, mpfr_sin, 1, 0, d1, 0)
 F (_ZGVsMxv_cexpi_cos, sv_cexpi_cos, cosl, mpfr_cos, 1, 0, d1, 0)
+F (_ZGVsMxv_digamma_abs, sv_digamma_abs, ref_digamma_abs, mpfr_digamma_abs, 1, 0, d1, 0)
+F (_ZGVsMxvv_beta_incf_sym, sv_beta_incf_sym, beta_inc_sym, mpfr_beta_inc_sym, 2, 1, f2, 0)
+F (_ZGVsMxvv_beta_incf_half, sv_beta_incf_half, beta_inc_half, mpfr_beta_inc_half, 2, 1, f2, 0)
+F (_ZGVsMxvv_beta_incf_mean, sv_beta_incf_mean, beta_inc_mean, mpfr_beta_inc_mean, 2, 1, f2, 0)
+F (_ZGVsMxvv_beta_inc_sym, sv_beta_inc_sym, beta_inc_syml, mpfr_beta_inc_sym, 2, 0, d2, 0)
+F (_ZGVsMxvv_beta_inc_half, sv_beta_inc_half, beta_inc_halfl, mpfr_beta_inc_half, 2, 0, d2, 0)
+F (_ZGVsMxvv_beta_inc_mean, sv_beta_inc_mean, beta_inc_meanl, mpfr_beta_inc_mean, 2, 0, d2, 0)
 #endif
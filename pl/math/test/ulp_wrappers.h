@@ -2,7 +2,7 @@
 /*
  * Function wrappers for ulp.
  *
- * Copyright (c) 2022-2023, Arm Limited.
+ * Copyright (c) 2022-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -25,6 +25,389 @@ static int wrap_mpfr_powi(mpfr_t ret, const mpfr_t x, const mpfr_t y, mpfr_rnd_t
   mpfr_trunc(y2, y);
   return mpfr_pow(ret, x, y2, rnd);
 }
+/* The integer argument of pown, rootn and compoundn is passed as a double
+   and rounded, as in the scalar wrappers below.  */
+static int wrap_mpfr_pown(mpfr_t ret, const mpfr_t x, const mpfr_t y, mpfr_rnd_t rnd) {
+  mpfr_t n;
+  mpfr_init2(n, 64);
+  mpfr_round(n, y);
+  int r = mpfr_pow(ret, x, n, rnd);
+  mpfr_clear(n);
+  return r;
+}
+static int wrap_mpfr_rootn(mpfr_t ret, const mpfr_t x, const mpfr_t y, mpfr_rnd_t rnd) {
+  long n = lround(mpfr_get_d(y, MPFR_RNDN));
+  if (n == 0) {
+    mpfr_set_nan(ret);
+    return 0;
+  }
+  if (n > 0)
+    return mpfr_rootn_ui(ret, x, n, rnd);
+  mpfr_t t;
+  mpfr_init2(t, mpfr_get_prec(ret) + 32);
+  mpfr_rootn_ui(t, x, -(unsigned long) n, MPFR_RNDN);
+  int r = mpfr_ui_div(ret, 1, t, rnd);
+  mpfr_clear(t);
+  return r;
+}
+static int wrap_mpfr_compoundn(mpfr_t ret, const mpfr_t x, const mpfr_t y, mpfr_rnd_t rnd) {
+  long n = lround(mpfr_get_d(y, MPFR_RNDN));
+  if (n == 0 && !(mpfr_cmp_si(x, -1) < 0))
+    return mpfr_set_ui(ret, 1, rnd);
+  if (mpfr_nan_p(x) || mpfr_cmp_si(x, -1) < 0) {
+    mpfr_set_nan(ret);
+    return 0;
+  }
+  /* n log1p(x) needs 64 bits more than the result for |n| up to 2^63.  */
+  mpfr_t t;
+  mpfr_init2(t, mpfr_get_prec(ret) + 128);
+  mpfr_log1p(t, x, MPFR_RNDN);
+  mpfr_mul_si(t, t, n, MPFR_RNDN);
+  int r = mpfr_exp(ret, t, rnd);
+  mpfr_clear(t);
+  return r;
+}
+static int wrap_mpfr_powr(mpfr_t ret, const mpfr_t x, const mpfr_t y, mpfr_rnd_t rnd) {
+  if (mpfr_nan_p(x) || mpfr_nan_p(y) || (mpfr_sgn(x) < 0)
+      || (mpfr_zero_p(y) && (mpfr_zero_p(x) || mpfr_inf_p(x)))
+      || (mpfr_inf_p(y) && mpfr_cmp_ui(x, 1) == 0)) {
+    mpfr_set_nan(ret);
+    return 0;
+  }
+  mpfr_t ax;
+  mpfr_init2(ax, mpfr_get_prec(x));
+  mpfr_abs(ax, x, MPFR_RNDN);
+  int r = mpfr_pow(ret, ax, y, rnd);
+  mpfr_clear(ax);
+  return r;
+}
+/* MPFR has no modified Bessel functions. The power series has positive
+   terms, so summing it with some guard bits is accurate for any x.  */
+static int mpfr_i_series(mpfr_t y, const mpfr_t x, int nu, mpfr_rnd_t r) {
+  mpfr_prec_t prec = mpfr_get_prec(y) + 32;
+  mpfr_t h2, t, s;
+  if (mpfr_cmp_ui(x, 1000) > 0 || mpfr_cmp_si(x, -1000) < 0) {
+    mpfr_set_inf(y, nu ? mpfr_sgn(x) : 1);
+    return 0;
+  }
+  mpfr_inits2(prec, h2, t, s, (mpfr_ptr) 0);
+  mpfr_div_2ui(t, x, 1, MPFR_RNDN);
+  mpfr_sqr(h2, t, MPFR_RNDN);
+  if (nu == 0)
+    mpfr_set_ui(t, 1, MPFR_RNDN);
+  mpfr_set(s, t, MPFR_RNDN);
+  for (unsigned long k = 1; mpfr_regular_p(t); k++) {
+    mpfr_mul(t, t, h2, MPFR_RNDN);
+    mpfr_div_ui(t, t, k * (k + nu), MPFR_RNDN);
+    mpfr_add(s, s, t, MPFR_RNDN);
+    if (mpfr_get_exp(t) < mpfr_get_exp(s) - prec)
+      break;
+  }
+  int ret = mpfr_set(y, s, r);
+  mpfr_clears(h2, t, s, (mpfr_ptr) 0);
+  return ret;
+}
+static int __attribute__((unused)) mpfr_i0(mpfr_t y, const mpfr_t x, mpfr_rnd_t r) { return mpfr_i_series(y, x, 0, r); }
+static int __attribute__((unused)) mpfr_i1(mpfr_t y, const mpfr_t x, mpfr_rnd_t r) { return mpfr_i_series(y, x, 1, r); }
+/* sinc(x) = sin(x) / x and sincpi(x) = sin(pi x) / (pi x), which are 1 at
+   x = 0.  */
+static int wrap_mpfr_sinc(mpfr_t y, const mpfr_t x, mpfr_rnd_t r) {
+  if (mpfr_zero_p(x))
+    return mpfr_set_ui(y, 1, r);
+  mpfr_t t;
+  mpfr_init2(t, mpfr_get_prec(y) + 32);
+  mpfr_sin(t, x, MPFR_RNDN);
+  int ret = mpfr_div(y, t, x, r);
+  mpfr_clear(t);
+  return ret;
+}
+static int wrap_mpfr_sincpi(mpfr_t y, const mpfr_t x, mpfr_rnd_t r) {
+  if (mpfr_zero_p(x))
+    return mpfr_set_ui(y, 1, r);
+  mpfr_t t, p;
+  mpfr_inits2(mpfr_get_prec(y) + 32, t, p, (mpfr_ptr) 0);
+  mpfr_sinpi(t, x, MPFR_RNDN);
+  mpfr_const_pi(p, MPFR_RNDN);
+  mpfr_mul(p, p, x, MPFR_RNDN);
+  int ret = mpfr_div(y, t, p, r);
+  mpfr_clears(t, p, (mpfr_ptr) 0);
+  return ret;
+}
+/* The windowed sinc kernels are tested with fixed parameters, see
+   WINDOW_C, WINDOW_HW and WINDOW_BETA below.  The window is evaluated on
+   v = 1 - |x| / hw, as the sin^2 forms of the Hann and Blackman windows.
+   Zero results are returned as +0, since their sign is unspecified.  */
+static int mpfr_windowed_sincpi(mpfr_t y, const mpfr_t x, int k, mpfr_rnd_t r) {
+  const float c = 0.75f, hw = 8.0f, beta = 8.6f;
+  if (mpfr_nan_p(x)) {
+    mpfr_set_nan(y);
+    return 0;
+  }
+  if (mpfr_cmp_d(x, hw) > 0 || mpfr_cmp_d(x, -hw) < 0) {
+    mpfr_set_zero(y, 1);
+    return 0;
+  }
+  mpfr_prec_t prec = mpfr_get_prec(y) + 32;
+  mpfr_t cx, v, w, t;
+  mpfr_inits2(prec, cx, v, w, t, (mpfr_ptr) 0);
+  /* c x is rounded to single precision, as in the routines.  */
+  mpfr_set_flt(cx, c * mpfr_get_flt(x, MPFR_RNDN), MPFR_RNDN);
+  wrap_mpfr_sincpi(cx, cx, MPFR_RNDN);
+  mpfr_abs(v, x, MPFR_RNDN);
+  mpfr_d_sub(v, hw, v, MPFR_RNDN);
+  mpfr_div_d(v, v, hw, MPFR_RNDN);
+  if (k < 2) {
+    mpfr_div_2ui(w, v, 1, MPFR_RNDN);
+    mpfr_sinpi(w, w, MPFR_RNDN);
+    mpfr_sqr(w, w, MPFR_RNDN);
+    if (k == 1) {
+      mpfr_mul_d(t, w, 0.64, MPFR_RNDN);
+      mpfr_add_d(t, t, 0.36, MPFR_RNDN);
+      mpfr_mul(w, w, t, MPFR_RNDN);
+    }
+  } else {
+    mpfr_ui_sub(w, 2, v, MPFR_RNDN);
+    mpfr_mul(w, w, v, MPFR_RNDN);
+    mpfr_sqrt(w, w, MPFR_RNDN);
+    mpfr_mul_d(w, w, beta, MPFR_RNDN);
+    mpfr_i0(w, w, MPFR_RNDN);
+    mpfr_set_d(t, beta, MPFR_RNDN);
+    mpfr_i0(t, t, MPFR_RNDN);
+    mpfr_div(w, w, t, MPFR_RNDN);
+  }
+  int ret = mpfr_mul(y, cx, w, r);
+  if (mpfr_zero_p(y))
+    mpfr_set_zero(y, 1);
+  mpfr_clears(cx, v, w, t, (mpfr_ptr) 0);
+  return ret;
+}
+static int wrap_mpfr_windowed_sincpi_hann(mpfr_t y, const mpfr_t x, mpfr_rnd_t r) { return mpfr_windowed_sincpi(y, x, 0, r); }
+static int wrap_mpfr_windowed_sincpi_blackman(mpfr_t y, const mpfr_t x, mpfr_rnd_t r) { return mpfr_windowed_sincpi(y, x, 1, r); }
+static int wrap_mpfr_windowed_sincpi_kaiser(mpfr_t y, const mpfr_t x, mpfr_rnd_t r) { return mpfr_windowed_sincpi(y, x, 2, r); }
+/* MPFR has no trigamma. Shift x up to at least 40 with the recurrence and
+   use the asymptotic expansion, whose first omitted term is then below
+   2^-100 relative to the result. Negative x uses the reflection formula,
+   with sin(pi x) evaluated on the exact fractional part of x.  */
+static void mpfr_trigamma_pos(mpfr_t s, mpfr_t t, mpfr_prec_t prec) {
+  static const long num[] = {1, -1, 1, -1, 5, -691, 7, -3617, 43867, -174611};
+  static const unsigned long den[] = {6, 30, 42, 30, 66, 2730, 6, 510, 798, 330};
+  mpfr_t iz, z, p, c;
+  mpfr_inits2(prec, iz, z, p, c, (mpfr_ptr) 0);
+  mpfr_set_zero(s, 1);
+  for (; mpfr_cmp_ui(t, 40) < 0; mpfr_add_ui(t, t, 1, MPFR_RNDN)) {
+    mpfr_sqr(c, t, MPFR_RNDN);
+    mpfr_ui_div(c, 1, c, MPFR_RNDN);
+    mpfr_add(s, s, c, MPFR_RNDN);
+  }
+  mpfr_ui_div(iz, 1, t, MPFR_RNDN);
+  mpfr_sqr(z, iz, MPFR_RNDN);
+  mpfr_set_zero(p, 1);
+  for (int k = 9; k >= 0; k--) {
+    mpfr_mul(p, p, z, MPFR_RNDN);
+    mpfr_set_si(c, num[k], MPFR_RNDN);
+    mpfr_div_ui(c, c, den[k], MPFR_RNDN);
+    mpfr_add(p, p, c, MPFR_RNDN);
+  }
+  /* s + 1/t + z/2 + p z/t.  */
+  mpfr_mul(p, p, iz, MPFR_RNDN);
+  mpfr_add_d(p, p, 0.5, MPFR_RNDN);
+  mpfr_mul(p, p, z, MPFR_RNDN);
+  mpfr_add(p, p, iz, MPFR_RNDN);
+  mpfr_add(s, s, p, MPFR_RNDN);
+  mpfr_clears(iz, z, p, c, (mpfr_ptr) 0);
+}
+static int __attribute__((unused)) mpfr_trigamma(mpfr_t y, const mpfr_t x, mpfr_rnd_t r) {
+  if (mpfr_nan_p(x) || (mpfr_inf_p(x) && mpfr_sgn(x) < 0)) {
+    mpfr_set_nan(y);
+    return 0;
+  }
+  if (mpfr_inf_p(x)) {
+    mpfr_set_zero(y, 1);
+    return 0;
+  }
+  if (mpfr_zero_p(x) || (mpfr_sgn(x) < 0 && mpfr_integer_p(x))) {
+    mpfr_set_inf(y, 1);
+    return 0;
+  }
+  mpfr_prec_t prec = mpfr_get_prec(y) + 32;
+  mpfr_t t, s, c;
+  mpfr_inits2(prec, t, s, c, (mpfr_ptr) 0);
+  if (mpfr_sgn(x) > 0) {
+    mpfr_set(t, x, MPFR_RNDN);
+    mpfr_trigamma_pos(s, t, prec);
+  } else {
+    /* pi^2 / sin(pi x)^2 - trigamma(1 - x).  */
+    mpfr_ui_sub(t, 1, x, MPFR_RNDN);
+    mpfr_trigamma_pos(s, t, prec);
+    mpfr_frac(t, x, MPFR_RNDN);
+    mpfr_const_pi(c, MPFR_RNDN);
+    mpfr_mul(t, t, c, MPFR_RNDN);
+    mpfr_sin(t, t, MPFR_RNDN);
+    mpfr_div(t, c, t, MPFR_RNDN);
+    mpfr_sqr(t, t, MPFR_RNDN);
+    mpfr_sub(s, t, s, MPFR_RNDN);
+  }
+  int ret = mpfr_set(y, s, r);
+  mpfr_clears(t, s, c, (mpfr_ptr) 0);
+  return ret;
+}
+/* MPFR has no regularised incomplete gamma function. P(a, x) is summed from
+   its power series for x < a + 1, and Q(a, x) = Gamma(a, x) / Gamma(a)
+   otherwise, with 64 extra bits so that 1 - P or 1 - Q stays accurate.  */
+static int mpfr_gamma_inc_reg(mpfr_t y, const mpfr_t a, const mpfr_t x, int upper, mpfr_rnd_t r) {
+  if (mpfr_nan_p(a) || mpfr_nan_p(x) || mpfr_sgn(a) <= 0 || mpfr_sgn(x) < 0
+      || (mpfr_inf_p(a) && mpfr_inf_p(x))) {
+    mpfr_set_nan(y);
+    return 0;
+  }
+  if (mpfr_zero_p(x) || mpfr_inf_p(a) || mpfr_inf_p(x)) {
+    int p = mpfr_inf_p(x) != 0;
+    return mpfr_set_ui(y, upper ? !p : p, r);
+  }
+  mpfr_prec_t prec = mpfr_get_prec(y) + 64;
+  mpfr_t s, t, c;
+  mpfr_inits2(prec, s, t, c, (mpfr_ptr) 0);
+  mpfr_add_ui(c, a, 1, MPFR_RNDN);
+  if (mpfr_less_p(x, c)) {
+    /* P = x^a e^-x / Gamma(a + 1) sum_n x^n / ((a + 1) ... (a + n)).  */
+    mpfr_set_ui(s, 1, MPFR_RNDN);
+    mpfr_set_ui(t, 1, MPFR_RNDN);
+    for (unsigned long n = 1; mpfr_get_exp(t) >= mpfr_get_exp(s) - (mpfr_exp_t) prec; n++) {
+      mpfr_add_ui(c, a, n, MPFR_RNDN);
+      mpfr_div(c, x, c, MPFR_RNDN);
+      mpfr_mul(t, t, c, MPFR_RNDN);
+      mpfr_add(s, s, t, MPFR_RNDN);
+    }
+    mpfr_add_ui(c, a, 1, MPFR_RNDN);
+    mpfr_lngamma(c, c, MPFR_RNDN);
+    mpfr_log(t, x, MPFR_RNDN);
+    mpfr_mul(t, t, a, MPFR_RNDN);
+    mpfr_sub(t, t, x, MPFR_RNDN);
+    mpfr_sub(t, t, c, MPFR_RNDN);
+    mpfr_exp(t, t, MPFR_RNDN);
+    mpfr_mul(s, s, t, MPFR_RNDN);
+    if (upper)
+      mpfr_ui_sub(s, 1, s, MPFR_RNDN);
+  } else {
+    mpfr_gamma_inc(s, a, x, MPFR_RNDN);
+    mpfr_gamma(c, a, MPFR_RNDN);
+    mpfr_div(s, s, c, MPFR_RNDN);
+    if (!upper)
+      mpfr_ui_sub(s, 1, s, MPFR_RNDN);
+  }
+  int ret = mpfr_set(y, s, r);
+  mpfr_clears(s, t, c, (mpfr_ptr) 0);
+  return ret;
+}
+static int __attribute__((unused)) mpfr_gamma_p(mpfr_t y, const mpfr_t a, const mpfr_t x, mpfr_rnd_t r) { return mpfr_gamma_inc_reg(y, a, x, 0, r); }
+static int __attribute__((unused)) mpfr_gamma_q(mpfr_t y, const mpfr_t a, const mpfr_t x, mpfr_rnd_t r) { return mpfr_gamma_inc_reg(y, a, x, 1, r); }
+/* MPFR has no regularised incomplete beta function either. Evaluate
+   I(a, b, x) = x^a (1 - x)^b / (a B(a, b)) / (1 + d_1 / (1 + d_2 / ...))
+   with the modified Lentz algorithm, or 1 - I(b, a, 1 - x) for
+   x > (a + 1) / (a + b + 2), with 128 extra bits.  */
+static int mpfr_beta_inc(mpfr_t y, const mpfr_t a, const mpfr_t b, const mpfr_t x, mpfr_rnd_t r) {
+  if (mpfr_nan_p(a) || mpfr_nan_p(b) || mpfr_nan_p(x) || mpfr_sgn(a) <= 0
+      || mpfr_sgn(b) <= 0 || mpfr_inf_p(a) || mpfr_inf_p(b) || mpfr_sgn(x) < 0
+      || mpfr_cmp_ui(x, 1) > 0) {
+    mpfr_set_nan(y);
+    return 0;
+  }
+  if (mpfr_zero_p(x) || mpfr_cmp_ui(x, 1) == 0)
+    return mpfr_set(y, x, r);
+  mpfr_prec_t prec = mpfr_get_prec(y) + 128;
+  mpfr_t p, q, z, f, c, d, num, den, t;
+  mpfr_inits2(prec, p, q, z, f, c, d, num, den, t, (mpfr_ptr) 0);
+  mpfr_add(t, a, b, MPFR_RNDN);
+  mpfr_add_ui(t, t, 2, MPFR_RNDN);
+  mpfr_mul(t, t, x, MPFR_RNDN);
+  mpfr_add_ui(c, a, 1, MPFR_RNDN);
+  int swap = mpfr_greater_p(t, c);
+  mpfr_set(p, swap ? b : a, MPFR_RNDN);
+  mpfr_set(q, swap ? a : b, MPFR_RNDN);
+  if (swap)
+    mpfr_ui_sub(z, 1, x, MPFR_RNDN);
+  else
+    mpfr_set(z, x, MPFR_RNDN);
+  /* f = 1 + d_1 / (1 + d_2 / ...), with d_(2m+1) = -(p + m) (p + q + m) z /
+     ((p + 2m) (p + 2m + 1)) and d_2m = m (q - m) z / ((p + 2m - 1) (p + 2m)).  */
+  mpfr_set_ui(f, 1, MPFR_RNDN);
+  mpfr_set_ui(c, 1, MPFR_RNDN);
+  mpfr_set_zero(d, 1);
+  for (unsigned long k = 1; k < 1000000; k++) {
+    unsigned long m = k / 2;
+    mpfr_add_ui(den, p, 2 * m, MPFR_RNDN);
+    if (k & 1) {
+      mpfr_add_ui(t, den, 1, MPFR_RNDN);
+      mpfr_mul(den, den, t, MPFR_RNDN);
+      mpfr_add_ui(num, p, m, MPFR_RNDN);
+      mpfr_add(t, p, q, MPFR_RNDN);
+      mpfr_add_ui(t, t, m, MPFR_RNDN);
+      mpfr_mul(num, num, t, MPFR_RNDN);
+      mpfr_neg(num, num, MPFR_RNDN);
+    } else {
+      mpfr_sub_ui(t, den, 1, MPFR_RNDN);
+      mpfr_mul(den, den, t, MPFR_RNDN);
+      mpfr_sub_ui(num, q, m, MPFR_RNDN);
+      mpfr_mul_ui(num, num, m, MPFR_RNDN);
+    }
+    mpfr_mul(num, num, z, MPFR_RNDN);
+    mpfr_div(num, num, den, MPFR_RNDN);
+    /* d = 1 / (1 + d_k d), c = 1 + d_k / c, f *= c d.  */
+    mpfr_mul(d, d, num, MPFR_RNDN);
+    mpfr_add_ui(d, d, 1, MPFR_RNDN);
+    mpfr_ui_div(d, 1, d, MPFR_RNDN);
+    mpfr_div(c, num, c, MPFR_RNDN);
+    mpfr_add_ui(c, c, 1, MPFR_RNDN);
+    mpfr_mul(t, c, d, MPFR_RNDN);
+    mpfr_mul(f, f, t, MPFR_RNDN);
+    mpfr_sub_ui(t, t, 1, MPFR_RNDN);
+    if (mpfr_zero_p(t) || mpfr_get_exp(t) < -(mpfr_exp_t) prec)
+      break;
+  }
+  /* x^a (1 - x)^b / B(a, b), from the logs.  */
+  mpfr_log(t, x, MPFR_RNDN);
+  mpfr_mul(num, t, a, MPFR_RNDN);
+  mpfr_ui_sub(t, 1, x, MPFR_RNDN);
+  mpfr_log(t, t, MPFR_RNDN);
+  mpfr_mul(t, t, b, MPFR_RNDN);
+  mpfr_add(num, num, t, MPFR_RNDN);
+  mpfr_add(t, a, b, MPFR_RNDN);
+  mpfr_lngamma(t, t, MPFR_RNDN);
+  mpfr_add(num, num, t, MPFR_RNDN);
+  mpfr_lngamma(t, a, MPFR_RNDN);
+  mpfr_sub(num, num, t, MPFR_RNDN);
+  mpfr_lngamma(t, b, MPFR_RNDN);
+  mpfr_sub(num, num, t, MPFR_RNDN);
+  mpfr_exp(num, num, MPFR_RNDN);
+  mpfr_mul(f, f, p, MPFR_RNDN);
+  mpfr_div(f, num, f, MPFR_RNDN);
+  if (swap)
+    mpfr_ui_sub(f, 1, f, MPFR_RNDN);
+  int ret = mpfr_set(y, f, r);
+  mpfr_clears(p, q, z, f, c, d, num, den, t, (mpfr_ptr) 0);
+  return ret;
+}
+/* The ulp tool only handles functions of up to two arguments, so the beta
+   routines are tested with b = a, with b = 0.5, or with independent a and b
+   at the mean x = a / (a + b), rounded to the precision of a.  */
+static int __attribute__((unused)) mpfr_beta_inc_sym(mpfr_t y, const mpfr_t a, const mpfr_t x, mpfr_rnd_t r) { return mpfr_beta_inc(y, a, a, x, r); }
+static int __attribute__((unused)) mpfr_beta_inc_half(mpfr_t y, const mpfr_t a, const mpfr_t x, mpfr_rnd_t r) {
+  mpfr_t h;
+  mpfr_init2(h, 2);
+  mpfr_set_d(h, 0.5, MPFR_RNDN);
+  int ret = mpfr_beta_inc(y, a, h, x, r);
+  mpfr_clear(h);
+  return ret;
+}
+static int __attribute__((unused)) mpfr_beta_inc_mean(mpfr_t y, const mpfr_t a, const mpfr_t b, mpfr_rnd_t r) {
+  mpfr_t x;
+  mpfr_init2(x, mpfr_get_prec(a));
+  mpfr_add(x, a, b, MPFR_RNDN);
+  mpfr_div(x, a, x, MPFR_RNDN);
+  int ret = mpfr_beta_inc(y, a, b, x, r);
+  mpfr_clear(x);
+  return ret;
+}
 #endif
 
 /* Our implementations of powi/powk are too imprecise to verify
@@ -62,6 +445,213 @@ static int wrap_mpfr_powi(mpfr_t ret, const mpfr_t x, const mpfr_t y, mpfr_rnd_t
 DECL_POW_INT_REF(ref_powif, double, float, int)
 DECL_POW_INT_REF(ref_powi, long double, double, int)
 
+/* Long double references for the C23 power functions, which are not
+   available in libm.  The integer argument is rounded as in the wrappers
+   below.  */
+static long double __attribute__((unused)) ref_pown(long double x, long double y) { return powl(x, roundl(y)); }
+static long double __attribute__((unused)) ref_rootn(long double x, long double y) {
+  long long n = llroundl(y);
+  if (n == 0)
+    return (x - x) / (x - x);
+  if (signbit(x) && (n & 1))
+    return -ref_rootn(-x, y);
+  return powl(x, 1.0L / n);
+}
+static long double __attribute__((unused)) ref_compoundn(long double x, long double y) {
+  long long n = llroundl(y);
+  if (n == 0 && !(x < -1))
+    return 1;
+  if (isnan(x) || x < -1)
+    return (x - x) / (x - x);
+  if (x == -1)
+    return powl(0, n);
+  return expl(n * log1pl(x));
+}
+static long double __attribute__((unused)) ref_powr(long double x, long double y) {
+  if (isnan(x) || isnan(y))
+    return x + y;
+  if (x < 0)
+    return (x - x) / (x - x);
+  x = fabsl(x);
+  if (y == 0 && (x == 0 || isinf(x)))
+    return (y - y) / (y - y);
+  if (isinf(y) && x == 1)
+    return y - y;
+  return powl(x, y);
+}
+
+/* References for sinc, sincpi and the windowed sinc kernels, computed in
+   long double.  The kernels are tested with c = WINDOW_C, hw = WINDOW_HW and
+   beta = WINDOW_BETA, and zero results are returned as +0.  */
+#define WINDOW_C 0.75f
+#define WINDOW_HW 8.0f
+#define WINDOW_BETA 8.6f
+static double ref_sinc(double x) { return x == 0 ? 1 : sinl(x) / x; }
+static long double ref_sincpil(long double x) {
+  if (x == 0)
+    return 1;
+  return sinpil(x) / (0x1.921fb54442d18469898cc51701b8p+1L * x);
+}
+static double ref_sincpi(double x) { return ref_sincpil(x); }
+static double ref_windowed_sincpi(double x, int k) {
+  if (isnan(x))
+    return x;
+  if (fabs(x) > WINDOW_HW)
+    return 0;
+  long double v = (WINDOW_HW - fabsl(x)) / WINDOW_HW, w;
+  if (k < 2) {
+    w = sinpil(v / 2);
+    w *= w;
+    if (k == 1)
+      w *= 0.36L + 0.64L * w;
+  } else {
+    w = i0l(WINDOW_BETA * sqrtl(v * (2 - v))) / i0l(WINDOW_BETA);
+  }
+  long double y = ref_sincpil((float) (WINDOW_C * (float) x)) * w;
+  return y == 0 ? 0 : y;
+}
+static double ref_windowed_sincpi_hann(double x) { return ref_windowed_sincpi(x, 0); }
+static double ref_windowed_sincpi_blackman(double x) { return ref_windowed_sincpi(x, 1); }
+static double ref_windowed_sincpi_kaiser(double x) { return ref_windowed_sincpi(x, 2); }
+
+/* The fixed-point routines are tested with the same Q format, Q16 or Q24, for
+   the input and the output, against their bit-exact scalar references.  The
+   integer arguments are passed as doubles and truncated.  */
+static long double ref_log2_fixed_q16(long double x) { return log2_fixed_ref((uint32_t) x, 16, 16); }
+static long double ref_log2_fixed_q24(long double x) { return log2_fixed_ref((uint32_t) x, 24, 24); }
+static long double ref_exp2_fixed_q16(long double x) { return exp2_fixed_ref((int32_t) x, 16, 16); }
+static long double ref_exp2_fixed_q24(long double x) { return exp2_fixed_ref((int32_t) x, 24, 24); }
+/* The _lsb variants are checked against the real functions instead.  The
+   results are offset by 0x1.8p52, so that 1 LSB is 1 ULP.  */
+static long double ref_log2_fixed_q16_lsb(long double x) { return 0x1.8p52L + log2l((uint32_t) x * 0x1p-16L) * 0x1p16L; }
+static long double ref_log2_fixed_q24_lsb(long double x) { return 0x1.8p52L + log2l((uint32_t) x * 0x1p-24L) * 0x1p24L; }
+static long double ref_exp2_fixed_q16_lsb(long double x) { return 0x1.8p52L + exp2l((int32_t) x * 0x1p-16L) * 0x1p16L; }
+static long double ref_exp2_fixed_q24_lsb(long double x) { return 0x1.8p52L + exp2l((int32_t) x * 0x1p-24L) * 0x1p24L; }
+
+/* The quantised activation kernels are tested with fixed parameters for each
+   activation, against the float routines called on one value.  The 8-bit
+   arguments are passed as floats and truncated.  */
+static const struct q8_test {
+  int is_signed;
+  float scale, out_scale;
+  int32_t zero_point, out_zero_point;
+} q8_tests[] = {
+  [Q8_SIGMOID] = { 1, 0x1p-4f, 0x1p-8f, 0, -128 },
+  [Q8_TANH] = { 1, 0x1p-5f, 0x1p-7f, 0, 0 },
+  [Q8_GELU] = { 1, 0x1p-4f, 0x1p-5f, -10, -100 },
+  [Q8_EXP] = { 0, 0x1p-4f, 0x1p-8f, 255, 0 },
+};
+static double ref_q8_activation(double x, enum q8_activation f) {
+  const struct q8_test *p = &q8_tests[f];
+  float t = (float) ((int32_t) x - p->zero_point) * p->scale, y, h;
+  switch (f) {
+  case Q8_SIGMOID:
+    y = fmaf(0.5f, _ZGVnN4v_tanhf(vdupq_n_f32(t * 0.5f))[0], 0.5f);
+    break;
+  case Q8_TANH:
+    y = _ZGVnN4v_tanhf(vdupq_n_f32(t))[0];
+    break;
+  case Q8_GELU:
+    h = t * 0.5f;
+    y = fmaf(h, _ZGVnN4v_erff(vdupq_n_f32(t * 0x1.6a09e6p-1f))[0], h);
+    break;
+  default:
+    y = 1.0f + _ZGVnN4v_expm1f(vdupq_n_f32(t))[0];
+  }
+  double q = rintf(y / p->out_scale) + (double) p->out_zero_point;
+  double lo = p->is_signed ? -128 : 0, hi = p->is_signed ? 127 : 255;
+  return q < lo ? lo : q > hi ? hi : q;
+}
+static double ref_q8_sigmoid(double x) { return ref_q8_activation(x, Q8_SIGMOID); }
+static double ref_q8_tanh(double x) { return ref_q8_activation(x, Q8_TANH); }
+static double ref_q8_gelu(double x) { return ref_q8_activation(x, Q8_GELU); }
+static double ref_q8_exp(double x) { return ref_q8_activation(x, Q8_EXP); }
+
+/* The reductions are tested on REDUCE_N values, with p[i] = x^i except for a
+   zero every 50 values, and histogram counts of 2^20 x^i, rounded down.
+   q[i] is in turn 3/4 x^i, x^i, (1 - 2^-20) x^i and a subnormal constant, so
+   that p[i]/q[i] is 4/3, 1, close to 1, or overflows when p[i] is not tiny.
+   The references compute the sums in long double.  */
+#define REDUCE_N 203
+#define DECL_REDUCE_ARGS(T, NAME, TINY)                                       \
+  static void NAME(T *p, T *q, T x) {                                         \
+    T t = 1;                                                                  \
+    for (int i = 0; i < REDUCE_N; i++, t *= x) {                              \
+      p[i] = i % 50 == 7 ? 0 : t;                                             \
+      q[i] = i % 4 == 0   ? t * 0.75                                          \
+             : i % 4 == 1 ? t                                                 \
+             : i % 4 == 2 ? t - t * 0x1p-20                                   \
+                          : TINY;                                             \
+    }                                                                         \
+  }
+DECL_REDUCE_ARGS(float, reduce_argsf, 0x1p-145f)
+DECL_REDUCE_ARGS(double, reduce_args, 0x1p-1070)
+static void reduce_counts(uint32_t *c, double x) {
+  double t = 0x1p20;
+  for (int i = 0; i < REDUCE_N; i++, t *= x)
+    c[i] = i % 50 == 7 ? 0 : t;
+}
+#define DECL_REDUCE_REF(T, RT, ARGS, NAME, TERM)                              \
+  static RT NAME(RT x) {                                                      \
+    T p[REDUCE_N], q[REDUCE_N];                                               \
+    long double s = 0;                                                        \
+    ARGS(p, q, x);                                                            \
+    for (int i = 0; i < REDUCE_N; i++)                                        \
+      if (p[i] != 0)                                                          \
+        s += TERM;                                                            \
+    return s;                                                                 \
+  }
+DECL_REDUCE_REF(float, double, reduce_argsf, ref_entropyf, -p[i] * logl(p[i]))
+DECL_REDUCE_REF(double, long double, reduce_args, ref_entropy, -p[i] * logl(p[i]))
+DECL_REDUCE_REF(float, double, reduce_argsf, ref_cross_entropyf, -p[i] * logl(q[i]))
+DECL_REDUCE_REF(double, long double, reduce_args, ref_cross_entropy, -p[i] * logl(q[i]))
+DECL_REDUCE_REF(float, double, reduce_argsf, ref_kl_divf, p[i] * logl((long double) p[i] / q[i]))
+DECL_REDUCE_REF(double, long double, reduce_args, ref_kl_div, p[i] * logl((long double) p[i] / q[i]))
+static long double ref_entropy_counts(long double x) {
+  uint32_t c[REDUCE_N];
+  long double s = 0, t = 0;
+  reduce_counts(c, x);
+  for (int i = 0; i < REDUCE_N; i++)
+    t += c[i];
+  for (int i = 0; i < REDUCE_N; i++)
+    if (c[i] != 0)
+      s -= c[i] / t * (2 * c[i] > t ? log1pl((c[i] - t) / t) : logl(c[i] / t));
+  return s;
+}
+static double ref_entropy_countsf(double x) { return ref_entropy_counts(x); }
+
+/* There is no MPFR equivalent of the fixed-point, quantised and reduction
+   routines, so the references are used in that mode too.  */
+#if USE_MPFR
+# define REF_MPFR_WRAP(f)                                                     \
+  static int wrap_mpfr_##f(mpfr_t y, const mpfr_t x, mpfr_rnd_t r) {          \
+    return mpfr_set_ld(y, ref_##f(mpfr_get_d(x, MPFR_RNDZ)), r);              \
+  }
+REF_MPFR_WRAP(log2_fixed_q16)
+REF_MPFR_WRAP(log2_fixed_q24)
+REF_MPFR_WRAP(exp2_fixed_q16)
+REF_MPFR_WRAP(exp2_fixed_q24)
+REF_MPFR_WRAP(log2_fixed_q16_lsb)
+REF_MPFR_WRAP(log2_fixed_q24_lsb)
+REF_MPFR_WRAP(exp2_fixed_q16_lsb)
+REF_MPFR_WRAP(exp2_fixed_q24_lsb)
+REF_MPFR_WRAP(q8_sigmoid)
+REF_MPFR_WRAP(q8_tanh)
+REF_MPFR_WRAP(q8_gelu)
+REF_MPFR_WRAP(q8_exp)
+REF_MPFR_WRAP(entropyf)
+REF_MPFR_WRAP(entropy)
+REF_MPFR_WRAP(cross_entropyf)
+REF_MPFR_WRAP(cross_entropy)
+REF_MPFR_WRAP(kl_divf)
+REF_MPFR_WRAP(kl_div)
+REF_MPFR_WRAP(entropy_counts)
+#endif
+
+static double pown_wrap(double x, double y) { return pown(x, llround(y)); }
+static double rootn_wrap(double x, double y) { return rootn(x, llround(y)); }
+static double compoundn_wrap(double x, double y) { return compoundn(x, llround(y)); }
+
 #define ZVF1_WRAP(func) static float Z_##func##f(float x) { return _ZGVnN4v_##func##f(argf(x))[0]; }
 #define ZVF2_WRAP(func) static float Z_##func##f(float x, float y) { return _ZGVnN4vv_##func##f(argf(x), argf(y))[0]; }
 #define ZVD1_WRAP(func) static double Z_##func(double x) { return _ZGVnN2v_##func(argd(x))[0]; }
@@ -121,10 +711,159 @@ double v_sincos_sin(double x) { float64x2_t s, c; _ZGVnN2vl8l8_sincos(vdupq_n_f6
 double v_sincos_cos(double x) { float64x2_t s, c; _ZGVnN2vl8l8_sincos(vdupq_n_f64(x), &s, &c); return c[0]; }
 double v_cexpi_sin(double x) { return _ZGVnN2v_cexpi(vdupq_n_f64(x)).val[0][0]; }
 double v_cexpi_cos(double x) { return _ZGVnN2v_cexpi(vdupq_n_f64(x)).val[1][0]; }
+double v_log_dd_hi(double x) { return _ZGVnN2v_log_dd(vdupq_n_f64(x)).val[0][0]; }
+double v_log1p_dd_hi(double x) { return _ZGVnN2v_log1p_dd(vdupq_n_f64(x)).val[0][0]; }
+/* hi + lo and exp(x + xtail) are checked as for the scalar __log_dd_hilo and
+   __exp_dd in math/test/ulp_wrappers.h: the leading DD_BITS bits of hi less
+   one unit in the last of them are subtracted from both results, and xtail is
+   made of 10 low bits of x.  */
+#if LDBL_MANT_DIG >= 113 || LDBL_MANT_DIG == DBL_MANT_DIG
+# define DD_BITS 16
+#else
+# define DD_BITS 10
+#endif
+static double dd_off(double hi) {
+  uint64_t e = asuint64(hi) & 0x7ff0000000000000;
+  if (e < asuint64(0x1p-900) || e == 0x7ff0000000000000) return 0;
+  double top = asdouble(asuint64(hi) & -(1ULL << (53 - DD_BITS)));
+  return top - copysign(asdouble(e - ((uint64_t) (DD_BITS - 1) << 52)), hi);
+}
+double v_log_dd_hilo(double x) { __f64x2x2_t r = _ZGVnN2v_log_dd(vdupq_n_f64(x)); return r.val[0][0] - dd_off(r.val[0][0]) + r.val[1][0]; }
+double v_log1p_dd_hilo(double x) { __f64x2x2_t r = _ZGVnN2v_log1p_dd(vdupq_n_f64(x)); return r.val[0][0] - dd_off(r.val[0][0]) + r.val[1][0]; }
+long double v_log_dd_hilo_ref(long double x) { return logl(x) - dd_off(v_log_dd_hi(x)); }
+long double v_log1p_dd_hilo_ref(long double x) { return log1pl(x) - dd_off(v_log1p_dd_hi(x)); }
+static double exp_dd_tail(double x) {
+  if (!(fabs(x) < 1024)) return 0;
+  double ulp = asdouble(asuint64(x) + 1) - x;
+  return ulp * ((int) (asuint64(x) >> 3 & 1023) - 512) * 0x1p-10;
+}
+double v_exp_dd(double x) { return _ZGVnN2vv_exp_dd(vdupq_n_f64(x), vdupq_n_f64(exp_dd_tail(x)))[0]; }
+long double v_exp_dd_ref(long double x) { return expl(x + exp_dd_tail(x)); }
+#if USE_MPFR
+static int v_log_dd_hilo_mpfr(mpfr_t y, const mpfr_t x, mpfr_rnd_t r) {
+  int t = mpfr_log(y, x, r);
+  mpfr_sub_d(y, y, dd_off(v_log_dd_hi(mpfr_get_d(x, MPFR_RNDN))), r);
+  return t;
+}
+static int v_log1p_dd_hilo_mpfr(mpfr_t y, const mpfr_t x, mpfr_rnd_t r) {
+  int t = mpfr_log1p(y, x, r);
+  mpfr_sub_d(y, y, dd_off(v_log1p_dd_hi(mpfr_get_d(x, MPFR_RNDN))), r);
+  return t;
+}
+static int v_exp_dd_mpfr(mpfr_t y, const mpfr_t x, mpfr_rnd_t r) {
+  MPFR_DECL_INIT(t, 128);
+  mpfr_add_d(t, x, exp_dd_tail(mpfr_get_d(x, MPFR_RNDN)), MPFR_RNDN);
+  return mpfr_exp(y, t, r);
+}
+#endif
+/* digamma is checked on the negative axis for absolute error, in units of
+   2^-52 max(1, |digamma(1 - x)|, |pi cot(pi x)|), as it cancels close to its
+   zeros there.  This max is in [2^(e-1), 2^e), so |digamma(x)| < 2^(e+1) and
+   both results are offset by 3 2^(e+1), which makes 1 ULP of the sum 4 to 8
+   of those units.  */
+static double digamma_abs_off(double x) {
+  long double pi = 0x1.921fb54442d18469898cc51701b8p1L, r = x - rintl(x);
+  if (r == 0 || isnan(r)) return 0;
+  long double s = fabsl(digammal(1 - (long double) x)), c = fabsl(pi / tanl(pi * r));
+  int e;
+  frexpl(fmaxl(1, fmaxl(s, c)), &e);
+  return ldexp(3, e + 1);
+}
+double v_digamma_abs(double x) { return digamma_abs_off(x) + _ZGVnN2v_digamma(vdupq_n_f64(x))[0]; }
+long double ref_digamma_abs(long double x) { return digamma_abs_off(x) + digammal(x); }
+#if USE_MPFR
+static int mpfr_digamma_abs(mpfr_t y, const mpfr_t x, mpfr_rnd_t r) {
+  MPFR_DECL_INIT(t, 128);
+  mpfr_digamma(t, x, MPFR_RNDN);
+  return mpfr_add_d(y, t, digamma_abs_off(mpfr_get_d(x, MPFR_RNDN)), r);
+}
+#endif
+float v_beta_incf_sym(float a, float x) { return _ZGVnN4vvv_beta_incf(vdupq_n_f32(a), vdupq_n_f32(a), vdupq_n_f32(x))[0]; }
+float v_beta_incf_half(float a, float x) { return _ZGVnN4vvv_beta_incf(vdupq_n_f32(a), vdupq_n_f32(0.5f), vdupq_n_f32(x))[0]; }
+double v_beta_inc_sym(double a, double x) { return _ZGVnN2vvv_beta_inc(vdupq_n_f64(a), vdupq_n_f64(a), vdupq_n_f64(x))[0]; }
+double v_beta_inc_half(double a, double x) { return _ZGVnN2vvv_beta_inc(vdupq_n_f64(a), vdupq_n_f64(0.5), vdupq_n_f64(x))[0]; }
+float v_beta_incf_mean(float a, float b) { return _ZGVnN4vvv_beta_incf(vdupq_n_f32(a), vdupq_n_f32(b), vdupq_n_f32(a / (a + b)))[0]; }
+double v_beta_inc_mean(double a, double b) { return _ZGVnN2vvv_beta_inc(vdupq_n_f64(a), vdupq_n_f64(b), vdupq_n_f64(a / (a + b)))[0]; }
+double v_pown(double x, double y) { return _ZGVnN2vv_pown(vdupq_n_f64(x), vdupq_n_s64(llround(y)))[0]; }
+double v_powr(double x, double y) { return _ZGVnN2vv_powr(vdupq_n_f64(x), vdupq_n_f64(y))[0]; }
+double v_rootn(double x, double y) { return _ZGVnN2vv_rootn(vdupq_n_f64(x), vdupq_n_s64(llround(y)))[0]; }
+double v_compoundn(double x, double y) { return _ZGVnN2vv_compoundn(vdupq_n_f64(x), vdupq_n_s64(llround(y)))[0]; }
+float v_sincf(float x) { return _ZGVnN4v_sincf(vdupq_n_f32(x))[0]; }
+float v_sincpif(float x) { return _ZGVnN4v_sincpif(vdupq_n_f32(x))[0]; }
+/* The array routines are called on one element, and their zero results are
+   returned as +0.  */
+float windowed_sincpif_hann_wrap(float x) { float y; windowed_sincpif_hann(&y, &x, 1, WINDOW_C, WINDOW_HW); return y == 0 ? 0 : y; }
+float windowed_sincpif_blackman_wrap(float x) { float y; windowed_sincpif_blackman(&y, &x, 1, WINDOW_C, WINDOW_HW); return y == 0 ? 0 : y; }
+float windowed_sincpif_kaiser_wrap(float x) { float y; windowed_sincpif_kaiser(&y, &x, 1, WINDOW_C, WINDOW_HW, WINDOW_BETA); return y == 0 ? 0 : y; }
+double log2_fixed_q16(double x) { uint32_t u = x; int32_t y; log2_fixed(&y, &u, 1, 16, 16); return y; }
+double log2_fixed_q24(double x) { uint32_t u = x; int32_t y; log2_fixed(&y, &u, 1, 24, 24); return y; }
+double exp2_fixed_q16(double x) { int32_t i = x; uint32_t y; exp2_fixed(&y, &i, 1, 16, 16); return y; }
+double exp2_fixed_q24(double x) { int32_t i = x; uint32_t y; exp2_fixed(&y, &i, 1, 24, 24); return y; }
+double log2_fixed_q16_lsb(double x) { return 0x1.8p52 + log2_fixed_q16(x); }
+double log2_fixed_q24_lsb(double x) { return 0x1.8p52 + log2_fixed_q24(x); }
+double exp2_fixed_q16_lsb(double x) { return 0x1.8p52 + exp2_fixed_q16(x); }
+double exp2_fixed_q24_lsb(double x) { return 0x1.8p52 + exp2_fixed_q24(x); }
+/* The values are looked up one at a time, which only runs the tail of
+   q8_lookup.  Its 64 and 16-byte loops are checked once per table, on all
+   256 bytes and on 64 + 16 + k bytes for every tail length k, and the
+   results are NaN if they do not match tab.  */
+static bool q8_lookup_ok(const uint8_t *tab) {
+  uint8_t x[256], y[257];
+  for (int i = 0; i < 256; i++)
+    x[i] = i * 167 + 13;
+  q8_lookup(y, x, 256, tab);
+  for (int i = 0; i < 256; i++)
+    if (y[i] != tab[x[i]])
+      return false;
+  for (int k = 0; k < 16; k++) {
+    int n = 64 + 16 + k;
+    memset(y, 0x5a, sizeof y);
+    q8_lookup(y, x + k, n, tab);
+    for (int i = 0; i < n; i++)
+      if (y[i] != tab[x[k + i]])
+        return false;
+    if (y[n] != 0x5a)
+      return false;
+  }
+  return true;
+}
+static float q8_activation(float x, enum q8_activation f) {
+  static uint8_t tab[4][256];
+  static bool init[4], ok[4];
+  const struct q8_test *p = &q8_tests[f];
+  if (!init[f]) {
+    q8_activation_table(tab[f], f, p->is_signed, p->scale, p->zero_point, p->out_scale, p->out_zero_point);
+    ok[f] = q8_lookup_ok(tab[f]);
+    init[f] = true;
+  }
+  uint8_t in = (int32_t) x, y;
+  q8_lookup(&y, &in, 1, tab[f]);
+  if (!ok[f])
+    return NAN;
+  return p->is_signed ? (int8_t) y : y;
+}
+float q8_sigmoid(float x) { return q8_activation(x, Q8_SIGMOID); }
+float q8_tanh(float x) { return q8_activation(x, Q8_TANH); }
+float q8_gelu(float x) { return q8_activation(x, Q8_GELU); }
+float q8_exp(float x) { return q8_activation(x, Q8_EXP); }
+float entropyf_wrap(float x) { float p[REDUCE_N], q[REDUCE_N]; reduce_argsf(p, q, x); return entropyf(p, REDUCE_N); }
+double entropy_wrap(double x) { double p[REDUCE_N], q[REDUCE_N]; reduce_args(p, q, x); return entropy(p, REDUCE_N); }
+float cross_entropyf_wrap(float x) { float p[REDUCE_N], q[REDUCE_N]; reduce_argsf(p, q, x); return cross_entropyf(p, q, REDUCE_N); }
+double cross_entropy_wrap(double x) { double p[REDUCE_N], q[REDUCE_N]; reduce_args(p, q, x); return cross_entropy(p, q, REDUCE_N); }
+float kl_divf_wrap(float x) { float p[REDUCE_N], q[REDUCE_N]; reduce_argsf(p, q, x); return kl_divf(p, q, REDUCE_N); }
+double kl_div_wrap(double x) { double p[REDUCE_N], q[REDUCE_N]; reduce_args(p, q, x); return kl_div(p, q, REDUCE_N); }
+float entropy_countsf_wrap(float x) { uint32_t c[REDUCE_N]; reduce_counts(c, x); return entropy_countsf(c, REDUCE_N); }
+double entropy_counts_wrap(double x) { uint32_t c[REDUCE_N]; reduce_counts(c, x); return entropy_counts(c, REDUCE_N); }
 
 #if WANT_SVE_MATH
 static float Z_sv_powi(float x, float y) { return svretf(_ZGVsMxvv_powi(svargf(x), svdup_s32((int)round(y)), svptrue_b32())); }
 static double Z_sv_powk(double x, double y) { return svretd(_ZGVsMxvv_powk(svargd(x), svdup_s64((long)round(y)), svptrue_b64())); }
+static double Z_sv_pown(double x, double y) { return svretd(_ZGVsMxvv_pown(svargd(x), svdup_s64(llround(y)), svptrue_b64())); }
+static double Z_sv_powr(double x, double y) { return svretd(_ZGVsMxvv_powr(svargd(x), svargd(y), svptrue_b64())); }
+static double Z_sv_rootn(double x, double y) { return svretd(_ZGVsMxvv_rootn(svargd(x), svdup_s64(llround(y)), svptrue_b64())); }
+static double Z_sv_compoundn(double x, double y) { return svretd(_ZGVsMxvv_compoundn(svargd(x), svdup_s64(llround(y)), svptrue_b64())); }
+static float Z_sv_sincf(float x) { return svretf(_ZGVsMxv_sincf(svargf(x), svptrue_b32())); }
+static float Z_sv_sincpif(float x) { return svretf(_ZGVsMxv_sincpif(svargf(x), svptrue_b32())); }
 
 float sv_sincosf_sin(float x) { float s[svcntw()], c[svcntw()]; _ZGVsMxvl4l4_sincosf(svdup_f32(x), s, c, svptrue_b32()); return s[0]; }
 float sv_sincosf_cos(float x) { float s[svcntw()], c[svcntw()]; _ZGVsMxvl4l4_sincosf(svdup_f32(x), s, c, svptrue_b32()); return c[0]; }
@@ -135,6 +874,13 @@ double sv_sincos_sin(double x) { double s[svcntd()], c[svcntd()]; _ZGVsMxvl8l8_s
 double sv_sincos_cos(double x) { double s[svcntd()], c[svcntd()]; _ZGVsMxvl8l8_sincos(svdup_f64(x), s, c, svptrue_b64()); return c[0]; }
 double sv_cexpi_sin(double x) { return svretd(svget2(_ZGVsMxv_cexpi(svdup_f64(x), svptrue_b64()), 0)); }
 double sv_cexpi_cos(double x) { return svretd(svget2(_ZGVsMxv_cexpi(svdup_f64(x), svptrue_b64()), 1)); }
+double sv_digamma_abs(double x) { return digamma_abs_off(x) + svretd(_ZGVsMxv_digamma(svargd(x), svptrue_b64())); }
+float sv_beta_incf_sym(float a, float x) { return svretf(_ZGVsMxvvv_beta_incf(svdup_f32(a), svdup_f32(a), svdup_f32(x), svptrue_b32())); }
+float sv_beta_incf_half(float a, float x) { return svretf(_ZGVsMxvvv_beta_incf(svdup_f32(a), svdup_f32(0.5f), svdup_f32(x), svptrue_b32())); }
+double sv_beta_inc_sym(double a, double x) { return svretd(_ZGVsMxvvv_beta_inc(svdup_f64(a), svdup_f64(a), svdup_f64(x), svptrue_b64())); }
+double sv_beta_inc_half(double a, double x) { return svretd(_ZGVsMxvvv_beta_inc(svdup_f64(a), svdup_f64(0.5), svdup_f64(x), svptrue_b64())); }
+float sv_beta_incf_mean(float a, float b) { return svretf(_ZGVsMxvvv_beta_incf(svdup_f32(a), svdup_f32(b), svdup_f32(a / (a + b)), svptrue_b32())); }
+double sv_beta_inc_mean(double a, double b) { return svretd(_ZGVsMxvvv_beta_inc(svdup_f64(a), svdup_f64(b), svdup_f64(a / (a + b)), svptrue_b64())); }
 
 #endif
 // clang-format on
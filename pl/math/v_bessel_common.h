@@ -0,0 +1,295 @@
+/*
+ * Core approximations for double-precision vector Bessel functions
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+#ifndef PL_MATH_V_BESSEL_COMMON_H
+#define PL_MATH_V_BESSEL_COMMON_H
+
+#include "v_math.h"
+#include "poly_advsimd_f64.h"
+#include "v_sincos_common.h"
+
+#define WANT_V_LOG1P_K0_SHORTCUT 1
+#include "v_log1p_inline.h"
+
+#define WANT_V_EXP_TAIL_SPECIALCASE 0
+#include "v_exp_tail_inline.h"
+
+/* The functions are approximated in three regions:
+   - Below 16, by the piecewise polynomials in __v_bessel_data, apart from y0
+     and y1 below 2, where they are singular.  There they are expanded as
+     y = 2/pi log(x/z) j(x) + (x - z) S(x), with z the first zero of y.
+   - For J and Y above 16, by the Hankel asymptotic expansion in modulus and
+     phase form: j = M cos(theta), y = M sin(theta) with
+     M = sqrt(2/(pi x)) (1 + u PM(u)) and theta = x + phi - (2 nu + 1) pi/4,
+     phi = (a + u Pphi(u)) / x, u = 1/x^2.  sin(theta) and cos(theta) are
+     computed by the sincos kernel after reducing theta by pi/2 in extended
+     precision, hence the routines fall back to scalar above 2^23.  The
+     phase is accurate to about 2^-66, so close to the zeros of j and y the
+     error is bounded in absolute terms, by 2^-65.5 sqrt(2/(pi x)), rather
+     than in ULP, as for any method not tabulating them.
+   - For I above 16, by i = e^x / sqrt(2 pi x) (1 + v P(v)), v = 1/x, using
+     the exp kernel.  */
+static const struct v_bessel_consts
+{
+  float64x2_t m[2][8], phi[2][10], phi_a[2];
+  float64x2_t i[2][13];
+  float64x2_t s[2][13], j[2][13], z[2][2], zinv[2], zhalf[2];
+  float64x2_t pio4[3], two_over_pi, inv_2pi;
+  float64x2_t table_bound, y_table_start, asymptotic_bound, range_val, y_min;
+  float64x2_t i_bound, i_scale_bound, i_scale_hi, i_scale_lo, i_scale;
+  struct v_log1p_data log1p_consts;
+} v_bessel_consts = {
+  /* Coefficients of PM and Pphi on [0, 1/16^2], for nu = 0 and 1, computed
+     by Chebyshev interpolation in quad precision.  */
+  .m = { { V2 (-0x1.fffffffffffdep-5), V2 (0x1.a7ffffff7648ep-4),
+	   V2 (-0x1.15effe9294cabp-1), V2 (0x1.764fa2cf9f4fdp+2),
+	   V2 (-0x1.ab2d1dc02456bp+6), V2 (0x1.6c4b48c2c4fcfp+11),
+	   V2 (-0x1.805c6dfeb4f7p+16), V2 (0x1.395abe0664096p+21) },
+	 { V2 (0x1.7fffffffffff6p-3), V2 (-0x1.8bffffffb1d47p-3),
+	   V2 (0x1.9c4ffe61372acp-1), V2 (-0x1.ef59c08166b81p+2),
+	   V2 (0x1.095032760d419p+7), V2 (-0x1.b34aba86ceb88p+11),
+	   V2 (0x1.c0ab0ca91c5c4p+16), V2 (-0x1.695d58fbdd921p+21) } },
+  .phi = { { V2 (0x1.0aaaaaaaaaaaap-4), V2 (-0x1.ad3333332f0f3p-3),
+	     V2 (0x1.a358491350b8p+0), V2 (-0x1.779a117af9678p+4),
+	     V2 (0x1.0bcf0984e4cdfp+9), V2 (-0x1.1658b824cb614p+14),
+	     V2 (0x1.87baa857ee907p+19), V2 (-0x1.4ab983488f9b9p+25),
+	     V2 (0x1.056b28daa604bp+31), V2 (-0x1.eca93854f41e7p+35) },
+	   { V2 (-0x1.5p-3), V2 (0x1.7bccccccca8p-2), V2 (-0x1.2f486dad45d1fp+1),
+	     V2 (0x1.e9fbe45e01212p+4), V2 (-0x1.49946efcef2b4p+9),
+	     V2 (0x1.4a2ab30697292p+14), V2 (-0x1.c544195b9851fp+19),
+	     V2 (0x1.78826c8c2011p+25), V2 (-0x1.26ce5f843e32bp+31),
+	     V2 (0x1.1466dd40d1e7fp+36) } },
+  .phi_a = { V2 (-0x1p-3), V2 (0x1.8p-2) },
+  /* Coefficients of P on [0, 1/16], for nu = 0 and 1.  */
+  .i = { { V2 (0x1.0000000000002p-3), V2 (0x1.1ffffffff983dp-4),
+	   V2 (0x1.2c00001686e38p-4), V2 (0x1.cb5fe174b50bdp-4),
+	   V2 (0x1.d128add3d60dbp-3), V2 (0x1.240503157304p-1),
+	   V2 (0x1.df328446fff0bp+0), V2 (-0x1.36c79224dd3d9p-2),
+	   V2 (0x1.ab1880f58d799p+7), V2 (-0x1.c50222d30bc06p+11),
+	   V2 (0x1.75b540dec59b3p+15), V2 (-0x1.53424c0a342f5p+18),
+	   V2 (0x1.24aa79e710a5ap+20) },
+	 { V2 (-0x1.8000000000001p-2), V2 (-0x1.dffffffff925fp-4),
+	   V2 (-0x1.a4000017cd012p-4), V2 (-0x1.274fefdd7669bp-3),
+	   V2 (-0x1.1c42a40b3d76p-2), V2 (-0x1.594091bd2a416p-1),
+	   V2 (-0x1.12a8afe2c7a4fp+1), V2 (-0x1.3042e072440ecp-3),
+	   V2 (-0x1.c6033dc1649ddp+7), V2 (0x1.dda42e6d883cap+11),
+	   V2 (-0x1.8abc698256906p+15), V2 (0x1.661ef017fb26dp+18),
+	   V2 (-0x1.353e455a01b8fp+20) } },
+  /* S(x) / (x + z) and j(x) / x^nu as polynomials in x^2 on [0, 4].  For
+     nu = 1, S(x) is divided by x instead of multiplied.  */
+  .s = { { V2 (0x1.750811790a13cp-3), V2 (-0x1.12583f4a4abcfp-6),
+	   V2 (0x1.268a9aaaeb0c7p-11), V2 (-0x1.4c030d99a8676p-17),
+	   V2 (0x1.cf0413da6a194p-24), V2 (-0x1.b797036d6f92p-31),
+	   V2 (0x1.2eb3f46ce6dd4p-38), V2 (-0x1.3c55dc0296d8dp-46),
+	   V2 (0x1.037f954c07db5p-54), V2 (-0x1.57258e8506b75p-63),
+	   V2 (0x1.758cc75e0adp-72), V2 (-0x1.5470f1d18b13bp-81),
+	   V2 (0x1.fe68b8d89d89ep-91) },
+	 { V2 (0x1.0e14beba09e96p-3), V2 (0x1.069922dcaf0ep-6),
+	   V2 (-0x1.7c2ca06d8e36p-10), V2 (0x1.5ba2f20a55ab6p-15),
+	   V2 (-0x1.4f2940694cd22p-21), V2 (0x1.96551dc3d73efp-28),
+	   V2 (-0x1.549cf8971bf69p-35), V2 (0x1.a3ab334fb6cf1p-43),
+	   V2 (-0x1.8cada87f89449p-51), V2 (0x1.2905e3226d256p-59),
+	   V2 (-0x1.6944e39ea6c95p-68), V2 (0x1.6bdde2f910276p-77),
+	   V2 (-0x1.29f3e7a889d8ap-86) } },
+  .j = { { V2 (0x1p+0), V2 (-0x1p-2), V2 (0x1p-6), V2 (-0x1.c71c71c71c71cp-12),
+	   V2 (0x1.c71c71c71c71cp-18), V2 (-0x1.23456789abcddp-24),
+	   V2 (0x1.02e85c0898a79p-31), V2 (-0x1.522a43f6492efp-39),
+	   V2 (0x1.522a43f0a7832p-47), V2 (-0x1.0b3130969318dp-55),
+	   V2 (0x1.5600a0c23e89ap-64), V2 (-0x1.6985384224p-73),
+	   V2 (0x1.357314d2cec4fp-82) },
+	 { V2 (0x1p-1), V2 (-0x1p-4), V2 (0x1.5555555555555p-9),
+	   V2 (-0x1.c71c71c71c71cp-15), V2 (0x1.6c16c16c16c17p-21),
+	   V2 (-0x1.845c8a0ce5128p-28), V2 (0x1.27e4fb7789ecep-35),
+	   V2 (-0x1.522a43f64e07ep-43), V2 (0x1.2c9758d7b5cf6p-51),
+	   V2 (-0x1.ab81e83a63995p-60), V2 (0x1.f1758e9fa77d9p-69),
+	   V2 (-0x1.e2140c2061d8ap-78), V2 (0x1.7de953893b13bp-87) } },
+  /* First zeros of y0 and y1, in two parts.  */
+  .z = { { V2 (0x1.c982eb8d417eap-1), V2 (0x1.ea9d270347f83p-56) },
+	 { V2 (0x1.193bed4dff243p+1), V2 (-0x1.bd1e50d219bfdp-55) } },
+  .zinv = { V2 (0x1.1e7d3131dd6bbp+0), V2 (0x1.d20f658382cf2p-2) },
+  .zhalf = { V2 (0x1.c982eb8d417eap-2), V2 (0x1.193bed4dff243p+0) },
+  /* pi/4 in three parts, the first two with 24 significant bits so that
+     k * pio4[0] and k * pio4[1] are exact for k < 2^25.  */
+  .pio4 = { V2 (0x1.921fb50000000p-1), V2 (0x1.110b460000000p-27),
+	    V2 (0x1.1a62633145c07p-55) },
+  .two_over_pi = V2 (0x1.45f306dc9c883p-1),
+  .inv_2pi = V2 (0x1.45f306dc9c883p-3),
+  .table_bound = V2 (0x1.fffffffffffffp+3),
+  .y_table_start = V2 (2),
+  .asymptotic_bound = V2 (16),
+  .range_val = V2 (0x1p23),
+  .y_min = V2 (0x1p-1022),
+  /* i0 and i1 overflow well below 720.  Above 700 e^x is scaled by 2^-64,
+     with 64 ln2 in two parts, so that it does not overflow before i does.  */
+  .i_bound = V2 (720),
+  .i_scale_bound = V2 (700),
+  .i_scale_hi = V2 (0x1.62e42fefa3800p+5),
+  .i_scale_lo = V2 (0x1.ef35793c76730p-39),
+  .i_scale = V2 (0x1p64),
+  .log1p_consts = V_LOG1P_CONSTANTS_TABLE,
+};
+
+#define V_BESSEL_TABLE_SCALE 4
+
+/* Evaluate the table entry covering x for each lane.  Lanes outside the
+   table, including NaNs, are clamped to the first or last entry.  */
+static inline float64x2_t
+v_bessel_lookup (const double (*tab)[V_BESSEL_ENTRY_LEN], float64x2_t x,
+		 float64x2_t start, const struct v_bessel_consts *d)
+{
+  float64x2_t xc = vminnmq_f64 (vmaxnmq_f64 (x, start), d->table_bound);
+  uint64x2_t i = vcvtq_u64_f64 (
+      vmulq_f64 (vsubq_f64 (xc, start), v_f64 (V_BESSEL_TABLE_SCALE)));
+
+  const double *e0 = tab[i[0]], *e1 = tab[i[1]];
+  float64x2_t c[V_BESSEL_ENTRY_LEN];
+  for (int k = 0; k < V_BESSEL_ENTRY_LEN; k += 2)
+    {
+      float64x2_t a = vld1q_f64 (e0 + k), b = vld1q_f64 (e1 + k);
+      c[k] = vzip1q_f64 (a, b);
+      c[k + 1] = vzip2q_f64 (a, b);
+    }
+
+  float64x2_t t = vsubq_f64 (vsubq_f64 (x, c[0]), c[1]);
+  float64x2_t p = v_horner_10_f64 (t, c + 3);
+  return vfmaq_f64 (c[2], t, p);
+}
+
+/* Hankel expansion of j (y = 0) or y (y = 1), for x >= 16.  */
+static inline float64x2_t
+v_bessel_jy_asymptotic (float64x2_t x, int nu, int y,
+			const struct v_bessel_consts *d)
+{
+  float64x2_t ix = vdivq_f64 (v_f64 (1), x);
+  float64x2_t u = vmulq_f64 (ix, ix);
+
+  /* phi = phi_hi + phi_lo, where phi_hi = a / x rounded.  */
+  float64x2_t phi_hi = vmulq_f64 (d->phi_a[nu], ix);
+  float64x2_t phi_lo = vmulq_f64 (vfmsq_f64 (d->phi_a[nu], phi_hi, x), ix);
+  float64x2_t pphi = vmulq_f64 (u, v_horner_9_f64 (u, d->phi[nu]));
+  phi_lo = vfmaq_f64 (phi_lo, pphi, ix);
+
+  float64x2_t m = vsqrtq_f64 (vmulq_f64 (d->two_over_pi, ix));
+  m = vmulq_f64 (m, vfmaq_f64 (v_f64 (1), u, v_horner_7_f64 (u, d->m[nu])));
+
+  /* theta = x + phi - (2 nu + 1) pi/4 = r + q pi/2, with q the nearest
+     integer, hence x + phi = r + k pi/4 with k = 2q + 2 nu + 1.  */
+  float64x2_t q = vrndnq_f64 (vfmaq_f64 (
+      v_f64 (-nu - 0.5), vaddq_f64 (x, phi_hi), d->two_over_pi));
+  float64x2_t k = vfmaq_f64 (v_f64 (2 * nu + 1), q, v_f64 (2));
+  /* Close to a zero of the function r is tiny, and x - k pi/4 ~= -phi.  The
+     first step is exact, and the rounding error of adding phi_hi is kept,
+     so that the cancellation is exact.  */
+  float64x2_t r0 = vfmsq_f64 (x, k, d->pio4[0]);
+  float64x2_t r = vaddq_f64 (r0, phi_hi);
+  float64x2_t b = vsubq_f64 (r, r0);
+  float64x2_t e = vaddq_f64 (vsubq_f64 (r0, vsubq_f64 (r, b)),
+			     vsubq_f64 (phi_hi, b));
+  r = vfmsq_f64 (r, k, d->pio4[1]);
+  r = vfmsq_f64 (r, k, d->pio4[2]);
+  r = vaddq_f64 (r, vaddq_f64 (e, phi_lo));
+
+  float64x2x2_t sc = v_sincos_reduced_inline (r, vcvtq_s64_f64 (q),
+					      ptr_barrier (&v_sincos_data));
+  return vmulq_f64 (m, y ? sc.val[0] : sc.val[1]);
+}
+
+/* y0 or y1 for normal x < 2.  log(x/z) is computed as log1p((x - z) / z)
+   close to z, otherwise as e ln2 + log1p(m / z - 1) with x = 2^e m.  */
+static inline float64x2_t
+v_bessel_y_small (float64x2_t x, int nu, const struct v_bessel_consts *d)
+{
+  const struct v_log1p_data *ld = &d->log1p_consts;
+  float64x2_t w = vmulq_f64 (x, x);
+  float64x2_t t = vsubq_f64 (vsubq_f64 (x, d->z[nu][0]), d->z[nu][1]);
+
+  uint64x2_t ux = vreinterpretq_u64_f64 (x);
+  float64x2_t e = vcvtq_f64_s64 (vsubq_s64 (
+      vreinterpretq_s64_u64 (vshrq_n_u64 (ux, 52)), v_s64 (1023)));
+  float64x2_t mant = vreinterpretq_f64_u64 (vorrq_u64 (
+      vandq_u64 (ux, v_u64 (0x000fffffffffffff)), v_u64 (0x3ff0000000000000)));
+  float64x2_t arg = vfmaq_f64 (v_f64 (-1), mant, d->zinv[nu]);
+
+  uint64x2_t near = vcgeq_f64 (x, d->zhalf[nu]);
+  arg = vbslq_f64 (near, vmulq_f64 (t, d->zinv[nu]), arg);
+  e = v_zerofy_f64 (e, near);
+
+  float64x2_t l = log1p_inline (arg, ld);
+  l = vfmaq_f64 (vfmaq_f64 (l, e, ld->ln2[1]), e, ld->ln2[0]);
+
+  float64x2_t j = v_horner_12_f64 (w, d->j[nu]);
+  float64x2_t s = v_horner_12_f64 (w, d->s[nu]);
+  s = vmulq_f64 (s, vmulq_f64 (t, vaddq_f64 (x, d->z[nu][0])));
+  l = vmulq_f64 (d->two_over_pi, l);
+  if (nu)
+    return vfmaq_f64 (vdivq_f64 (s, x), l, vmulq_f64 (x, j));
+  return vfmaq_f64 (s, l, j);
+}
+
+/* j0 or j1 of |x|, for |x| < 2^23 or NaN.  */
+static inline float64x2_t
+v_bessel_j_inline (float64x2_t ax, int nu, const struct v_bessel_consts *d)
+{
+  uint64x2_t large = vcgeq_f64 (ax, d->asymptotic_bound);
+  float64x2_t y = v_f64 (0);
+  if (likely (!v_all_u64 (large)))
+    y = v_bessel_lookup (nu ? __v_bessel_data.j1 : __v_bessel_data.j0, ax,
+			 v_f64 (0), d);
+  if (unlikely (v_any_u64 (large)))
+    y = vbslq_f64 (large, v_bessel_jy_asymptotic (ax, nu, 0, d), y);
+  return y;
+}
+
+/* y0 or y1 of x, for normal positive x < 2^23.  */
+static inline float64x2_t
+v_bessel_y_inline (float64x2_t x, int nu, const struct v_bessel_consts *d)
+{
+  uint64x2_t large = vcgeq_f64 (x, d->asymptotic_bound);
+  uint64x2_t small = vcltq_f64 (x, d->y_table_start);
+  float64x2_t y = v_f64 (0);
+  if (likely (!v_all_u64 (vorrq_u64 (large, small))))
+    y = v_bessel_lookup (nu ? __v_bessel_data.y1 : __v_bessel_data.y0, x,
+			 d->y_table_start, d);
+  if (unlikely (v_any_u64 (small)))
+    y = vbslq_f64 (small, v_bessel_y_small (x, nu, d), y);
+  if (unlikely (v_any_u64 (large)))
+    y = vbslq_f64 (large, v_bessel_jy_asymptotic (x, nu, 1, d), y);
+  return y;
+}
+
+/* i0 or i1 of |x|.  Overflows to infinity and propagates NaN.  */
+static inline float64x2_t
+v_bessel_i_inline (float64x2_t ax, int nu, const struct v_bessel_consts *d)
+{
+  uint64x2_t large = vcgeq_f64 (ax, d->asymptotic_bound);
+  float64x2_t y = v_f64 (0);
+  if (likely (!v_all_u64 (large)))
+    y = v_bessel_lookup (nu ? __v_bessel_data.i1 : __v_bessel_data.i0, ax,
+			 v_f64 (0), d);
+  if (unlikely (v_any_u64 (large)))
+    {
+      float64x2_t x = vminq_f64 (ax, d->i_bound);
+      float64x2_t v = vdivq_f64 (v_f64 (1), x);
+      float64x2_t p
+	  = vfmaq_f64 (v_f64 (1), v, v_horner_12_f64 (v, d->i[nu]));
+      p = vmulq_f64 (p, vsqrtq_f64 (vmulq_f64 (v, d->inv_2pi)));
+
+      /* e^x = e^(x - s) * 2^64, with s = 64 ln2, above i_scale_bound.  The
+	 tail of the exp helper is only meant for tiny corrections, so the
+	 low part of s is applied as e^-s_lo ~= 1 - s_lo instead.  */
+      uint64x2_t scale = vcgtq_f64 (x, d->i_scale_bound);
+      float64x2_t s_hi = vbslq_f64 (scale, d->i_scale_hi, v_f64 (0));
+      float64x2_t s_lo = vbslq_f64 (scale, d->i_scale_lo, v_f64 (0));
+      float64x2_t ex = v_exp_tail_inline (vsubq_f64 (x, s_hi), v_f64 (0));
+      p = vmulq_f64 (ex, p);
+      p = vfmsq_f64 (p, p, s_lo);
+      p = vmulq_f64 (p, vbslq_f64 (scale, d->i_scale, v_f64 (1)));
+      y = vbslq_f64 (large, p, y);
+    }
+  return y;
+}
+
+#endif
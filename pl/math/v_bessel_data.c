@@ -0,0 +1,1868 @@
+/*
+ * Data for vector Bessel functions.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "math_config.h"
+
+/* Piecewise polynomial approximations of j0, j1, i0 and i1 on [0, 16), and of
+   y0 and y1 on [2, 16), on intervals of width 1/4.  Each entry
+   {c, clo, f(c), q[0..10]} approximates f(x) ~= f(c) + t * Q(t), with
+   t = (x - c) - clo.  c is the midpoint of the interval, except for the
+   intervals closest to a zero of f, where c + clo is the zero and f(c) is 0,
+   so that the relative error stays small close to it.  Polynomial
+   coefficients were computed by Chebyshev interpolation in quad precision.  */
+const struct v_bessel_data __v_bessel_data = {
+  .j0 = {
+    { 0x1p-3, 0x0p+0, 0x1.fe007ff1c7fffp-1, -0x1.ff002aa71c9f5p-5,
+      -0x1.fd00d53c7360ap-3, 0x1.fee3bffbbbf36p-8, 0x1.fcaba3705cfap-7,
+      -0x1.548e5cb777a0cp-12, -0x1.c400eed1b33fep-12, 0x1.c60b92c186798p-18,
+      0x1.c3ea376338244p-18, -0x1.6b386a40a3323p-24, -0x1.2119f79770173p-24,
+      0x1.8352f00f41ed1p-31 },
+    { 0x1.8p-2, 0x0p+0, 0x1.ee285796bfce8p-1, -0x1.794a186b69c69p-3,
+      -0x1.e5433948f2945p-3, 0x1.788bc6e75f21cp-6, 0x1.e24e6b253f009p-7,
+      -0x1.f590f5381e24ap-11, -0x1.ab67b86948ca2p-12, 0x1.4e2df9f99d1bep-16,
+      0x1.aa9e7ed54e76ap-18, -0x1.0b3cf903d0e53p-22, -0x1.109eb055e70ap-24,
+      0x1.1ce69e6da662p-29 },
+    { 0x1.4p-1, 0x0p+0, 0x1.cf352138d4ab2p-1, -0x1.30a093b16f993p-2,
+      -0x1.b702efbc29facp-3, 0x1.2eeee0b689533p-5, 0x1.af033aea2ba1cp-7,
+      -0x1.92c8e442d82a6p-10, -0x1.7b95bfc1de78p-12, 0x1.0c12d7f815a85p-15,
+      0x1.797835dc72235p-18, -0x1.ac705cdde2201p-22, -0x1.e1378ea5e9c7dp-25,
+      0x1.c8853724424d3p-29 },
+    { 0x1.cp-1, 0x0p+0, 0x1.a297458a01c65p-1, -0x1.96789d2ae443dp-2,
+      -0x1.74a4b2e2feacdp-3, 0x1.91ee4f91886e5p-5, 0x1.659405d6c9c0ep-7,
+      -0x1.0a73089f8e58fp-9, -0x1.3737d5ed80558p-12, 0x1.62111ba0c6049p-15,
+      0x1.33445bbee2332p-18, -0x1.1a9da41340a6p-21, -0x1.85d4a68ad8cfcp-25,
+      0x1.2ce5284ab3c11p-28 },
+    { 0x1.2p+0, 0x0p+0, 0x1.6a5f6c08995e5p-1, -0x1.e98e423a36ba4p-2,
+      -0x1.2195b9a4904ffp-3, 0x1.e034ea570418bp-5, 0x1.09fd826a669fep-7,
+      -0x1.3d0d4634153b9p-9, -0x1.c44046be0fca6p-13, 0x1.a4487d4604f66p-15,
+      0x1.b804c60d4f0bcp-19, -0x1.4eecafc4ed0c1p-21, -0x1.145a922b7f5e1p-25,
+      0x1.642c68320851fp-28 },
+    { 0x1.6p+0, 0x0p+0, 0x1.2923311e7b196p-1, -0x1.131d12edf35f4p-1,
+      -0x1.8438305156f38p-4, 0x1.0ae9946def871p-4, 0x1.426c4001f7107p-8,
+      -0x1.5e7f1babf864fp-9, -0x1.021ce97db02bp-13, 0x1.cf0fe04aa36aap-15,
+      0x1.e2a4914d410d8p-20, -0x1.7030b1788e3a2p-21, -0x1.26a8a26d5d578p-26,
+      0x1.86ec9fdabbc76p-28 },
+    { 0x1.ap+0, 0x0p+0, 0x1.c3b63a40ac889p-2, -0x1.24fdbc6d9f415p-1,
+      -0x1.6c6de6e704922p-5, 0x1.181788db87ee4p-4, 0x1.87390451b909ep-10,
+      -0x1.6d09666bf8f89p-9, -0x1.96b10ce201268p-16, 0x1.e013481c4228bp-15,
+      0x1.dbb31385bb569p-23, -0x1.7c8dfcd2e7accp-21, -0x1.460e03d947a92p-30,
+      0x1.932bf927c73aap-28 },
+    { 0x1.ep+0, 0x0p+0, 0x1.2f77684f94a1bp-2, -0x1.29cb87526959fp-1,
+      0x1.c5cfabb511618p-8, 0x1.17138025bda2bp-4, -0x1.039084162d6e9p-9,
+      -0x1.67fa4517087aap-9, 0x1.3c1faf53fe512p-14, 0x1.d67521a261bb8p-15,
+      -0x1.6d818388d59cbp-20, -0x1.735ce4b21314ep-21, 0x1.fcb6aa3f1a9c9p-27,
+      0x1.883fa574b563dp-28 },
+    { 0x1.1p+1, 0x0p+0, 0x1.382ee4d39f511p-3, -0x1.2192718f2904cp-1,
+      0x1.d1c98782c5338p-5, 0x1.080fbda2450aap-4, -0x1.5c284f30ff374p-8,
+      -0x1.4fb623cab345dp-9, 0x1.65044b0fce49ep-13, 0x1.b2d9ffad949d1p-15,
+      -0x1.801cb2d914fc3p-19, -0x1.5532dd70affecp-21, 0x1.00e31cbbbea6ap-25,
+      0x1.66d55c9a1e441p-28 },
+    { 0x1.33d152e971b4p+1, -0x1.0f539d7da258ep-53, 0x0p+0,
+      -0x1.09cdb3655128p-1, 0x1.ba1deea029494p-4, 0x1.cfae864368d7p-5,
+      -0x1.1bb1cbe1a4073p-7, -0x1.1f992590d133fp-9, 0x1.15382ba07249fp-12,
+      0x1.6ed3b9f2e8972p-15, -0x1.232c786a7334ap-18, -0x1.1cce7e2971be2p-21,
+      0x1.7ffd33228e971p-25, 0x1.3047635893f51p-28 },
+    { 0x1.33d152e971b4p+1, -0x1.0f539d7da258ep-53, 0x0p+0,
+      -0x1.09cdb3655128p-1, 0x1.ba1deea0294b6p-4, 0x1.cfae864368624p-5,
+      -0x1.1bb1cbe18725dp-7, -0x1.1f9925957a052p-9, 0x1.15382ca82c96p-12,
+      0x1.6ed3912727839p-15, -0x1.23280e70b50b6p-18, -0x1.1d21e25cd349p-21,
+      0x1.880d4d7e47e84p-25, 0x1.deb187d77470cp-29 },
+    { 0x1.7p+1, 0x0p+0, -0x1.b7f15ff27299ep-3, -0x1.896d353f52f9p-2,
+      0x1.64d0c27e8dd01p-3, 0x1.27a010ba83d02p-5, -0x1.a350a807d0daep-7,
+      -0x1.4ddef180a8825p-10, 0x1.8ba41bc7009afp-12, 0x1.8f707d629c96dp-16,
+      -0x1.978f508b65055p-18, -0x1.2818bdc7f011ep-22, 0x1.094f83fe6eb6ap-24,
+      0x1.2a6984966e417p-29 },
+    { 0x1.9p+1, 0x0p+0, -0x1.32a70ee3cd6f5p-2, -0x1.2a22db050a95dp-2,
+      0x1.920e5f3755f13p-3, 0x1.7287e20afed48p-6, -0x1.cb852651955e3p-7,
+      -0x1.657a112f4c40cp-11, 0x1.abdc2de9ba7c4p-12, 0x1.7678427e75136p-17,
+      -0x1.b5379c3c3307fp-18, -0x1.ef61c2d7f449p-24, 0x1.1b11d076b1f45p-24,
+      0x1.c422c846a530cp-31 },
+    { 0x1.bp+1, 0x0p+0, -0x1.705132d1d9be6p-2, -0x1.846094a41de38p-3,
+      0x1.a9dac4199251ep-3, 0x1.0fcb4afc4b208p-7, -0x1.dac592b7595cbp-7,
+      -0x1.fe987662cc4bp-15, 0x1.b4482ff54457cp-12, -0x1.0d22d77c365dap-19,
+      -0x1.ba1b80dcb2b4dp-18, 0x1.b39ebc7b37206p-25, 0x1.1c92b6e420324p-24,
+      -0x1.384c2e59cb48cp-31 },
+    { 0x1.dp+1, 0x0p+0, -0x1.937b4938aa87p-2, -0x1.5c3bdf0d15d26p-4,
+      0x1.ab7f6a4265696p-3, -0x1.8ff80367c6adfp-8, -0x1.d093ee9ad5a31p-7,
+      0x1.22eb35c8307dap-11, 0x1.a4a3d2dd59ep-12, -0x1.f56df2107bb71p-17,
+      -0x1.a6193190613d2p-18, 0x1.c928d5e87c956p-23, 0x1.0dcdfb465a08dp-24,
+      -0x1.07d77ad5a6a43p-29 },
+    { 0x1.fp+1, 0x0p+0, -0x1.9c0a65186bbbp-2, 0x1.1c011f1f5d985p-6,
+      0x1.9775bb4d97a3ep-3, -0x1.4495913cce99fp-6, -0x1.add97e09b289dp-7,
+      0x1.28a580f703416p-10, 0x1.7e05b3fc7779fp-12, -0x1.c3cc5fae35c54p-16,
+      -0x1.7a7b576dee621p-18, 0x1.849aa8d52c2f4p-22, 0x1.df609258dc24bp-25,
+      -0x1.b18b7bb82209fp-29 },
+    { 0x1.08p+2, 0x0p+0, -0x1.8b3cf6edfaeeep-2, 0x1.cbfcaa2cde2b1p-4,
+      0x1.6f5c326f23c58p-3, -0x1.070f830c77817p-5, -0x1.74d68b13a9f0ap-7,
+      0x1.ad65616a17e85p-10, 0x1.42cd600e4f82bp-12, -0x1.38d8e26573303p-15,
+      -0x1.39e45e2be09fap-18, 0x1.06b9e1b1042bdp-21, 0x1.881132f9ab012p-25,
+      -0x1.20b7785dfb6ffp-28 },
+    { 0x1.18p+2, 0x0p+0, -0x1.639108f151875p-2, 0x1.8ff48cd424aa4p-3,
+      0x1.35db7c814d56ap-3, -0x1.5b239fbc24fbdp-5, -0x1.28fefa8e2d0bap-7,
+      0x1.0c4ddd729553cp-9, 0x1.ecfd41603ef1ep-13, -0x1.7d69bba1ac034p-15,
+      -0x1.d04be86b22b54p-19, 0x1.3bb719c021b87p-21, 0x1.1ad8deb022ad1p-25,
+      -0x1.57a5cdfbdbf47p-28 },
+    { 0x1.28p+2, 0x0p+0, -0x1.2899eb6a172cep-2, 0x1.0cc4a2764a1bcp-2,
+      0x1.dcfa7bd176166p-4, -0x1.9a5bace9a5617p-5, -0x1.9d8babef6d14bp-8,
+      0x1.325796d31ef0ap-9, 0x1.3b18911c76fc1p-13, -0x1.abe358b12041cp-15,
+      -0x1.140e57bd7a594p-19, 0x1.5e550f42e8dfdp-21, 0x1.3c4259b6108bap-26,
+      -0x1.7a773ba4e46f7p-28 },
+    { 0x1.38p+2, 0x0p+0, -0x1.bd8fc2ecc47fp-3, 0x1.3e6a958f32f0cp-2,
+      0x1.3aede176f13d1p-4, -0x1.c1c213fe89a96p-5, -0x1.ad6b924597268p-9,
+      0x1.46ea00223a622p-9, 0x1.e8ad234a04e5bp-15, -0x1.c1d96b4917b9dp-15,
+      -0x1.27e566e390a51p-21, 0x1.6cb71880abcadp-21, 0x1.93171c2732ee8p-29,
+      -0x1.87413b4d21667p-28 },
+    { 0x1.48p+2, 0x0p+0, -0x1.164a3879b75cbp-3, 0x1.5b14edb67224ep-2,
+      0x1.1dafd0650926p-5, -0x1.cfbce47c04a6fp-5, -0x1.178d4a5c75448p-13,
+      0x1.491f63c87b52p-9, -0x1.2b2c35b36628bp-15, -0x1.be4a16293afdap-15,
+      0x1.04a336e02c6aep-20, 0x1.662e0a2b093dbp-21, -0x1.b0faa855a0371p-27,
+      -0x1.7d63bacec6a4bp-28 },
+    { 0x1.6148f5b2c2e45p+2, 0x1.75054cd60a517p-54, 0x0p+0,
+      0x1.5c6e60a097823p-2, -0x1.f8f72e7a848ep-6, -0x1.b2150cb41e8c8p-5,
+      0x1.2f7ffe9024ed3p-8, 0x1.27e31fe995456p-9, -0x1.6f641f524c399p-13,
+      -0x1.863f4a6905c78p-15, 0x1.ad76fb93a2d0ap-19, 0x1.32d93fc23349fp-21,
+      -0x1.2fcba8f84c91p-25, -0x1.5b7b0ab216579p-28 },
+    { 0x1.6148f5b2c2e45p+2, 0x1.75054cd60a517p-54, 0x0p+0,
+      0x1.5c6e60a097823p-2, -0x1.f8f72e7a848ep-6, -0x1.b2150cb41e8c1p-5,
+      0x1.2f7ffe90256c7p-8, 0x1.27e31fe9a9cecp-9, -0x1.6f641f42b654p-13,
+      -0x1.863f47c0fe051p-15, 0x1.ad779b8947439p-19, 0x1.32ecbd951aebbp-21,
+      -0x1.2f0161a6529e4p-25, -0x1.2bde233891e51p-28 },
+    { 0x1.78p+2, 0x0p+0, 0x1.d568976dba3cp-4, 0x1.328c2f53e4924p-2,
+      -0x1.530f97bda2c23p-4, -0x1.6669ca7a40262p-5, 0x1.0deaffb201338p-7,
+      0x1.d01a56ac85556p-10, -0x1.22f057b8c7f29p-12, -0x1.261008fbe06fap-15,
+      0x1.41bf950819cc8p-18, 0x1.c031b35456db8p-22, -0x1.b53e6dd915248p-25,
+      -0x1.ca2f7380fdbep-29 },
+    { 0x1.88p+2, 0x0p+0, 0x1.780d3a3718d8ep-3, 0x1.005356aaaf713p-2,
+      -0x1.cbbff33fcf85bp-4, -0x1.1a9dd8f78cf2fp-5, 0x1.4d53a9c039db9p-7,
+      0x1.581701276f85cp-10, -0x1.59f0242120a44p-12, -0x1.9d29c7c084f8ep-16,
+      0x1.76a3390ee76fdp-18, 0x1.2c9dadb5ddee7p-22, -0x1.f64b9c6ee15dep-25,
+      -0x1.275295a1c8dc7p-29 },
+    { 0x1.98p+2, 0x0p+0, 0x1.e8d3be5f66f25p-3, 0x1.81d1062e56053p-3,
+      -0x1.12ac764264e3p-3, -0x1.82de34dc47e6cp-6, 0x1.7890d0fb22b9p-7,
+      0x1.9e67d6a43b268p-11, -0x1.7c8cb90a83063p-12, -0x1.b25051944169fp-17,
+      0x1.958e0d9db0786p-18, 0x1.127c8dcb7b86fp-23, -0x1.0cec0879487c3p-24,
+      -0x1.d23cde8b8fe11p-31 },
+    { 0x1.a8p+2, 0x0p+0, 0x1.1bb9d70b88b74p-2, 0x1.e1d23d58ef741p-4,
+      -0x1.2de86a4405ad2p-3, -0x1.80bef80be7d0bp-7, 0x1.8d9d64cd7596dp-7,
+      0x1.eb88f0e3ed3d3p-13, -0x1.891710b92b486p-12, -0x1.7131345f88475p-21,
+      0x1.9cf1c5641d4cdp-18, -0x1.02ef8ead28bc1p-25, -0x1.0f069613df1ecp-24,
+      0x1.0e67d479cc7b4p-31 },
+    { 0x1.b8p+2, 0x0p+0, 0x1.304415d3eb481p-2, 0x1.5c06277e82e8dp-5,
+      -0x1.3697fa9e5d5efp-3, 0x1.bad1fc2141b85p-12, 0x1.8bbdcb496a307p-7,
+      -0x1.53333c79efc2dp-12, -0x1.7f27ee5919eap-12, 0x1.7fa7d321a60ap-17,
+      0x1.8c9f0b5e54e1fp-18, -0x1.8cbcf79c2d96ep-23, -0x1.017524ffe2803p-24,
+      0x1.eccefc41da1c7p-30 },
+    { 0x1.c8p+2, 0x0p+0, 0x1.317d84d8f5e44p-2, -0x1.0a667944441fcp-5,
+      -0x1.2cd10df2b5d1cp-3, 0x1.8f4641295d221p-7, 0x1.7385ea7cd6d98p-7,
+      -0x1.be717147f2889p-11, -0x1.5fa2749ad4e6p-12, 0x1.7d5288af3568bp-16,
+      0x1.65c58c828318ap-18, -0x1.5f3418c7c9ba8p-22, -0x1.ca41f6c3fcd3ep-25,
+      0x1.9978e64f1bfe9p-29 },
+    { 0x1.d8p+2, 0x0p+0, 0x1.2001106334647p-2, -0x1.a5d50dfe16acfp-4,
+      -0x1.11b46b08269b5p-3, 0x1.77048d8cdccaep-6, 0x1.46cbee1f3858dp-7,
+      -0x1.5a164f796d969p-10, -0x1.2ca3a21e2229p-12, 0x1.11203627c708dp-15,
+      0x1.2adf91b050545p-18, -0x1.e226d2b7180d8p-22, -0x1.779bc572c5a29p-25,
+      0x1.11b4ef3148fe1p-28 },
+    { 0x1.e8p+2, 0x0p+0, 0x1.fafb7132157d9p-3, -0x1.51c233dd19ed1p-3,
+      -0x1.ceaf9cc12712fp-4, 0x1.05c0bffaf077ap-5, 0x1.0888bfeb2bb03p-7,
+      -0x1.bea9dc54bacap-10, -0x1.d2bf9f68ed59ep-13, 0x1.52b9cdd750b1p-15,
+      0x1.bf14f70f13e73p-19, -0x1.23eb438472ed7p-21, -0x1.0ffcb03bc2bebp-25,
+      0x1.462eefdbf4008p-28 },
+    { 0x1.f8p+2, 0x0p+0, 0x1.992aca572dcd3p-3, -0x1.b832a17fd017dp-3,
+      -0x1.6144de77b5eabp-4, 0x1.3ea3b251d7c4bp-5, 0x1.79506b16b26cbp-8,
+      -0x1.03cc022f63933p-9, -0x1.33e0adb92881ap-13, 0x1.7fe7169f1f0c8p-15,
+      0x1.109d1dd0e42b3p-19, -0x1.45534063ab8bbp-21, -0x1.3332d44f707ecp-26,
+      0x1.673a001607f29p-28 },
+    { 0x1.04p+3, 0x0p+0, 0x1.215d60fe97a8fp-3, -0x1.00761ca922995p-2,
+      -0x1.c478bbc18c905p-5, 0x1.6354e574cac28p-5, 0x1.9f2f8e102ba81p-9,
+      -0x1.189815870bab5p-9, -0x1.0c51bd3a03b5fp-14, 0x1.965169297da8p-15,
+      0x1.52cbbf275a4e4p-21, -0x1.5386f8255dcbep-21, -0x1.b7751fde0d85ep-29,
+      0x1.730e23390fc69p-28 },
+    { 0x1.0cp+3, 0x0p+0, 0x1.36f24e279009ap-4, -0x1.1440ce9953c29p-2,
+      -0x1.66026827a6092p-6, 0x1.7235ef909437ap-5, 0x1.e0886c13a8a25p-12,
+      -0x1.1cceab27e0fdcp-9, 0x1.616f46ec526dbp-16, 0x1.94fa16314acd8p-15,
+      -0x1.a682a473fee9ep-21, -0x1.4de458408de6p-21, 0x1.8bf9239d2d634p-27,
+      0x1.6924cdd66aaddp-28 },
+    { 0x1.14eb56cccdecap+3, -0x1.51970714c7c25p-52, 0x0p+0,
+      -0x1.15f7977a772d4p-2, 0x1.00f7fcf183e0dp-6, 0x1.68b984ec6493cp-5,
+      -0x1.48e63600d841dp-9, -0x1.0e0d60385a74ep-9, 0x1.d796052782948p-14,
+      0x1.7800bc56aee4fp-15, -0x1.332484d6d79edp-19, -0x1.30e8ff2a0a455p-21,
+      0x1.cedb826edcaa1p-26, 0x1.49da48313ccffp-28 },
+    { 0x1.14eb56cccdecap+3, -0x1.51970714c7c25p-52, 0x0p+0,
+      -0x1.15f7977a772d4p-2, 0x1.00f7fcf183e79p-6, 0x1.68b984ec6439cp-5,
+      -0x1.48e636007fe64p-9, -0x1.0e0d603be3d42p-9, 0x1.d796084201aedp-14,
+      0x1.78009ddd1bef9p-15, -0x1.331dfbbe5c4b1p-19, -0x1.312620d23b35dp-21,
+      0x1.da873a423494dp-26, 0x1.1c91ecfe45ac1p-28 },
+    { 0x1.24p+3, 0x0p+0, -0x1.eb8b2a13ba93dp-4, -0x1.d4b9a04f10c97p-3,
+      0x1.29239190c6949p-4, 0x1.1f0592c197798p-5, -0x1.bfeed0aaf995dp-8,
+      -0x1.965a8a55f09a8p-10, 0x1.fa436333ac6c7p-13, 0x1.0cfc57b81fd13p-15,
+      -0x1.241063b9ee5bp-18, -0x1.a18449cbfd954p-22, 0x1.994b8e25280cap-25,
+      0x1.ad0307a86ba33p-29 },
+    { 0x1.2cp+3, 0x0p+0, -0x1.609a9d782c552p-3, -0x1.7deb8b1226d1bp-3,
+      0x1.895794690aed3p-4, 0x1.bf7dad92cf6b1p-6, -0x1.1782542d6ce7bp-7,
+      -0x1.2d7125290e148p-10, 0x1.2f7e4cb3cc4fap-12, 0x1.7ad2c2a3258f8p-16,
+      -0x1.5549bd4d10678p-18, -0x1.1765553a0538fp-22, 0x1.d5f0cfc88c737p-25,
+      0x1.117acf3d83549p-29 },
+    { 0x1.34p+3, 0x0p+0, -0x1.b2fd09f7dfcffp-3, -0x1.123b142ff3499p-3,
+      0x1.cf7add852af58p-4, 0x1.297d38b0a1bc8p-6, -0x1.3d5c2207b4d5bp-7,
+      -0x1.6a1e878f79fe4p-11, 0x1.4f48ecef76b01p-12, 0x1.903b6b3f0ce02p-17,
+      -0x1.71f50d316567cp-18, -0x1.fa976733c5bc1p-24, 0x1.f6772e4092297p-25,
+      0x1.9da6347a8e0c3p-31 },
+    { 0x1.3cp+3, 0x0p+0, -0x1.e88f5f34b99c1p-3, -0x1.314dbcbe21433p-4,
+      0x1.f804b9c67400bp-4, 0x1.0aca76b401939p-7, -0x1.4fa9e7617df9fp-7,
+      -0x1.a3ff91ebaf9fp-13, 0x1.5af1de35d81a6p-12, 0x1.912a3091a5f9ep-21,
+      -0x1.78a5dcd9f9027p-18, 0x1.fa2be0091e31bp-26, 0x1.f93bda1889491p-25,
+      -0x1.1c4e0f3f70bc7p-31 },
+    { 0x1.44p+3, 0x0p+0, -0x1.fecb4868dc0f6p-3, -0x1.8d6036cda6d0ap-7,
+      0x1.009f9e0d8ef0ap-3, -0x1.165f21d7293b3p-9, -0x1.4dbd331bad2c8p-7,
+      0x1.3253c59dca4a2p-12, 0x1.521b998d37095p-12, -0x1.59aeaf46eb75dp-17,
+      -0x1.693ceaf6d064p-18, 0x1.7440dfb98a071p-23, 0x1.de5f412cc0e61p-25,
+      -0x1.df61676ce3be7p-30 },
+    { 0x1.4cp+3, 0x0p+0, -0x1.f51ce0659a86p-3, 0x1.957cfef4d0bf1p-5,
+      0x1.eb578d251a1ecp-4, -0x1.8a1a541891c63p-7, -0x1.3819863fb946cp-7,
+      0x1.8d3cd964ada36p-11, 0x1.359c7c53158ap-12, -0x1.5934ff1186843p-16,
+      -0x1.44e6c3720fe1p-18, 0x1.47cf88992227bp-22, 0x1.a7bf9a861569ep-25,
+      -0x1.888fc2fb4b4p-29 },
+    { 0x1.54p+3, 0x0p+0, -0x1.ccdfef6c1a53fp-3, 0x1.b4cebfc336c69p-4,
+      0x1.b851b02fb75fbp-4, -0x1.57e19b111e0b5p-6, -0x1.1067d9068179bp-7,
+      0x1.32935b7c50877p-10, 0x1.076e710e1edeep-12, -0x1.eea5a0aca7bc2p-16,
+      -0x1.0e06d781bed37p-18, 0x1.c083b284b4b1ap-22, 0x1.58d92a7d1ba54p-25,
+      -0x1.046a2563f97a2p-28 },
+    { 0x1.5cp+3, 0x0p+0, -0x1.893fdff80fda2p-3, 0x1.3f68d2c1c3f53p-3,
+      0x1.6be0e71261e1p-4, -0x1.d2e446e2900ep-6, -0x1.b2b23f9f97913p-8,
+      0x1.8a5a089ce38e7p-10, 0x1.951b59cea8867p-13, -0x1.325b714f00b42p-15,
+      -0x1.9020f201ad464p-19, 0x1.0eb09e0843e69p-21, 0x1.ed1c97c8b8125p-26,
+      -0x1.3493f4254d561p-28 },
+    { 0x1.64p+3, 0x0p+0, -0x1.2efce0911e33fp-3, 0x1.8ea6509bbb1c8p-3,
+      0x1.0b2774a5a2f4fp-4, -0x1.17a0db2cfbc3dp-5, -0x1.2cf3808ddf2e8p-8,
+      0x1.c92072ca0dff9p-10, 0x1.0591425cbbfdp-13, -0x1.5a74785c25122p-15,
+      -0x1.dd40ae6104d2cp-20, 0x1.2ca0c2ec2e587p-21, 0x1.0db56f2a21ab1p-26,
+      -0x1.521336ae6b0dp-28 },
+    { 0x1.6cp+3, 0x0p+0, -0x1.883461da5c4d6p-4, 0x1.c3d05d855bc8ap-3,
+      0x1.38c3ca60738c9p-5, -0x1.340bf111d47aep-5, -0x1.2fe30f4bbbaf6p-9,
+      0x1.eba039d2b8b2dp-10, 0x1.a420d45c697dap-15, -0x1.6d856254bd9f6p-15,
+      -0x1.0545358be92f1p-21, 0x1.387e67a33bcc1p-21, 0x1.076b97a5a2addp-29,
+      -0x1.5b55e88612bfp-28 },
+    { 0x1.79544008272b6p+3, 0x1.444fd5821d5bp-52, 0x0p+0, 0x1.dc13e66ac2e77p-3,
+      -0x1.42ff0cdc58466p-7, -0x1.38d1dd8992e1ep-5, 0x1.a55e9b346a02dp-10,
+      0x1.e2e16f9784a0ap-10, -0x1.3dfc37b4925acp-14, -0x1.5ce7f764ffbe7p-15,
+      0x1.bb15cfaa7595dp-20, 0x1.233b13e076b51p-21, -0x1.646e8a9b7dda3p-26,
+      -0x1.4ec084118ba8bp-28 },
+    { 0x1.79544008272b6p+3, 0x1.444fd5821d5bp-52, 0x0p+0, 0x1.dc13e66ac2e77p-3,
+      -0x1.42ff0cdc58463p-7, -0x1.38d1dd8992e04p-5, 0x1.a55e9b346edbfp-10,
+      0x1.e2e16f97d0781p-10, -0x1.3dfc378283033p-14, -0x1.5ce7f491e79ddp-15,
+      0x1.bb1779d913d98p-20, 0x1.23487e3a83f79p-21, -0x1.6245df4fb9cdep-26,
+      -0x1.32095192ad8b1p-28 },
+    { 0x1.84p+3, 0x0p+0, 0x1.335566e908b2bp-4, 0x1.b53df955eb758p-3,
+      -0x1.7b74bce75f0abp-5, -0x1.171487cb2842dp-5, 0x1.26e8b485d59ap-8,
+      0x1.a2c4eaab69912p-10, -0x1.5c68ddcb3e519p-13, -0x1.26ab13d16b028p-15,
+      0x1.a6a51e4c1736cp-19, 0x1.e0511e4e7acb8p-22, -0x1.352800dc0bcbcp-25,
+      -0x1.0023f4d65047ep-28 },
+    { 0x1.8cp+3, 0x0p+0, 0x1.fffe9a7a2e65ep-4, 0x1.795db0e7cb2b6p-3,
+      -0x1.1e7dd27bc7f0ap-4, -0x1.d500550fba591p-6, 0x1.9e5e368d50efbp-8,
+      0x1.56224c4e62233p-10, -0x1.d09ab6b650a97p-13, -0x1.d3ffa3ee131a8p-16,
+      0x1.0f76da5f3b30fp-18, 0x1.72fdaa82ce594p-22, -0x1.82aa1c419c0f5p-25,
+      -0x1.81649fec8da63p-29 },
+    { 0x1.94p+3, 0x0p+0, 0x1.5485e140bdc6fp-3, 0x1.279c126228ff9p-3,
+      -0x1.6bf00631b459fp-4, -0x1.613cdb5932f9ep-6, 0x1.fabfb15119186p-8,
+      0x1.ecc8f3eed5ffdp-11, -0x1.13a191f9c711p-12, -0x1.40b24a067a52ap-16,
+      0x1.3ab2239d1b1a4p-18, 0x1.e21cf74af561cp-23, -0x1.b864dceb8b6aep-25,
+      -0x1.d9f8834366b59p-30 },
+    { 0x1.9cp+3, 0x0p+0, 0x1.926d0fa72ef3bp-3, 0x1.8abda1563b9acp-4,
+      -0x1.a1c179560703bp-4, -0x1.b49ed4d562b81p-7, 0x1.1b7f966274b2fp-7,
+      0x1.131c4b1b9ad69p-11, -0x1.2dd694daccacfp-12, -0x1.3909f773d5011p-17,
+      0x1.52aa8cf50af3fp-18, 0x1.89c97aa3d62b6p-24, -0x1.d368151378bf7p-25,
+      -0x1.30416f1c3adc6p-31 },
+    { 0x1.a4p+3, 0x0p+0, 0x1.b65b8392ec71bp-3, 0x1.63c2432cef902p-5,
+      -0x1.bd2243065eb8cp-4, -0x1.22b6366d9047fp-8, 0x1.2806dc133d2f7p-7,
+      0x1.652693594e557p-14, -0x1.359e304741881p-12, 0x1.d1c7c3bfdbfecp-21,
+      0x1.56315d1b2f378p-18, -0x1.81e441cf35e8bp-25, -0x1.d2608ceacc7ffp-25,
+      0x1.5ecd2f7a814aap-31 },
+    { 0x1.acp+3, 0x0p+0, 0x1.be9cc0d53b43bp-3, -0x1.6e412e23f3dc9p-7,
+      -0x1.bce69decfd1d9p-4, 0x1.2acef0aef9263p-8, 0x1.2281355d7f639p-7,
+      -0x1.714dcb5d91e21p-12, -0x1.2ac6f77bf9f05p-12, 0x1.6c888614eb4fp-17,
+      0x1.4551d8ffaff04p-18, -0x1.7c7a2b43843b8p-23, -0x1.b5a890b5efa1ep-25,
+      0x1.e91a94d68d36fp-30 },
+    { 0x1.b4p+3, 0x0p+0, 0x1.ab33d1b80ae89p-3, -0x1.067ef690e8503p-4,
+      -0x1.a191cd5e2ca89p-4, 0x1.add5ddb32d9c6p-7, 0x1.0b901809e7ff8p-7,
+      -0x1.8f165f058b0c2p-11, -0x1.0e3bab823478dp-12, 0x1.50ada6989733cp-16,
+      0x1.214d5402dcbc7p-18, -0x1.3f2ca88c5f60fp-22, -0x1.7f3ed0a43e61ep-25,
+      0x1.813b54bb8d8a2p-29 },
+    { 0x1.bcp+3, 0x0p+0, 0x1.7dd326e8c2bd8p-3, -0x1.cb2edc5474944p-4,
+      -0x1.6d4715be82934p-4, 0x1.53a2389ca720dp-6, 0x1.c9ba714395ef7p-8,
+      -0x1.250764fdcd0cep-10, -0x1.c3e38584cfc55p-13, 0x1.d4c4e108889eep-16,
+      0x1.d909b98876edep-19, -0x1.ab85d95d2c662p-22, -0x1.32a44e3b1e4d3p-25,
+      0x1.f5865697b68cep-29 },
+    { 0x1.c4p+3, 0x0p+0, 0x1.39ba98493bf0ap-3, -0x1.381a9e2aeb843p-3,
+      -0x1.23a20e389a467p-4, 0x1.b994e86d54829p-6, 0x1.61faa4151586p-8,
+      -0x1.6f63c698d1b5dp-10, -0x1.5190903f1b206p-13, 0x1.1d7a83b842945p-15,
+      0x1.54a407d24d70cp-19, -0x1.fd10e92c6bb41p-22, -0x1.a9471d70f495p-26,
+      0x1.255ec824915cdp-28 },
+    { 0x1.ccp+3, 0x0p+0, 0x1.c6fbfbcd2259p-4, -0x1.76077779c620dp-3,
+      -0x1.92f20a58048e5p-5, 0x1.017d5fcf6513cp-5, 0x1.cd15398912354p-9,
+      -0x1.a2745ca81be58p-10, -0x1.9964cf4f5345p-14, 0x1.3ec496b39a6e4p-15,
+      0x1.7b44e30470484p-20, -0x1.179faa337e6dbp-21, -0x1.ac128449cc1fp-27,
+      0x1.3e0cbfec289d8p-28 },
+    { 0x1.d4p+3, 0x0p+0, 0x1.01706aedb4bd4p-4, -0x1.9bf12f7a959bep-3,
+      -0x1.9235d83009dbfp-6, 0x1.15ed7ec50337cp-5, 0x1.7ca44a00d2568p-10,
+      -0x1.bb81289418dddp-10, -0x1.ec0291a500da6p-16, 0x1.4c7f03ed5356cp-15,
+      0x1.d421cc8ea8e6dp-23, -0x1.1fb69f7b340c1p-21, 0x1.e6ad8f5c30307p-32,
+      0x1.43806cac02cf9p-28 },
+    { 0x1.ddca13ef271d2p+3, -0x1.9796609364e85p-51, 0x0p+0,
+      -0x1.a701d0f9675p-3, 0x1.c54b930fef892p-8, 0x1.17798aa09f11fp-5,
+      -0x1.2a2151407dd07p-10, -0x1.b541f829bfa5ap-10, 0x1.cc0bda1a0330bp-15,
+      0x1.41f3b0644addep-15, -0x1.4b230d0bb01e1p-20, -0x1.1223c60fb6da7p-21,
+      0x1.11d91ef1a3c91p-26, 0x1.3524dc8d17f08p-28 },
+    { 0x1.ddca13ef271d2p+3, -0x1.9796609364e85p-51, 0x0p+0,
+      -0x1.a701d0f9675p-3, 0x1.c54b930fef8cdp-8, 0x1.17798aa09f02cp-5,
+      -0x1.2a21514059ce6p-10, -0x1.b541f82b785e5p-10, 0x1.cc0bdbe3b8eadp-15,
+      0x1.41f3a6196c3e6p-15, -0x1.4b1de6b3eb7f6p-20, -0x1.123fc2daf19bdp-21,
+      0x1.17a99dc2cfcc5p-26, 0x1.17e539640ae18p-28 },
+    { 0x1.ecp+3, 0x0p+0, -0x1.662c0354290fcp-4, -0x1.728dd45022536p-3,
+      0x1.965fc35e95978p-5, 0x1.da5c85151f1b4p-6, -0x1.2b347073b7c9ep-8,
+      -0x1.6781432d87d1dp-10, 0x1.57656ee5adf1cp-13, 0x1.00a3f6779201cp-15,
+      -0x1.9c5c03f7d54abp-19, -0x1.a85a7bcd077c4p-22, 0x1.2defcc240a0aep-25,
+      0x1.c99b640dd3b42p-29 },
+    { 0x1.f4p+3, 0x0p+0, -0x1.087cd1362803bp-3, -0x1.3546ce758202dp-3,
+      0x1.1c48013dad436p-4, 0x1.826bca1ffd018p-6, -0x1.90738a58cd85bp-8,
+      -0x1.1d585feffd8d1p-10, 0x1.bb606d47986f6p-13, 0x1.8c7267a23a18p-16,
+      -0x1.02ada6edfd727p-18, -0x1.3eba64c8c460fp-22, 0x1.724e54e79e83ep-25,
+      0x1.4e330630ef15p-29 },
+    { 0x1.fcp+3, 0x0p+0, -0x1.4c381a100ccb7p-3, -0x1.cbf1f66918e24p-4,
+      0x1.5ab4a2d4df375p-4, 0x1.144b346ee8cfp-6, -0x1.dbdb489c33f21p-8,
+      -0x1.8600bbfeb9f1ap-11, 0x1.019b2a69997c9p-12, 0x1.014ea8d63d5d6p-16,
+      -0x1.26fb94d8e547bp-18, -0x1.8676ed2de67cp-23, 0x1.9fbc9fbf7bc48p-25,
+      0x1.801989e799badp-30 },
+  },
+  .j1 = {
+    { 0x0p+0, 0x0p+0, 0x0p+0, 0x1p-1, -0x1.7f8885a7c222fp-68, -0x1p-4,
+      -0x1.ce58315f23e6cp-55, 0x1.555555555639fp-9, -0x1.0644bf6287f2cp-45,
+      -0x1.c71c719897573p-15, -0x1.4ebc2457178ecp-39, 0x1.6c183b086b0aep-21,
+      -0x1.f5726361cae8cp-36, -0x1.81e1a3600634p-28 },
+    { 0x1.8p-2, 0x0p+0, 0x1.794a186b69c69p-3, 0x1.e5433948f2945p-2,
+      -0x1.1a68d52d87595p-4, -0x1.e24e6b253f00cp-5, 0x1.397a994312d6dp-8,
+      0x1.408dca4efd6b7p-9, -0x1.24683aba66691p-13, -0x1.aa9e80223be28p-15,
+      0x1.2ca497d9b0db9p-19, 0x1.54e05eee0b1f3p-21, -0x1.87b870350b5c5p-26,
+      -0x1.6b309604de591p-28 },
+    { 0x1.4p-1, 0x0p+0, 0x1.30a093b16f993p-2, 0x1.b702efbc29facp-2,
+      -0x1.c6665111cdfcdp-4, -0x1.af033aea2ba1fp-5, 0x1.f77b1d538e34dp-8,
+      0x1.1cb04fd16cddep-9, -0x1.d520f9f220ffdp-13, -0x1.79783701c1025p-15,
+      0x1.e1fe68021fac3p-19, 0x1.2cd9a34887695p-21, -0x1.39d7d9f3b6a5ap-25,
+      -0x1.3ff81a058c524p-28 },
+    { 0x1.cp-1, 0x0p+0, 0x1.96789d2ae443dp-2, 0x1.74a4b2e2feacdp-2,
+      -0x1.2d72bbad2652cp-3, -0x1.659405d6c9c11p-5, 0x1.4d0fcac771ef2p-7,
+      0x1.d2d3c0e44a368p-10, -0x1.35cef82caa098p-12, -0x1.33445cabaab36p-15,
+      0x1.3df15846f27bdp-18, 0x1.e76ecf73c49c8p-22, -0x1.9db62c037bd5dp-25,
+      -0x1.024e68a0adb9fp-28 },
+    { 0x1.2p+0, 0x0p+0, 0x1.e98e423a36ba4p-2, 0x1.2195b9a4904ffp-2,
+      -0x1.6827afc143128p-3, -0x1.09fd826a66ap-5, 0x1.8c5097c11a8a5p-7,
+      0x1.5330350e92adap-10, -0x1.6fbf6d9d40862p-12, -0x1.b804c75a99ea4p-16,
+      0x1.78ca45607353fp-18, 0x1.598b408613c34p-22, -0x1.e9b73dd005868p-25,
+      -0x1.6b968988a190ap-29 },
+    { 0x1.6p+0, 0x0p+0, 0x1.131d12edf35f4p-1, 0x1.8438305156f38p-3,
+      -0x1.905e5ea4e74aap-3, -0x1.426c4001f7109p-6, 0x1.b61ee296f67e1p-7,
+      0x1.832b5e3c8f632p-11, -0x1.952de4414acdcp-12, -0x1.e2a492a92e025p-17,
+      0x1.9e36c74192d3fp-18, 0x1.706df981e39a8p-23, -0x1.0cbf7d7d6962ep-24,
+      -0x1.7b8d26db2e391p-30 },
+    { 0x1.ap+0, 0x0p+0, 0x1.24fdbc6d9f415p-1, 0x1.6c6de6e704922p-4,
+      -0x1.a4234d494be55p-3, -0x1.87390451b909ep-8, 0x1.c84bc006f7369p-7,
+      0x1.3104c9a981a88p-13, -0x1.a410df18b5945p-12, -0x1.dbb313d34dc42p-20,
+      0x1.ac1fbc0431061p-18, 0x1.979da3b1769cfp-27, -0x1.152af2aeeea5fp-24,
+      -0x1.527f1b06916e9p-35 },
+    { 0x1.ep+0, 0x0p+0, 0x1.29cb87526959fp-1, -0x1.c5cfabb511618p-7,
+      -0x1.a29d40389c741p-3, 0x1.039084162d6edp-7, 0x1.c1f8d65cca992p-7,
+      -0x1.da2f86fe0af26p-12, -0x1.9ba67d6e11551p-12, 0x1.6d8184d14723ep-17,
+      0x1.a1c880e255e09p-18, -0x1.3e0bd33bfc923p-23, -0x1.0da891c3f92d6p-24,
+      0x1.664c504f55a8ep-30 },
+    { 0x1.1p+1, 0x0p+0, 0x1.2192718f2904cp-1, -0x1.d1c98782c5338p-4,
+      -0x1.8c179c73678ffp-3, 0x1.5c284f30ff378p-6, 0x1.a3a3acbd60173p-7,
+      -0x1.0bc3384be1597p-10, -0x1.7c7ebfb7de38ep-12, 0x1.801cb41c844fdp-16,
+      0x1.7fd938c1c4724p-18, -0x1.413528938572p-22, -0x1.ed5f8f3bf72fbp-25,
+      0x1.60d59496d2166p-29 },
+    { 0x1.3p+1, 0x0p+0, 0x1.0d05b61537fabp-1, -0x1.a52f89d39766p-3,
+      -0x1.61fc8d8652edep-3, 0x1.10dba85f14942p-5, 0x1.6f1d46983bafdp-7,
+      -0x1.914d1a8960cdp-10, -0x1.487261e96bd42p-12, 0x1.197fa4d3373fep-15,
+      0x1.48545a141e21dp-18, -0x1.d08796fa637d1p-22, -0x1.a33b073e8cf5p-25,
+      0x1.f9b52b4c19eedp-29 },
+    { 0x1.5p+1, 0x0p+0, 0x1.dae913f18f66dp-2, -0x1.24028161073fdp-2,
+      -0x1.26bf5505d707ep-3, 0x1.64095ad1d3f8ap-5, 0x1.276e93bd6cd86p-7,
+      -0x1.ffdc0a5976f3ap-10, -0x1.0286dcb0b2291p-12, 0x1.62b0817bd4045p-15,
+      0x1.fcf050d173304p-19, -0x1.2268671891f21p-21, -0x1.413eea2d64819p-25,
+      0x1.3a78b349f2239p-28 },
+    { 0x1.7p+1, 0x0p+0, 0x1.896d353f52f9p-2, -0x1.64d0c27e8dd01p-2,
+      -0x1.bb701917c5b83p-4, 0x1.a350a807d0db1p-5, 0x1.a156ade0d2a2dp-8,
+      -0x1.28bb14d5472ddp-9, -0x1.5d826db645f24p-13, 0x1.978f51d35152dp-15,
+      0x1.4d1bd5361a6acp-19, -0x1.4bbd036a666eap-21, -0x1.9a4c6914e6b86p-26,
+      0x1.65bb02349ea3cp-28 },
+    { 0x1.9p+1, 0x0p+0, 0x1.2a22db050a95dp-2, -0x1.920e5f3755f13p-2,
+      -0x1.15e5e9883f1f6p-4, 0x1.cb852651955e6p-5, 0x1.bed8957b1f50ep-9,
+      -0x1.40e5226f5302dp-9, -0x1.47a93a2ea44f9p-14, 0x1.b5379d98b1433p-15,
+      0x1.16a6fd6587683p-20, -0x1.61f17e66b9962p-21, -0x1.36d4aa90ed769p-27,
+      0x1.7c2b99de77159p-28 },
+    { 0x1.bp+1, 0x0p+0, 0x1.846094a41de38p-3, -0x1.a9dac4199251ep-2,
+      -0x1.97b0f07a70b0cp-6, 0x1.dac592b7595cep-5, 0x1.3f1f49fdbfaf5p-12,
+      -0x1.473623f7fa694p-9, 0x1.d6fcf9194f3c4p-17, 0x1.ba1b82398a44bp-15,
+      -0x1.ea129348bb7eep-22, -0x1.63d2a56a25753p-21, 0x1.ad62b0a842ac6p-28,
+      0x1.7c8d0e07f1477p-28 },
+    { 0x1.ea75575af6f09p+1, -0x1.60155a9d1b256p-53, 0x0p+0,
+      -0x1.9c6cf582cbf7fp-2, 0x1.ae8a39f51ad12p-5, 0x1.b589d1da13abbp-5,
+      -0x1.537544c322f47p-8, -0x1.24b3409807e83p-9, 0x1.6e4c2df6724a5p-13,
+      0x1.83a07bfd9ce14p-15, -0x1.97968e9eaabb4p-19, -0x1.3360137aa109bp-21,
+      0x1.1abccb467b38ap-25, 0x1.649b7a708c6c9p-28 },
+    { 0x1.ea75575af6f09p+1, -0x1.60155a9d1b256p-53, 0x0p+0,
+      -0x1.9c6cf582cbf7fp-2, 0x1.ae8a39f51ad04p-5, 0x1.b589d1da13905p-5,
+      -0x1.537544c331daap-8, -0x1.24b34099590cfp-9, 0x1.6e4c2d53613f1p-13,
+      0x1.83a06e3175f09p-15, -0x1.9799d720c824bp-19, -0x1.33824070670e7p-21,
+      0x1.1727bd8c04f34p-25, 0x1.3d5da4a61fbf6p-28 },
+    { 0x1.08p+2, 0x0p+0, -0x1.cbfcaa2cde2b1p-4, -0x1.6f5c326f23c58p-2,
+      0x1.8a974492b3423p-4, 0x1.74d68b13a9f0cp-5, -0x1.0c5f5ce24ef11p-7,
+      -0x1.e434101580e5dp-10, 0x1.11bdc618c1ap-12, 0x1.39e45f16b6384p-15,
+      -0x1.27911d99fb9a1p-18, -0x1.ea3a310a629fap-22, 0x1.8cf772f0797c2p-25,
+      0x1.002e29ad819c5p-28 },
+    { 0x1.18p+2, 0x0p+0, -0x1.8ff48cd424aa4p-3, -0x1.35db7c814d56ap-2,
+      0x1.045ab7cd1bbcep-3, 0x1.28fefa8e2d0bcp-5, -0x1.4f6154cf3aa89p-7,
+      -0x1.71bdf10836056p-10, 0x1.4dbc842d72c51p-12, 0x1.d04be9b751ba7p-16,
+      -0x1.632dfc9cee9cap-18, -0x1.61a909ff25038p-22, 0x1.d87e47c5f34b8p-25,
+      0x1.6a60e88fd8926p-29 },
+    { 0x1.28p+2, 0x0p+0, -0x1.0cc4a2764a1bcp-2, -0x1.dcfa7bd176166p-3,
+      0x1.33c4c1af3c091p-3, 0x1.9d8babef6d14dp-6, -0x1.7eed7c87e6acbp-7,
+      -0x1.d8a4d9aab9b38p-11, 0x1.7666ed9af8208p-12, 0x1.140e586d9bfc1p-16,
+      -0x1.8a1fb0c75e92ap-18, -0x1.8b6e755b78619p-23, 0x1.042ed9c686882p-24,
+      0x1.804871a22aa6cp-30 },
+    { 0x1.38p+2, 0x0p+0, -0x1.3e6a958f32f0cp-2, -0x1.3aede176f13d1p-3,
+      0x1.51518efee73f1p-3, 0x1.ad6b924597268p-7, -0x1.98a4802ac8fa8p-7,
+      -0x1.6e81da77848c7p-12, 0x1.899e3ddff08bep-12, 0x1.27e5670e43dd5p-18,
+      -0x1.9a4dfb2a0472ep-18, -0x1.f7ea3b34cfc24p-26, 0x1.0cf9a2def1e9bp-24,
+      0x1.74a82d72be48cp-34 },
+    { 0x1.48p+2, 0x0p+0, -0x1.5b14edb67224ep-2, -0x1.1dafd0650926p-4,
+      0x1.5bcdab5d037d3p-3, 0x1.178d4a5c75418p-11, -0x1.9b673cba9a266p-7,
+      0x1.c0c2508d32968p-13, 0x1.8680d3640f886p-12, -0x1.04a338153165ep-17,
+      -0x1.92f3cb0cd7113p-18, 0x1.0eb4cd8f125c7p-23, 0x1.063173d3f804ap-24,
+      -0x1.511bb66b47e25p-30 },
+    { 0x1.58p+2, 0x0p+0, -0x1.621c156acb943p-2, 0x1.dab4464893138p-7,
+      0x1.5317c76cf9f37p-3, -0x1.81c7e3789639cp-7, -0x1.8763eb2340a54p-7,
+      0x1.8d0201d5c93e2p-11, 0x1.6d74eb1d9c3f5p-12, -0x1.4525c48eaf063p-16,
+      -0x1.74a8e03f81dc4p-18, 0x1.253192551a354p-22, 0x1.e0a1d91a4fa0dp-25,
+      -0x1.51f6d06f15de3p-29 },
+    { 0x1.68p+2, 0x0p+0, -0x1.540a2b7e4919p-2, 0x1.826675b2c14adp-4,
+      0x1.381e9423159dbp-3, -0x1.7b1867caee354p-6, -0x1.5e102d00b749ap-7,
+      0x1.47a5ab7b698fcp-10, 0x1.402060a0e2936p-12, -0x1.f3779ee60b748p-16,
+      -0x1.415712760600bp-18, 0x1.b0f82b680a553p-22, 0x1.996657fb5fe7bp-25,
+      -0x1.e6c4a9ab1e7fp-29 },
+    { 0x1.78p+2, 0x0p+0, -0x1.328c2f53e4924p-2, 0x1.530f97bda2c23p-3,
+      0x1.0ccf57dbb01cap-3, -0x1.0deaffb20133bp-5, -0x1.2210762bd3554p-7,
+      0x1.b468839537523p-10, 0x1.014e07dc6201fp-12, -0x1.41bf961e098e4p-15,
+      -0x1.f837e94b1e61bp-19, 0x1.115cbb5a6e15ap-21, 0x1.3afd014e853acp-25,
+      -0x1.2f3345261d4aep-28 },
+    { 0x1.88p+2, 0x0p+0, -0x1.005356aaaf713p-2, 0x1.cbbff33fcf85bp-3,
+      0x1.a7ecc573536c6p-4, -0x1.4d53a9c039dbcp-5, -0x1.ae1cc1714b672p-8,
+      0x1.03741b18def7ap-9, 0x1.69848ec87164ep-13, -0x1.76a33a4b2d5b4p-15,
+      -0x1.52316324834d7p-19, 0x1.3a07f73239a6cp-21, 0x1.960d0c5922484p-26,
+      -0x1.590585ad7a64bp-28 },
+    { 0x1.98p+2, 0x0p+0, -0x1.81d1062e56053p-3, 0x1.12ac764264e3p-2,
+      0x1.2226a7a535ed1p-4, -0x1.7890d0fb22b93p-5, -0x1.0300e626a4f8p-8,
+      0x1.1d698ac7e9288p-9, 0x1.7c064761b73b3p-14, -0x1.958e0eeda8e47p-15,
+      -0x1.34cc1f5402179p-20, 0x1.504149f60c4c9p-21, 0x1.4086ca7248a16p-27,
+      -0x1.6e8261b2bfcb5p-28 },
+    { 0x1.a8p+2, 0x0p+0, -0x1.e1d23d58ef741p-4, 0x1.2de86a4405ad2p-2,
+      0x1.208f3a08eddc8p-5, -0x1.8d9d64cd7597p-5, -0x1.3335968e74465p-10,
+      0x1.26d14c8ae75a3p-9, 0x1.430b0dd3b72b3p-18, -0x1.9cf1c6b41a02bp-15,
+      0x1.234d7fc036ccap-22, 0x1.52e27b4d1b642p-21, -0x1.73c8af704f51cp-28,
+      -0x1.6e8710c8b619fp-28 },
+    { 0x1.c0ff5f3b4725p+2, -0x1.b226d9d243827p-54, 0x0p+0,
+      0x1.33518b3874e8ap-2, -0x1.5e70dc60362bfp-6, -0x1.80c83bdeee5b4p-5,
+      0x1.9a4b292e3d61p-9, 0x1.13fbc7d68cd6bp-9, -0x1.07358bc7b4b0cp-13,
+      -0x1.796a769330e63p-15, 0x1.42551f011437ep-19, 0x1.301d7d7546d5ap-21,
+      -0x1.d7a908679f656p-26, -0x1.57ae750f10434p-28 },
+    { 0x1.c0ff5f3b4725p+2, -0x1.b226d9d243827p-54, 0x0p+0,
+      0x1.33518b3874e8ap-2, -0x1.5e70dc60362bfp-6, -0x1.80c83bdeee5bp-5,
+      0x1.9a4b292e3de33p-9, 0x1.13fbc7d698d8cp-9, -0x1.07358bbf44927p-13,
+      -0x1.796a74ba2886p-15, 0x1.425572d350dffp-19, 0x1.302c7c454020cp-21,
+      -0x1.d700f31d1aae2p-26, -0x1.31bd38420b9c2p-28 },
+    { 0x1.d8p+2, 0x0p+0, 0x1.a5d50dfe16acfp-4, 0x1.11b46b08269b5p-2,
+      -0x1.19436a29a5982p-4, -0x1.46cbee1f3858fp-5, 0x1.b09be357c8fcp-8,
+      0x1.c2f5732d3c75bp-10, -0x1.ddf85ec5962c6p-13, -0x1.2adf929117c04p-15,
+      0x1.0f35d63c2daf6p-18, 0x1.d5a5d5eb6a037p-22, -0x1.78541be6f1515p-25,
+      -0x1.ea6c01d567a4fp-29 },
+    { 0x1.e8p+2, 0x0p+0, 0x1.51c233dd19ed1p-3, 0x1.ceaf9cc12712fp-3,
+      -0x1.88a11ff868b37p-4, -0x1.0888bfeb2bb05p-5, 0x1.172a29b4f4be3p-7,
+      0x1.5e0fb78eb881p-10, -0x1.2862941c62fd6p-12, -0x1.bf14f84b9224ep-16,
+      0x1.4868ab9cdd858p-18, 0x1.5414961ea5eacp-22, -0x1.c07b0792e421ap-25,
+      -0x1.594305c104867p-29 },
+    { 0x1.f8p+2, 0x0p+0, 0x1.b832a17fd017dp-3, 0x1.6144de77b5eabp-3,
+      -0x1.ddf58b7ac3a71p-4, -0x1.79506b16b26cdp-6, 0x1.44bf02bb3c77dp-7,
+      0x1.cdd10495c391p-11, -0x1.4fea33cb3738bp-12, -0x1.109d1e76d8fe3p-16,
+      0x1.6dfda80fe9effp-18, 0x1.8019779b9ae22p-23, -0x1.ede9bcae56446p-25,
+      -0x1.6a154e4b64c57p-30 },
+    { 0x1.04p+3, 0x0p+0, 0x1.00761ca922995p-2, 0x1.c478bbc18c905p-4,
+      -0x1.0a7fac179811ep-3, -0x1.9f2f8e102ba81p-7, 0x1.5ebe1ae8ce96p-7,
+      0x1.927a9bd706218p-12, -0x1.63873c0449e7cp-12, -0x1.52cbbf42e6778p-18,
+      0x1.7df7d6c7710eap-18, 0x1.12ad81d4b614ap-25, -0x1.fe2d46e7ecd49p-25,
+      -0x1.e0d7056df84bap-35 },
+    { 0x1.0cp+3, 0x0p+0, 0x1.1440ce9953c29p-2, 0x1.66026827a6092p-5,
+      -0x1.15a873ac6f29bp-3, -0x1.e0886c13a8a0dp-10, 0x1.640255f1d93d2p-7,
+      -0x1.0913753156a63p-13, -0x1.625ad36b1d8c7p-12, 0x1.a682a6d150d58p-18,
+      0x1.77a0e2e972512p-18, -0x1.ef26b6d64a38p-24, -0x1.f08ca83293534p-25,
+      0x1.4a2baaa2c6acap-30 },
+    { 0x1.14p+3, 0x0p+0, 0x1.16c72e6435411p-2, -0x1.85311f62c533fp-6,
+      -0x1.1035d849a7254p-3, 0x1.21ee78944604bp-7, 0x1.549cdf5f018f3p-7,
+      -0x1.452c0c9c0c1ebp-11, -0x1.4cbd08dc9f53dp-12, 0x1.1f4d5b3eefd79p-16,
+      0x1.5b9131969a081p-18, -0x1.111727a0139fcp-22, -0x1.c610f316d4b68p-25,
+      0x1.46a28266cab27p-29 },
+    { 0x1.1cp+3, 0x0p+0, 0x1.085f701540a76p-2, -0x1.681bedddcf918p-4,
+      -0x1.f5beb006ebd24p-4, 0x1.3356df70fb7bap-6, 0x1.31d00c1291903p-7,
+      -0x1.1851b5b0a1564p-10, -0x1.24348b778c665p-12, 0x1.c1e0b08a29e22p-16,
+      0x1.2ba44c251fc3bp-18, -0x1.94efabcb1493dp-22, -0x1.8172d18d57156p-25,
+      0x1.d3bb6a6e14f46p-29 },
+    { 0x1.24p+3, 0x0p+0, 0x1.d4b9a04f10c97p-3, -0x1.29239190c6949p-3,
+      -0x1.ae885c2263364p-4, 0x1.bfeed0aaf9963p-6, 0x1.fbf12ceb6cc1p-8,
+      -0x1.7bb28a66cc39dp-10, -0x1.d6b99982333ddp-13, 0x1.241064c3e08fbp-15,
+      0x1.d5b4d29946b42p-19, -0x1.ffc7ff7661b24p-22, -0x1.26eeb38fa3063p-25,
+      0x1.221eb12ed10bfp-28 },
+    { 0x1.2cp+3, 0x0p+0, 0x1.7deb8b1226d1bp-3, -0x1.895794690aed3p-3,
+      -0x1.4f9e422e1b904p-4, 0x1.1782542d6ce7ep-5, 0x1.78cd6e7351999p-8,
+      -0x1.c73d730dbed4fp-10, -0x1.4b786a4ebe29bp-13, 0x1.5549be7a8a4c7p-15,
+      0x1.3a51ff9f61414p-19, -0x1.25ce0f5a14faep-21, -0x1.7804beab337f9p-26,
+      0x1.48e129a458bf2p-28 },
+    { 0x1.34p+3, 0x0p+0, 0x1.123b142ff3499p-3, -0x1.cf7add852af58p-3,
+      -0x1.be3bd508f29adp-5, 0x1.3d5c2207b4d5ep-5, 0x1.c4a62973587dcp-9,
+      -0x1.f6ed63673f1dap-10, -0x1.5e33fdd7299fap-14, 0x1.71f50e7065eb4p-15,
+      0x1.1cf529e514b2ap-20, -0x1.3a2368e907a56p-21, -0x1.1c5fc36c0fdc1p-27,
+      0x1.5bff9c9ab6aacp-28 },
+    { 0x1.3cp+3, 0x0p+0, 0x1.314dbcbe21433p-4, -0x1.f804b9c67400bp-3,
+      -0x1.902fb20e025d6p-6, 0x1.4fa9e7617dfa2p-5, 0x1.067fbb334dc38p-10,
+      -0x1.043566a868975p-9, -0x1.5f04ea7f943dp-18, 0x1.78a5de179aa5bp-15,
+      -0x1.1cb8ad2fbdb31p-22, -0x1.3bde38e69b4e2p-21, 0x1.86e4a9de248fbp-28,
+      0x1.5a80d97ba55ccp-28 },
+    { 0x1.458d0d0bdfc29p+3, 0x1.02610a51562b6p-51, 0x0p+0,
+      -0x1.ff654544ebcd1p-3, 0x1.9223ff2c0785bp-7, 0x1.4b0c5d5da6789p-5,
+      -0x1.f91a9ee0d289cp-10, -0x1.f51c2489b9d87p-10, 0x1.6b4c9ca104ad9p-14,
+      0x1.63c54752eee1p-15, -0x1.e37260da65bfap-20, -0x1.25c124702691bp-21,
+      0x1.74c2404c98f0ep-26, 0x1.4420baa295808p-28 },
+    { 0x1.458d0d0bdfc29p+3, 0x1.02610a51562b6p-51, 0x0p+0,
+      -0x1.ff654544ebcd1p-3, 0x1.9223ff2c07895p-7, 0x1.4b0c5d5da65c8p-5,
+      -0x1.f91a9ee093bfap-10, -0x1.f51c248c92f47p-10, 0x1.6b4c9e0954dccp-14,
+      0x1.63c537d90eebfp-15, -0x1.e36af7974d5b6p-20, -0x1.25e7a6da193fp-21,
+      0x1.7c9df7745109p-26, 0x1.1f1fcad55e419p-28 },
+    { 0x1.54p+3, 0x0p+0, -0x1.b4cebfc336c69p-4, -0x1.b851b02fb75fbp-3,
+      0x1.01e9344cd6888p-4, 0x1.1067d9068179dp-5, -0x1.7f38325b64a92p-8,
+      -0x1.8b25a99536d4cp-10, 0x1.b0d0ec970cd35p-13, 0x1.0e06d85197c36p-15,
+      -0x1.f894284468cefp-19, -0x1.af2feef5e6e8dp-22, 0x1.660d6c565ccd4p-25,
+      0x1.c57b0b3b4c34cp-29 },
+    { 0x1.5cp+3, 0x0p+0, -0x1.3f68d2c1c3f53p-3, -0x1.6be0e71261e1p-3,
+      0x1.5e2b3529ec0a8p-4, 0x1.b2b23f9f97916p-6, -0x1.ecf08ac41c71dp-8,
+      -0x1.2fd4835b0449bp-10, 0x1.0c1003251d24ap-12, 0x1.9020f3211224cp-16,
+      -0x1.3086b174a2151p-18, -0x1.344852b6d0856p-22, 0x1.a846250f2d311p-25,
+      0x1.398484fdc8e69p-29 },
+    { 0x1.64p+3, 0x0p+0, -0x1.8ea6509bbb1c8p-3, -0x1.0b2774a5a2f4fp-3,
+      0x1.a37148c379a5bp-4, 0x1.2cf3808ddf2eap-6, -0x1.1db447be48bfap-7,
+      -0x1.8859e38b1fdc3p-11, 0x1.2f25e9509cac2p-12, 0x1.dd40af7fa0c7fp-17,
+      -0x1.5234daedeb616p-18, -0x1.51392f1c91aa8p-23, 0x1.d0d4aea488d7cp-25,
+      0x1.38a96b5a84a7ap-30 },
+    { 0x1.6cp+3, 0x0p+0, -0x1.c3d05d855bc8ap-3, -0x1.38c3ca60738c9p-4,
+      0x1.ce11e99abeb84p-4, 0x1.2fe30f4bbbaf6p-7, -0x1.33442423b36fbp-7,
+      -0x1.3b189f454e77dp-12, 0x1.3fd4b60a2216ap-12, 0x1.0545356c3621ap-18,
+      -0x1.5f8e343a38b7ep-18, -0x1.493c95aa0b2d9p-26, 0x1.dd90491057ba9p-25,
+      -0x1.14a345768118p-34 },
+    { 0x1.74p+3, 0x0p+0, -0x1.dc3fa06206e92p-3, -0x1.34194888ddf09p-6,
+      0x1.dc098ec777ea7p-4, -0x1.99bb13ed281e5p-13, -0x1.362e85db85f48p-7,
+      0x1.4a699bca6d515p-13, 0x1.3d622d5e8ad5cp-12, -0x1.b5c34914748c7p-18,
+      -0x1.5803ee9429ec8p-18, 0x1.fc017c34ef26ap-24, 0x1.cdfa04dae611cp-25,
+      -0x1.572bbc2f1ebd9p-30 },
+    { 0x1.7cp+3, 0x0p+0, -0x1.d714fc52324e9p-3, 0x1.3ce1823cc539cp-5,
+      0x1.cd11f61dc9623p-4, -0x1.364bc3e55cc15p-7, -0x1.26979f5a3b4bbp-7,
+      0x1.39d67328f45d8p-11, 0x1.283712f9cfb67p-12, -0x1.1352b72488791p-16,
+      -0x1.3c445908a05ecp-18, 0x1.0969ee9094952p-22, 0x1.a34108a8f9fb4p-25,
+      -0x1.42dcaedbb1041p-29 },
+    { 0x1.84p+3, 0x0p+0, -0x1.b53df955eb758p-3, 0x1.7b74bce75f0abp-4,
+      0x1.a29ecbb0bc644p-4, -0x1.26e8b485d59a4p-6, -0x1.05bb12ab21faap-7,
+      0x1.054ea65877444p-10, 0x1.01d5b1573ae84p-12, -0x1.a6a51febe8183p-16,
+      -0x1.0e2da0c9acc88p-18, 0x1.82927d57945f1p-22, 0x1.602d4922a5159p-25,
+      -0x1.c59cc21405153p-29 },
+    { 0x1.8cp+3, 0x0p+0, -0x1.795db0e7cb2b6p-3, 0x1.1e7dd27bc7f0ap-3,
+      0x1.5fc03fcbcbc2dp-4, -0x1.9e5e368d50fp-6, -0x1.abaadf61faabdp-8,
+      0x1.5c740908c6f42p-10, 0x1.997faf704cb6ap-13, -0x1.0f76db5e2fd84p-15,
+      -0x1.a15d5f7194e87p-19, 0x1.e37c797c5908fp-22, 0x1.08f221592d292p-25,
+      -0x1.162162eded6c8p-28 },
+    { 0x1.94p+3, 0x0p+0, -0x1.279c126228ff9p-3, 0x1.6bf00631b459fp-3,
+      0x1.08eda482e63b6p-4, -0x1.fabfb1511918cp-6, -0x1.33fd987545bfdp-8,
+      0x1.9d725af6b6593p-10, 0x1.189c00c5a8b4bp-13, -0x1.3ab224bb8c89fp-15,
+      -0x1.0f304ae17061fp-19, 0x1.13556ae727cc4p-21, 0x1.45d74ea47c098p-26,
+      -0x1.387ae166d4abap-28 },
+    { 0x1.9cp+3, 0x0p+0, -0x1.8abda1563b9acp-4, 0x1.a1c179560703bp-3,
+      0x1.47771fa00a0a1p-5, -0x1.1b7f966274b32p-5, -0x1.57e35de2818c2p-9,
+      0x1.c4c1df483f581p-10, 0x1.11e8b8855952dp-14, -0x1.52aa8e21adb35p-15,
+      -0x1.bb02a9c4df49cp-21, 0x1.243889d9fbde6p-21, 0x1.a256c1ac9b296p-28,
+      -0x1.47f6754209b4dp-28 },
+    { 0x1.aa5baf310e5a2p+3, 0x1.2bce7fd18e693p-52, 0x0p+0,
+      0x1.bf3337873a7d8p-3, -0x1.0c83a2d7add44p-7, -0x1.25185801181f1p-5,
+      0x1.59eb160be3d7dp-10, 0x1.c5bce33a0aacep-10, -0x1.0413e37df325bp-14,
+      -0x1.4a670a26a9873p-15, 0x1.6c413f417d791p-20, 0x1.169ce02604987p-21,
+      -0x1.28f8e31bc5174p-26, -0x1.42d2e76c5811bp-28 },
+    { 0x1.aa5baf310e5a2p+3, 0x1.2bce7fd18e693p-52, 0x0p+0,
+      0x1.bf3337873a7d8p-3, -0x1.0c83a2d7add33p-7, -0x1.251858011816bp-5,
+      0x1.59eb160bf72dap-10, 0x1.c5bce33af2e87p-10, -0x1.0413e306e96c9p-14,
+      -0x1.4a6704d228b68p-15, 0x1.6c43f1dfba58dp-20, 0x1.16abe5e26db1fp-21,
+      -0x1.25c43a24c8b1ap-26, -0x1.2d07a3246530fp-28 },
+    { 0x1.b4p+3, 0x0p+0, 0x1.067ef690e8503p-4, 0x1.a191cd5e2ca89p-3,
+      -0x1.4260664662355p-5, -0x1.0b901809e7ffap-5, 0x1.f2dbf6c6edceep-9,
+      0x1.955981435876dp-10, -0x1.2697f1c57fc3ap-13, -0x1.214d54f0ba2cdp-15,
+      0x1.67123d2f491a5p-19, 0x1.df33af58d8a75p-22, -0x1.08d5552fe2fcep-25,
+      -0x1.037c837aa765bp-28 },
+    { 0x1.bcp+3, 0x0p+0, 0x1.cb2edc5474944p-4, 0x1.6d4715be82934p-3,
+      -0x1.fd7354eafab13p-5, -0x1.c9ba714395efap-6, 0x1.6e493e3d404ffp-8,
+      0x1.52eaa423a37a2p-10, -0x1.9a2c44e771c2cp-13, -0x1.d909bafd723e2p-16,
+      0x1.e0f693fbd8cf3p-19, 0x1.7f6a8561623e1p-22, -0x1.58c7f3bfda1efp-25,
+      -0x1.96e28c929eb77p-29 },
+    { 0x1.c4p+3, 0x0p+0, 0x1.381a9e2aeb843p-3, 0x1.23a20e389a467p-3,
+      -0x1.4b2fae51ff61fp-4, -0x1.61faa41515863p-6, 0x1.cb3cb83f0623p-8,
+      0x1.fa58d85eb2e71p-11, -0x1.f39666826dd7dp-13, -0x1.54a408cb4e1a4p-16,
+      0x1.1e5982d7aa2acp-18, 0x1.09dfe66ce8933p-22, -0x1.935d3e0c610edp-25,
+      -0x1.0fa2f2489e23p-29 },
+    { 0x1.ccp+3, 0x0p+0, 0x1.76077779c620dp-3, 0x1.92f20a58048e5p-4,
+      -0x1.823c0fb7179dap-4, -0x1.cd15398912356p-7, 0x1.0588b9e9116f5p-7,
+      0x1.330b9b7b83052p-11, -0x1.16ec03dd238ccp-12, -0x1.7b44e3e32e4bbp-17,
+      0x1.3a939f22b7f61p-18, 0x1.0b9cf980fe2b1p-23, -0x1.b54c14812fd58p-25,
+      -0x1.e5fa9934eb9c6p-31 },
+    { 0x1.d4p+3, 0x0p+0, 0x1.9bf12f7a959bep-3, 0x1.9235d83009dbfp-5,
+      -0x1.a0e43e2784d3ap-4, -0x1.7ca44a00d2567p-8, 0x1.1530b95c8f8a9p-7,
+      0x1.7101ed3bbb755p-13, -0x1.22ef236fa5518p-12, -0x1.d421ca95599a9p-20,
+      0x1.43ad7312c203dp-18, -0x1.30ca61f74a803p-28, -0x1.bccb17e4b5c37p-25,
+      0x1.139e4e4db5a8fp-32 },
+    { 0x1.dcp+3, 0x0p+0, 0x1.a7ef378633fc2p-3, -0x1.341b0e820bb21p-9,
+      -0x1.a5b1e18ed1d9dp-4, 0x1.5e87e2f4b9f0fp-9, 0x1.13e2cab33768fp-7,
+      -0x1.f3c69529ce13bp-13, -0x1.1d558ab24a79ep-12, 0x1.059688469f02ep-17,
+      0x1.3952d538e2f89p-18, -0x1.1afdef237087fp-23, -0x1.a9a8ce02428c4p-25,
+      0x1.75b076bef95c2p-30 },
+    { 0x1.e4p+3, 0x0p+0, 0x1.99b48c01c7711p-3, -0x1.b09582271f9a9p-5,
+      -0x1.90c3a0ddb79adp-4, 0x1.63e50bc39e93ep-7, 0x1.01f2392bc91ep-7,
+      -0x1.4b7a77e5597abp-11, -0x1.06af33aa8d938p-12, 0x1.18f4bd9a960fap-16,
+      0x1.1c59cb8068501p-18, -0x1.0c3f682c52b0cp-22, -0x1.7d4b3983889ddp-25,
+      0x1.469cab7771057p-29 },
+    { 0x1.ecp+3, 0x0p+0, 0x1.728dd45022536p-3, -0x1.965fc35e95978p-4,
+      -0x1.63c563cfd7547p-4, 0x1.2b347073b7ca2p-6, 0x1.c16193f8e9c62p-8,
+      -0x1.018c132c4ad56p-10, -0x1.c11eef513a9b1p-13, 0x1.9c5c059039a3dp-16,
+      0x1.dd65cacf08999p-19, -0x1.798ba6f711ac5p-22, -0x1.3a9717cb775cp-25,
+      0x1.bd8376e3915cp-29 },
+    { 0x1.f4p+3, 0x0p+0, 0x1.3546ce758202dp-3, -0x1.1c48013dad436p-3,
+      -0x1.21d0d797fdc12p-4, 0x1.90738a58cd86p-6, 0x1.64ae77ebfcf04p-8,
+      -0x1.4c8851f5bc6a1p-10, -0x1.5ae41aadef58cp-13, 0x1.02ada7e3f219dp-15,
+      0x1.6691b10ce25ccp-19, -0x1.cf08584c4f5abp-22, -0x1.cb80d8dafe79cp-26,
+      0x1.0c4ff439b0896p-28 },
+    { 0x1.fcp+3, 0x0p+0, 0x1.cbf1f66918e24p-4, -0x1.5ab4a2d4df375p-3,
+      -0x1.9e70cea65d368p-5, 0x1.dbdb489c33f26p-6, 0x1.e780eafe686dep-9,
+      -0x1.8268bf9e71691p-10, -0x1.c249a776e7a6cp-14, 0x1.26fb95e97cfeep-15,
+      0x1.b745ca7886ea7p-20, -0x1.03eb2fa98f61ap-21, -0x1.080eb5ec8ea84p-26,
+      0x1.295edb640e649p-28 },
+  },
+  .y0 = {
+    { 0x1.1p+1, 0x0p+0, 0x1.09f0f995cb215p-1, 0x1.38ba68ddbc78ap-5,
+      -0x1.1323a25105612p-2, 0x1.30b19d0383429p-5, 0x1.fcfc806fc67dcp-8,
+      0x1.93534e4f27399p-10, -0x1.7af9dc805ab2dp-10, 0x1.e1cc5e71fa5c5p-12,
+      -0x1.71bdc32faa9aep-13, 0x1.4230cc9e258e9p-14, -0x1.16dd1fd98f5abp-15,
+      0x1.df25d7a74bc21p-17 },
+    { 0x1.3p+1, 0x0p+0, 0x1.068b13f5a6b1p-1, -0x1.6b450e1e688eep-4,
+      -0x1.e6d8fe030c7b8p-3, 0x1.74f0bf26a71bfp-5, 0x1.18049b162c6b3p-7,
+      -0x1.3ad36a9df26bp-13, -0x1.c8b7fe4c6b7d4p-11, 0x1.e72890bd029d6p-13,
+      -0x1.20f97c7100aaep-14, 0x1.cff4a8c1c6d13p-16, -0x1.6cbd72d1a3f8cp-17,
+      0x1.1816aec17f3fap-18 },
+    { 0x1.5p+1, 0x0p+0, 0x1.e7ee30648a72bp-2, -0x1.967fbde1e26fdp-3,
+      -0x1.9a808621225d6p-3, 0x1.b82dfa74ed734p-5, 0x1.f57fa916209b3p-8,
+      -0x1.3acb87fcbdf01p-10, -0x1.2398ac1f7cadap-11, 0x1.2743072e0da73p-13,
+      -0x1.e3ade6fe1856fp-16, 0x1.68b2eb0d9d178p-17, -0x1.0b39ef76f63b8p-18,
+      0x1.72cac19e3792dp-20 },
+    { 0x1.7p+1, 0x0p+0, 0x1.a92dca3034579p-2, -0x1.27187e118f03ap-2,
+      -0x1.428971d10dba8p-3, 0x1.ef70ef411b075p-5, 0x1.758edf923c93ap-8,
+      -0x1.ea7f40685036bp-10, -0x1.6dcd57495b593p-12, 0x1.a9193b6dd6815p-14,
+      -0x1.b4075d8f29ac7p-17, 0x1.2040e1d443c18p-18, -0x1.ad30485bece37p-20,
+      0x1.108b81b29fad4p-21 },
+    { 0x1.9p+1, 0x0p+0, 0x1.56506de081a74p-2, -0x1.6bcae39fcec6p-2,
+      -0x1.c3cd16dfdb21cp-4, 0x1.09e2b4f9c27cp-4, 0x1.948c07d98dab4p-9,
+      -0x1.29a8a52bbc29p-9, -0x1.8dd65f59d98ddp-13, 0x1.5a65bf5af4379p-14,
+      -0x1.c5a862fe5329dp-18, 0x1.b293f896e6a44p-20, -0x1.70ff9515c8188p-21,
+      0x1.b809f2e6de3bdp-23 },
+    { 0x1.bp+1, 0x0p+0, 0x1.eab5e99e09dc8p-3, -0x1.97a7366a44aep-2,
+      -0x1.f246d51cf1bb6p-5, 0x1.10841bee3e5dcp-4, 0x1.db9849a6deae1p-14,
+      -0x1.417046921cf8dp-9, -0x1.d068b6e978008p-15, 0x1.2c85e2d347056p-14,
+      -0x1.357e486d82394p-18, 0x1.e04d84d7031bep-22, -0x1.4769f8b9ca584p-22,
+      0x1.84accff428da2p-24 },
+    { 0x1.dp+1, 0x0p+0, 0x1.193934128ebedp-3, -0x1.aa1032ea71092p-2,
+      -0x1.713b820e191d8p-7, 0x1.0aabb0544a942p-4, -0x1.84c343f31a2dcp-9,
+      -0x1.408174f2dda07p-9, 0x1.056d869b8ed9ep-14, 0x1.0816faa1901e4p-14,
+      -0x1.1e41ceaa1dde5p-18, -0x1.214029410539ap-24, -0x1.15add1f1888ecp-23,
+      0x1.77b16b8297295p-25 },
+    { 0x1.fa9534d98569cp+1, -0x1.f06ae7804384ep-54, 0x0p+0,
+      -0x1.9c34256a12a0cp-2, 0x1.a09c9290367efp-5, 0x1.df6d59bf50ebdp-5,
+      -0x1.c116fdc59808p-8, -0x1.1e32bc4efab21p-9, 0x1.9982764f4a493p-13,
+      0x1.ab2c20426b5cep-15, -0x1.486306580a34dp-18, -0x1.3ad7caa3cc81dp-22,
+      -0x1.5eef3397bfe51p-26, 0x1.858db87dcefdap-26 },
+    { 0x1.fa9534d98569cp+1, -0x1.f06ae7804384ep-54, 0x0p+0,
+      -0x1.9c34256a12a0cp-2, 0x1.a09c9290367fcp-5, 0x1.df6d59bf50c6bp-5,
+      -0x1.c116fdc57bb07p-8, -0x1.1e32bc526960cp-9, 0x1.9982788e2292ap-13,
+      0x1.ab2be00a82ce4p-15, -0x1.48599f003639p-18, -0x1.3d2f1f5424b58p-22,
+      -0x1.2f951b29a0f8ap-26, 0x1.ccfc0e9d899e9p-27 },
+    { 0x1.18p+2, 0x0p+0, -0x1.3dac3c7bb8dep-3, -0x1.53ca220fd7783p-2,
+      0x1.d901535e6482ap-4, 0x1.654e5c9d7e5aep-5, -0x1.613ca1b736026p-7,
+      -0x1.90ec99fd6e5dfp-10, 0x1.4dcb2425cf65bp-12, 0x1.126ca78cb0b34p-15,
+      -0x1.91a1e710ab097p-18, -0x1.0b55d5872a359p-22, 0x1.28f8c643787edp-25,
+      0x1.0217af4d831e3p-27 },
+    { 0x1.28p+2, 0x0p+0, -0x1.d77ac61cb36efp-3, -0x1.110213ae52213p-2,
+      0x1.26c4c141e118ap-3, 0x1.0603e30bc5024p-5, -0x1.95920ac14e6f9p-7,
+      -0x1.09e5fea64e1dcp-10, 0x1.7e8837a8e6088p-12, 0x1.53de6daabbdf1p-16,
+      -0x1.af8f1d7a421a8p-18, -0x1.2eb0281e70ce8p-23, 0x1.aefa5f4e58064p-25,
+      0x1.16b5400777d3cp-28 },
+    { 0x1.38p+2, 0x0p+0, -0x1.2651a8fa81f8ap-2, -0x1.83f869fea2e11p-3,
+      0x1.4e1c5e8436c78p-3, 0x1.38c410941b09fp-6, -0x1.b39aedca89757p-7,
+      -0x1.d3e00ed98e077p-12, 0x1.97c176f53f1afp-12, 0x1.e1b2416578983p-18,
+      -0x1.bac79fe1b5a3bp-18, -0x1.375de6aca3b91p-28, 0x1.f01e9f01b9387p-25,
+      0x1.afdb5efe0ba13p-30 },
+    { 0x1.48p+2, 0x0p+0, -0x1.4c1f55f2acd17p-2, -0x1.ae9937de1a611p-4,
+      0x1.612090de4a33ep-3, 0x1.7194d8058be31p-8, -0x1.b9ddb2cd763a4p-7,
+      0x1.2731251590d42p-13, 0x1.98dd27eed7c74p-12, -0x1.8d2d40cc8b664p-18,
+      -0x1.b0602ec6f852ep-18, 0x1.33045448cc7bp-23, 0x1.fd4662df17e61p-25,
+      -0x1.ad8a5c544ff86p-32 },
+    { 0x1.58p+2, 0x0p+0, -0x1.5bf68af496e01p-2, -0x1.32498092002acp-6,
+      0x1.5f8647fc3d933p-3, -0x1.f479b43d3603dp-8, -0x1.a849040210ce5p-7,
+      0x1.75764ce9a1781p-11, 0x1.826da3060b8f8p-12, -0x1.343c4129ab57ap-16,
+      -0x1.8fbc3ee1e9947p-18, 0x1.35328ca63a401p-22, 0x1.e0632b2a7ac92p-25,
+      -0x1.137907cd7c471p-29 },
+    { 0x1.68p+2, 0x0p+0, -0x1.55efd3f6af1ecp-2, 0x1.09d6b9c3d05e2p-4,
+      0x1.4a1f2c6b2303dp-3, -0x1.4820769184b4cp-6, -0x1.802b2fba0971fp-7,
+      0x1.43feadb64acbfp-10, 0x1.563a66ebd5f06p-12, -0x1.ef85bdcb6166fp-16,
+      -0x1.5a1a55e9c29b3p-18, 0x1.c242e311b9064p-22, 0x1.a0e834c2f1fcdp-25,
+      -0x1.c8a1f5a029b74p-29 },
+    { 0x1.78p+2, 0x0p+0, -0x1.3b5f2235f162fp-2, 0x1.20d7a6a41cb1ep-3,
+      0x1.22ca0e94e97f6p-3, -0x1.f9f467b2d1a81p-6, -0x1.44178d897c82dp-7,
+      0x1.b90adf7016daep-10, 0x1.172f0fbcff57ap-12, -0x1.45a59c25d30b9p-15,
+      -0x1.123e8f726315fp-18, 0x1.1b7c35ff2534p-21, 0x1.45c03a6586cebp-25,
+      -0x1.2a9d64d28c205p-28 },
+    { 0x1.88p+2, 0x0p+0, -0x1.0eb6084d6954bp-2, 0x1.a52ede99507a3p-3,
+      0x1.d8a854c07c613p-4, -0x1.44bff6e4443f5p-5, -0x1.ef75c0b761737p-8,
+      0x1.09c1a62837ec2p-9, 0x1.9269f11eba124p-13, -0x1.7fb19fab95b63p-15,
+      -0x1.784847352ee2ep-19, 0x1.45e45298781b2p-21, 0x1.ac296b8c686fcp-26,
+      -0x1.5b7306e7c8b4p-28 },
+    { 0x1.98p+2, 0x0p+0, -0x1.a6ae424966d99p-3, 0x1.059ec45a8b7f5p-2,
+      0x1.549a913c0de8dp-4, -0x1.77dcc63e077bcp-5, -0x1.3f41df3443f88p-8,
+      0x1.2755168e0984p-9, 0x1.c3ef71c10d47fp-14, -0x1.a2ef85f0b81fp-15,
+      -0x1.72b2b923259fbp-20, 0x1.5dbb9bab59a37p-21, 0x1.65f3a12324248p-27,
+      -0x1.75a6ac3246dc7p-28 },
+    { 0x1.a8p+2, 0x0p+0, -0x1.1abab7f3e22e5p-3, 0x1.271ec751cf3c9p-2,
+      0x1.8345df6916efap-5, -0x1.940384dfeaeebp-5, -0x1.03ba41c45064cp-9,
+      0x1.33cf2db951db8p-9, 0x1.3b5e372164db1p-16, -0x1.adb447ea152c9p-15,
+      0x1.ad460059c67d8p-24, 0x1.619a5c8ff0447p-21, -0x1.4116f220d203bp-28,
+      -0x1.78b6850af265p-28 },
+    { 0x1.c581dc4e72103p+2, -0x1.9774a495f56cfp-54, 0x0p+0,
+      0x1.334cca0697a5bp-2, -0x1.5aef611fc4d7cp-6, -0x1.8969c64cbf65cp-5,
+      0x1.b2f14a953014ap-9, 0x1.1d35e85e63781p-9, -0x1.26dd729616882p-13,
+      -0x1.8177f3ba9f9ffp-15, 0x1.6a8ebcbbf30f4p-19, 0x1.348773b092bcp-21,
+      -0x1.0ddf59f803ef1p-25, -0x1.62e02e3a3aad8p-28 },
+    { 0x1.c581dc4e72103p+2, -0x1.9774a495f56cfp-54, 0x0p+0,
+      0x1.334cca0697a5bp-2, -0x1.5aef611fc4d57p-6, -0x1.8969c64cbf452p-5,
+      0x1.b2f14a95527d3p-9, 0x1.1d35e85fde2c3p-9, -0x1.26dd71e39ec1cp-13,
+      -0x1.8177e4fdf6707p-15, 0x1.6a9229296638bp-19, 0x1.34aa4910ec237p-21,
+      -0x1.0a3df641d64d8p-25, -0x1.3d1c38a61b734p-28 },
+    { 0x1.d8p+2, 0x0p+0, 0x1.574d212037e88p-4, 0x1.1adaf3f61957ep-2,
+      -0x1.f0b6ddd9c37bfp-5, -0x1.5bc18f4a26e54p-5, 0x1.99832b3703583p-8,
+      0x1.e67c1a12ca1ebp-10, -0x1.da32b2ac0d473p-13, -0x1.3f6e1afa02895p-15,
+      0x1.109bb99572731p-18, 0x1.f365f5a10ae9ep-22, -0x1.7e564b5900521p-25,
+      -0x1.0170bbb40a01p-28 },
+    { 0x1.e8p+2, 0x0p+0, 0x1.30032525684c8p-3, 0x1.e831019f64681p-3,
+      -0x1.70099279431b3p-4, -0x1.1faf5c0730ef3p-5, 0x1.112dd28357002p-7,
+      0x1.8175b643fc809p-10, -0x1.2aeb8c89c88ebp-12, -0x1.e679f16b0da1dp-16,
+      0x1.4dd407893bcdp-18, 0x1.6f4ff985318dcp-22, -0x1.ca85c963ff04bp-25,
+      -0x1.6f7efbf9d4e9fp-29 },
+    { 0x1.f8p+2, 0x0p+0, 0x1.9d8133a3ee803p-3, 0x1.7fd1ba9a0b357p-3,
+      -0x1.ce3e5fa73d216p-4, -0x1.a93e5194125f3p-6, 0x1.442d086ee7fbfp-7,
+      0x1.0891e0df0ffb5p-10, -0x1.56939f4926a94p-12, -0x1.34619cafeb6f9p-16,
+      0x1.76fdf4b2cc44ap-18, 0x1.af263630f90edp-23, -0x1.fb7cfb9d1ddf4p-25,
+      -0x1.8f734681d971ap-30 },
+    { 0x1.04p+3, 0x0p+0, 0x1.ee43cc65afc46p-3, 0x1.03982aba8c112p-3,
+      -0x1.071b826d95ac1p-3, -0x1.fd0f22be0b86ep-7, 0x1.63332d6198b28p-7,
+      0x1.062a9072354aap-11, -0x1.6dd3c84b3d256p-12, -0x1.ccc404a9bfcfep-18,
+      0x1.89f4fa80877p-18, 0x1.a93a270b87837p-25, -0x1.074a784c37e3dp-24,
+      -0x1.59cb5472cbed1p-33 },
+    { 0x1.0cp+3, 0x0p+0, 0x1.0f27a2342a671p-2, 0x1.ede9ea397699fp-5,
+      -0x1.1686d38ce7658p-3, -0x1.266c14c4cb7dp-8, 0x1.6ce4ca59f56aap-7,
+      -0x1.c7639aa9078d7p-16, -0x1.6fa37f85eba44p-12, 0x1.46ea7d477e7a1p-18,
+      0x1.85e310755cc83p-18, -0x1.b9b7dd0d29c01p-24, -0x1.0176fad499e4ep-24,
+      0x1.38963f2f4571dp-30 },
+    { 0x1.14p+3, 0x0p+0, 0x1.15dbb3cf435e2p-2, -0x1.01705f01d61e9p-7,
+      -0x1.14eceb1e18da5p-3, 0x1.ab232660fd969p-8, 0x1.61266cae71391p-7,
+      -0x1.1bfa08c49e612p-11, -0x1.5c3b272fef214p-12, 0x1.0eef158ffb1c7p-16,
+      0x1.6b4a78f771dddp-18, -0x1.09a9c3fa9bd2dp-22, -0x1.d9786cac8aa2cp-25,
+      0x1.438c5eb0d2ccap-29 },
+    { 0x1.1cp+3, 0x0p+0, 0x1.0b56fe404293cp-2, -0x1.2d645ab331af2p-4,
+      -0x1.02d99321f910ap-3, 0x1.14274e7fc80cap-6, 0x1.4119612d92f6fp-7,
+      -0x1.09cffb0bcbf4cp-10, -0x1.350cf86b8fe5bp-12, 0x1.b98fa0f279edcp-16,
+      0x1.3bfb40f9ba05p-18, -0x1.939af7d4119ffp-22, -0x1.94e2b138c3949p-25,
+      0x1.d66bfc7d12bd5p-29 },
+    { 0x1.24p+3, 0x0p+0, 0x1.e1716ede89befp-3, -0x1.1070354551ecfp-3,
+      -0x1.c3963b713e234p-4, 0x1.a8dfb292c671ap-6, 0x1.0f06226c4131dp-7,
+      -0x1.739f55231a48dp-10, -0x1.f9578b62c73efp-13, 0x1.23fa8e013b43dp-15,
+      0x1.f5ea7a78b1e37p-19, -0x1.0233a20b06ee3p-21, -0x1.396d1ebd851c5p-25,
+      0x1.263ad1f1d3e81p-28 },
+    { 0x1.2cp+3, 0x0p+0, 0x1.901d4e82f6d98p-3, -0x1.7660b951a5cd2p-3,
+      -0x1.682e4bcf96a85p-4, 0x1.105bbd0c108efp-5, 0x1.9c6be5a3b7f6fp-8,
+      -0x1.c59ad65a58611p-10, -0x1.6d4269c2d850fp-13, 0x1.591d53f215e4fp-15,
+      0x1.5870e30f151aap-19, -0x1.2adf765b96688p-21, -0x1.994dbdd425f64p-26,
+      0x1.4f7c21cb37c23p-28 },
+    { 0x1.34p+3, 0x0p+0, 0x1.286004c161f27p-3, -0x1.c2ec00e33c9e8p-3,
+      -0x1.f30d55cb3c48fp-5, 0x1.3aa71fb1a9aedp-5, 0x1.057c2377d5db9p-8,
+      -0x1.fb6ba3463949ep-10, -0x1.9cd81f93c7c86p-14, 0x1.79575ee3184d8p-15,
+      0x1.521b48f415e72p-20, -0x1.419c308022fc5p-21, -0x1.545e32f8f00e6p-27,
+      0x1.64b3bc0bf49f4p-28 },
+    { 0x1.3cp+3, 0x0p+0, 0x1.623543433831dp-4, -0x1.f21f2d47cc1d4p-3,
+      -0x1.faa5302210bf7p-6, 0x1.513a0c423054cp-5, 0x1.89fe59c6aab69p-10,
+      -0x1.0937e203e1b8bp-9, -0x1.32fd6df91b7ecp-16, 0x1.83111eb2d4ca8p-15,
+      -0x1.b9362f1a63b02p-24, -0x1.45473fcdf93bap-21, 0x1.312929b752d8fp-28,
+      0x1.64ce0e63c111ap-28 },
+    { 0x1.471d735a47d58p+3, -0x1.cb49ff791c495p-51, 0x0p+0,
+      -0x1.ff635cc72b9f1p-3, 0x1.9036451ff57c5p-7, 0x1.4e667a71556afp-5,
+      -0x1.0325ee41e911fp-9, -0x1.fe23914fb92b8p-10, 0x1.7f84d7c572f07p-14,
+      0x1.6afdd59598751p-15, -0x1.040525045cbd9p-19, -0x1.2ae81b1a4782ep-21,
+      0x1.9541bb4cbdd7ep-26, 0x1.4ef250e6fdfffp-28 },
+    { 0x1.471d735a47d58p+3, -0x1.cb49ff791c495p-51, 0x0p+0,
+      -0x1.ff635cc72b9f1p-3, 0x1.9036451ff57c6p-7, 0x1.4e667a715569fp-5,
+      -0x1.0325ee41e7286p-9, -0x1.fe23914ffebaep-10, 0x1.7f84d7f936669p-14,
+      0x1.6afdd2327fb1p-15, -0x1.04041bc25b593p-19, -0x1.2afae7f323bb9p-21,
+      0x1.989c26f75c44fp-26, 0x1.2a135730ca11dp-28 },
+    { 0x1.54p+3, 0x0p+0, -0x1.89185ab7a3c69p-4, -0x1.c42620a09747ap-3,
+      0x1.de349d1820a0dp-5, 0x1.1bc28d3c1ba56p-5, -0x1.6d906803b318bp-8,
+      -0x1.9fedc404b98cdp-10, 0x1.a7030171ca9bp-13, 0x1.1d40d9b9c36cp-15,
+      -0x1.f5658e8830e6cp-19, -0x1.c6a7c9190a3e5p-22, 0x1.6710bc3125cecp-25,
+      0x1.dc8509cb40553p-29 },
+    { 0x1.5cp+3, 0x0p+0, -0x1.2d0d561b2439fp-3, -0x1.7bd8cfaf2348fp-3,
+      0x1.4ffb05284db95p-4, 0x1.ccfcb44606ed6p-6, -0x1.e200194c35bb7p-8,
+      -0x1.45d2ac6d03c6p-10, 0x1.0a813976299d9p-12, 0x1.ae8f441f2ddddp-16,
+      -0x1.322f387ac38c5p-18, -0x1.4ad3b271cfbf6p-22, 0x1.ad1fa1bc9485ep-25,
+      0x1.4eeef65bbb439p-29 },
+    { 0x1.64p+3, 0x0p+0, -0x1.80acdde63ac76p-3, -0x1.1e090efcdc87cp-3,
+      0x1.9a62e4ffd5cbp-4, 0x1.491d39d82abcdp-6, -0x1.1baf3628eaff9p-7,
+      -0x1.b4460b408de5fp-11, 0x1.30d853a5d0d05p-12, 0x1.0b74e33dbcccbp-16,
+      -0x1.56e6fb8663675p-18, -0x1.7a2c64385df5ap-23, 0x1.d924a49e821fdp-25,
+      0x1.5e16510079b01p-30 },
+    { 0x1.6cp+3, 0x0p+0, -0x1.bac99a3fee8a9p-3, -0x1.61b9e604b694cp-4,
+      0x1.ca55fe61e5b01p-4, 0x1.688a876f57953p-7, -0x1.34991770a6f3fp-7,
+      -0x1.8e1ac2c17170fp-12, 0x1.448703808c6c1p-12, 0x1.6c741f86f3385p-18,
+      -0x1.66ece5fdbdea5p-18, -0x1.2fda7d0938354p-25, 0x1.e8cb0d4a46399p-25,
+      0x1.9d14040e6412fp-35 },
+    { 0x1.74p+3, 0x0p+0, -0x1.d86775939c8edp-3, -0x1.da2adf1cb016p-6,
+      0x1.dd80b1c8389a1p-4, 0x1.7ad00b6b175c1p-10, -0x1.3a978c305ecf5p-7,
+      0x1.6cfff0ae44617p-14, 0x1.44adc35f79bbdp-12, -0x1.5f97e4960731dp-18,
+      -0x1.619176ce4cd4dp-18, 0x1.c5e722cb320dfp-24, 0x1.db7071e4d441fp-25,
+      -0x1.419745bd9a79cp-30 },
+    { 0x1.7cp+3, 0x0p+0, -0x1.d8548476f6379p-3, 0x1.db80e8eb0dd78p-6,
+      0x1.d35329162bf75p-4, -0x1.0651ffe02d6b9p-7, -0x1.2da7f1c1738fep-7,
+      0x1.1b256d8928bbbp-11, 0x1.3196e479b14d6p-12, -0x1.02fb57b8693fap-16,
+      -0x1.4769f4200890ap-18, 0x1.005827c57690cp-22, 0x1.b22ab09729499p-25,
+      -0x1.3cd49b91eec87p-29 },
+    { 0x1.84p+3, 0x0p+0, -0x1.bb3202b2d3d66p-3, 0x1.58156505816e4p-4,
+      0x1.ad019f85bc06ap-4, -0x1.130133fd9536p-6, -0x1.0ee6d68e8aa3cp-7,
+      0x1.f38bb7c91dd95p-11, 0x1.0cae734595464p-12, -0x1.9c23fde33e57bp-16,
+      -0x1.1a44471af4cf5p-18, 0x1.7e4841fdd3675p-22, 0x1.6fb3c670d48c5p-25,
+      -0x1.c485ec9d70e41p-29 },
+    { 0x1.8cp+3, 0x0p+0, -0x1.8361330aa8ab2p-3, 0x1.0fd4b1abca25dp-3,
+      0x1.6d69deddbf1fp-4, -0x1.8f720fa9ab019p-6, -0x1.c0f589b45b6fdp-8,
+      0x1.5528ff4cef495p-10, 0x1.b0d230e1f25fdp-13, -0x1.0d47f9dfb1d1cp-15,
+      -0x1.ba10ee4a0d9a4p-19, 0x1.e408db4e90462p-22, 0x1.183ce48717425p-25,
+      -0x1.1803b7513b3c2p-28 },
+    { 0x1.94p+3, 0x0p+0, -0x1.34d5c74a1ee25p-3, 0x1.60fff097223c5p-3,
+      0x1.18dfebfec8876p-4, -0x1.f16074662de09p-6, -0x1.4adf3f3b3f76ap-8,
+      0x1.9a92f2fa29803p-10, 0x1.30373ecc8af3dp-13, -0x1.3b902a1420e7dp-15,
+      -0x1.271376d1452e5p-19, 0x1.15ed322fa998bp-21, 0x1.625736f572882p-26,
+      -0x1.3c9f0f93719e7p-28 },
+    { 0x1.9cp+3, 0x0p+0, -0x1.a9a2027c603ap-4, 0x1.9afaac4bab3c4p-3,
+      0x1.69ca9aac45a08p-5, -0x1.19b3360b68802p-5, -0x1.8613b5aa0bb0ap-9,
+      0x1.c63c340c02ebcp-10, 0x1.3f16bff6855d2p-14, -0x1.5667238c1159ap-15,
+      -0x1.09283b57befbp-20, 0x1.28e9465a58354p-21, 0x1.0314f9c668a13p-27,
+      -0x1.4e12b8f0aa5bcp-28 },
+    { 0x1.ab8e1c4a1e74ap+3, -0x1.7df81de86f24dp-51, 0x0p+0,
+      0x1.bf32a27594007p-3, -0x1.0bc2d84e65293p-7, -0x1.26cab38a8b67ap-5,
+      0x1.5f03e4710c22p-10, 0x1.caaa76dfecdadp-10, -0x1.0c5f1a28f0df1p-14,
+      -0x1.4f0b04de7bef2p-15, 0x1.7d18bf2eebacbp-20, 0x1.1ab7578b3c718p-21,
+      -0x1.3aebff28fa6b4p-26, -0x1.4a6a7a297363ap-28 },
+    { 0x1.ab8e1c4a1e74ap+3, -0x1.7df81de86f24dp-51, 0x0p+0,
+      0x1.bf32a27594007p-3, -0x1.0bc2d84e65214p-7, -0x1.26cab38a8b368p-5,
+      0x1.5f03e47165d6fp-10, 0x1.caaa76e349876p-10, -0x1.0c5f18c46775fp-14,
+      -0x1.4f0af7d33741bp-15, 0x1.7d1e27077b1dbp-20, 0x1.1ad0582fda0fep-21,
+      -0x1.35ecf9d35a964p-26, -0x1.357057dfc03a9p-28 },
+    { 0x1.b4p+3, 0x0p+0, 0x1.ce0ec80e7a153p-5, 0x1.a74117c51c32p-3,
+      -0x1.25286e90356fep-5, -0x1.117a3bdb416e5p-5, 0x1.d20f85ae5b387p-9,
+      0x1.a14281b1b2b23p-10, -0x1.19735c19ab4e2p-13, -0x1.2b365bb52c78bp-15,
+      0x1.5d1bfa4e27b47p-19, 0x1.f09eefe80e8b7p-22, -0x1.04bda018ff95ap-25,
+      -0x1.0ce96e2cdcec6p-28 },
+    { 0x1.bcp+3, 0x0p+0, 0x1.af6be05de4c68p-4, 0x1.764eae1353962p-3,
+      -0x1.e5602795b978fp-5, -0x1.d929a794e39eep-6, 0x1.61f342d665725p-8,
+      0x1.60dea109e65d6p-10, -0x1.9197c2766c5a9p-13, -0x1.eeb9811e288fap-16,
+      0x1.dc084cad847ebp-19, 0x1.919a9d78f9953p-22, -0x1.57f526c8da6e6p-25,
+      -0x1.a9e6863f6fbfep-29 },
+    { 0x1.c4p+3, 0x0p+0, 0x1.2cd33fc8bf2cbp-3, 0x1.2f49d46799968p-3,
+      -0x1.424c040f83d17p-4, -0x1.73ef3418440e5p-6, 0x1.c37757632aa77p-8,
+      0x1.0c48cdd97ec02p-10, -0x1.efd6e989281e2p-13, -0x1.6aebad6459255p-16,
+      0x1.1e6fae72f1b65p-18, 0x1.1bd080abd06dp-22, -0x1.95bf92b35e3fep-25,
+      -0x1.21c74423a3d55p-29 },
+    { 0x1.ccp+3, 0x0p+0, 0x1.6de7f71ccb936p-3, 0x1.add56021bbafdp-4,
+      -0x1.7cdb5a2d8d186p-4, -0x1.f3afa803bceafp-7, 0x1.040a745e4bec2p-7,
+      0x1.51c37bec43fd4p-11, -0x1.1775b0ee14fa8p-12, -0x1.a680ff870a454p-17,
+      0x1.3d1c7cb6cc20cp-18, 0x1.2d0e63b6d479fp-23, -0x1.baa78ec78fa0cp-25,
+      -0x1.1399ea53758dp-30 },
+    { 0x1.d4p+3, 0x0p+0, 0x1.974f68aa2377cp-3, 0x1.cb8a669dc7a3cp-5,
+      -0x1.9f2a63dac8cb8p-4, -0x1.ca74ef4746ad6p-8, 0x1.160ef9c8fa02p-7,
+      0x1.e6ce3e23da288p-13, -0x1.25bf061b8337fp-12, -0x1.88573635f65bep-19,
+      0x1.486d15727342cp-18, 0x1.3bcb504fa3618p-27, -0x1.c4bc01609dd62p-25,
+      0x1.4d170803f1a29p-33 },
+    { 0x1.dcp+3, 0x0p+0, 0x1.a6e6e382385fp-3, 0x1.2ffc8392ad724p-8,
+      -0x1.a78a608ee5e97p-4, 0x1.95b0622a27e8dp-10, 0x1.16f3b5b447dd4p-7,
+      -0x1.8984270215ac5p-13, -0x1.222990203faa9p-12, 0x1.c77800d515dd9p-18,
+      0x1.3ff05b5336dffp-18, -0x1.035ec670a26c5p-23, -0x1.b3aa4018c5f33p-25,
+      0x1.6118faf3a5a2p-30 },
+    { 0x1.e4p+3, 0x0p+0, 0x1.9c2884aa7b564p-3, -0x1.7ad9874c6a164p-5,
+      -0x1.95e5739ea3e5cp-4, 0x1.4306822554e9p-7, 0x1.06edd5f31d1c7p-7,
+      -0x1.352e5827d8967p-11, -0x1.0d2b419d40aep-12, 0x1.0bb6c437961fdp-16,
+      0x1.24653049a79b9p-18, -0x1.03ced36cfdebap-22, -0x1.88bf4eba3ea2fp-25,
+      0x1.401e9f3e6905ap-29 },
+    { 0x1.ecp+3, 0x0p+0, 0x1.782c9b856f296p-3, -0x1.7ecd1a6b499b1p-4,
+      -0x1.6bb9b5b80f1cp-4, 0x1.1da9eeeacb014p-6, 0x1.ce6cc06a39ae8p-8,
+      -0x1.f2258e6002dc5p-11, -0x1.d087095fdc1e4p-13, 0x1.9364bb6b6203ap-16,
+      0x1.ef57cfde1f028p-19, -0x1.74d3134226019p-22, -0x1.46d04715a781ap-25,
+      0x1.bb1167a7b136fp-29 },
+    { 0x1.f4p+3, 0x0p+0, 0x1.3d91ef508e6fap-3, -0x1.12c62bd842744p-3,
+      -0x1.2bfc092e3c5bep-4, 0x1.8676a94fc8c1fp-6, 0x1.73e7b7242228cp-8,
+      -0x1.4719a41cfd8b5p-10, -0x1.6bc236f672a9dp-13, 0x1.007fbe6ac0b8bp-15,
+      0x1.794d26e13527ep-19, -0x1.ce296234a1d2ap-22, -0x1.e4170745200e8p-26,
+      0x1.0d1eadbdb3271p-28 },
+    { 0x1.fcp+3, 0x0p+0, 0x1.e09d6b523937bp-4, -0x1.53f1ba8907bp-3,
+      -0x1.b5c98c42f9c2cp-5, 0x1.d5d8616a43cbbp-6, 0x1.042c0b05419f2p-8,
+      -0x1.8032664ce6f71p-10, -0x1.e4e7e7fa08d2fp-14, 0x1.27234f47cd91dp-15,
+      0x1.dc28ccff36f26p-20, -0x1.055d865bcdf3cp-21, -0x1.1f6b0fb81f19ep-26,
+      0x1.2c1a5d3adfc24p-28 },
+  },
+  .y1 = {
+    { 0x1.193bed4dff243p+1, -0x1.bd1e50d219bfdp-55, 0x0p+0,
+      0x1.0aa48442f014bp-1, -0x1.e56f82217b90bp-4, -0x1.0d2af4e931e73p-5,
+      -0x1.3a6dec3658bd7p-8, 0x1.e671c7ceb4604p-8, -0x1.5429dfeeb41c8p-9,
+      0x1.17ab0e570062ap-10, -0x1.0b267243c35cbp-11, 0x1.f0f2b218eb2fcp-13,
+      -0x1.a496de580d7e3p-14, 0x1.2d71cfa9e349fp-14 },
+    { 0x1.193bed4dff243p+1, -0x1.bd1e50d219bfdp-55, 0x0p+0,
+      0x1.0aa48442f00f3p-1, -0x1.e56f82216c93ep-4, -0x1.0d2af4eda9f98p-5,
+      -0x1.3a6de92388672p-8, 0x1.e6719c3ce1f3bp-8, -0x1.542698a13294p-9,
+      0x1.177fde0eeed5fp-10, -0x1.099a6fd856636p-11, 0x1.da77e03673ed6p-13,
+      -0x1.6d32aea97ee65p-14, 0x1.607e9e10b84c3p-16 },
+    { 0x1.5p+1, 0x0p+0, 0x1.967fbde1e26fdp-3, 0x1.9a808621225d6p-2,
+      -0x1.4a227bd7b2167p-3, -0x1.f57fa9161eddp-6, 0x1.897e69fbf25bp-8,
+      0x1.b5650211f179dp-9, -0x1.025aa65d04d9p-10, 0x1.e3af4c14da9ap-13,
+      -0x1.95c8ca1e1b16dp-14, 0x1.4c49fec13b233p-15, -0x1.fe551d6faaf89p-17,
+      0x1.85a6b0e03991fp-18 },
+    { 0x1.7p+1, 0x0p+0, 0x1.27187e118f03ap-2, 0x1.428971d10dba8p-2,
+      -0x1.7394b370d4458p-3, -0x1.758edf923bfefp-6, 0x1.328f884132e28p-7,
+      0x1.125a016d41a4ap-9, -0x1.73f6140cbab87p-11, 0x1.b4084b94f2774p-14,
+      -0x1.4448b11f99d0ep-15, 0x1.0b149d040fb65p-16, -0x1.770cc28c9c9a2p-18,
+      0x1.03b76a24615edp-19 },
+    { 0x1.9p+1, 0x0p+0, 0x1.6bcae39fcec6p-2, 0x1.c3cd16dfdb21cp-3,
+      -0x1.8ed40f76a3bap-3, -0x1.948c07d98d3eap-7, 0x1.7412ce76ab73ep-7,
+      0x1.2a60c77c42052p-10, -0x1.2f190773d29ecp-11, 0x1.c5a910d6ad7d9p-15,
+      -0x1.e8e61054a4387p-17, 0x1.cb8cd25ba86fap-18, -0x1.2eba8222d97f2p-19,
+      0x1.7b5dfb5ff74ccp-21 },
+    { 0x1.bp+1, 0x0p+0, 0x1.97a7366a44aep-2, 0x1.f246d51cf1bb6p-4,
+      -0x1.98c629e55d8cbp-3, -0x1.db9849a6d94eep-12, 0x1.91cc5836a44e8p-7,
+      0x1.5c4e8923d1c3dp-12, -0x1.06f5267a69483p-11, 0x1.357e8d33e2514p-15,
+      -0x1.0e2b4f744d0fcp-18, 0x1.97ec8f80fbfe7p-19, -0x1.0b5c71a7646ap-20,
+      0x1.2c27b8445d04fp-22 },
+    { 0x1.dp+1, 0x0p+0, 0x1.aa1032ea71092p-2, 0x1.713b820e191d8p-6,
+      -0x1.9001887e6fde3p-3, 0x1.84c343f31a402p-7, 0x1.90a1d22f9511cp-7,
+      -0x1.882449ee27bf1p-12, -0x1.ce28369bf00a3p-12, 0x1.1e41ec091905p-15,
+      0x1.456918f5c4716p-21, 0x1.59f38b1ee073ep-20, -0x1.02674bbd20244p-21,
+      0x1.005ce42ea1663p-23 },
+    { 0x1.fp+1, 0x0p+0, 0x1.a392128ee4f97p-2, -0x1.277f1ee9ae1cep-4,
+      -0x1.749064928a06ap-3, 0x1.84b04c1369274p-6, 0x1.74654e08f0c86p-7,
+      -0x1.0353688a809ffp-10, -0x1.8d03ff0dacf12p-12, 0x1.3a4eee8b7152cp-15,
+      0x1.4384f296ed146p-19, 0x1.b6a1231b41e2fp-22, -0x1.1057de9a8bcep-22,
+      0x1.dc6bfc2bb896cp-25 },
+    { 0x1.08p+2, 0x0p+0, 0x1.85e225d832436p-2, -0x1.43827cea7cebcp-3,
+      -0x1.47c1bfd9da1d3p-3, 0x1.1973be8be4acfp-5, 0x1.40f06490629edp-7,
+      -0x1.8ab96fd1e26fdp-10, -0x1.43783b051cec9p-12, 0x1.67004a89b5a5fp-15,
+      0x1.6f9263f98c8c2p-19, -0x1.3205734235914p-24, -0x1.33471aaced10ap-23,
+      0x1.ebe4ba8aa679p-26 },
+    { 0x1.18p+2, 0x0p+0, 0x1.53ca220fd7783p-2, -0x1.d901535e6482ap-3,
+      -0x1.0bfac5761ec43p-3, 0x1.613ca1b73603p-5, 0x1.f527c07cc9f6ep-8,
+      -0x1.f4b0b638e2aadp-10, -0x1.e03e253666478p-13, 0x1.91a1eb3706d2cp-15,
+      0x1.2cc094e414bc7p-19, -0x1.73dcf7a7a6804p-22, -0x1.62f3413d8e37dp-24,
+      0x1.21c0a23e9b1fbp-26 },
+    { 0x1.28p+2, 0x0p+0, 0x1.110213ae52213p-2, -0x1.26c4c141e118ap-2,
+      -0x1.8905d491a7837p-4, 0x1.95920ac14e7p-5, 0x1.4c5f7e4fe1a5ep-8,
+      -0x1.1ee629bebb4e2p-9, -0x1.29629ff57be54p-13, 0x1.af8f204afd1a6p-15,
+      0x1.5486319c93c1fp-20, -0x1.0d94ca7dd9f14p-21, -0x1.7f4b217798ca9p-25,
+      0x1.89242db35b75ap-27 },
+    { 0x1.38p+2, 0x0p+0, 0x1.83f869fea2e11p-3, -0x1.4e1c5e8436c78p-2,
+      -0x1.d52618de288efp-5, 0x1.b39aedca8975dp-5, 0x1.246c0947f8c57p-9,
+      -0x1.31d11937fa95cp-9, -0x1.a57bf938fc981p-15, 0x1.bac7a206958a4p-15,
+      0x1.5e49f15664c08p-25, -0x1.363e050011c75p-21, -0x1.28fa4670fcd1bp-26,
+      0x1.2b647c02eab24p-27 },
+    { 0x1.48p+2, 0x0p+0, 0x1.ae9937de1a611p-4, -0x1.612090de4a33ep-2,
+      -0x1.152fa20428ea5p-6, 0x1.b9ddb2cd763a9p-5, -0x1.70fd6e5af5072p-11,
+      -0x1.32a5ddf32afd7p-9, 0x1.5b8798b2d7836p-15, 0x1.b06030857474cp-15,
+      -0x1.5964dd2dcaf23p-20, -0x1.3e6edf89823d4p-21, 0x1.271a9bed37542p-28,
+      0x1.e7142ed23cd7fp-28 },
+    { 0x1.5b7fe4e87b02ep+2, 0x1.dfe7bac228e8cp-52, 0x0p+0,
+      -0x1.5c7c556f0c19ap-2, 0x1.00b9f8571ca1fp-5, 0x1.a15d92dfe3e26p-5,
+      -0x1.10a329e2c23f9p-8, -0x1.1be6db9923955p-9, 0x1.337c7e13948e3p-13,
+      0x1.85b940e5842ep-15, -0x1.806194b36ceb5p-19, -0x1.255e1d2e3147p-21,
+      0x1.b6fc020b541c9p-26, 0x1.90b1a3738a2eep-28 },
+    { 0x1.5b7fe4e87b02ep+2, 0x1.dfe7bac228e8cp-52, 0x0p+0,
+      -0x1.5c7c556f0c19ap-2, 0x1.00b9f8571ca3p-5, 0x1.a15d92dfe3c09p-5,
+      -0x1.10a329e2ae58ap-8, -0x1.1be6db9b081bep-9, 0x1.337c7f0e3301ap-13,
+      0x1.85b92a6476c74p-15, -0x1.805beedeb3f6ep-19, -0x1.259bff28fb474p-21,
+      0x1.c3dc80e4b93fbp-26, 0x1.479a2dbedffe9p-28 },
+    { 0x1.78p+2, 0x0p+0, -0x1.20d7a6a41cb1ep-3, -0x1.22ca0e94e97f6p-2,
+      0x1.7b774dc61d3e1p-4, 0x1.44178d897c82fp-5, -0x1.13a6cba60e48bp-7,
+      -0x1.a2c6979b88016p-10, 0x1.1cf0e8a114b0cp-12, 0x1.123e904d9f3e7p-15,
+      -0x1.3eebbc5e24b19p-18, -0x1.97528a6016affp-22, 0x1.9a925c4f037d6p-25,
+      0x1.de54333269c5fp-29 },
+    { 0x1.88p+2, 0x0p+0, -0x1.a52ede99507a3p-3, -0x1.d8a854c07c613p-3,
+      0x1.e71ff256665efp-4, 0x1.ef75c0b761739p-6, -0x1.4c320fb245e71p-7,
+      -0x1.2dcf74d711382p-10, 0x1.4fbb6bb61ecc3p-12, 0x1.7848484973b39p-16,
+      -0x1.6ea0dc852016cp-18, -0x1.0baf789489f3fp-22, 0x1.ddb7c30eb52d6p-25,
+      0x1.2d61fef19336fp-29 },
+    { 0x1.98p+2, 0x0p+0, -0x1.059ec45a8b7f5p-2, -0x1.549a913c0de8dp-3,
+      0x1.19e594ae859cdp-3, 0x1.3f41df3443f89p-6, -0x1.712a5c318be4ep-7,
+      -0x1.52f39550ce5d5p-11, 0x1.6e9195329cceap-12, 0x1.72b2b9f9e17bap-17,
+      -0x1.89730eb7f5d4cp-18, -0x1.bf9216c553959p-24, 0x1.00df4fead1e75p-24,
+      0x1.d48281aa09b9ap-31 },
+    { 0x1.a8p+2, 0x0p+0, -0x1.271ec751cf3c9p-2, -0x1.8345df6916efap-4,
+      0x1.2f02a3a7f033p-3, 0x1.03ba41c45064ap-7, -0x1.80c2f927a6524p-7,
+      -0x1.d90d52b202fa2p-14, 0x1.77fdbeecce50dp-12, -0x1.ad46081621d7bp-21,
+      -0x1.8dcda7bb40297p-18, 0x1.91835c5350b5ep-25, 0x1.02fa4606ce683p-24,
+      -0x1.0e0af39d529cfp-31 },
+    { 0x1.b8p+2, 0x0p+0, -0x1.35c6a08153938p-2, -0x1.44ba028467f82p-6,
+      0x1.322c8bf3e75c3p-3, -0x1.eebeb65a8002fp-9, -0x1.7a6edc3871dcbp-7,
+      0x1.b73967ae59bcap-12, 0x1.6bc32c082c101p-12, -0x1.a15782d30a0ffp-17,
+      -0x1.7b80b5e0f3c74p-18, 0x1.a15c0bae6c821p-23, 0x1.eb0316a203caap-25,
+      -0x1.e7cc4fb7fa07bp-30 },
+    { 0x1.c8p+2, 0x0p+0, -0x1.31634c843a224p-2, 0x1.b65b7db84c2d9p-5,
+      0x1.23ae87fefae7p-3, -0x1.ea0dd546d4cc7p-7, -0x1.5ee4346d6be8fp-7,
+      0x1.e1569ad2cf662p-11, 0x1.4ae0b0ee70aa9p-12, -0x1.8554b233d5f05p-16,
+      -0x1.53b9673bb3365p-18, 0x1.6224cd103528p-22, 0x1.b31c631e63728p-25,
+      -0x1.93018e14a2ccdp-29 },
+    { 0x1.d8p+2, 0x0p+0, -0x1.1adaf3f61957ep-2, 0x1.f0b6ddd9c37bfp-4,
+      0x1.04d12b779d2bfp-3, -0x1.99832b3703588p-6, -0x1.300d904bbe532p-7,
+      0x1.63a60601140aap-10, 0x1.1780579abf7dbp-12, -0x1.109bba8b46e53p-15,
+      -0x1.18e959e81096ap-18, 0x1.de124751bae4ep-22, 0x1.61f6d9bf4c0b9p-25,
+      -0x1.0c2cd197f5bfep-28 },
+    { 0x1.e8p+2, 0x0p+0, -0x1.e831019f64681p-3, 0x1.70099279431b3p-3,
+      0x1.af870a0ac966cp-4, -0x1.112dd28357005p-5, -0x1.e1d323d4fba09p-8,
+      0x1.c06152ceb8ce4p-10, 0x1.a9aab33da8234p-13, -0x1.4dd408ad11058p-15,
+      -0x1.9d39f8596e628p-19, 0x1.1eaa6a7dfa2cap-21, 0x1.f948d3e276b1p-26,
+      -0x1.3e5c15d02826ep-28 },
+    { 0x1.f8p+2, 0x0p+0, -0x1.7fd1ba9a0b357p-3, 0x1.ce3e5fa73d216p-3,
+      0x1.3eeebd2f0dc76p-4, -0x1.442d086ee7fc2p-5, -0x1.4ab65916d3fa1p-8,
+      0x1.00eeb776e3904p-9, 0x1.0dd56919ec159p-13, -0x1.76fdf5f30b709p-15,
+      -0x1.e50afc995d869p-20, 0x1.3d472227f2a7fp-21, 0x1.129c52a44ec2bp-26,
+      -0x1.5d5b3afe9c1cbp-28 },
+    { 0x1.04p+3, 0x0p+0, -0x1.03982aba8c112p-3, 0x1.071b826d95ac1p-2,
+      0x1.7dcb5a0e88a53p-5, -0x1.63332d6198b2bp-5, -0x1.47b5348ec29d5p-9,
+      0x1.125ed638749e7p-9, 0x1.932b841487fefp-15, -0x1.89f4fbca20bddp-15,
+      -0x1.de616bf4c8168p-22, 0x1.4936d64f7be4fp-21, 0x1.db788e10feaa7p-30,
+      -0x1.678efe22c7cd9p-28 },
+    { 0x1.13127ae6169b4p+3, 0x1.479cc068d9046p-52, 0x0p+0,
+      0x1.15f993fceab5cp-2, -0x1.02b3933cf21dfp-6, -0x1.6395dfe49ff3fp-5,
+      0x1.3ced2a2e42ad9p-9, 0x1.07a678d471302p-9, -0x1.b50d7f811c061p-14,
+      -0x1.6f7bb903d4738p-15, 0x1.176b5d63cff54p-19, 0x1.2bce6e1c979a5p-21,
+      -0x1.a9b7027d96d02p-26, -0x1.5ae1d097aa4bap-28 },
+    { 0x1.13127ae6169b4p+3, 0x1.479cc068d9046p-52, 0x0p+0,
+      0x1.15f993fceab5cp-2, -0x1.02b3933cf21b1p-6, -0x1.6395dfe49fcd4p-5,
+      0x1.3ced2a2e69185p-9, 0x1.07a678d600062p-9, -0x1.b50d7e1d3f49fp-14,
+      -0x1.6f7bab0eb89c1p-15, 0x1.176e7372ea498p-19, 0x1.2bec8135e96b1p-21,
+      -0x1.a388a45df6a2ep-26, -0x1.3d96d134cc92p-28 },
+    { 0x1.1cp+3, 0x0p+0, 0x1.2d645ab331af2p-4, 0x1.02d99321f910ap-2,
+      -0x1.9e3af5bfac12fp-5, -0x1.4119612d92f72p-5, 0x1.4c43f9cebef1dp-8,
+      0x1.cf9374a161e6fp-10, -0x1.825dacd42552ap-13, -0x1.3bfb41eee7bedp-15,
+      0x1.c60e564bc6b44p-19, 0x1.fa41ac9dc05b6p-22, -0x1.4366272d9be84p-25,
+      -0x1.0b76ff570c012p-28 },
+    { 0x1.24p+3, 0x0p+0, 0x1.1070354551ecfp-3, 0x1.c3963b713e234p-3,
+      -0x1.3ea7c5ee14d54p-4, -0x1.0f06226c4131fp-5, 0x1.d0872a6be0dadp-8,
+      0x1.7b01a88a1d0bcp-10, -0x1.fef67882211aap-13, -0x1.f5ea7bebd7ef2p-16,
+      0x1.227a15fbd554p-18, 0x1.87e5655b3fb68p-22, -0x1.948bd785c32f5p-25,
+      -0x1.94e2a4686079p-29 },
+    { 0x1.2cp+3, 0x0p+0, 0x1.7660b951a5cd2p-3, 0x1.682e4bcf96a85p-3,
+      -0x1.98899b9218d66p-4, -0x1.9c6be5a3b7f71p-6, 0x1.1b80c5f8773c9p-7,
+      0x1.11f1cf5226fa3p-10, -0x1.2df9a973cf6e1p-12, -0x1.5870e3f638472p-16,
+      0x1.503b64cc2720ap-18, 0x1.ffc54abb8bc7fp-23, -0x1.cd450056f23d4p-25,
+      -0x1.f84b7fa7b1e94p-30 },
+    { 0x1.34p+3, 0x0p+0, 0x1.c2ec00e33c9e8p-3, 0x1.f30d55cb3c48fp-4,
+      -0x1.d7faaf8a7e864p-4, -0x1.057c2377d5dbap-6, 0x1.3d23460be3ce1p-7,
+      0x1.35a217aed910fp-11, -0x1.4a2c7306b1565p-12, -0x1.521b49918af04p-17,
+      0x1.69cfb6306458ep-18, 0x1.a98e59f9dc09dp-24, -0x1.ea7126611fcd9p-25,
+      -0x1.578a5224653a3p-31 },
+    { 0x1.3cp+3, 0x0p+0, 0x1.f21f2d47cc1d4p-3, 0x1.faa5302210bf7p-5,
+      -0x1.f9d71263487f3p-4, -0x1.89fe59c6aab66p-8, 0x1.4b85da84da26cp-7,
+      0x1.cc7c24f58ff9cp-14, -0x1.52aefadc764c1p-12, 0x1.b93638ba8025bp-21,
+      0x1.6df02768c2a57p-18, -0x1.7da3949b86e12p-25, -0x1.ea95646e2986ep-25,
+      0x1.5002b2e421211p-31 },
+    { 0x1.44p+3, 0x0p+0, 0x1.00ef220e1f667p-2, -0x1.9f9bcd45dd538p-12,
+      -0x1.fcc6854344ebfp-4, 0x1.0af6046130e91p-8, 0x1.462925a49de38p-7,
+      -0x1.82ceb9a9a36fp-12, -0x1.47477cb6e77b5p-12, 0x1.829a31eea8da1p-17,
+      0x1.5c9ae9f39ae0cp-18, -0x1.8aa0ded94b8f4p-23, -0x1.cdefaf65dce37p-25,
+      0x1.eef31a2a24a3fp-30 },
+    { 0x1.4cp+3, 0x0p+0, 0x1.f1f9a3522b7aep-3, -0x1.f4be3a2b9aef4p-5,
+      -0x1.e14863f109dfdp-4, 0x1.c0f37b63b1ff9p-7, 0x1.2db7093783934p-7,
+      -0x1.ac9b24b0075edp-11, -0x1.28e72aac8b54fp-12, 0x1.6704bedd14a78p-16,
+      0x1.3710909c0eacp-18, -0x1.4db31242e56d8p-22, -0x1.966ff5e81ceabp-25,
+      0x1.8af159433894fp-29 },
+    { 0x1.54p+3, 0x0p+0, 0x1.c42620a09747ap-3, -0x1.de349d1820a0dp-4,
+      -0x1.a9a3d3da29781p-4, 0x1.6d906803b319p-6, 0x1.03f49a82f3f7fp-7,
+      -0x1.3d42411561b06p-10, -0x1.f3317d0510fc6p-13, 0x1.f5659062e097cp-16,
+      0x1.ff7cc1c234e9cp-19, -0x1.c0fa00e887bb9p-22, -0x1.4797a7076113ap-25,
+      0x1.02eabd79740ep-28 },
+    { 0x1.5cp+3, 0x0p+0, 0x1.7bd8cfaf2348fp-3, -0x1.4ffb05284db95p-3,
+      -0x1.59bd873485321p-4, 0x1.e200194c35bbcp-6, 0x1.9747578844b76p-8,
+      -0x1.8fc1d63149dfbp-10, -0x1.78bd5b9b44bacp-13, 0x1.322f3991ef213p-15,
+      0x1.742e286d0d7c8p-19, -0x1.0c499474ee167p-21, -0x1.cc8362fb287a7p-26,
+      0x1.308bc9cf0bbd8p-28 },
+    { 0x1.64p+3, 0x0p+0, 0x1.1e090efcdc87cp-3, -0x1.9a62e4ffd5cbp-3,
+      -0x1.edabd6c4401b4p-5, 0x1.1baf3628eaffcp-5, 0x1.10abc70858afap-8,
+      -0x1.c9447d78c5b21p-10, -0x1.d40c8dac072a5p-14, 0x1.56e6fcb688e76p-15,
+      0x1.a971f07090b56p-20, -0x1.27cea9c7d534bp-21, -0x1.e159c1d1531bfp-27,
+      0x1.4bcae7c8c0926p-28 },
+    { 0x1.6cp+3, 0x0p+0, 0x1.61b9e604b694cp-4, -0x1.ca55fe61e5b01p-3,
+      -0x1.0e67e59381afep-5, 0x1.34991770a6f42p-5, 0x1.f1a17371cdcd4p-10,
+      -0x1.e6ca8540df62fp-10, -0x1.3ee59b9615d1cp-15, 0x1.66ece734ad392p-15,
+      0x1.55d5ccdb3a7ap-22, -0x1.319732f7361c1p-21, -0x1.1c09f995c2b8cp-31,
+      0x1.5332aed77a69ep-28 },
+    { 0x1.77f9138d43206p+3, 0x1.0fc786ce0608p-55, 0x0p+0,
+      -0x1.dc14ea14e89f9p-3, 0x1.4429fef5b5fbdp-7, 0x1.367d7d608e4bbp-5,
+      -0x1.9d6eb2bc49c22p-10, -0x1.dc4f991b396ddp-10, 0x1.315ec052914cfp-14,
+      0x1.5718151bf1d8cp-15, -0x1.a2970abf2909ap-20, -0x1.1e81c1195df29p-21,
+      0x1.4c39697ef7d16p-26, 0x1.4586a29ad6fdbp-28 },
+    { 0x1.77f9138d43206p+3, 0x1.0fc786ce0608p-55, 0x0p+0,
+      -0x1.dc14ea14e89f9p-3, 0x1.4429fef5b5fbdp-7, 0x1.367d7d608e4bap-5,
+      -0x1.9d6eb2bc499fep-10, -0x1.dc4f991b45e5ap-10, 0x1.315ec056c1f4ap-14,
+      0x1.571813ccb9fa8p-15, -0x1.a296bc5c26c61p-20, -0x1.1e8d6f4868583p-21,
+      0x1.4d15dda46d32bp-26, 0x1.284707e7bce02p-28 },
+    { 0x1.84p+3, 0x0p+0, -0x1.58156505816e4p-4, -0x1.ad019f85bc06ap-3,
+      0x1.9c81cdfc5fd11p-5, 0x1.0ee6d68e8aa3fp-5, -0x1.383752ddb2a7ap-8,
+      -0x1.9305ace86924dp-10, 0x1.689f7e26d14e3p-13, 0x1.1a4447fc0bf59p-15,
+      -0x1.ae1149bdb0d43p-19, -0x1.cbc3e39de4e6cp-22, 0x1.371813c4d7f33p-25,
+      0x1.eb19f0520437p-29 },
+    { 0x1.8cp+3, 0x0p+0, -0x1.0fd4b1abca25dp-3, -0x1.6d69deddbf1fp-3,
+      0x1.2b958bbf40413p-4, 0x1.c0f589b45b701p-6, -0x1.aa733f202b1b7p-8,
+      -0x1.449da4a97ca3cp-10, 0x1.d73df54770cddp-13, 0x1.ba10ef988111bp-16,
+      -0x1.1044fb0e6ae1cp-18, -0x1.5e663ea4ad5d7p-22, 0x1.81003fac0fa4ap-25,
+      0x1.6cda1d30dba02p-29 },
+    { 0x1.94p+3, 0x0p+0, -0x1.60fff097223c5p-3, -0x1.18dfebfec8876p-3,
+      0x1.7508574ca2686p-4, 0x1.4adf3f3b3f76cp-6, -0x1.009bd7dc59fp-7,
+      -0x1.c852de32d8a1ap-11, 0x1.141e24d1993a9p-12, 0x1.2713779941647p-16,
+      -0x1.38aad81ebce2dp-18, -0x1.bb0c441082634p-23, 0x1.b355474cf9fd8p-25,
+      0x1.b453c314efd4cp-30 },
+    { 0x1.9cp+3, 0x0p+0, -0x1.9afaac4bab3c4p-3, -0x1.69ca9aac45a08p-4,
+      0x1.a68cd1111cc04p-4, 0x1.8613b5aa0bb0bp-7, -0x1.1be5a08781d34p-7,
+      -0x1.dea21ff1cc8d3p-12, 0x1.2b9a3f1a8b758p-12, 0x1.09283bc59a212p-17,
+      -0x1.4e066ecae2c47p-18, -0x1.43eb627227234p-24, 0x1.cb54124447775p-25,
+      0x1.df5e710ca1b97p-32 },
+    { 0x1.a4p+3, 0x0p+0, -0x1.bab004eec6a2dp-3, -0x1.1f3e37db276a6p-5,
+      0x1.bd96cd9cf9515p-4, 0x1.8f22c4eb765efp-9, -0x1.25b8292cb597cp-7,
+      -0x1.6f21d9098c73bp-16, 0x1.30e981c14af0bp-12, -0x1.1cc063540ccc1p-19,
+      -0x1.4f4ad583c411cp-18, 0x1.f63100d29db37p-25, 0x1.c7d00f3be42ebp-25,
+      -0x1.917f514df33c2p-31 },
+    { 0x1.acp+3, 0x0p+0, -0x1.beb094b3dc366p-3, 0x1.3ce38ee609f02p-6,
+      0x1.b93b2f58c34c8p-4, -0x1.7ed94202db596p-8, -0x1.1dc3e3283d92ep-7,
+      0x1.aaf65a39b6885p-12, 0x1.23fa013021f47p-12, -0x1.8ec4b4574664p-17,
+      -0x1.3c9f2ef025b06p-18, 0x1.925639d87923cp-23, 0x1.a941d3c08cc33p-25,
+      -0x1.fa59ed67efcbdp-30 },
+    { 0x1.b4p+3, 0x0p+0, -0x1.a74117c51c32p-3, 0x1.25286e90356fep-4,
+      0x1.9a3759c8e2258p-4, -0x1.d20f85ae5b38ep-7, -0x1.04c9910f0faf5p-7,
+      0x1.a62d0a268f99dp-11, 0x1.05cf903e8403bp-12, -0x1.5d1bfbb329b3ap-16,
+      -0x1.175966abdfbe1p-18, 0x1.4608ec3bc73e5p-22, 0x1.71bc8cf74abbcp-25,
+      -0x1.85756a3861f5fp-29 },
+    { 0x1.bcp+3, 0x0p+0, -0x1.764eae1353962p-3, 0x1.e5602795b978fp-4,
+      0x1.62df3dafaab73p-4, -0x1.61f342d665729p-6, -0x1.b916494c5ff49p-8,
+      0x1.2d31d1d8dab04p-10, 0x1.b0e250fa5efd8p-13, -0x1.dc084e7901e21p-16,
+      -0x1.c3cdf0ba5dd82p-19, 0x1.ae1656386bcb1p-22, 0x1.24cb0e7499a8dp-25,
+      -0x1.f5418b94ef4e9p-29 },
+    { 0x1.c4p+3, 0x0p+0, -0x1.2f49d46799968p-3, 0x1.424c040f83d17p-3,
+      0x1.16f36712330acp-4, -0x1.c37757632aa7cp-6, -0x1.4f5b014fde701p-8,
+      0x1.73e12f26e9082p-10, 0x1.3d8e37b7cb0dep-13, -0x1.1e6faf7dc10e4p-15,
+      -0x1.3f4a907967e92p-19, 0x1.fb5927b56e37ep-22, 0x1.8e6d7f88844ffp-26,
+      -0x1.230fec0f38a48p-28 },
+    { 0x1.ccp+3, 0x0p+0, -0x1.add56021bbafdp-4, 0x1.7cdb5a2d8d186p-3,
+      0x1.76c3be02cdb03p-5, -0x1.040a745e4bec4p-5, -0x1.a6345ae754fc8p-9,
+      0x1.a33089652b43bp-10, 0x1.71b0df962684cp-14, -0x1.3d1c7dd6699b4p-15,
+      -0x1.52b02ff1818a5p-20, 0x1.14bf31817a014p-21, 0x1.7aefdf5b43586p-27,
+      -0x1.39c2322fee9afp-28 },
+    { 0x1.d4p+3, 0x0p+0, -0x1.cb8a669dc7a3cp-5, 0x1.9f2a63dac8cb8p-3,
+      0x1.57d7b3757502p-6, -0x1.160ef9c8fa023p-5, -0x1.3040e6d668596p-10,
+      0x1.b89e892950c41p-10, 0x1.574c4f6f3bdf7p-16, -0x1.486d1695839cap-15,
+      -0x1.6344bbfdcc7fep-24, 0x1.1b0c3e1a907fap-21, -0x1.c9f28962b886p-30,
+      -0x1.3d8553cd0279fp-28 },
+    { 0x1.dcb7d88de848bp+3, -0x1.5e091a50f8e05p-51, 0x0p+0,
+      0x1.a7022be084d99p-3, -0x1.c650b6b83109ap-8, -0x1.163191c30aa62p-5,
+      0x1.26b045287ddcdp-10, 0x1.b17602840ac9p-10, -0x1.c0a9cee3cd28cp-15,
+      -0x1.3e398cbd6aeffp-15, 0x1.3f35db24c3805p-20, 0x1.0e9b7deead94cp-21,
+      -0x1.0562d20a8c058p-26, -0x1.2e1bdc581eb8p-28 },
+    { 0x1.dcb7d88de848bp+3, -0x1.5e091a50f8e05p-51, 0x0p+0,
+      0x1.a7022be084d99p-3, -0x1.c650b6b83123cp-8, -0x1.163191c30a525p-5,
+      0x1.26b04527df7e3p-10, 0x1.b176028a25d95p-10, -0x1.c0a9d40e49e0ep-15,
+      -0x1.3e397445e87ffp-15, 0x1.3f2bbc1faadccp-20, 0x1.0ec92bedd520cp-21,
+      -0x1.0dcb7fef685bep-26, -0x1.103694d37266dp-28 },
+    { 0x1.ecp+3, 0x0p+0, 0x1.7ecd1a6b499b1p-4, 0x1.6bb9b5b80f1cp-3,
+      -0x1.ac7ee6603081ep-5, -0x1.ce6cc06a39aecp-6, 0x1.375778fc01c99p-8,
+      0x1.5c654707ed5e9p-10, -0x1.60f823fdf0982p-13, -0x1.ef57d171e6e3cp-16,
+      0x1.a36d752c68cb7p-19, 0x1.98a3e46cd6087p-22, -0x1.3098073430addp-25,
+      -0x1.b87bca7346657p-29 },
+    { 0x1.f4p+3, 0x0p+0, 0x1.12c62bd842744p-3, 0x1.2bfc092e3c5bep-3,
+      -0x1.24d8fefbd6917p-4, -0x1.73e7b7242228fp-6, 0x1.98e00d243cedfp-8,
+      0x1.10d1a938dbf62p-10, -0x1.c0df8d3acb15ap-13, -0x1.794d280405e44p-16,
+      0x1.03f746f24b142p-18, 0x1.2ea51cd1a074p-22, -0x1.720579e6660cfp-25,
+      -0x1.3d3ffbb962c0fp-29 },
+    { 0x1.fcp+3, 0x0p+0, 0x1.53f1ba8907bp-3, 0x1.b5c98c42f9c2cp-4,
+      -0x1.6062490fb2d8cp-4, -0x1.042c0b05419f4p-6, 0x1.e03effe020b4ap-8,
+      0x1.6badedfb8d3e3p-11, -0x1.023ee55ed0781p-12, -0x1.dc28ce4243253p-17,
+      0x1.260936d446fa7p-18, 0x1.675f10918e087p-23, -0x1.9c9f10263caf5p-25,
+      -0x1.60698d3e416fap-30 },
+  },
+  .i0 = {
+    { 0x1p-3, 0x0p+0, 0x1.010040071ce39p+0, 0x1.008015571c889p-4,
+      0x1.01806ab71d3eap-2, 0x1.008e51c93eafcp-7, 0x1.01ab272b61b05p-6,
+      0x1.561c95a147d76p-12, 0x1.ca39d29a67866p-12, 0x1.c82db4ec8e7efp-18,
+      0x1.ca509e024e006p-18, 0x1.6cf569a523dafp-24, 0x1.257276490e958p-24,
+      0x1.85669f9241e24p-31 },
+    { 0x1.8p-2, 0x0p+0, 0x1.0914544b681adp+0, 0x1.86ca279b6bd37p-3,
+      0x1.0da1e38488534p-2, 0x1.878bd920fb453p-6, 0x1.0f278a9f7eeaap-6,
+      0x1.054887f9819d9p-10, 0x1.e3685ebb6d06p-12, 0x1.5c947349473a3p-16,
+      0x1.e438c8c12cc8cp-18, 0x1.16f8c47b27beep-22, 0x1.3657a0907dcf5p-24,
+      0x1.29ba6d5d95811p-29 },
+    { 0x1.4p-1, 0x0p+0, 0x1.199df4afef914p+0, 0x1.4fe1a2f6fbf29p-2,
+      0x1.26876700af2d3p-2, 0x1.51a909cb7565cp-5, 0x1.2ade11c11c809p-6,
+      0x1.c367337a3a463p-10, 0x1.0b98f2c712ac3p-11, 0x1.2d697f1510553p-15,
+      0x1.0cc37e435a66bp-17, 0x1.e2c4bbf55cd79p-22, 0x1.591e3acbfc37bp-24,
+      0x1.01bc953dfe2d2p-28 },
+    { 0x1.cp-1, 0x0p+0, 0x1.33652b6c7b43bp+0, 0x1.ec43c8ddd031fp-2,
+      0x1.4d7f08a35afd3p-2, 0x1.f142d3a884fccp-5, 0x1.5654f7540f8abp-6,
+      0x1.4d2ea44724838p-9, 0x1.344220227d85ep-11, 0x1.bd967bec187edp-15,
+      0x1.36a69e0540d75p-17, 0x1.6530802a8262p-21, 0x1.8fcdab8dea71ap-24,
+      0x1.7da61c66e42a9p-28 },
+    { 0x1.2p+0, 0x0p+0, 0x1.57a311e81bc7cp+0, 0x1.50079243d0e7fp-1,
+      0x1.8494be3e9a4f9p-2, 0x1.5581636778d6ep-4, 0x1.93f1036e842ccp-6,
+      0x1.cb065f6778281p-9, 0x1.6dfcf21983d15p-11, 0x1.337fd749f52dbp-14,
+      0x1.722fc549f9cd7p-17, 0x1.ed96699bfd016p-21, 0x1.dd9712642636p-24,
+      0x1.07ebe4e50c31ep-27 },
+    { 0x1.6p+0, 0x0p+0, 0x1.8812439732c64p+0, 0x1.ba01476bf7f2ap-1,
+      0x1.ceaf3bf725965p-2, 0x1.c464ac13efcf2p-4, 0x1.e7183c3d00019p-6,
+      0x1.311b020ba2f14p-8, 0x1.bc0ee7738b401p-11, 0x1.99a406e8ff13p-14,
+      0x1.c2ce08cf28f3cp-17, 0x1.493bc36e26defp-20, 0x1.2382b6c44ba08p-23,
+      0x1.606fe3649ba94p-27 },
+    { 0x1.ap+0, 0x0p+0, 0x1.c7062ed9e38e4p+0, 0x1.1ca3cafbcc49ep+0,
+      0x1.17dc76dc79882p-1, 0x1.259d0f92247b1p-3, 0x1.2a319a52e9034p-5,
+      0x1.8d945a0b8f1eap-8, 0x1.117308f8eb627p-10, 0x1.0b856dca9071fp-13,
+      0x1.16947414c3a9ep-16, 0x1.aeb09f6aae848p-20, 0x1.6921146158284p-23,
+      0x1.cd8edc23a92d6p-27 },
+    { 0x1.ep+0, 0x0p+0, 0x1.0bc54698e3742p+1, 0x1.6a19de1a859a7p+0,
+      0x1.566bb056d4fc5p-1, 0x1.78a1e715387ep-3, 0x1.70efe8778afbep-5,
+      0x1.000d1838b9246p-7, 0x1.542d4825dd33bp-10, 0x1.596fad9b76e19p-13,
+      0x1.5bb2f8a2c188ep-16, 0x1.16868feda12bdp-19, 0x1.c3b913ca80979p-23,
+      0x1.2ad7ecd2dd1c5p-26 },
+    { 0x1.1p+1, 0x0p+0, 0x1.3ec66018e0916p+1, 0x1.c94b9288a2d41p+0,
+      0x1.a65a20e26573bp-1, 0x1.dfbf6d0ea0c79p-3, 0x1.cbb4ae29113f3p-5,
+      0x1.478c4340e754cp-7, 0x1.aa0283819c292p-10, 0x1.bb0781a22a2f3p-13,
+      0x1.b4c2659abafddp-16, 0x1.65d4d899687d1p-19, 0x1.1c4c34649f81fp-22,
+      0x1.80690b4f8105fp-26 },
+    { 0x1.3p+1, 0x0p+0, 0x1.7f08aeef213a6p+1, 0x1.1f89f194856bdp+1,
+      0x1.05f705d903ff7p+0, 0x1.30491ffec90afp-2, 0x1.1fc6c1b7af27p-4,
+      0x1.a14d4bcbbfe73p-7, 0x1.0bebc9bec1204p-9, 0x1.1af3a966495bfp-12,
+      0x1.1375c5c01ae0cp-15, 0x1.c9e126e789cc6p-19, 0x1.674c1c3f658a1p-22,
+      0x1.ec831d0b21403p-26 },
+    { 0x1.5p+1, 0x0p+0, 0x1.cfbc72f093319p+1, 0x1.68c1dc284de37p+1,
+      0x1.464e06b075859p+0, 0x1.8112ef7aa4e13p-2, 0x1.6978daf1b57b3p-4,
+      0x1.0930455e274ep-6, 0x1.51f9361567b84p-9, 0x1.68905c011034ep-12,
+      0x1.5c66cebd35208p-15, 0x1.2440620ab31e6p-18, 0x1.c7425b3f26beap-22,
+      0x1.3ac1c44536fd6p-25 },
+    { 0x1.7p+1, 0x0p+0, 0x1.1a75dcbe9f465p+2, 0x1.c41b6b99c5f1cp+1,
+      0x1.97aa88eeb6ea9p+0, 0x1.e6ad363ff5b51p-2, 0x1.c7106b0c07dap-4,
+      0x1.5095d4747c49fp-6, 0x1.ab2ba2d81d52cp-9, 0x1.cad2fc6515a95p-12,
+      0x1.b970cfa6d8248p-15, 0x1.748c192198ffap-18, 0x1.20e89679fe651p-21,
+      0x1.91beb86355fcfp-25 },
+    { 0x1.9p+1, 0x0p+0, 0x1.59d9137e2b4fdp+2, 0x1.1b2fb8ecf1253p+2,
+      0x1.fe74e3d555e3fp+0, 0x1.33594f2b362fdp-1, 0x1.1ee6e2dd02cdfp-3,
+      0x1.aae401d9f095ep-6, 0x1.0e4ff3a81ca88p-8, 0x1.23b3f15188f17p-11,
+      0x1.17fe6f4b47d4fp-14, 0x1.da855c2d7d9a5p-18, 0x1.6f16262d01c14p-21,
+      0x1.002d1bff81671p-24 },
+    { 0x1.bp+1, 0x0p+0, 0x1.a941e83f3fce8p+2, 0x1.62caa0a71a267p+2,
+      0x1.4022505996df9p+1, 0x1.841ce5d3c4ddbp-1, 0x1.6a2f6cca4e704p-3,
+      0x1.0e9e991a835b2p-5, 0x1.566cd9f0e8b9p-8, 0x1.72c1c14f5f48p-11,
+      0x1.637905c223001p-14, 0x1.2e120b2037459p-17, 0x1.d2c31535836f5p-21,
+      0x1.468e2e07b0f14p-24 },
+    { 0x1.dp+1, 0x0p+0, 0x1.0661c7d9744b3p+3, 0x1.bcac11b11ad67p+2,
+      0x1.921881fda3641p+1, 0x1.ea1e45182472ap-1, 0x1.c9a0b03c131c6p-3,
+      0x1.5712c28937e32p-5, 0x1.b21256ea7a74p-8, 0x1.d72730c4391b3p-11,
+      0x1.c38ea902b4bbep-14, 0x1.80805a7876413p-17, 0x1.28e6e008391a9p-20,
+      0x1.a02b7b468228fp-24 },
+    { 0x1.fp+1, 0x0p+0, 0x1.44c1b372c4df7p+3, 0x1.16d0e42a71fccp+3,
+      0x1.f99bb753c286cp+1, 0x1.3586b0434375p+0, 0x1.214ffa20f97e4p-2,
+      0x1.b2f1bb1c30179p-5, 0x1.13440fd9b1333p-7, 0x1.2b5b9e5d37a6bp-10,
+      0x1.1eed902677b1dp-13, 0x1.e9638b3e02e37p-17, 0x1.79d963bcfc824p-20,
+      0x1.0929139b07cc1p-23 },
+    { 0x1.08p+2, 0x0p+0, 0x1.93009a62b44fep+3, 0x1.5ddf156275115p+3,
+      0x1.3e2f5ee5fcc7dp+2, 0x1.87103018d8743p+0, 0x1.6e0440008d857p-2,
+      0x1.13beb141fbb71p-4, 0x1.5d43599c0745cp-7, 0x1.7c6d8a82f0d14p-10,
+      0x1.6cc20d0b8f02fp-13, 0x1.3772407ba66dbp-16, 0x1.e0ff6cc8ad778p-20,
+      0x1.51e22fd8b7ea4p-23 },
+    { 0x1.18p+2, 0x0p+0, 0x1.f5396271f85efp+3, 0x1.b7579e2b3771cp+3,
+      0x1.90cd961052191p+2, 0x1.ee3ea40e24306p+0, 0x1.cf4873bb211bep-2,
+      0x1.5db235f4c75d6p-4, 0x1.bb4df3a4b5074p-7, 0x1.e380c3f2f0008p-10,
+      0x1.cfd28cfa35c02p-13, 0x1.8c6e388882e67p-16, 0x1.3237fbd43d8a5p-19,
+      0x1.ae903a8dcfe1fp-23 },
+    { 0x1.28p+2, 0x0p+0, 0x1.384e0323c68e8p+4, 0x1.140b3ae66e45ep+4,
+      0x1.f93d38ead30cap+2, 0x1.387010e76838ep+1, 0x1.2552feab98d2p-1,
+      0x1.bb92f29fa91ccp-4, 0x1.196ac27bb8129p-6, 0x1.334b3e75a1d15p-9,
+      0x1.26f6480bad399p-12, 0x1.f8a5f90026a44p-16, 0x1.85f7aafbdf364p-19,
+      0x1.125919dea56dcp-22 },
+    { 0x1.38p+2, 0x0p+0, 0x1.85db9cd376a17p+4, 0x1.5b2143a8dac07p+4,
+      0x1.3ea6d726fafd4p+3, 0x1.8b299942eaf56p+1, 0x1.739338b5ed84p-1,
+      0x1.1963fb8e2f261p-3, 0x1.656409e8d277ep-6, 0x1.86aa14cffacaap-9,
+      0x1.773a8e8e91d1ep-12, 0x1.413cb559052fp-15, 0x1.f0b2bccff49ep-19,
+      0x1.5da572a6f5143p-22 },
+    { 0x1.48p+2, 0x0p+0, 0x1.e76ae85731039p+4, 0x1.b4d3461b8b2cbp+4,
+      0x1.922ef3a2fce1ep+3, 0x1.f3f9b31678d9bp+1, 0x1.d6de0293baea4p-1,
+      0x1.6518450147aefp-3, 0x1.c5fc07226288p-6, 0x1.f0bb67b98a551p-9,
+      0x1.dd6c5b81578f2p-12, 0x1.990477229b9f2p-15, 0x1.3c5d3bc0ecd98p-18,
+      0x1.bda6048ae2794p-22 },
+    { 0x1.58p+2, 0x0p+0, 0x1.311d4f94700fdp+5, 0x1.13087838b30bp+5,
+      0x1.fbe41f13c72d5p+3, 0x1.3c68dbf471ebap+2, 0x1.2a71a20022fd5p+0,
+      0x1.c54574cf731d7p-3, 0x1.206837df21821p-5, 0x1.3bd98122ea3d4p-8,
+      0x1.2fc68a9eb10d8p-11, 0x1.046c3afb03c39p-14, 0x1.930ee3da7f572p-18,
+      0x1.1c07c4136c90cp-21 },
+    { 0x1.68p+2, 0x0p+0, 0x1.7e76fc15a78a4p+5, 0x1.5a8df50ee2ce6p+5,
+      0x1.40dae74635436p+4, 0x1.909f36fd62cbfp+2, 0x1.7a6f2c660fdcfp+0,
+      0x1.1fbdcbc760e66p-2, 0x1.6e83fab4d9f01p-5, 0x1.91bbd6bc0ba26p-8,
+      0x1.82a22d4f3241dp-11, 0x1.4ba9de884568bp-14, 0x1.00c90eb86c054p-17,
+      0x1.6a14f07b64067p-21 },
+    { 0x1.78p+2, 0x0p+0, 0x1.dff609752e545p+5, 0x1.b4f16e4bec60cp+5,
+      0x1.9596796842027p+4, 0x1.fb6be9e7329dep+2, 0x1.e000edbf957c4p+0,
+      0x1.6d67836116424p-2, 0x1.d1defbdf482bbp-5, 0x1.ff0d56bd68236p-8,
+      0x1.ec2a18c0b7306p-11, 0x1.a67161f17e1ap-14, 0x1.473abe4c843fep-17,
+      0x1.cd9fcb0893d84p-21 },
+    { 0x1.88p+2, 0x0p+0, 0x1.2d76468673075p+6, 0x1.139d48499232ap+6,
+      0x1.0076b81c659bdp+5, 0x1.4173d9eb29a33p+3, 0x1.30803ac309cf2p+1,
+      0x1.d021518a65efap-2, 0x1.2822f33f8d47bp-4, 0x1.451c087eeea1fp-7,
+      0x1.394b4f9604ffdp-10, 0x1.0d10f233426acp-13, 0x1.a10b49f8cc1c5p-17,
+      0x1.264b09b10c888p-20 },
+    { 0x1.98p+2, 0x0p+0, 0x1.7b0c051b4c07cp+6, 0x1.5be571d785974p+6,
+      0x1.447998e569456p+5, 0x1.97695088df9bep+3, 0x1.826f803fe93c7p+1,
+      0x1.26d3cc4c1e52ep-1, 0x1.788df1c1a8111p-4, 0x1.9db456e286d33p-7,
+      0x1.8eeaf76a82bd5p-10, 0x1.56caa7f430defp-13, 0x1.09c8771e525p-16,
+      0x1.77447241b37e8p-20 },
+    { 0x1.a8p+2, 0x0p+0, 0x1.dd018ffe0d84p+6, 0x1.b75d9f0acb92dp+6,
+      0x1.9aafceedeec9ap+5, 0x1.0241d481c81cbp+4, 0x1.ea8a699a238b1p+1,
+      0x1.76a3f6f25419cp-1, 0x1.dee51642852ffp-4, 0x1.074297255f546p-6,
+      0x1.fc025ab6215e4p-10, 0x1.b4c47102e1466p-13, 0x1.52cd803cc3b6fp-16,
+      0x1.de905fd955ffep-20 },
+    { 0x1.b8p+2, 0x0p+0, 0x1.2c6067b8b477bp+7, 0x1.1594a5b181712p+7,
+      0x1.04004f9ee2cdap+6, 0x1.478370695d3dbp+4, 0x1.376bc566d7bbp+2,
+      0x1.dc278496013cdp-1, 0x1.30939415b58fbp-3, 0x1.4f193a831c1ap-6,
+      0x1.438203ee27bbp-9, 0x1.1648a6478909dp-12, 0x1.afed16a815fc1p-16,
+      0x1.312c6f93a3d16p-19 },
+    { 0x1.c8p+2, 0x0p+0, 0x1.7a938cafcad86p+7, 0x1.5ee747d9de79bp+7,
+      0x1.4953a6883b57p+6, 0x1.9f758b255c506p+4, 0x1.8b812425dcd35p+2,
+      0x1.2ea539983737ep+0, 0x1.837be7c5ee2dfp-3, 0x1.aa999a9f06b2p-6,
+      0x1.9c147e7f2028ep-9, 0x1.62a6e15fa18f2p-12, 0x1.135964a7f6f3cp-15,
+      0x1.853e356d32e21p-19 },
+    { 0x1.d8p+2, 0x0p+0, 0x1.dd74b040bf3d3p+7, 0x1.bbcb1d1dcd721p+7,
+      0x1.a147caad85025p+6, 0x1.0794e3388ae1cp+5, 0x1.f666ff00e16bbp+2,
+      0x1.80cbda7d75074p+0, 0x1.ed09a266d77cfp-3, 0x1.0f9490475148bp-5,
+      0x1.067b803c7833ap-8, 0x1.c4064d444f24ep-12, 0x1.5f192d35c9e63p-15,
+      0x1.f08364a3c9a49p-19 },
+    { 0x1.e8p+2, 0x0p+0, 0x1.2d44e32c71d88p+8, 0x1.18c1833d1a6ccp+8,
+      0x1.0872da5afd119p+7, 0x1.4e899156cc733p+5, 0x1.3f2a2fa318373p+3,
+      0x1.e955889eeedd5p+0, 0x1.39b8776aec97cp-2, 0x1.59d4951741ed2p-5,
+      0x1.4e6ce77e2dafbp-8, 0x1.201868a6186b8p-11, 0x1.bfba21dff9989p-15,
+      0x1.3cb2db63e99ep-18 },
+    { 0x1.f8p+2, 0x0p+0, 0x1.7c6a98518f1a2p+8, 0x1.635f118a0ea2ap+8,
+      0x1.4f4a34914c3a5p+7, 0x1.a8b346a7a592p+5, 0x1.959996b352cc5p+3,
+      0x1.373095ee21e33p+1, 0x1.8f4d109191ee3p-2, 0x1.b86fe072e71dap-5,
+      0x1.aa2294d1ae9ap-8, 0x1.6f44b885be76ep-11, 0x1.1d8012e07287ep-14,
+      0x1.940aaa76a0d72p-18 },
+    { 0x1.04p+3, 0x0p+0, 0x1.e09e56d6e9ad2p+8, 0x1.c1fd6300df3ecp+8,
+      0x1.a93c330611276p+7, 0x1.0da57934aa709p+6, 0x1.01c5d8dfacdf4p+4,
+      0x1.8bdda222ec3c9p+1, 0x1.fc4ce0d1cf2edp-2, 0x1.187f4e44c5967p-4,
+      0x1.0f86e74179971p-7, 0x1.d43eb564f113bp-11, 0x1.6c23a02e8c994p-14,
+      0x1.01c1b2c053b01p-17 },
+    { 0x1.0cp+3, 0x0p+0, 0x1.2fc3109733903p+9, 0x1.1d011a402f8afp+9,
+      0x1.0dbb4a972de2fp+8, 0x1.567b2dbb9b0fp+6, 0x1.47b5c00c29277p+4,
+      0x1.f7a9fd2b6b478p+1, 0x1.43926c89260d3p-1, 0x1.6551ae1c4ca8ep-4,
+      0x1.5a1017db43c5dp-7, 0x1.2a852a058fd1fp-10, 0x1.d07a51b9a3c4ap-14,
+      0x1.48e4fb7c0c8cdp-17 },
+    { 0x1.14p+3, 0x0p+0, 0x1.80272fe7ade34p+9, 0x1.6924ff907a4cfp+9,
+      0x1.5647ffb93f3e8p+8, 0x1.b315ff7d6b528p+6, 0x1.a0b2ef98d07abp+4,
+      0x1.40756cb79a686p+2, 0x1.9c03247bbbe62p-1, 0x1.c73bf616ad001p-4,
+      0x1.b91aeca940f63p-7, 0x1.7caa8bd54933bp-10, 0x1.2841c1c4e2694p-13,
+      0x1.a3b25a708c991p-17 },
+    { 0x1.1cp+3, 0x0p+0, 0x1.e609e74641a51p+9, 0x1.c9c7027d21398p+9,
+      0x1.b27548589ba5dp+8, 0x1.146c95fc0fb74p+7, 0x1.08f94269a4bd4p+5,
+      0x1.97d947c7b215ap+2, 0x1.0658e198e0dcp+0, 0x1.22060d8fe0b4cp-3,
+      0x1.192741486df5cp-6, 0x1.e575eb8605ddbp-10, 0x1.79f3c3b1070b2p-13,
+      0x1.0bcdabf9b5af4p-16 },
+    { 0x1.24p+3, 0x0p+0, 0x1.339a915e4fe4bp+10, 0x1.22399029cf7c4p+10,
+      0x1.13cc5e804e324p+9, 0x1.5f50866881defp+7, 0x1.510b842009fadp+5,
+      0x1.0392c789b46bfp+3, 0x1.4e23bf7e3f687p+0, 0x1.7194e25ea970ap-3,
+      0x1.6670c7d7fed3ap-6, 0x1.3594490c84bcdp-9, 0x1.e236b54cdc16bp-13,
+      0x1.55c9de0b3dd9ap-16 },
+    { 0x1.2cp+3, 0x0p+0, 0x1.8582102db130cp+10, 0x1.701bb6f756681p+10,
+      0x1.5e3e40edc347dp+9, 0x1.be953ecf36248p+7, 0x1.acca6b237b20ap+5,
+      0x1.4a749bfd3f29bp+3, 0x1.a9a18c07a11a2p+0, 0x1.d703b9ea9089p-3,
+      0x1.c90473412bceep-6, 0x1.8adf590f23d0fp-9, 0x1.33a45a58a10a6p-12,
+      0x1.b43e5e843fa1fp-16 },
+    { 0x1.34p+3, 0x0p+0, 0x1.ed684d033febfp+10, 0x1.d306bab756c87p+10,
+      0x1.bce29d5a97523p+9, 0x1.1be5ab2ebb9b3p+8, 0x1.10cc8b7918815p+6,
+      0x1.a4c06f1e5ad16p+3, 0x1.0f1e9809f55b9p+1, 0x1.2c2cbd6c6d7b3p-2,
+      0x1.236124fa94f37p-5, 0x1.f7b50a42cd296p-9, 0x1.889148c1c2ba3p-12,
+      0x1.166b7cd891d79p-15 },
+    { 0x1.3cp+3, 0x0p+0, 0x1.389f6f1b2f847p+11, 0x1.28581afda3c89p+11,
+      0x1.1a9cfe321bb0fp+10, 0x1.6904cab3432c3p+8, 0x1.5b2aa17f4ac8ep+6,
+      0x1.0be57d71dc97fp+4, 0x1.596fe3383fa02p+1, 0x1.7ea3739e9656cp-2,
+      0x1.73950524bf42bp-5, 0x1.414bb298c818p-8, 0x1.f4f94a2ac64fdp-12,
+      0x1.636916e953a3p-15 },
+    { 0x1.44p+3, 0x0p+0, 0x1.8c4a45105f83cp+11, 0x1.782e0a871bc62p+11,
+      0x1.6722f50307702p+10, 0x1.cb2c0d6246d3fp+8, 0x1.b9dfb95fd651dp+6,
+      0x1.55304602839a5p+4, 0x1.b82d0f0db647ep+1, 0x1.e7ce2b6f70b67p-2,
+      0x1.d9e71e4b762afp-5, 0x1.99ead55b7b9ffp-8, 0x1.3fae573b5dda6p-11,
+      0x1.c5b87e7e0180cp-15 },
+    { 0x1.4cp+3, 0x0p+0, 0x1.f682f61672ddfp+11, 0x1.dda4bfd0e5645p+11,
+      0x1.c87940212852cp+10, 0x1.240e3f7b1471bp+9, 0x1.193ff56aeb82ap+7,
+      0x1.b296485bd98e1p+4, 0x1.187ada2aa6cb7p+2, 0x1.36f8023ea297ep-1,
+      0x1.2e39ca75f94c1p-4, 0x1.05830b1cd874cp-7, 0x1.980494397e17dp-11,
+      0x1.21a174e6d776cp-14 },
+    { 0x1.54p+3, 0x0p+0, 0x1.3eb33a54d6b85p+12, 0x1.2f4f67e904e73p+12,
+      0x1.22273c9942aeap+11, 0x1.7395a3c98e3cbp+9, 0x1.6613f459773fbp+7,
+      0x1.14cf706e95c28p+5, 0x1.657b4a27f493bp+2, 0x1.8c8385900a18ep-1,
+      0x1.8183a40fc39d7p-4, 0x1.4db1e7ebf583bp-7, 0x1.046676d9e2bc1p-10,
+      0x1.71caca50de644p-14 },
+    { 0x1.5cp+3, 0x0p+0, 0x1.945dd9d62b9edp+12, 0x1.814d1ea65a613p+12,
+      0x1.70efc55cf1496p+11, 0x1.d8d86591d2df4p+9, 0x1.c7f4947c7cd8cp+7,
+      0x1.60abb3cb4d9bbp+5, 0x1.c7abac2c3a461p+2, 0x1.f9a36367dd1a6p-1,
+      0x1.ebcbd921adba7p-4, 0x1.a9d57172a02e8p-7, 0x1.4c66bf10df4f4p-10,
+      0x1.d82b3a69874dcp-14 },
+    { 0x1.64p+3, 0x0p+0, 0x1.009a019be6808p+13, 0x1.e9909567c81a2p+12,
+      0x1.d532859bc685dp+11, 0x1.2ce599c6a414ap+10, 0x1.2254f999cf015p+8,
+      0x1.c15f6af0c88b9p+5, 0x1.2271ac2ca2c4ap+3, 0x1.426d2f520b591p+0,
+      0x1.39b7025f2dbeap-3, 0x1.0fba005b28783p-6, 0x1.a856bac867f9p-10,
+      0x1.2d7658f8c6db7p-13 },
+    { 0x1.6cp+3, 0x0p+0, 0x1.45c0d8df303c3p+13, 0x1.37165fd77817cp+13,
+      0x1.2a67abdff03a2p+12, 0x1.7f02d090ad39ep+10, 0x1.71c9cef18c8aep+8,
+      0x1.1e53cbaf7d8d1p+6, 0x1.724b4f4201d5p+3, 0x1.9b3c15705a6c6p+0,
+      0x1.904436e35b14fp-3, 0x1.5acdff80caabap-6, 0x1.0edead5a3fb49p-9,
+      0x1.80f7b1a46331ep-13 },
+    { 0x1.74p+3, 0x0p+0, 0x1.9da55312e39e5p+13, 0x1.8b6f008f6f60ep+13,
+      0x1.7ba14803cc462p+12, 0x1.e79abe1d3743fp+10, 0x1.d70c787dda813p+8,
+      0x1.6ceb39d1706a3p+6, 0x1.d8247fb513158p+3, 0x1.064644a5ee373p+1,
+      0x1.febc7c54d1188p-3, 0x1.baa85a34b2715p-6, 0x1.59d5242c49d0fp-9,
+      0x1.eba1cfe7973d8p-13 },
+    { 0x1.7cp+3, 0x0p+0, 0x1.06b0b0a9bee3p+14, 0x1.f6bf72ed0602ep+13,
+      0x1.e30b31ebfe9d6p+12, 0x1.366c7cfb2e417p+11, 0x1.2c0e20936f1ffp+9,
+      0x1.d121b55070e92p+6, 0x1.2d07c237038cbp+4, 0x1.4e92408807698p+1,
+      0x1.45df31be83365p-2, 0x1.1a85542ab1535p-5, 0x1.b99181a0d334ap-9,
+      0x1.39f1665ac8c5fp-12 },
+    { 0x1.84p+3, 0x0p+0, 0x1.4db9dba63f614p+14, 0x1.3fa73cfaa57d9p+14,
+      0x1.335ce3d0ea794p+13, 0x1.8b4dd695f0468p+11, 0x1.7e4fcb5f1fd17p+9,
+      0x1.2876829d5f457p+7, 0x1.7fe626b2957d7p+4, 0x1.aad4f2af5cc5ep+1,
+      0x1.9fdf09e00ec74p-2, 0x1.68a7a58f32311p-5, 0x1.19eb95a463ab1p-8,
+      0x1.90f91f65efd54p-12 },
+    { 0x1.8cp+3, 0x0p+0, 0x1.a810c5def5f9cp+14, 0x1.968d9b7f022e5p+14,
+      0x1.87367612c215p+13, 0x1.f775aec27f396p+11, 0x1.e72c6ea58d587p+9,
+      0x1.79f42228101e6p+7, 0x1.e99fb2aabde61p+4, 0x1.1049e57b2498dp+2,
+      0x1.0961e4ecf72e4p-1, 0x1.cc6d7996b5a7fp-5, 0x1.6801a6479c7b4p-8,
+      0x1.00141fa379bcp-11 },
+    { 0x1.94p+3, 0x0p+0, 0x1.0d7cccc8736eap+15, 0x1.02958a179f951p+15,
+      0x1.f202dc6723c32p+13, 0x1.40a4f34e1addfp+12, 0x1.366ee41f887f4p+10,
+      0x1.e1e433b64508ep+7, 0x1.384276eeb4a3dp+5, 0x1.5b6dd5b921546p+2,
+      0x1.52b95043167a6p-1, 0x1.25eb6d50ab184p-4, 0x1.cbbf612f97d74p-8,
+      0x1.471a5625e4c3ap-11 },
+    { 0x1.9cp+3, 0x0p+0, 0x1.5694be37a0942p+15, 0x1.48fede44030e5p+15,
+      0x1.3d072939cd144p+14, 0x1.9879c553a4a2dp+12, 0x1.8baaa95ab857ep+10,
+      0x1.333c425d875efp+8, 0x1.8e52d35787d8fp+5, 0x1.bb56b9ea2bb8ap+2,
+      0x1.b05d21cb4e7e9p-1, 0x1.77471d6076397p-4, 0x1.2593ee72a6538p-7,
+      0x1.a1d9039a53739p-11 },
+    { 0x1.a4p+3, 0x0p+0, 0x1.b395e95af81e3p+15, 0x1.a2a5f4882d92ep+15,
+      0x1.93b046e070fd1p+14, 0x1.0436d52f69767p+13, 0x1.f85ae666130cep+10,
+      0x1.87cc9beae993fp+8, 0x1.fc266f182c77dp+5, 0x1.1ae22ba8a6136p+3,
+      0x1.13f6b6091d3aap+0, 0x1.df2f78b958ba7p-4, 0x1.76f4f56738ffbp-7,
+      0x1.0ae5a8a8b9baap-10 },
+    { 0x1.acp+3, 0x0p+0, 0x1.14f8d74020943p+16, 0x1.0a686d20c6cd3p+16,
+      0x1.010dbe57fe933p+15, 0x1.4b92261893612p+13, 0x1.417b98f5f3223p+11,
+      0x1.f3af0d4950fb6p+8, 0x1.4427c50a9ef91p+6, 0x1.69072ff72f5e5p+3,
+      0x1.604ce8244fd2dp+0, 0x1.31f32b9dfd0bdp-3, 0x1.deeb89262f808p-7,
+      0x1.54f961162527bp-10 },
+    { 0x1.b4p+3, 0x0p+0, 0x1.604bb795d39b9p+16, 0x1.531c487f05becp+16,
+      0x1.47682c6493c5fp+15, 0x1.a68b08144a9a2p+13, 0x1.99e034cfbb356p+11,
+      0x1.3eaa6720df473p+9, 0x1.9d991fbb4f40dp+6, 0x1.cccad235f17dcp+3,
+      0x1.c1c83c5c293a3p+0, 0x1.86b543a295ccp-3, 0x1.31deeaf3a5c3dp-6,
+      0x1.b3a1f0dba71d8p-10 },
+    { 0x1.bcp+3, 0x0p+0, 0x1.c02ec5a56a025p+16, 0x1.afb79a2b422e2p+16,
+      0x1.a111653397fa6p+15, 0x1.0d446503626acp+14, 0x1.054fcc33a8a82p+12,
+      0x1.967baf2e87f0cp+9, 0x1.07e16c3c5defdp+7, 0x1.26152dea0ab13p+4,
+      0x1.1f22fb81003fdp+1, 0x1.f2f9c340f8ecdp-3, 0x1.86b855a2ff62fp-6,
+      0x1.164c4efece9dcp-9 },
+    { 0x1.c4p+3, 0x0p+0, 0x1.1d21d2422a387p+17, 0x1.12d8938985b72p+17,
+      0x1.09ac8aa52c14dp+16, 0x1.57383f8581655p+14, 0x1.4d395e414b6a5p+12,
+      0x1.0345bb49b355ap+10, 0x1.50be4346d81bp+7, 0x1.7766308404965p+4,
+      0x1.6ea2174d54479p+1, 0x1.3ea3ea4be002cp-2, 0x1.f321e596f86dcp-6,
+      0x1.639743f30db9bp-9 },
+    { 0x1.ccp+3, 0x0p+0, 0x1.6adbe87aa621p+17, 0x1.5e0048b0e6e8ap+17,
+      0x1.5282d84ab9aedp+16, 0x1.b587433b01ad3p+14, 0x1.a8f73322cd787p+12,
+      0x1.4ac6f4984263dp+10, 0x1.adc199d806862p+7, 0x1.df3b6c794c15fp+4,
+      0x1.d42ad23093b3cp+1, 0x1.96fb91b27e78p-2, 0x1.3ed4363783999p-5,
+      0x1.c65f222490c01p-9 },
+    { 0x1.d4p+3, 0x0p+0, 0x1.cdd8c91cb5952p+17, 0x1.bdc439a85c5dp+17,
+      0x1.af5df77e9963p+16, 0x1.16e752a91b6cap+15, 0x1.0f01b8a8a07b8p+13,
+      0x1.a60934a6b7213p+10, 0x1.124003b36b178p+8, 0x1.31e9823d51a64p+5,
+      0x1.2aed75aea8e29p+2, 0x1.03ec45eec9126p-1, 0x1.9755a3b87e7ddp-5,
+      0x1.224f4a0435dcfp-8 },
+    { 0x1.dcp+3, 0x0p+0, 0x1.25f6bd4b38382p+18, 0x1.1be771eb907c1p+18,
+      0x1.12e0b9f016d79p+17, 0x1.639c53e5be015p+15, 0x1.59ae11a624ae6p+13,
+      0x1.0d41d42ccf8a7p+11, 0x1.5e0d22475599fp+8, 0x1.869359459bc3dp+5,
+      0x1.7dc191a2cea81p+2, 0x1.4c0583133e74bp-1, 0x1.04379283a907dp-4,
+      0x1.72fd44897f567p-8 },
+    { 0x1.e4p+3, 0x0p+0, 0x1.7644c77b968cfp+18, 0x1.69ad2ec73e2ecp+18,
+      0x1.5e5b2e2cd406bp+17, 0x1.c5753a6a71ceep+15, 0x1.b8f755bb54341p+13,
+      0x1.579890febaa36p+11, 0x1.bed59125a3bb2p+8, 0x1.f2b38490cb3dap+5,
+      0x1.e7901a1755d09p+2, 0x1.a82421cba1f0fp-1, 0x1.4c7bf73412deep-4,
+      0x1.da1c81516b2acp-8 },
+    { 0x1.ecp+3, 0x0p+0, 0x1.dc9421fe9a272p+18, 0x1.cccf4ff1e0b2p+18,
+      0x1.be9b764a72902p+17, 0x1.21241a796f29fp+16, 0x1.1948415d653a1p+14,
+      0x1.b67dd05afda4cp+11, 0x1.1d35040210a2fp+9, 0x1.3e663ef339469p+6,
+      0x1.375d5d987e1e6p+3, 0x1.0eec68f63c1dp+0, 0x1.a8d75a571cfedp-4,
+      0x1.2ef640b93e45fp-7 },
+    { 0x1.f4p+3, 0x0p+0, 0x1.2f7837634f908p+19, 0x1.2597936d44134p+19,
+      0x1.1cae00e588a5dp+18, 0x1.70c450fe40ad8p+16, 0x1.66e046e15bf78p+14,
+      0x1.17d16d08e0bb8p+12, 0x1.6c1c2c19e4dffp+9, 0x1.9697ce878f951p+6,
+      0x1.8db4a442df7b3p+3, 0x1.5a2051f15136fp+0, 0x1.0f705fb3bf1e3p-3,
+      0x1.83353733c90e1p-7 },
+    { 0x1.fcp+3, 0x0p+0, 0x1.8287b73e15ff7p+19, 0x1.76269a2b397abp+19,
+      0x1.6af62a81ea0fep+18, 0x1.d65cbd9e9c152p+16, 0x1.c9e930c1824f3p+14,
+      0x1.6526824755b5dp+12, 0x1.d0df1697ab3d9p+9, 0x1.039f7202e714cp+7,
+      0x1.fc040d8a45258p+3, 0x1.ba39b40ccb3bep+0, 0x1.5aded5574c535p-3,
+      0x1.eee6ae5352b53p-7 },
+  },
+  .i1 = {
+    { 0x0p+0, 0x0p+0, 0x0p+0, 0x1p-1, -0x1.8119966bf6571p-68, 0x1p-4,
+      -0x1.d0348ca545877p-55, 0x1.55555555563adp-9, -0x1.074942e92cfd6p-45,
+      0x1.c71c71f5ce5d4p-15, -0x1.4ff0d433e9634p-39, 0x1.6c183c4ee63a1p-21,
+      -0x1.f6fa25225b7a3p-36, 0x1.86d90f86e9994p-28 },
+    { 0x1.8p-2, 0x0p+0, 0x1.86ca279b6bd37p-3, 0x1.0da1e38488534p-1,
+      0x1.25a8e2d8bc73ep-4, 0x1.0f278a9f7eeacp-4, 0x1.469aa9f7e204dp-8,
+      0x1.6a8e470c89fbbp-9, 0x1.3101e4e02185dp-13, 0x1.e438ca3cc40cbp-15,
+      0x1.39d7dcbc8ee28p-19, 0x1.83cfe0d82a888p-21, 0x1.9965363ea362p-26,
+      0x1.9e1a7b3952637p-28 },
+    { 0x1.4p-1, 0x0p+0, 0x1.4fe1a2f6fbf29p-2, 0x1.26876700af2d3p-1,
+      0x1.fa7d8eb13018ap-4, 0x1.2ade11c11c80bp-4, 0x1.1a20802c646bdp-7,
+      0x1.91656c2a93576p-9, 0x1.07bc4f32710fbp-12, 0x1.0cc37f16af026p-14,
+      0x1.0f8ea9767a0f6p-18, 0x1.af44c43a3cc89p-21, 0x1.626785d8761fap-25,
+      0x1.cd16eae88a2f4p-28 },
+    { 0x1.cp-1, 0x0p+0, 0x1.ec43c8ddd031fp-2, 0x1.4d7f08a35afd3p-1,
+      0x1.74f21ebe63bd9p-3, 0x1.5654f7540f8adp-4, 0x1.a07a4d58eda44p-7,
+      0x1.ce633033b23a2p-9, 0x1.85e3ac6e9989ap-12, 0x1.36a69efa76786p-14,
+      0x1.91d68fcbc2ba5p-18, 0x1.f39ac601cdd42p-21, 0x1.06655406cf1eep-24,
+      0x1.0b810912512f4p-27 },
+    { 0x1.2p+0, 0x0p+0, 0x1.50079243d0e7fp-1, 0x1.8494be3e9a4f9p-1,
+      0x1.00210a8d9aa12p-2, 0x1.93f1036e842cfp-4, 0x1.1ee3fba0ab18fp-6,
+      0x1.127db5931cd88p-8, 0x1.0d0fdc60b95fp-11, 0x1.722fc66f6784dp-14,
+      0x1.15a49b2280a3ep-17, 0x1.2a677ee3a097ep-20, 0x1.6ae8ae965dd4bp-24,
+      0x1.401b7417d676p-27 },
+    { 0x1.6p+0, 0x0p+0, 0x1.ba01476bf7f2ap-1, 0x1.ceaf3bf725965p-1,
+      0x1.534b810ef3db6p-2, 0x1.e7183c3d0001dp-4, 0x1.7d61c28e8bad7p-6,
+      0x1.4d0b2d96a1144p-8, 0x1.666f860be2fc4p-11, 0x1.c2ce0a35fd79fp-14,
+      0x1.72633b7f6335cp-17, 0x1.6c475bd04e92ap-20, 0x1.e49fa1337a009p-24,
+      0x1.877486c5e9877p-27 },
+    { 0x1.ap+0, 0x0p+0, 0x1.1ca3cafbcc49ep+0, 0x1.17dc76dc79882p+0,
+      0x1.b86b975b36b8ap-2, 0x1.2a319a52e9036p-3, 0x1.f0f9708e72e62p-6,
+      0x1.9a2c8d7557f2p-8, 0x1.d429802281c0ep-11, 0x1.169474f3666fbp-13,
+      0x1.e486b2debb6a5p-17, 0x1.c3468ffd9f40ap-20, 0x1.3d5601a0659b8p-23,
+      0x1.e5c187defeaedp-27 },
+    { 0x1.ep+0, 0x0p+0, 0x1.6a19de1a859a7p+0, 0x1.566bb056d4fc5p+0,
+      0x1.1a796d4fea5e8p-1, 0x1.70efe8778afcp-3, 0x1.40105e46e76d6p-5,
+      0x1.fe43ec38c05cdp-8, 0x1.2e41b7e80b3eap-10, 0x1.5bb2f9b9aeeb6p-13,
+      0x1.3957619cbc296p-16, 0x1.1a3de1ca9ed42p-19, 0x1.9aedcf352212p-23,
+      0x1.3049992e4189fp-26 },
+    { 0x1.1p+1, 0x0p+0, 0x1.c94b9288a2d41p+0, 0x1.a65a20e26573bp+0,
+      0x1.67cf91caf895bp-1, 0x1.cbb4ae29113f6p-3, 0x1.996f54112129dp-5,
+      0x1.3f81e2a12de8ep-7, 0x1.83a6916de90fdp-10, 0x1.b4c266fa5823ep-13,
+      0x1.928f734762fecp-16, 0x1.6343c92c65dfep-19, 0x1.084b615b8ca1ap-22,
+      0x1.7f9530cb2a93ap-26 },
+    { 0x1.3p+1, 0x0p+0, 0x1.1f89f194856bdp+1, 0x1.05f705d903ff7p+1,
+      0x1.c86daffe2d907p-1, 0x1.1fc6c1b7af272p-2, 0x1.04d04f5f57f07p-4,
+      0x1.91e1ae9e18903p-7, 0x1.ef2a687305b39p-10, 0x1.1375c69e99c42p-12,
+      0x1.018ea5a159bb1p-15, 0x1.c0fc5f6e8850ap-19, 0x1.529e3234b9e89p-22,
+      0x1.e5733da4d3bc4p-26 },
+    { 0x1.5p+1, 0x0p+0, 0x1.68c1dc284de37p+1, 0x1.464e06b075859p+1,
+      0x1.20ce339bfba8ep+0, 0x1.6978daf1b57b5p-2, 0x1.4b7c56b5b1216p-4,
+      0x1.faf5d12010005p-7, 0x1.3b7e5080f196p-9, 0x1.5c66cfd77fa9bp-12,
+      0x1.48c86df904641p-15, 0x1.1c736b2c60edap-18, 0x1.b0cf9e31cbce3p-22,
+      0x1.33f50c6099e71p-25 },
+    { 0x1.7p+1, 0x0p+0, 0x1.c41b6b99c5f1cp+1, 0x1.97aa88eeb6ea9p+1,
+      0x1.6d01e8aff847cp+0, 0x1.c7106b0c07da3p-2, 0x1.a4bb49919b5c5p-4,
+      0x1.4060ba220ea2bp-6, 0x1.91789cd8774ddp-9, 0x1.b970d10d93b1p-12,
+      0x1.a31d9bdbbb476p-15, 0x1.6906b566dd076p-18, 0x1.14366f4b8697p-21,
+      0x1.8759499fe2a91p-25 },
+    { 0x1.9p+1, 0x0p+0, 0x1.1b2fb8ecf1253p+2, 0x1.fe74e3d555e3fp+1,
+      0x1.cd05f6c0d147bp+0, 0x1.1ee6e2dd02ce1p-1, 0x1.0ace8128365dap-3,
+      0x1.9577ed7c21a0fp-6, 0x1.fe7ae64eb5343p-9, 0x1.17fe702f745c9p-11,
+      0x1.0aeb0395e3e6ap-14, 0x1.cab808b581f5ep-18, 0x1.604241abf0594p-21,
+      0x1.f1d6dc060741cp-25 },
+    { 0x1.bp+1, 0x0p+0, 0x1.62caa0a71a267p+2, 0x1.4022505996df9p+2,
+      0x1.2315ac5ed3a65p+1, 0x1.6a2f6cca4e707p-1, 0x1.52463f612431dp-3,
+      0x1.00d1a374a895dp-5, 0x1.4469892576eap-8, 0x1.637906e499321p-11,
+      0x1.53d44c2ddd672p-14, 0x1.23a33bfce5a6p-17, 0x1.c108e557cd42dp-21,
+      0x1.3cdee296186c5p-24 },
+    { 0x1.dp+1, 0x0p+0, 0x1.bcac11b11ad67p+2, 0x1.921881fda3641p+2,
+      0x1.6f96b3d21b56p+1, 0x1.c9a0b03c131cap-1, 0x1.acd7732b85dbcp-3,
+      0x1.458dc12fd440ep-5, 0x1.9c424aabb67cbp-8, 0x1.c38eaa74a16fep-11,
+      0x1.b090655955fc8p-14, 0x1.7303b18134aadp-17, 0x1.1e2156395efe6p-20,
+      0x1.938ef22de5dccp-24 },
+    { 0x1.fp+1, 0x0p+0, 0x1.16d0e42a71fccp+3, 0x1.f99bb753c286cp+2,
+      0x1.d04a0864e52f8p+1, 0x1.214ffa20f97e6p+0, 0x1.0fd714f19e0eap-2,
+      0x1.9ce617c680229p-5, 0x1.05f02a919393bp-7, 0x1.1eed91121b8cp-10,
+      0x1.1347fe0c9d66dp-13, 0x1.d82aeb041a6f4p-17, 0x1.6c9cdf395e8afp-20,
+      0x1.01108851c15afp-23 },
+    { 0x1.08p+2, 0x0p+0, 0x1.5ddf156275115p+3, 0x1.3e2f5ee5fcc7dp+3,
+      0x1.254c2412a2573p+2, 0x1.6e0440008d85ap+0, 0x1.58ae5d927aa4cp-2,
+      0x1.05f28334ff4bep-4, 0x1.4cdfd93296641p-7, 0x1.6cc20e37d55aap-10,
+      0x1.5e6088317d48p-13, 0x1.2c882e759ebe5p-16, 0x1.d09c9baa01c7fp-20,
+      0x1.479370ae82b9dp-23 },
+    { 0x1.18p+2, 0x0p+0, 0x1.b7579e2b3771cp+3, 0x1.90cd961052191p+3,
+      0x1.72aefb0a9b244p+2, 0x1.cf4873bb211c2p+0, 0x1.b51ec371f934ap-2,
+      0x1.4c7a76bb7fec4p-4, 0x1.a710ab7496b09p-7, 0x1.cfd28e78eb486p-10,
+      0x1.bdfbff2747326p-13, 0x1.7ea8148f3bc61p-16, 0x1.2806baa289ebdp-19,
+      0x1.a18158768a6eap-23 },
+    { 0x1.28p+2, 0x0p+0, 0x1.140b3ae66e45ep+4, 0x1.f93d38ead30cap+3,
+      0x1.d4a8195b1c554p+2, 0x1.2552feab98d23p+1, 0x1.153bd7a3c9b1ep-1,
+      0x1.a62023b98a1aap-4, 0x1.0ce1d6a6f0948p-6, 0x1.26f648ff99addp-9,
+      0x1.1bdd5bc731fa5p-12, 0x1.e74f78ba1c913p-16, 0x1.793f11ceed161p-19,
+      0x1.0a19f13bcbb2cp-22 },
+    { 0x1.38p+2, 0x0p+0, 0x1.5b2143a8dac07p+4, 0x1.3ea6d726fafd4p+4,
+      0x1.285f32f23038p+3, 0x1.739338b5ed843p+1, 0x1.5fbcfa71baef8p-1,
+      0x1.0c0b076e97795p-3, 0x1.55d4d235ff418p-6, 0x1.773a8fc58b3c4p-9,
+      0x1.69644ba72d1cdp-12, 0x1.36576a7c5deacp-15, 0x1.e0c94d31e91ebp-19,
+      0x1.533f8db298f81p-22 },
+    { 0x1.48p+2, 0x0p+0, 0x1.b4d3461b8b2cbp+4, 0x1.922ef3a2fce1ep+4,
+      0x1.76fb4650daa34p+3, 0x1.d6de0293baea8p+1, 0x1.be5e5641999a9p-1,
+      0x1.547d0559c1c46p-3, 0x1.b2a3fac25de7bp-6, 0x1.dd6c5d0dd7c79p-9,
+      0x1.cc2505905710bp-12, 0x1.8b5590a0e4314p-15, 0x1.3265d7e017a59p-18,
+      0x1.b08d0c6899e22p-22 },
+    { 0x1.58p+2, 0x0p+0, 0x1.13087838b30bp+5, 0x1.fbe41f13c72d5p+4,
+      0x1.da9d49eeaae16p+3, 0x1.2a71a20022fd8p+2, 0x1.1b4b6901a7f25p+0,
+      0x1.b09c53cea7e4bp-3, 0x1.145e50fe900fep-5, 0x1.2fc68b9b7e154p-8,
+      0x1.24f9c20ebf655p-11, 0x1.f7ab1cb8c7defp-15, 0x1.868f67e8cf7b2p-18,
+      0x1.13c924eb2d403p-21 },
+    { 0x1.68p+2, 0x0p+0, 0x1.5a8df50ee2ce6p+5, 0x1.40dae74635436p+5,
+      0x1.2c77693e0a18fp+4, 0x1.7a6f2c660fdd3p+2, 0x1.67ad3eb9391fdp+0,
+      0x1.12e2fc079cd78p-2, 0x1.5f845be48e236p-5, 0x1.82a22e9196bb9p-8,
+      0x1.751f19f8ccf38p-11, 0x1.40e222835c034p-14, 0x1.f1e2d2bcae36bp-18,
+      0x1.5fb461cc094d4p-21 },
+    { 0x1.78p+2, 0x0p+0, 0x1.b4f16e4bec60cp+5, 0x1.9596796842027p+5,
+      0x1.7c90ef6d65f67p+4, 0x1.e000edbf957c8p+2, 0x1.c8c164395bd2bp+0,
+      0x1.5d673ce76db21p-2, 0x1.bf2babe5c02bdp-5, 0x1.ec2a1a5be4fd8p-8,
+      0x1.db3f8db48d6b2p-11, 0x1.98e94e3f4c416p-14, 0x1.3d61b49a057bap-17,
+      0x1.c0904606739fcp-21 },
+    { 0x1.88p+2, 0x0p+0, 0x1.139d48499232ap+6, 0x1.0076b81c659bdp+6,
+      0x1.e22dc6e0be74dp+4, 0x1.30803ac309cf5p+3, 0x1.2214d2f67fb5ap+1,
+      0x1.bc346cdf492a2p-2, 0x1.1c78876f14068p-4, 0x1.394b509c403e1p-7,
+      0x1.2eb3102b1d4f8p-10, 0x1.04929192c6439p-13, 0x1.94ac162ab1d3ep-17,
+      0x1.1e12dc3d78825p-20 },
+    { 0x1.98p+2, 0x0p+0, 0x1.5be571d785974p+6, 0x1.447998e569456p+6,
+      0x1.318efc66a7b4fp+5, 0x1.826f803fe93cbp+3, 0x1.7088bf5f25e77p+1,
+      0x1.1a6a75513730ap-1, 0x1.69fdcc063a154p-4, 0x1.8eeaf8b90488fp-7,
+      0x1.81a3fc8e7a524p-10, 0x1.4c2072b7f3feep-13, 0x1.02023072e3ed1p-16,
+      0x1.6cebad8ae7149p-20 },
+    { 0x1.a8p+2, 0x0p+0, 0x1.b75d9f0acb92dp+6, 0x1.9aafceedeec9ap+6,
+      0x1.8362bec2ac2b1p+5, 0x1.ea8a699a238b5p+3, 0x1.d44cf4aee92p+1,
+      0x1.672bd0b1db239p-1, 0x1.ccb488816c12dp-4, 0x1.fc025c60de45ap-7,
+      0x1.eb5cfea352be9p-10, 0x1.a75f897d110dcp-13, 0x1.4907413b84aa1p-16,
+      0x1.d1898657c07ecp-20 },
+    { 0x1.b8p+2, 0x0p+0, 0x1.1594a5b181712p+7, 0x1.04004f9ee2cdap+7,
+      0x1.eb45289e0bdc8p+5, 0x1.376bc566d7bb2p+4, 0x1.2998b2ddc0c5fp+2,
+      0x1.c8dd5e20852d4p-1, 0x1.25361332bbefdp-3, 0x1.438204fe60524p-6,
+      0x1.3911babed9f3ep-9, 0x1.0ddee9b50f949p-12, 0x1.a3a2336f31935p-16,
+      0x1.28f8b9ac31994p-19 },
+    { 0x1.c8p+2, 0x0p+0, 0x1.5ee747d9de79bp+7, 0x1.4953a6883b57p+7,
+      0x1.3798285c053c4p+6, 0x1.8b812425dcd39p+4, 0x1.7a4e87fe4505cp+2,
+      0x1.229cedd46b82fp+0, 0x1.7546674b2a21ap-3, 0x1.9c147fda755c1p-6,
+      0x1.8efbbd236773fp-9, 0x1.58149b1f83499p-12, 0x1.0b9e062df4958p-15,
+      0x1.7ae99d17c5863p-19 },
+    { 0x1.d8p+2, 0x0p+0, 0x1.bbcb1d1dcd721p+7, 0x1.a147caad85025p+7,
+      0x1.8b5f54d4d052bp+6, 0x1.f666ff00e16bfp+4, 0x1.e0fed11cd248ep+2,
+      0x1.71c739cd1886fp+0, 0x1.db43fc7cd3b37p-3, 0x1.067b811a122f8p-5,
+      0x1.fc871667ded54p-9, 0x1.b6bcd8668b592p-12, 0x1.555e7d02d6ed5p-15,
+      0x1.e37fd3eddb4b2p-19 },
+    { 0x1.e8p+2, 0x0p+0, 0x1.18c1833d1a6ccp+8, 0x1.0872da5afd119p+8,
+      0x1.f5ce5a0232accp+6, 0x1.3f2a2fa318375p+5, 0x1.31d57563554a3p+3,
+      0x1.d694b320574a6p+0, 0x1.2e9a02745d2aap-2, 0x1.4e6ce898f783ep-5,
+      0x1.441b7565fc251p-8, 0x1.17be3d5ee4d67p-11, 0x1.b37b3b9f63e84p-15,
+      0x1.347fed58fcbeep-18 },
+    { 0x1.f8p+2, 0x0p+0, 0x1.635f118a0ea2ap+8, 0x1.4f4a34914c3a5p+8,
+      0x1.3e8674fdbc2d8p+7, 0x1.959996b352cc9p+5, 0x1.84fcbb69aa5bep+3,
+      0x1.2b79cc6d260bfp+1, 0x1.8161e4648eab9p-2, 0x1.aa22963a93e89p-5,
+      0x1.9d2d4f2a1dabdp-8, 0x1.64c3e5a38e313p-11, 0x1.15cab7f6dc4e6p-14,
+      0x1.89b568972fbcdp-18 },
+    { 0x1.04p+3, 0x0p+0, 0x1.c1fd6300df3ecp+8, 0x1.a93c330611276p+8,
+      0x1.947835ceffa8ep+7, 0x1.01c5d8dfacdf6p+6, 0x1.eed50aaba74b8p+3,
+      0x1.7d39a89d51f0fp+1, 0x1.eadec8f85f73bp-2, 0x1.0f86e827c78cdp-4,
+      0x1.076345c39e867p-7, 0x1.c7088bfde9016p-11, 0x1.626ea85a5e327p-14,
+      0x1.f67ceb99957f9p-18 },
+    { 0x1.0cp+3, 0x0p+0, 0x1.1d011a402f8afp+9, 0x1.0dbb4a972de2fp+9,
+      0x1.00dc624cb44b4p+8, 0x1.47b5c00c2927ap+6, 0x1.3aca3e3b230c9p+4,
+      0x1.e55ba2cdad054p+1, 0x1.38a77858c6b2ep-1, 0x1.5a10190138a53p-4,
+      0x1.4fd5ceedf50cp-7, 0x1.22357be9b5e38p-10, 0x1.c4405e9762344p-14,
+      0x1.40aeeb231adep-17 },
+    { 0x1.14p+3, 0x0p+0, 0x1.6924ff907a4cfp+9, 0x1.5647ffb93f3e8p+9,
+      0x1.46507f9e107dep+8, 0x1.a0b2ef98d07aep+6, 0x1.9092c7e581025p+4,
+      0x1.35025b5cc53abp+2, 0x1.8e547753dbffep-1, 0x1.b91aee207ad5ep-4,
+      0x1.ac3fdcdf343cep-7, 0x1.7234e1a550218p-10, 0x1.208e241ece5fbp-13,
+      0x1.995786a99a7ffp-17 },
+    { 0x1.1cp+3, 0x0p+0, 0x1.c9c7027d21398p+9, 0x1.b27548589ba5dp+9,
+      0x1.9ea2e0fa1792ep+8, 0x1.08f94269a4bd7p+7, 0x1.fdcf99b99e9adp+4,
+      0x1.8985526547775p+2, 0x1.fb8a97bbcf23dp-1, 0x1.19274237ed653p-3,
+      0x1.1112543368627p-6, 0x1.d84b48a569966p-10, 0x1.703f4c26a5fbcp-13,
+      0x1.0545ea9b664b6p-16 },
+    { 0x1.24p+3, 0x0p+0, 0x1.22399029cf7c4p+10, 0x1.13cc5e804e324p+10,
+      0x1.077c64ce61673p+9, 0x1.510b842009fbp+7, 0x1.4477796c2186dp+5,
+      0x1.f5359f3d52925p+2, 0x1.43624612d807bp+0, 0x1.6670c909bf1c9p-3,
+      0x1.5c46d1d22abf8p-6, 0x1.2d4a4e411bb98p-9, 0x1.d5fb4ff99a4ccp-13,
+      0x1.4d8cdbfb8b9dcp-16 },
+    { 0x1.2cp+3, 0x0p+0, 0x1.701bb6f756681p+10, 0x1.5e3e40edc347dp+10,
+      0x1.4eefef1b689b6p+9, 0x1.acca6b237b20ep+7, 0x1.9d11c2fc8ef4p+5,
+      0x1.3f392905b0d24p+3, 0x1.9c2342ad43486p+0, 0x1.c90474c787352p-3,
+      0x1.bc3b43bba6c2ap-6, 0x1.806ef1bf01dc1p-9, 0x1.2bee8c07b8154p-12,
+      0x1.a9d93cb825149p-16 },
+    { 0x1.34p+3, 0x0p+0, 0x1.d306bab756c87p+10, 0x1.bce29d5a97523p+10,
+      0x1.a9d880c61968dp+9, 0x1.10cc8b7918818p+8, 0x1.06f84572f8c2cp+6,
+      0x1.96ade40ee5d0cp+3, 0x1.06a725bee2dedp+1, 0x1.236125f3c8daap-2,
+      0x1.1b55d57a9f112p-5, 0x1.ea8eaac7024d5p-9, 0x1.7ed87aefd9fc6p-12,
+      0x1.0fdc4664bab42p-15 },
+    { 0x1.3cp+3, 0x0p+0, 0x1.28581afda3c89p+11, 0x1.1a9cfe321bb0fp+11,
+      0x1.0ec3980672612p+10, 0x1.5b2aa17f4ac91p+8, 0x1.4ededcce53bdcp+6,
+      0x1.0313ea6a29319p+4, 0x1.4ecf052ac7791p+1, 0x1.73950662f26b1p-2,
+      0x1.6975288c260f1p-5, 0x1.3902f251f578ap-8, 0x1.e8b67b3271a11p-12,
+      0x1.5b217c8199fe7p-15 },
+    { 0x1.44p+3, 0x0p+0, 0x1.782e0a871bc62p+11, 0x1.6722f50307702p+11,
+      0x1.58610a09b51efp+10, 0x1.b9dfb95fd6521p+8, 0x1.aa7c57832480cp+6,
+      0x1.4a21cb4a4060cp+4, 0x1.aad4660187a38p+1, 0x1.d9e71fe1c9335p-2,
+      0x1.cd282f8ca55b7p-5, 0x1.8f7a2e814356ep-8, 0x1.37f2a924f3e7fp-11,
+      0x1.bb4485dd68257p-15 },
+    { 0x1.4cp+3, 0x0p+0, 0x1.dda4bfd0e5645p+11, 0x1.c87940212852cp+11,
+      0x1.b6155f389eaa8p+10, 0x1.193ff56aeb82dp+9, 0x1.0f9ded3967f8bp+7,
+      0x1.a4b8473fef8d1p+4, 0x1.101901f6d178ep+2, 0x1.2e39cb796a8eep-1,
+      0x1.26336c325c538p-4, 0x1.fddd2f85b94ap-8, 0x1.8e42e2311c62ap-11,
+      0x1.1b07f8384c31dp-14 },
+    { 0x1.54p+3, 0x0p+0, 0x1.2f4f67e904e73p+12, 0x1.22273c9942aeap+12,
+      0x1.16b03ad72aad8p+11, 0x1.6613f459773fep+9, 0x1.5a034c8a3b33p+7,
+      0x1.0c1c779df0a35p+5, 0x1.5af314de0ced2p+2, 0x1.8183a55b18b4bp-1,
+      0x1.77682485b3b05p-4, 0x1.456631e082d65p-7, 0x1.fc7d1238584bp-11,
+      0x1.69751717bb40ep-14 },
+    { 0x1.5cp+3, 0x0p+0, 0x1.814d1ea65a613p+12, 0x1.70efc55cf1496p+12,
+      0x1.62a24c2d5e277p+11, 0x1.c7f4947c7cd9p+9, 0x1.b8d6a0be21027p+7,
+      0x1.55c0c1212306fp+5, 0x1.ba6ef6fae6b11p+2, 0x1.ebcbdac8d84a8p-1,
+      0x1.df101f21867aap-4, 0x1.9f5f5f7505cf8p-7, 0x1.44a1b396efcb3p-10,
+      0x1.cda40fde2bffep-14 },
+    { 0x1.64p+3, 0x0p+0, 0x1.e9909567c81a2p+12, 0x1.d532859bc685dp+12,
+      0x1.c35866a9f61efp+11, 0x1.2254f999cf017p+10, 0x1.18dba2d67d572p+8,
+      0x1.b3aa8242e9117p+5, 0x1.1a1f8967cd449p+3, 0x1.39b7036d6b8e3p+0,
+      0x1.31b14015281a3p-3, 0x1.092117e0d97f3p-6, 0x1.9e87d0ada0138p-10,
+      0x1.26cfe01db899ap-13 },
+    { 0x1.6cp+3, 0x0p+0, 0x1.37165fd77817cp+13, 0x1.2a67abdff03a2p+13,
+      0x1.1f421c6c81eb7p+12, 0x1.71c9cef18c8b1p+10, 0x1.65e8be9b5cf04p+8,
+      0x1.15b87b717a4b9p+6, 0x1.67d492c25362cp+3, 0x1.9044383c89472p+0,
+      0x1.8627bf08e67f7p-3, 0x1.527b610a6c26p-6, 0x1.08ad8a0d8ae5ep-9,
+      0x1.789085512417fp-13 },
+    { 0x1.74p+3, 0x0p+0, 0x1.8b6f008f6f60ep+13, 0x1.7ba14803cc462p+13,
+      0x1.6db40e95e972fp+12, 0x1.d70c787dda817p+10, 0x1.c8260845cc849p+8,
+      0x1.621b5fc7c5455p+6, 0x1.cafaf8226653bp+3, 0x1.febc7e0dbd864p+0,
+      0x1.f1fd64f66bf63p-3, 0x1.b027fab16b258p-6, 0x1.520365d61e1e7p-9,
+      0x1.e1033e4966079p-13 },
+    { 0x1.7cp+3, 0x0p+0, 0x1.f6bf72ed0602ep+13, 0x1.e30b31ebfe9d6p+13,
+      0x1.d1a2bb78c5622p+12, 0x1.2c0e20936f202p+11, 0x1.22b511524691ap+9,
+      0x1.c38ba35279c6p+6, 0x1.24bff87709f78p+4, 0x1.45df32d8237b1p+1,
+      0x1.3dd5fe5b265b3p-2, 0x1.13e4f0769a5c1p-5, 0x1.afb13acfc4c1p-9,
+      0x1.333b51a4c61efp-12 },
+    { 0x1.84p+3, 0x0p+0, 0x1.3fa73cfaa57d9p+14, 0x1.335ce3d0ea794p+14,
+      0x1.287a60f07434ep+13, 0x1.7e4fcb5f1fd1ap+11, 0x1.72942344b716bp+9,
+      0x1.1fec9d05e8bd4p+7, 0x1.757a5459759fep+4, 0x1.9fdf0b47d5e42p+1,
+      0x1.95bc99d4a3c4ep-2, 0x1.604a5f744f885p-5, 0x1.13aea93c269d4p-8,
+      0x1.887d33baccedcp-12 },
+    { 0x1.8cp+3, 0x0p+0, 0x1.968d9b7f022e5p+14, 0x1.87367612c215p+14,
+      0x1.79984311df6b1p+13, 0x1.e72c6ea58d58cp+11, 0x1.d8712ab21425dp+9,
+      0x1.6f37c60004ff8p+7, 0x1.dc81519785baap+4, 0x1.0961e5d2c90dp+2,
+      0x1.02fd941f7b02bp-1, 0x1.c1de2700c056bp-5, 0x1.6020003426a4p-8,
+      0x1.f56e2fc93021ep-12 },
+    { 0x1.94p+3, 0x0p+0, 0x1.02958a179f951p+15, 0x1.f202dc6723c32p+14,
+      0x1.e0f76cf5284cfp+13, 0x1.366ee41f887f7p+12, 0x1.2d2ea051eb257p+10,
+      0x1.d463b26602eabp+7, 0x1.30001b0200cbap+5, 0x1.52b95168b6413p+2,
+      0x1.4aa8daa233f51p-1, 0x1.1f40ac394c7cp-4, 0x1.c1c9bf3d4d7d3p-8,
+      0x1.405217872524bp-11 },
+    { 0x1.9cp+3, 0x0p+0, 0x1.48fede44030e5p+15, 0x1.3d072939cd144p+15,
+      0x1.325b53febb7a2p+14, 0x1.8baaa95ab8582p+12, 0x1.800b52f4e9368p+10,
+      0x1.2abe1e819e312p+8, 0x1.83ebe2aceae5cp+5, 0x1.b05d234277847p+2,
+      0x1.a630009b5c142p-1, 0x1.6edb9acf74b3ep-4, 0x1.1f48bbc2025cap-7,
+      0x1.994526bd3e884p-11 },
+    { 0x1.a4p+3, 0x0p+0, 0x1.a2a5f4882d92ep+15, 0x1.93b046e070fd1p+15,
+      0x1.86523fc71e31bp+14, 0x1.f85ae666130d3p+12, 0x1.e9bfc2e5a3f8cp+10,
+      0x1.7d1cd35217854p+8, 0x1.ef0bcc6728906p+5, 0x1.13f6b6f8cb612p+3,
+      0x1.0d8ab39ff2e3fp+0, 0x1.d48cbf7c70432p-4, 0x1.6f004cd8f879bp-7,
+      0x1.0578e250d6e14p-10 },
+    { 0x1.acp+3, 0x0p+0, 0x1.0a686d20c6cd3p+16, 0x1.010dbe57fe933p+16,
+      0x1.f15b3924dd11bp+14, 0x1.417b98f5f3226p+13, 0x1.384d684dd29dp+11,
+      0x1.e63ba78fe1e5dp+8, 0x1.3be649f84d3cep+6, 0x1.604ce95693be3p+3,
+      0x1.583190b552be1p+0, 0x1.2b3b48602ac1dp-3, 0x1.d4dcac1e3f92cp-7,
+      0x1.4e1c77f33dd41p-10 },
+    { 0x1.b4p+3, 0x0p+0, 0x1.531c487f05becp+16, 0x1.47682c6493c5fp+16,
+      0x1.3ce8460f37f39p+15, 0x1.99e034cfbb359p+13, 0x1.8e5500e91718dp+11,
+      0x1.3632d7cc7369fp+9, 0x1.933177ef38264p+6, 0x1.c1c83de386e66p+3,
+      0x1.b78beba0cb536p+0, 0x1.7e38125333ccep-3, 0x1.2b8306811e7ecp-6,
+      0x1.aaf30041e472bp-10 },
+    { 0x1.bcp+3, 0x0p+0, 0x1.afb79a2b422e2p+16, 0x1.a111653397fa6p+16,
+      0x1.93e6978513a02p+15, 0x1.054fcc33a8a84p+14, 0x1.fc1a9afa29eccp+11,
+      0x1.8bd2225a82a61p+9, 0x1.0152882ccc73ap+7, 0x1.1f22fc7b1190dp+4,
+      0x1.18ac7d891026cp+1, 0x1.e83f5847deaadp-3, 0x1.7eada45cf56c4p-6,
+      0x1.10cdd30bd6cd1p-9 },
+    { 0x1.c4p+3, 0x0p+0, 0x1.12d8938985b72p+17, 0x1.09ac8aa52c14dp+17,
+      0x1.016a2fa4210cp+16, 0x1.4d395e414b6a9p+14, 0x1.44172a1c202aep+12,
+      0x1.f91d64ea370cep+9, 0x1.48796a7387f8ap+7, 0x1.6ea2188ce9054p+4,
+      0x1.66786734e02abp+1, 0x1.37dc37d5cee6ep-2, 0x1.e8f6052c9d0cp-6,
+      0x1.5ca33962c5c0fp-9 },
+    { 0x1.ccp+3, 0x0p+0, 0x1.5e0048b0e6e8ap+17, 0x1.5282d84ab9aedp+17,
+      0x1.4825726c4141ep+16, 0x1.a8f73322cd78bp+14, 0x1.9d78b1be52fc9p+12,
+      0x1.42513361fc845p+10, 0x1.a353feea27a23p+7, 0x1.d42ad3c90318fp+4,
+      0x1.c9db036d7994ep+1, 0x1.8e695b050e188p-2, 0x1.3865421f45c6ep-5,
+      0x1.bd92060321455p-9 },
+    { 0x1.d4p+3, 0x0p+0, 0x1.bdc439a85c5dp+17, 0x1.af5df77e9963p+17,
+      0x1.a25afbfda923p+16, 0x1.0f01b8a8a07bap+15, 0x1.07c5c0e83274ap+13,
+      0x1.9b60058d15eecp+10, 0x1.0bac51f5aaad3p+8, 0x1.2aed76b3aae3ap+5,
+      0x1.2469ce5dce711p+2, 0x1.fd0244468e0e8p-2, 0x1.8f31f302bde87p-5,
+      0x1.1cbd2754de3dep-8 },
+    { 0x1.dcp+3, 0x0p+0, 0x1.1be771eb907c1p+18, 0x1.12e0b9f016d79p+18,
+      0x1.0ab53eec4e80fp+17, 0x1.59ae11a624aeap+15, 0x1.50924938036cfp+13,
+      0x1.0689d9b5795c1p+11, 0x1.55c0ee1cec6d6p+8, 0x1.7dc192f0696bap+5,
+      0x1.75863310e161ap+2, 0x1.452b6703214cap-1, 0x1.fe228a8c16fcep-5,
+      0x1.6befa7f3d17f6p-8 },
+    { 0x1.e4p+3, 0x0p+0, 0x1.69ad2ec73e2ecp+18, 0x1.5e5b2e2cd406bp+18,
+      0x1.5417ebcfd55b2p+17, 0x1.b8f755bb54345p+15, 0x1.ad7eb53e694c1p+13,
+      0x1.4f202cdc320dcp+11, 0x1.b45d13feb71e9p+8, 0x1.e7901bc1bef3p+5,
+      0x1.dd28a58443642p+2, 0x1.9f79a4bd67fb3p-1, 0x1.45f79f7ee9447p-4,
+      0x1.d12e287eec302p-8 },
+    { 0x1.ecp+3, 0x0p+0, 0x1.cccf4ff1e0b2p+18, 0x1.be9b764a72902p+18,
+      0x1.b1b627b626befp+17, 0x1.1948415d653a4p+16, 0x1.120ea238de86ep+14,
+      0x1.abcf86030dc6ep+11, 0x1.16997714d57e6p+9, 0x1.375d5ea9055bdp+6,
+      0x1.30c9f5c2aac2bp+3, 0x1.09714ddd56d27p+0, 0x1.a097be8d559a4p-4,
+      0x1.294e898a2ca4bp-7 },
+    { 0x1.f4p+3, 0x0p+0, 0x1.2597936d44134p+19, 0x1.1cae00e588a5dp+19,
+      0x1.14933cbeb0822p+18, 0x1.66e046e15bf7bp+16, 0x1.5dc5c84b18ea4p+14,
+      0x1.111521136483p+12, 0x1.63c4d4b6a1f3ep+9, 0x1.8db4a59f3e7ddp+6,
+      0x1.85645bc6338c8p+3, 0x1.53314029da93fp+0, 0x1.0a37e032a036p-3,
+      0x1.7c0b9b4125eefp-7 },
+    { 0x1.fcp+3, 0x0p+0, 0x1.76269a2b397abp+19, 0x1.6af62a81ea0fep+19,
+      0x1.60c58e36f50fep+18, 0x1.c9e930c1824f7p+16, 0x1.be7022d92b231p+14,
+      0x1.5ca750f1b74c3p+12, 0x1.c657078519e9bp+9, 0x1.fc040f479b9edp+6,
+      0x1.f180ea07c997p+3, 0x1.b173bfde0f832p+0, 0x1.5442ccb24aaffp-3,
+      0x1.e5d40a892dab5p-7 },
+  },
+};
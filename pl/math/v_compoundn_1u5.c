@@ -0,0 +1,76 @@
+/*
+ * Double-precision vector compoundn(x, n) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "mathlib.h"
+#include "v_pown_common.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+/* Vector (1 + x)^n for integer n.  1 + x is computed exactly as u + ulo, then
+   the result is evaluated as in the scalar compoundn, by repeated squaring
+   or as exp(n log1p(x)).  x <= -1, infinite and nan x fall back to scalar
+   compoundn.
+   Maximum measured error is 1.04 ULPs:
+   _ZGVnN2vv_compoundn(0x1.1d9eb93a680c7p-7, -6232)
+     got 0x1.f5e3dd2f7649ep-79
+    want 0x1.f5e3dd2f7649fp-79.  */
+float64x2_t VPCS_ATTR V_NAME_D2 (compoundn) (float64x2_t x, int64x2_t n)
+{
+  const struct v_pow_data *d = ptr_barrier (&v_pow_data);
+  /* x <= -1, inf or nan.  */
+  uint64x2_t special = vorrq_u64 (
+      vcgeq_u64 (vreinterpretq_u64_f64 (x), v_u64 (0xbff0000000000000)),
+      vcgeq_u64 (vreinterpretq_u64_f64 (vabsq_f64 (x)),
+		 v_u64 (0x7ff0000000000000)));
+  float64x2_t z = vbslq_f64 (special, v_f64 (0.0), x);
+
+  /* u + ulo = 1 + z exactly.  */
+  float64x2_t u = vaddq_f64 (v_f64 (1.0), z);
+  float64x2_t v = vsubq_f64 (u, z);
+  float64x2_t ulo = vaddq_f64 (vsubq_f64 (v_f64 (1.0), v),
+			       vsubq_f64 (z, vsubq_f64 (u, v)));
+
+  uint64x2_t sq = v_pown_use_squaring (u, n);
+  float64x2_t y;
+  if (likely (v_all_u64 (sq)))
+    y = v_pown_squaring (u, ulo, n);
+  else
+    {
+      y = v_pown_squaring (u, ulo,
+			   vandq_s64 (n, vreinterpretq_s64_u64 (sq)));
+      float64x2_t ll;
+      float64x2_t lh = v_pow_log_inline (vreinterpretq_u64_f64 (u), &ll, d);
+      /* log1p(x) ~= log(u) + t - t^2/2, t = th + tl = ulo/u.  */
+      float64x2_t th = vdivq_f64 (ulo, u);
+      float64x2_t tl = vdivq_f64 (vfmsq_f64 (ulo, th, u), u);
+      float64x2_t hi = vaddq_f64 (lh, th);
+      float64x2_t lo = vbslq_f64 (vcageq_f64 (lh, th),
+				  vaddq_f64 (vsubq_f64 (lh, hi), th),
+				  vaddq_f64 (vsubq_f64 (th, hi), lh));
+      lo = vaddq_f64 (lo, vaddq_f64 (ll, tl));
+      lo = vfmsq_f64 (lo, vmulq_f64 (v_f64 (0.5), th), th);
+      y = vbslq_f64 (sq, y, v_pown_exp_mul (n, hi, lo, d));
+    }
+
+  if (unlikely (v_any_u64 (special)))
+    return v_call_pown (compoundn, x, n, y, special);
+  return y;
+}
+
+PL_TEST_ULP (V_NAME_D2 (compoundn), 0.55)
+#define V_COMPOUNDN_INTERVAL2(xlo, xhi, ylo, yhi, n)                          \
+  PL_TEST_INTERVAL2 (V_NAME_D2 (compoundn), xlo, xhi, ylo, yhi, n)            \
+  PL_TEST_INTERVAL2 (V_NAME_D2 (compoundn), xlo, xhi, -ylo, -yhi, n)
+V_COMPOUNDN_INTERVAL2 (0, 0x1p-20, 0, 64, 40000)
+V_COMPOUNDN_INTERVAL2 (-0, -1, 0, 64, 40000)
+V_COMPOUNDN_INTERVAL2 (0x1p-20, inf, 0, 64, 40000)
+V_COMPOUNDN_INTERVAL2 (0, 0x1p-2, 0, 1000, 40000)
+V_COMPOUNDN_INTERVAL2 (-0, -0x1p-2, 0, 1000, 40000)
+V_COMPOUNDN_INTERVAL2 (0, 0x1p-20, 0, 0x1p30, 40000)
+V_COMPOUNDN_INTERVAL2 (-0, -0x1p-20, 0, 0x1p30, 40000)
+V_COMPOUNDN_INTERVAL2 (0, inf, 0, 0x1p62, 10000)
+V_COMPOUNDN_INTERVAL2 (-0, -1, 0, 0x1p62, 10000)
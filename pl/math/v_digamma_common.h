@@ -0,0 +1,187 @@
+/*
+ * Core approximations for double-precision vector digamma and trigamma
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "poly_advsimd_f64.h"
+
+#define V_LOG_INLINE_POLY_ORDER 5
+#include "v_log_inline.h"
+
+/* Both functions are approximated in three regions:
+   - For 0 <= x < 8, by the piecewise polynomials in __v_digamma_data.  Below
+     1 the tables hold digamma(x + 1) and trigamma(x + 1), and the pole is
+     added back as -1/x or 1/x^2, so the relative error stays small as x
+     approaches 0.  The positive zero of digamma is tabulated exactly.
+   - For x >= 8, by the asymptotic expansions
+       digamma(x) = log(x) - 1/(2x) - z P(z),
+       trigamma(x) = 1/x + z (1/2 + P1(z) / x), with z = 1/x^2.
+   - For x < 0, by the reflection formulas
+       digamma(x) = digamma(1 - x) - pi cot(pi x),
+       trigamma(x) = pi^2 / sin(pi x)^2 - trigamma(1 - x).
+     sin(pi x) is evaluated on r = x - rint(x), and cos(pi x) as
+     sin(pi (1/2 - |r|)), both exact, so the relative error stays small close
+     to the poles.  However digamma has a zero between each pair of negative
+     integers, where the two terms cancel, so close to those the error is
+     only small in absolute terms, below
+     3.6 2^-52 max(1, |digamma(1 - x)|, |pi cot(pi x)|).  */
+static const struct v_digamma_consts
+{
+  float64x2_t digamma_poly[7], trigamma_poly[7], sinpi_poly[10];
+  float64x2_t table_bound, asymptotic_bound, pi;
+  struct v_log_inline_data log_consts;
+} v_digamma_consts = {
+  /* Coefficients of P and P1 on [0, 1/8^2], computed by Chebyshev
+     interpolation in quad precision.  */
+  .digamma_poly = { V2 (0x1.5555555555555p-4), V2 (-0x1.11111111095e6p-7),
+		    V2 (0x1.041040c62923cp-8), V2 (-0x1.1110b33fc17d6p-8),
+		    V2 (0x1.f037df4b69ba2p-8), V2 (-0x1.531da6b6dedcp-6),
+		    V2 (0x1.0497fbf0fa8adp-4) },
+  .trigamma_poly = { V2 (0x1.5555555555551p-3), V2 (-0x1.11111110f37eep-5),
+		     V2 (0x1.86186098270b1p-6), V2 (-0x1.11105c888595ep-5),
+		     V2 (0x1.360bc3ac05fb3p-4), V2 (-0x1.f9d9c7216c73ap-3),
+		     V2 (0x1.b7a5f47721ecbp-1) },
+  /* sin(pi r) / r as a polynomial in r^2, same coefficients as sinpi.  */
+  .sinpi_poly = { V2 (0x1.921fb54442d184p1), V2 (-0x1.4abbce625be53p2),
+		  V2 (0x1.466bc6775ab16p1), V2 (-0x1.32d2cce62dc33p-1),
+		  V2 (0x1.507834891188ep-4), V2 (-0x1.e30750a28c88ep-8),
+		  V2 (0x1.e8f48308acda4p-12), V2 (-0x1.6fc0032b3c29fp-16),
+		  V2 (0x1.af86ae521260bp-21), V2 (-0x1.012a9870eeb7dp-25) },
+  .table_bound = V2 (0x1.fffffffffffffp+2),
+  .asymptotic_bound = V2 (8),
+  .pi = V2 (0x1.921fb54442d18p+1),
+  .log_consts = V_LOG_CONSTANTS,
+};
+
+#define V_DIGAMMA_TABLE_SCALE 8
+
+/* Evaluate the table entry covering x for each lane.  Lanes outside the
+   table, including NaNs, are clamped to the first or last entry.  */
+static inline float64x2_t
+v_digamma_lookup (const double (*tab)[V_DIGAMMA_ENTRY_LEN], float64x2_t x,
+		  const struct v_digamma_consts *d)
+{
+  float64x2_t xc = vminnmq_f64 (vmaxnmq_f64 (x, v_f64 (0)), d->table_bound);
+  uint64x2_t i
+      = vcvtq_u64_f64 (vmulq_f64 (xc, v_f64 (V_DIGAMMA_TABLE_SCALE)));
+
+  const double *e0 = tab[i[0]], *e1 = tab[i[1]];
+  float64x2_t c[V_DIGAMMA_ENTRY_LEN];
+  for (int k = 0; k < V_DIGAMMA_ENTRY_LEN; k += 2)
+    {
+      float64x2_t a = vld1q_f64 (e0 + k), b = vld1q_f64 (e1 + k);
+      c[k] = vzip1q_f64 (a, b);
+      c[k + 1] = vzip2q_f64 (a, b);
+    }
+
+  float64x2_t t = vsubq_f64 (vsubq_f64 (x, c[0]), c[1]);
+  float64x2_t p = v_horner_10_f64 (t, c + 3);
+  return vfmaq_f64 (c[2], t, p);
+}
+
+/* sin(pi r) / r, for |r| <= 1/2.  */
+static inline float64x2_t
+v_digamma_sinpi (float64x2_t r, const struct v_digamma_consts *d)
+{
+  float64x2_t r2 = vmulq_f64 (r, r);
+  float64x2_t r4 = vmulq_f64 (r2, r2);
+  return v_pw_horner_9_f64 (r2, r4, d->sinpi_poly);
+}
+
+/* digamma(x) for x >= 0 or NaN.  Infinity is not handled.  */
+static inline float64x2_t
+v_digamma_pos (float64x2_t x, const struct v_digamma_consts *d)
+{
+  uint64x2_t large = vcgeq_f64 (x, d->asymptotic_bound);
+  float64x2_t y = v_f64 (0);
+  if (!v_all_u64 (large))
+    {
+      y = v_digamma_lookup (__v_digamma_data.digamma, x, d);
+      uint64x2_t small = vcltq_f64 (x, v_f64 (1));
+      if (v_any_u64 (small))
+	y = vbslq_f64 (small, vsubq_f64 (y, vdivq_f64 (v_f64 (1), x)), y);
+    }
+  if (v_any_u64 (large))
+    {
+      float64x2_t ix = vdivq_f64 (v_f64 (1), x);
+      float64x2_t z = vmulq_f64 (ix, ix);
+      float64x2_t p = vmulq_f64 (z, v_horner_6_f64 (z, d->digamma_poly));
+      p = vfmaq_f64 (p, ix, v_f64 (0.5));
+      y = vbslq_f64 (large, vsubq_f64 (v_log_inline (x, &d->log_consts), p),
+		     y);
+    }
+  return y;
+}
+
+/* trigamma(x) for x >= 0 or NaN.  */
+static inline float64x2_t
+v_trigamma_pos (float64x2_t x, const struct v_digamma_consts *d)
+{
+  uint64x2_t large = vcgeq_f64 (x, d->asymptotic_bound);
+  float64x2_t y = v_f64 (0);
+  if (!v_all_u64 (large))
+    {
+      y = v_digamma_lookup (__v_digamma_data.trigamma, x, d);
+      uint64x2_t small = vcltq_f64 (x, v_f64 (1));
+      /* 1/x^2 as (1/x)/x, which does not underflow for tiny x.  */
+      if (v_any_u64 (small))
+	y = vbslq_f64 (
+	    small, vaddq_f64 (y, vdivq_f64 (vdivq_f64 (v_f64 (1), x), x)), y);
+    }
+  if (v_any_u64 (large))
+    {
+      float64x2_t ix = vdivq_f64 (v_f64 (1), x);
+      float64x2_t z = vmulq_f64 (ix, ix);
+      float64x2_t p = vfmaq_f64 (v_f64 (0.5), ix,
+				 v_horner_6_f64 (z, d->trigamma_poly));
+      y = vbslq_f64 (large, vfmaq_f64 (ix, z, p), y);
+    }
+  return y;
+}
+
+/* digamma(x) for any x.  */
+static inline float64x2_t
+v_digamma_inline (float64x2_t x, const struct v_digamma_consts *d)
+{
+  uint64x2_t neg = vcltzq_f64 (x);
+  float64x2_t y = v_digamma_pos (vbslq_f64 (neg, vsubq_f64 (v_f64 (1), x), x),
+				 d);
+  if (unlikely (v_any_u64 (neg)))
+    {
+      /* pi cot(pi x) = pi sin(pi s) / sin(pi r), with r = x - rint(x) and
+	 s = 1/2 - |r|.  digamma is NaN at negative integers, where r is 0,
+	 and for -inf, where r is NaN.  */
+      float64x2_t r = vsubq_f64 (x, vrndaq_f64 (x));
+      float64x2_t s = vsubq_f64 (v_f64 (0.5), vabsq_f64 (r));
+      float64x2_t c = vmulq_f64 (vmulq_f64 (d->pi, s), v_digamma_sinpi (s, d));
+      c = vdivq_f64 (c, vmulq_f64 (r, v_digamma_sinpi (r, d)));
+      float64x2_t yn = vsubq_f64 (y, c);
+      yn = vbslq_f64 (vceqzq_f64 (r), v_f64 (NAN), yn);
+      y = vbslq_f64 (neg, yn, y);
+    }
+  /* The log helper does not handle infinity.  */
+  return vbslq_f64 (vceqq_f64 (x, v_f64 (INFINITY)), x, y);
+}
+
+/* trigamma(x) for any x.  */
+static inline float64x2_t
+v_trigamma_inline (float64x2_t x, const struct v_digamma_consts *d)
+{
+  uint64x2_t neg = vcltzq_f64 (x);
+  float64x2_t y
+      = v_trigamma_pos (vbslq_f64 (neg, vsubq_f64 (v_f64 (1), x), x), d);
+  if (unlikely (v_any_u64 (neg)))
+    {
+      /* pi^2 / sin(pi x)^2, with sin(pi x) = +-sin(pi r), r = x - rint(x).
+	 This is infinity at negative integers, where r is 0, and NaN for
+	 -inf.  */
+      float64x2_t r = vsubq_f64 (x, vrndaq_f64 (x));
+      float64x2_t c
+	  = vdivq_f64 (d->pi, vmulq_f64 (r, v_digamma_sinpi (r, d)));
+      y = vbslq_f64 (neg, vfmaq_f64 (vnegq_f64 (y), c, c), y);
+    }
+  return y;
+}
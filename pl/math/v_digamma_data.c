@@ -0,0 +1,664 @@
+/*
+ * Data for vector digamma and trigamma functions.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "math_config.h"
+
+/* Piecewise polynomial approximations of digamma and trigamma on [0, 8), on
+   intervals of width 1/8.  Below 1 the tables approximate digamma(x + 1) =
+   digamma(x) + 1/x and trigamma(x + 1) = trigamma(x) - 1/x^2 instead, which
+   are smooth at 0.  Each entry {c, clo, f(c), q[0..10]} approximates
+   f(x) ~= f(c) + t * Q(t), with t = (x - c) - clo.  c is the midpoint of the
+   interval, except for the interval containing the positive zero of digamma,
+   where c + clo is the zero and f(c) is 0, so that the relative error stays
+   small close to it.  Polynomial coefficients were computed by Chebyshev
+   interpolation in quad precision.  */
+const struct v_digamma_data __v_digamma_data = {
+  .digamma = {
+    { 0x1p-4, 0x0p+0, -0x1.ea5891bd88d0ep-2, 0x1.81a4be725c51ap+0,
+      -0x1.056a44ad9fa46p+0, 0x1.b77f8ca7a4316p-1, -0x1.8a7b636a38107p-1,
+      0x1.6b4f0a8ad0155p-1, -0x1.52679367853bfp-1, 0x1.3ce04d3fdcbb5p-1,
+      -0x1.2977637d62a24p-1, 0x1.179b9341172ddp-1, -0x1.098356dc8a5ep-1,
+      0x1.f39f886dace88p-2 },
+    { 0x1.8p-3, 0x0p+0, -0x1.385190ecfb6ap-2, 0x1.493e798974dbep+0,
+      -0x1.84f80f326bc95p-1, 0x1.2014cdb67674p-1, -0x1.ca8137d8dbab2p-2,
+      0x1.77c5321f93fe3p-2, -0x1.382717f2b06adp-2, 0x1.05058b1a53fb5p-2,
+      -0x1.b5fbfaec027fp-3, 0x1.701b194363f06p-3, -0x1.3808a1af0d5afp-3,
+      0x1.069e46da41b47p-3 },
+    { 0x1.4p-2, 0x0p+0, -0x1.3da7fe09fcec9p-3, 0x1.1e94ccc16391cp+0,
+      -0x1.2b426f907c829p-1, 0x1.8b56931967c56p-2, -0x1.1a1b680216b0bp-2,
+      0x1.a0084d43b43dbp-3, -0x1.3798006d3e484p-3, 0x1.d674644933e4bp-4,
+      -0x1.64a213392fd0ap-4, 0x1.0ef667100c0dp-4, -0x1.9ed5e0e94deeap-5,
+      0x1.3bca7d733a862p-5 },
+    { 0x1.cp-2, 0x0p+0, -0x1.82e261cfb4d1bp-6, 0x1.faa0205f510bap-1,
+      -0x1.d927d475b5d54p-2, 0x1.1992b6aaf1aeep-2, -0x1.6bbdec431f576p-3,
+      0x1.e705c4511f589p-4, -0x1.4bd3a0f1d050ap-4, 0x1.c85aa2f3da055p-5,
+      -0x1.3b61819cc6277p-5, 0x1.b5235e7be999ap-6, -0x1.3103df0e3a8f2p-6,
+      0x1.a7d4cbff66f84p-7 },
+    { 0x1.2p-1, 0x0p+0, 0x1.7e5e39fac1c1bp-4, 0x1.c56ff90b35b22p-1,
+      -0x1.7e8251ce09d71p-2, 0x1.9db2d7b284ba5p-3, -0x1.e798bf7d23d53p-4,
+      0x1.2aa27e890006dp-4, -0x1.74faa9ae00119p-5, 0x1.d6b9aab389878p-6,
+      -0x1.2ac91a8334234p-6, 0x1.7c9486b11696fp-7, -0x1.e7dccd02e2717p-8,
+      0x1.37af938236566p-8 },
+    { 0x1.6p-1, 0x0p+0, 0x1.96b3b8a15e1b1p-3, 0x1.9a098b5f5bbf4p-1,
+      -0x1.3b106b01e8d3p-2, 0x1.37ef0709791ap-3, -0x1.51baa36e08291p-4,
+      0x1.7cf18b574ca36p-5, -0x1.b6db8bb384175p-6, 0x1.ff7e287243784p-7,
+      -0x1.2c12166b7d19ap-7, 0x1.6177b6747293bp-8, -0x1.a2ed20c523c49p-9,
+      0x1.ef5bf43bad11fp-10 },
+    { 0x1.ap-1, 0x0p+0, 0x1.2d390b2bcb34dp-2, 0x1.7601b5781c867p-1,
+      -0x1.07a736093528ap-2, 0x1.e0f78d68f7c03p-4, -0x1.e12fc276544dap-5,
+      0x1.f69da48b151f4p-6, -0x1.0c84d3d507778p-6, 0x1.22971baccc53fp-7,
+      -0x1.3cd5b3f43dde4p-8, 0x1.5b02e1a605bddp-9, -0x1.7e5beed99b117p-10,
+      0x1.a49dba4db9bcep-11 },
+    { 0x1.ep-1, 0x0p+0, 0x1.86d373297a939p-2, 0x1.57a6a74a1ce54p-1,
+      -0x1.bf49ba0bacb82p-3, 0x1.79f613f31b283p-4, -0x1.5f38da685f875p-5,
+      0x1.5568f0f5f7c7ap-6, -0x1.53f6d69cb7e81p-7, 0x1.573a29bee1bc8p-8,
+      -0x1.5d637d2d1e9e7p-9, 0x1.6577c7e5a10b4p-10, -0x1.6ff16af96785ap-11,
+      0x1.7a67b55c30476p-12 },
+    { 0x1.1p+0, 0x0p+0, -0x1.ea5891bd88d0ep-2, 0x1.81a4be725c51ap+0,
+      -0x1.056a44ad9fa46p+0, 0x1.b77f8ca7a4316p-1, -0x1.8a7b636a38107p-1,
+      0x1.6b4f0a8ad0155p-1, -0x1.52679367853bfp-1, 0x1.3ce04d3fdcbb5p-1,
+      -0x1.2977637d62a24p-1, 0x1.179b9341172ddp-1, -0x1.098356dc8a5ep-1,
+      0x1.f39f886dace88p-2 },
+    { 0x1.3p+0, 0x0p+0, -0x1.385190ecfb6ap-2, 0x1.493e798974dbep+0,
+      -0x1.84f80f326bc95p-1, 0x1.2014cdb67674p-1, -0x1.ca8137d8dbab2p-2,
+      0x1.77c5321f93fe3p-2, -0x1.382717f2b06adp-2, 0x1.05058b1a53fb5p-2,
+      -0x1.b5fbfaec027fp-3, 0x1.701b194363f06p-3, -0x1.3808a1af0d5afp-3,
+      0x1.069e46da41b47p-3 },
+    { 0x1.5p+0, 0x0p+0, -0x1.3da7fe09fcec9p-3, 0x1.1e94ccc16391cp+0,
+      -0x1.2b426f907c829p-1, 0x1.8b56931967c56p-2, -0x1.1a1b680216b0bp-2,
+      0x1.a0084d43b43dbp-3, -0x1.3798006d3e484p-3, 0x1.d674644933e4bp-4,
+      -0x1.64a213392fd0ap-4, 0x1.0ef667100c0dp-4, -0x1.9ed5e0e94deeap-5,
+      0x1.3bca7d733a862p-5 },
+    { 0x1.762d86356be3fp+0, 0x1.b86a722197829p-54, 0x0p+0,
+      0x1.ef72bc8ee38acp-1, -0x1.c563b54aa1a35p-2, 0x1.08b4294d502eep-2,
+      -0x1.4fc131725a01p-3, 0x1.b9a5b6388df9fp-4, -0x1.27bab9fb1b063p-4,
+      0x1.8fcdfa01f0e6fp-5, -0x1.0fa933519c06ap-5, 0x1.723ea26b2eef9p-6,
+      -0x1.f360f95c3a955p-7, 0x1.a0d6cfcc9a6ddp-7 },
+    { 0x1.9p+0, 0x0p+0, 0x1.7e5e39fac1c1bp-4, 0x1.c56ff90b35b22p-1,
+      -0x1.7e8251ce09d71p-2, 0x1.9db2d7b284ba5p-3, -0x1.e798bf7d23d53p-4,
+      0x1.2aa27e890006dp-4, -0x1.74faa9ae00119p-5, 0x1.d6b9aab389878p-6,
+      -0x1.2ac91a8334234p-6, 0x1.7c9486b11696fp-7, -0x1.e7dccd02e2717p-8,
+      0x1.37af938236566p-8 },
+    { 0x1.bp+0, 0x0p+0, 0x1.96b3b8a15e1b1p-3, 0x1.9a098b5f5bbf4p-1,
+      -0x1.3b106b01e8d3p-2, 0x1.37ef0709791ap-3, -0x1.51baa36e08291p-4,
+      0x1.7cf18b574ca36p-5, -0x1.b6db8bb384175p-6, 0x1.ff7e287243784p-7,
+      -0x1.2c12166b7d19ap-7, 0x1.6177b6747293bp-8, -0x1.a2ed20c523c49p-9,
+      0x1.ef5bf43bad116p-10 },
+    { 0x1.dp+0, 0x0p+0, 0x1.2d390b2bcb34dp-2, 0x1.7601b5781c867p-1,
+      -0x1.07a736093528ap-2, 0x1.e0f78d68f7c03p-4, -0x1.e12fc276544dap-5,
+      0x1.f69da48b151f4p-6, -0x1.0c84d3d507778p-6, 0x1.22971baccc53fp-7,
+      -0x1.3cd5b3f43dde4p-8, 0x1.5b02e1a605bddp-9, -0x1.7e5beed99b117p-10,
+      0x1.a49dba4db9bb3p-11 },
+    { 0x1.fp+0, 0x0p+0, 0x1.86d373297a939p-2, 0x1.57a6a74a1ce54p-1,
+      -0x1.bf49ba0bacb82p-3, 0x1.79f613f31b283p-4, -0x1.5f38da685f875p-5,
+      0x1.5568f0f5f7c7ap-6, -0x1.53f6d69cb7e81p-7, 0x1.573a29bee1bc8p-8,
+      -0x1.5d637d2d1e9e7p-9, 0x1.6577c7e5a10b4p-10, -0x1.6ff16af96785ap-11,
+      0x1.7a67b55c30464p-12 },
+    { 0x1.08p+1, 0x0p+0, 0x1.d96b32063af2ep-2, 0x1.3dc02fd3e40afp-1,
+      -0x1.7fe3d61e9171bp-3, 0x1.2dff93b893104p-4, -0x1.05da51e96086cp-5,
+      0x1.dbd2186fc6ea2p-7, -0x1.bb6dc7c0b936p-8, 0x1.a363fc181a3cfp-9,
+      -0x1.903ab3597427bp-10, 0x1.8017be6ad7e1ep-11, -0x1.72db749792a71p-12,
+      0x1.66015f584c6a5p-13 },
+    { 0x1.18p+1, 0x0p+0, 0x1.12ffa3539d3d8p-1, 0x1.27686268b813fp-1,
+      -0x1.4cde557eecfbp-3, 0x1.e9b23c1abe46p-5, -0x1.8dcbb4a24fdadp-6,
+      0x1.531fe4152babep-7, -0x1.28e38ad22a837p-8, 0x1.0804cd5c2845ep-9,
+      -0x1.da2245836655p-11, 0x1.ac5a49a7b2951p-12, -0x1.856653e3ae9d5p-13,
+      0x1.6235a2ff03dbdp-14 },
+    { 0x1.28p+1, 0x0p+0, 0x1.36ae620399266p-1, 0x1.13f273c746d92p-1,
+      -0x1.233d1a806b0ebp-3, 0x1.922c8d58dfbeap-5, -0x1.3330564ef948ap-6,
+      0x1.ed27a2e8fd44ap-8, -0x1.96f0c3d33af6ap-9, 0x1.5563379eab1afp-10,
+      -0x1.215cc6969051bp-11, 0x1.edcbdd9bb0225p-13, -0x1.a80498e67d1f2p-14,
+      0x1.6cfc834b1c59fp-15 },
+    { 0x1.38p+1, 0x0p+0, 0x1.58157282346fbp-1, 0x1.02da32c301ae4p-1,
+      -0x1.00dafd7b40e94p-3, 0x1.4e1968fe0b5d1p-5, -0x1.e179c33923b75p-7,
+      0x1.6d07651bf34afp-8, -0x1.1cc65b87e9cf6p-9, 0x1.c41324c0a4504p-11,
+      -0x1.6ac5260a3212dp-12, 0x1.252fc59c46c5cp-13, -0x1.dd0005757543fp-15,
+      0x1.843b2397a1d37p-16 },
+    { 0x1.48p+1, 0x0p+0, 0x1.7779dbba397fep-1, 0x1.e771c364a7316p-2,
+      -0x1.c84b5f0aabf8ep-4, 0x1.1867a63defda9p-5, -0x1.7e560efd552a8p-7,
+      0x1.128e676232257p-8, -0x1.961e24c0858d7p-10, 0x1.31d021ef07196p-11,
+      -0x1.d1e309e2297ddp-13, 0x1.6592ace809d8ep-14, -0x1.14498df08030bp-15,
+      0x1.aaf0e959ab549p-17 },
+    { 0x1.58p+1, 0x0p+0, 0x1.95153a026a7d5p-1, 0x1.cc7b08b2c6f2p-2,
+      -0x1.97e2ba2439b32p-4, 0x1.db08f1731a5c5p-6, -0x1.333e42bb5473bp-7,
+      0x1.a3087ae460541p-9, -0x1.26890c23cba42p-10, 0x1.a5d8c495a6062p-12,
+      -0x1.31bf943f648e6p-13, 0x1.bec3ae981aecap-15, -0x1.48ac55e19d979p-16,
+      0x1.e50e315e5faa7p-18 },
+    { 0x1.68p+1, 0x0p+0, 0x1.b1181ba78d53dp-1, 0x1.b44ee8a7c698ap-2,
+      -0x1.6eb634357fc51p-4, 0x1.95bde655e5ec3p-6, -0x1.f3251e0f6872dp-8,
+      0x1.43fdbd05a949ep-9, -0x1.b1d9958485cd2p-11, 0x1.282043a4df547p-12,
+      -0x1.9956781b33d44p-14, 0x1.1d518a2d18868p-15, -0x1.908c42635f594p-17,
+      0x1.0fc6332edcde6p-18 },
+    { 0x1.78p+1, 0x0p+0, 0x1.cbabca18de52p-1, 0x1.9e84fb773077bp-2,
+      -0x1.4b697e2dfbdep-4, 0x1.5d2f1a4dbbf6ep-6, -0x1.9971bfa8cbea1p-8,
+      0x1.fb08b55af2788p-10, -0x1.440c0428dd05fp-11, 0x1.a67c24576cfdfp-13,
+      -0x1.17034173160c3p-14, 0x1.73c4e360c9cf9p-16, -0x1.f3067f8fcc9a7p-18,
+      0x1.57b61128e9e5p-19 },
+    { 0x1.88p+1, 0x0p+0, 0x1.e4f3a886fe71bp-1, 0x1.8ac8128cbf633p-2,
+      -0x1.2cede065cc338p-4, 0x1.2e95f9dbd2adep-6, -0x1.52e16e46389d8p-8,
+      0x1.911a35e181b49p-10, -0x1.ea53a70f594fap-12, 0x1.31da1a0bf865ep-13,
+      -0x1.82b7b0fc360fep-15, 0x1.ed7169c425eb7p-17, -0x1.3d34faa153d26p-18,
+      0x1.a5d38a5a7d369p-20 },
+    { 0x1.98p+1, 0x0p+0, 0x1.fd0e443dabde7p-1, 0x1.78d205cf8eaacp-2,
+      -0x1.126e80ebc89c1p-4, 0x1.07dcdad29ea5ap-6, -0x1.1ac92075610ddp-8,
+      0x1.407faf25f653bp-10, -0x1.775e43c7b108dp-12, 0x1.c0de66afe628dp-14,
+      -0x1.101d7b8488947p-15, 0x1.4d14fa88833b7p-17, -0x1.9ad7263df54f2p-19,
+      0x1.eeb5a7306344p-21 },
+    { 0x1.a8p+1, 0x0p+0, 0x1.0a0b1554d37e7p+0, 0x1.68688d0cc6eafp-2,
+      -0x1.f6847d02722f2p-5, 0x1.cedbd9b7dc4e5p-7, -0x1.db85898642b5bp-9,
+      0x1.02777cfc97ed9p-10, -0x1.2280d4bae5ff5p-12, 0x1.4d8445c563b81p-14,
+      -0x1.845f45dd9d767p-16, 0x1.c8b11610a86d7p-18, -0x1.0eaa5d61e7aep-19,
+      0x1.4f20fce4b7a29p-21 },
+    { 0x1.b8p+1, 0x0p+0, 0x1.151149aa20c84p+0, 0x1.595adb010c482p-2,
+      -0x1.cdc2ccd6277c5p-5, 0x1.98221855f21ddp-7, -0x1.929906ee065e7p-9,
+      0x1.a472ea933f45dp-11, -0x1.c630cee3297fp-13, 0x1.f55ebf52710b7p-15,
+      -0x1.18c74dadea406p-16, 0x1.3db3e419f6962p-18, -0x1.6a59c3a97c1bfp-20,
+      0x1.7de16ffa3feddp-22 },
+    { 0x1.c8p+1, 0x0p+0, 0x1.1fa3f41b8d23ep+0, 0x1.4b7fc62268251p-2,
+      -0x1.a9bc3d46869f8p-5, 0x1.69a72d8f726dp-7, -0x1.570e36a3b0ea6p-9,
+      0x1.58ae83efc0f5dp-11, -0x1.66606c0194c59p-13, 0x1.7ce804152b67cp-15,
+      -0x1.9aea66268ee02p-17, 0x1.bfe061d6faaafp-19, -0x1.ec4f0b6fa0639p-21,
+      0x1.2ff746106222fp-22 },
+    { 0x1.d8p+1, 0x0p+0, 0x1.29cc1a0729567p+0, 0x1.3eb45a8631f84p-2,
+      -0x1.89bd79b7d5b45p-5, 0x1.41ee326e3826ep-7, -0x1.261151abd9f7p-9,
+      0x1.1ca54ee8a4ba2p-11, -0x1.1d3b8fbd1fde5p-13, 0x1.2447e6508d75dp-15,
+      -0x1.3014a4ed6f66dp-17, 0x1.3fc9561cf5211p-19, -0x1.531111e2d9033p-21,
+      0x1.2c6eae2480e5dp-23 },
+    { 0x1.e8p+1, 0x0p+0, 0x1.3391be2ecc5a4p+0, 0x1.32dabaa37a3d2p-2,
+      -0x1.6d3301f85f3bdp-5, 0x1.1fc973db42e09p-7, -0x1.faf431a833083p-10,
+      0x1.d9599a8bdfa6dp-12, -0x1.c9b57c4878bb8p-14, 0x1.c4bb71010c595p-16,
+      -0x1.c6c820fc44734p-18, 0x1.ce142529a2ab3p-20, -0x1.d913d41ab3b9ep-22,
+      0x1.2000e10abd346p-25 },
+    { 0x1.f8p+1, 0x0p+0, 0x1.3cfc05babb6a6p+0, 0x1.27d93be6717b4p-2,
+      -0x1.53a2a664d45e4p-5, 0x1.0247f60421a49p-7, -0x1.b73e289a19237p-10,
+      0x1.8c16cd33d40a9p-12, -0x1.72037d8f106f9p-14, 0x1.61af3ebe3aa44p-16,
+      -0x1.576e0634bd0b1p-18, 0x1.5103beb4dcf47p-20, -0x1.4e0242fbc5c77p-22,
+      0x1.34e5f8647fe74p-23 },
+    { 0x1.04p+2, 0x0p+0, 0x1.461156e03b4dcp+0, 0x1.1d99b118d9674p-2,
+      -0x1.3ca68387f1429p-5, 0x1.d14f71318133bp-8, -0x1.7e6aff500514cp-10,
+      0x1.4d6a8199d9092p-12, -0x1.2d3be2dca0e96p-14, 0x1.168e8df42a6bbp-16,
+      -0x1.05baef8c640ap-18, 0x1.f16cd44ec2dcep-21, -0x1.dcf95d0225539p-23,
+      0x1.f8c6f27acd346p-25 },
+    { 0x1.0cp+2, 0x0p+0, 0x1.4ed7726f263f9p+0, 0x1.1408d83d985p-2,
+      -0x1.27e91c04d69aap-5, 0x1.a496d0207e104p-8, -0x1.4e740f6ea1b12p-10,
+      0x1.1a3a6943ee1ebp-12, -0x1.edba15e076b87p-15, 0x1.ba205710268c3p-17,
+      -0x1.926115f78049ap-19, 0x1.72ae80d714212p-21, -0x1.582dec7343b8p-23,
+      -0x1.62cd6a0f9e8bap-31 },
+    { 0x1.14p+2, 0x0p+0, 0x1.5753894181617p+0, 0x1.0b15e4159dff7p-2,
+      -0x1.15224a603fa92p-5, 0x1.7d651c2b9f325p-8, -0x1.25bf7e330af72p-10,
+      0x1.e04dd2856e2dfp-13, -0x1.97211cee62191p-15, 0x1.6163f22325ee5p-17,
+      -0x1.37d11905cb8aep-19, 0x1.164e751deada4p-21, -0x1.f5ab06db73a57p-24,
+      0x1.5920d3f872cbap-25 },
+    { 0x1.1cp+2, 0x0p+0, 0x1.5f8a4e51b112cp+0, 0x1.02b21b67f4abap-2,
+      -0x1.0414d714c6a51p-5, 0x1.5ae7313da11dp-8, -0x1.0307008ef1d73p-10,
+      0x1.9ab6994f03c87p-13, -0x1.51af5fa09c4efp-15, 0x1.1c5f3bf551fd5p-17,
+      -0x1.e6f80aa50f457p-20, 0x1.a60dada535c09p-22, -0x1.710be3e383d7dp-24,
+      0x1.6556545db3p-27 },
+    { 0x1.24p+2, 0x0p+0, 0x1.6780061291a1ap+0, 0x1.f5a113159dc87p-3,
+      -0x1.e91919935875ap-6, 0x1.3c6e7df48ea27p-8, -0x1.ca8a005c9ac2fp-11,
+      0x1.60d64c2875e3ap-13, -0x1.19a16422201e2p-15, 0x1.cc94c5a533e93p-18,
+      -0x1.7efecd662fa47p-20, 0x1.426172a9697f2p-22, -0x1.11e48df7a2be3p-24,
+      0x1.8a3a60c28a2e9p-27 },
+    { 0x1.2cp+2, 0x0p+0, 0x1.6f389384fdf2bp+0, 0x1.e6cb7967e0724p-3,
+      -0x1.ccb95c58dc3c9p-6, 0x1.2169db007133cp-8, -0x1.974cc928e7a4cp-11,
+      0x1.3071fd3c1579dp-13, -0x1.d834e9833a3cap-16, 0x1.773b4f09e051ap-18,
+      -0x1.2f45f2712838bp-20, 0x1.f11b5559f3d7dp-23, -0x1.99f4597f30ea9p-25,
+      -0x1.c0d2de8d56p-26 },
+    { 0x1.34p+2, 0x0p+0, 0x1.76b7836dbfc33p+0, 0x1.d8cf1eba77d06p-3,
+      -0x1.b2bd6fe754285p-6, 0x1.095ff0115d8f9p-8, -0x1.6aff89d444163p-11,
+      0x1.07c74cb70e8bfp-13, -0x1.8dd1f0567d2e3p-16, 0x1.336fde4f43dd2p-18,
+      -0x1.e362f6f3d3278p-21, 0x1.825c821d4a0afp-23, -0x1.353cfa7306ce3p-25,
+      -0x1.0a7c36db9dda3p-24 },
+    { 0x1.3cp+2, 0x0p+0, 0x1.7e0015fbbf7aap+0, 0x1.cb99f540a9f1fp-3,
+      -0x1.9ae2bd73df8eap-6, 0x1.e7d59045c940ep-9, -0x1.448a41294952ap-11,
+      0x1.cae12c98f44b8p-14, -0x1.50b6906dff035p-16, 0x1.fa7f286a4093dp-19,
+      -0x1.83962db816e1ep-21, 0x1.2c3fc80f1992bp-23, -0x1.d60a3d78117bap-26,
+      0x1.3f4a4d4a1ba2fp-27 },
+    { 0x1.44p+2, 0x0p+0, 0x1.8515471f3f3ep+0, 0x1.bf1bdfbd7bca1p-3,
+      -0x1.84ef78622b58fp-6, 0x1.c1689e18bd244p-9, -0x1.2306f6766b61bp-11,
+      0x1.90a01db6cb9fcp-14, -0x1.1e405f71caef1p-16, 0x1.a35a87a1eb03p-19,
+      -0x1.3892b194d2fbdp-21, 0x1.d6a3d69aca938p-24, -0x1.67c76de48c3d1p-26,
+      0x1.0f83df973a22fp-25 },
+    { 0x1.4cp+2, 0x0p+0, 0x1.8bf9d5c707ae5p+0, 0x1.b34670c7d601cp-3,
+      -0x1.70b144128d75dp-6, 0x1.9ee7077bf8c9bp-9, -0x1.05b7ca11c9bf5p-11,
+      0x1.5effeff60fafep-14, -0x1.e8bedef4a3d52p-17, 0x1.5ce34648556b1p-19,
+      -0x1.faedeac161bd8p-22, 0x1.778e5bde81a5cp-24, -0x1.15404b4c4ab06p-26,
+      -0x1.bc8d181a49b74p-25 },
+    { 0x1.54p+2, 0x0p+0, 0x1.92b04a2ef4653p+0, 0x1.a80cb3e5c363ap-3,
+      -0x1.5dfc161a859dcp-6, 0x1.7fd46eca4dc83p-9, -0x1.d7fe5dce234e9p-12,
+      0x1.348d2b8a9d2a6p-14, -0x1.a2e7bedaa3e4cp-17, 0x1.239a51f6ed7edp-19,
+      -0x1.9d381ad47caa9p-22, 0x1.25fbaa5a0c9a5p-24, -0x1.ae10fc597ac2fp-27,
+      0x1.f8d5f35f5fd74p-25 },
+    { 0x1.5cp+2, 0x0p+0, 0x1.993afb63b848dp+0, 0x1.9d62fecc414c5p-3,
+      -0x1.4ca9492dc6e71p-6, 0x1.63c676579bab8p-9, -0x1.aab395d03d584p-12,
+      0x1.1019e2ea129b4p-14, -0x1.68683353a7702p-17, 0x1.e9963db81904ep-20,
+      -0x1.5282bfbb5f78p-22, 0x1.d96156f02c703p-25, -0x1.4f9b39d4e3817p-27,
+      0x1.80a1c65012e8cp-27 },
+    { 0x1.64p+2, 0x0p+0, 0x1.9f9c141995236p+0, 0x1.933ec9647f16p-3,
+      -0x1.3c96d77c573ccp-6, 0x1.4a61caa83ab06p-9, -0x1.82b33a245e963p-12,
+      0x1.e15ed7f093081p-15, -0x1.3732d992330aep-17, 0x1.9cb7a9c1d9edap-20,
+      -0x1.16a073f20045fp-22, 0x1.793d8bfa657c6p-25, -0x1.076df6d76dca3p-27,
+      0x1.7a85a7d09f774p-25 },
+    { 0x1.6cp+2, 0x0p+0, 0x1.a5d596eece294p+0, 0x1.89968b794311ap-3,
+      -0x1.2da6b535ad833p-6, 0x1.3357b779bf093p-9, -0x1.5f443f7fa7678p-12,
+      0x1.ab068d22f6537p-15, -0x1.0da2a6d244d39p-17, 0x1.5d4e4ee1bbdbcp-20,
+      -0x1.ccc0a9625891ep-23, 0x1.34723f857f50cp-25, -0x1.9fddc00fd255dp-28,
+      -0x1.38bd35e0708bap-28 },
+    { 0x1.74p+2, 0x0p+0, 0x1.abe9622e948aap+0, 0x1.80619f2379d7fp-3,
+      -0x1.1fbe455d5e2e3p-6, 0x1.1e642bb514ecfp-9, -0x1.3fca5f69f23cdp-12,
+      0x1.7bdcdc03399f6p-15, -0x1.d4c8da89ed176p-18, 0x1.28c3b08fd584p-20,
+      -0x1.7e9ce87895deap-23, 0x1.010be153b7884p-25, -0x1.4a0332210c146p-28,
+      -0x1.465f7cbae422fp-24 },
+    { 0x1.7cp+2, 0x0p+0, 0x1.b1d93325dfe25p+0, 0x1.77982736bcbb5p-3,
+      -0x1.12c5e446a0059p-6, 0x1.0b4c16779ca3cp-9, -0x1.23c11af113454p-12,
+      0x1.52cd092f47d33p-15, -0x1.98cb2b04fce63p-18, 0x1.fa1825b59e3dep-21,
+      -0x1.3f0a7a9a29869p-23, 0x1.9347d6d592a59p-26, -0x1.07392890dbf2fp-28,
+      0x1.a4e2514d8522fp-26 },
+    { 0x1.84p+2, 0x0p+0, 0x1.b7a6a918ed11cp+0, 0x1.6f32f91029e3cp-3,
+      -0x1.06a883f4a071bp-6, 0x1.f3b8181351804p-10, -0x1.0ab7b0c85e0c3p-12,
+      0x1.2ef0d93a8dbf5p-15, -0x1.658d86f14957bp-18, 0x1.b10b340d8215cp-21,
+      -0x1.0b160b257a205p-23, 0x1.4de5c9933eb2fp-26, -0x1.a5f5c3d966974p-29,
+      0x1.95145ffe0a2e9p-31 },
+    { 0x1.8cp+2, 0x0p+0, 0x1.bd5347e5df95bp+0, 0x1.672b8944fe408p-3,
+      -0x1.f6a6aeaa376f6p-7, 0x1.d3ce4a5f70d3bp-10, -0x1.e89ba8e6c3231p-13,
+      0x1.0f87f913fa02dp-15, -0x1.39a2e7ca14941p-18, 0x1.73c6609697919p-21,
+      -0x1.c0e1cfded6302p-24, 0x1.1de0a24988925p-26, -0x1.53ccbff940e5dp-29,
+      -0x1.02741638768e9p-24 },
+    { 0x1.94p+2, 0x0p+0, 0x1.c2e07a5f24956p+0, 0x1.5f7bdac459b1bp-3,
+      -0x1.e16b13b8516bdp-7, 0x1.b68c1c1808453p-10, -0x1.c061fea471d81p-13,
+      0x1.e7e240492f9edp-16, -0x1.13dfbb89dc1b8p-18, 0x1.4033548b4093bp-21,
+      -0x1.7a955f00965cdp-24, 0x1.b77b5f3e16287p-27, -0x1.12dea0c2aa917p-29,
+      0x1.4f5372ce7b8p-25 },
+    { 0x1.9cp+2, 0x0p+0, 0x1.c84f9466a9926p+0, 0x1.581e70117d328p-3,
+      -0x1.cd8002f8324a3p-7, 0x1.9bac77e22f39dp-10, -0x1.9c3479e59500fp-13,
+      0x1.b749194ba0249p-16, -0x1.e69a4279eae21p-19, 0x1.14a0596e47d48p-21,
+      -0x1.4068ebb3e673cp-24, 0x1.7274adb8d4d9p-27, -0x1.be9dac4bd4dd1p-30,
+      0x1.12767728e64bap-26 },
+    { 0x1.a4p+2, 0x0p+0, 0x1.cda1d4d1ac264p+0, 0x1.510e3e4a7ac16p-3,
+      -0x1.baca52a2573b3p-7, 0x1.82f286727c37cp-10, -0x1.7b98b531c422bp-13,
+      0x1.8c5f215eb9175p-16, -0x1.ae3da7b4dd163p-19, 0x1.df603915af842p-22,
+      -0x1.1015d0f539119p-24, 0x1.30ea5a697de06p-27, -0x1.6c581d32689d1p-30,
+      0x1.831f153c349d1p-26 },
+    { 0x1.acp+2, 0x0p+0, 0x1.d2d8671bd0f97p+0, 0x1.4a46a1bb5b3e6p-3,
+      -0x1.a93187470cbf7p-7, 0x1.6c288f1a726e5p-10, -0x1.5e24cdfb062b1p-13,
+      0x1.6661eea472bp-16, -0x1.7d5652aa74c5p-19, 0x1.a08ad4a1d7de6p-22,
+      -0x1.cf969c6fecde7p-25, 0x1.f4bf08c48367fp-28, -0x1.2a6a33a48b0bap-30,
+      0x1.0636ea8fa1cbap-25 },
+    { 0x1.b4p+2, 0x0p+0, 0x1.d7f464ef44b6bp+0, 0x1.43c353c7b0a91p-3,
+      -0x1.989f843cb3995p-7, 0x1.571f04280d46dp-10, -0x1.437ce662e0ee3p-13,
+      0x1.44ac2b077c41ep-16, -0x1.52c96120b6621p-19, 0x1.6aed758fd32a6p-22,
+      -0x1.8c2a07fcc0fcdp-25, 0x1.e36c1bb93ec9fp-28, -0x1.eab5a1d7d9517p-31,
+      -0x1.04bab07ea5c17p-24 },
+    { 0x1.bcp+2, 0x0p+0, 0x1.dcf6d786e2943p+0, 0x1.3d8061fcc945p-3,
+      -0x1.89004698293d6p-7, 0x1.43abb3ba8e6d5p-10, -0x1.2b51113a2d7a5p-13,
+      0x1.26b0c8ba6fa73p-16, -0x1.2daa28b5f69f8p-19, 0x1.3d0ce6737b911p-22,
+      -0x1.538e9cc635d3bp-25, 0x1.671ee748abf32p-28, -0x1.94f35ee061f46p-31,
+      0x1.c5b6bf385f3a3p-27 },
+    { 0x1.c4p+2, 0x0p+0, 0x1.e1e0b8eeb301ep+0, 0x1.377a26259389dp-3,
+      -0x1.7a41a91f204a7p-7, 0x1.31a9170897f7ep-10, -0x1.155b94f9586d2p-13,
+      0x1.0bf713544bde7p-16, -0x1.0d31fc8ec3895p-19, 0x1.15ab08fb41bc8p-22,
+      -0x1.23e02130988f7p-25, 0x1.504b4cc555129p-28, -0x1.4f5ed9f69p-31,
+      -0x1.23d173e3218bap-25 },
+    { 0x1.ccp+2, 0x0p+0, 0x1.e6b2f52685146p+0, 0x1.31ad3f3efc51bp-3,
+      -0x1.6c532fe5abf8fp-7, 0x1.20f5bb286ef02p-10, -0x1.015f763309189p-13,
+      0x1.e82ee51380c18p-17, -0x1.e1730f5871745p-20, 0x1.e78b7ec1e8378p-23,
+      -0x1.f72b86a7bea19p-26, 0x1.16245696298f9p-28, -0x1.16b342eb378p-31,
+      -0x1.5752ac8516dd1p-26 },
+    { 0x1.d4p+2, 0x0p+0, 0x1.eb6e6b29ea495p+0, 0x1.2c168b305c9afp-3,
+      -0x1.5f25da7e0cc2ap-7, 0x1.1173bf4a62adap-10, -0x1.de4e79fb35d5fp-14,
+      0x1.bd7179db20ff5p-17, -0x1.af66d15bdd522p-20, 0x1.ad0938bc2914dp-23,
+      -0x1.b2df3c8206041p-26, 0x1.b85c87d5a63bp-29, -0x1.d0bf5876f4d17p-32,
+      0x1.3c8910f1562e9p-28 },
+    { 0x1.dcp+2, 0x0p+0, 0x1.f013ede072e46p+0, 0x1.26b3212f94692p-3,
+      -0x1.52abfbce2b5d3p-7, 0x1.03086509eaf8cp-10, -0x1.bd07d65aa8203p-14,
+      0x1.971bff15a3adfp-17, -0x1.834f9bf219ba9p-20, 0x1.7a68aec70637dp-23,
+      -0x1.78d071c6a6142p-26, 0x1.140beb16cccc6p-29, -0x1.84bc428a7c5d1p-32,
+      0x1.305fe0088c6e9p-24 },
+    { 0x1.e4p+2, 0x0p+0, 0x1.f4a444f8ae966p+0, 0x1.21804cbbd6de7p-3,
+      -0x1.46d916c2e9cb3p-7, 0x1.eb37601990f7ap-11, -0x1.9e9836385f795p-14,
+      0x1.74a949d9d9143p-17, -0x1.5c61be7a98869p-20, 0x1.4e79f380219f9p-23,
+      -0x1.47522dc4c0b34p-26, 0x1.385a7a40079f3p-29, -0x1.46291179d45d1p-32,
+      0x1.25d56e89f1ba3p-27 },
+    { 0x1.ecp+2, 0x0p+0, 0x1.f9202db0271afp+0, 0x1.1c7b891d0c224p-3,
+      -0x1.3ba1bf37f48f5p-7, 0x1.d230253e3cee2p-11, -0x1.82b6807da3276p-14,
+      0x1.55a5d45b10823p-17, -0x1.39ef983fae10cp-20, 0x1.28458dd44853p-23,
+      -0x1.1d0356d74fe5dp-26, 0x1.2f3bc8d085da1p-29, -0x1.1279bbb210746p-32,
+      -0x1.23874e8e0e8bap-26 },
+    { 0x1.f4p+2, 0x0p+0, 0x1.fd885b8a470ffp+0, 0x1.17a27d581ea2ep-3,
+      -0x1.30fb7e842b527p-7, 0x1.bad44abae3e1fp-11, -0x1.692207fa59bc9p-14,
+      0x1.39ad288130988p-17, -0x1.1b64c06d6016fp-20, 0x1.06f6a49c6b183p-23,
+      -0x1.f1809d679ec4ap-27, 0x1.6559975a44c93p-29, -0x1.cf4bbc8211174p-33,
+      -0x1.590a9a07456p-24 },
+    { 0x1.fcp+2, 0x0p+0, 0x1.00eebc7bf2715p+1, 0x1.12f2f88a9d18bp-3,
+      -0x1.26dcbb2ffab6fp-7, 0x1.a500d09be6999p-11, -0x1.51a17480cbab4p-14,
+      0x1.2067b41abc433p-17, -0x1.00420610518ccp-20, 0x1.d3c067b199e4fp-24,
+      -0x1.b32eedd430808p-27, 0x1.40f7f18498791p-30, -0x1.88192a2298ba3p-33,
+      0x1.0565d5bd80a5dp-25 },
+  },
+  .trigamma = {
+    { 0x1p-4, 0x0p+0, 0x1.81a4be725c51ap+0, -0x1.056a44ad9fa31p+1,
+      0x1.499fa97dbb2afp+1, -0x1.8a7b636a6a974p+1, 0x1.c622cd2d24d51p+1,
+      -0x1.fb9b5b72b0b63p+1, 0x1.1544445ffbfddp+2, -0x1.2979eaafc4797p+2,
+      0x1.3a8dd4b2ff7c9p+2, -0x1.48baf9ff54d21p+2, 0x1.58162cf4afae2p+2,
+      -0x1.612d011d1168ap+2 },
+    { 0x1.8p-3, 0x0p+0, 0x1.493e798974dbep+0, -0x1.84f80f326bc8bp+0,
+      0x1.b01f3491b1b08p+0, -0x1.ca8137d8f36d1p+0, 0x1.d5b67ea750ff2p+0,
+      -0x1.d43aa324683d4p+0, 0x1.c8c9b41624b3dp+0, -0x1.b5fe5b759b602p+0,
+      0x1.9e1d7c3c5af2ep+0, -0x1.8311f748e8a6dp+0, 0x1.6999bfeedc85cp+0,
+      -0x1.4c0ca7a9a9a34p+0 },
+    { 0x1.4p-2, 0x0p+0, 0x1.1e94ccc16391cp+0, -0x1.2b426f907c826p+0,
+      0x1.2880ee530dd4ap+0, -0x1.1a1b68021d267p+0, 0x1.0405304a46d8p+0,
+      -0x1.d36400374e80dp-1, 0x1.9ba5d812881fep-1, -0x1.64a35e22a0619p-1,
+      0x1.30d4b62e8844ap-1, -0x1.01a7f77ff8c09p-1, 0x1.b2b43cf741ba3p-2,
+      -0x1.6919f7d5ab593p-2 },
+    { 0x1.cp-2, 0x0p+0, 0x1.faa0205f510bap-1, -0x1.d927d475b5d53p-1,
+      0x1.a65c12006a86ap-1, -0x1.6bbdec43234c6p-1, 0x1.30639ab2ae12fp-1,
+      -0x1.f1bd71283a6eap-2, 0x1.8f4f4ec3b3c4cp-2, -0x1.3b624c4a4c7fcp-2,
+      0x1.ebc73d1beb71ap-3, -0x1.7b4a13611c605p-3, 0x1.23a8e2ef4a854p-3,
+      -0x1.ba50a76124856p-4 },
+    { 0x1.2p-1, 0x0p+0, 0x1.c56ff90b35b22p-1, -0x1.7e8251ce09d71p-1,
+      0x1.364621c5e38bdp-1, -0x1.e798bf7d26825p-2, 0x1.754b1e2b3c9a3p-2,
+      -0x1.17bbff2c03f96p-2, 0x1.9be27579e8607p-3, -0x1.2ac9a394e8b5ap-3,
+      0x1.ac26bfba21831p-4, -0x1.2f9349cc112b2p-4, 0x1.ace936d131c59p-5,
+      -0x1.2b1f487e2c188p-5 },
+    { 0x1.6p-1, 0x0p+0, 0x1.9a098b5f5bbf4p-1, -0x1.3b106b01e8d3p-1,
+      0x1.d3e68a8e35a72p-2, -0x1.51baa36e0925p-2, 0x1.dc2dee2d1d83p-3,
+      -0x1.4924a8b619bc9p-3, 0x1.bf8e637746eebp-4, -0x1.2c127b39d4db8p-4,
+      0x1.8da6724f168d4p-5, -0x1.04d82a4712f9ep-5, 0x1.54ca422be7bafp-6,
+      -0x1.b7f591511b323p-7 },
+    { 0x1.ap-1, 0x0p+0, 0x1.7601b5781c867p-1, -0x1.07a7360935289p-1,
+      0x1.68b9aa0eb9d03p-2, -0x1.e12fc2765514cp-3, 0x1.3a2286d6ec0fap-3,
+      -0x1.92c73db279c7ap-4, 0x1.fc8870806c75ap-5, -0x1.3cd6039d8f845p-5,
+      0x1.866308a2bad3cp-6, -0x1.dc6493405ee4ep-7, 0x1.2160a000f21e3p-7,
+      -0x1.5baacec705b6p-8 },
+    { 0x1.ep-1, 0x0p+0, 0x1.57a6a74a1ce54p-1, -0x1.bf49ba0bacb82p-2,
+      0x1.1b788ef6545e2p-2, -0x1.5f38da685fdbp-3, 0x1.aac32d337501cp-4,
+      -0x1.fdf241e01628fp-5, 0x1.2c52e48cf73e1p-5, -0x1.5d63c02cea67bp-6,
+      0x1.92269cea68428p-7, -0x1.ca9ec045885f9p-8, 0x1.044b1c45c6f8bp-8,
+      -0x1.24666a7958e49p-9 },
+    { 0x1.1p+0, 0x0p+0, 0x1.81a4be725c51ap+0, -0x1.056a44ad9fa31p+1,
+      0x1.499fa97dbb2afp+1, -0x1.8a7b636a6a974p+1, 0x1.c622cd2d24d51p+1,
+      -0x1.fb9b5b72b0b63p+1, 0x1.1544445ffbfddp+2, -0x1.2979eaafc4797p+2,
+      0x1.3a8dd4b2ff7c9p+2, -0x1.48baf9ff54d21p+2, 0x1.58162cf4afae2p+2,
+      -0x1.612d011d1168ap+2 },
+    { 0x1.3p+0, 0x0p+0, 0x1.493e798974dbep+0, -0x1.84f80f326bc8bp+0,
+      0x1.b01f3491b1b08p+0, -0x1.ca8137d8f36d1p+0, 0x1.d5b67ea750ff2p+0,
+      -0x1.d43aa324683d4p+0, 0x1.c8c9b41624b3dp+0, -0x1.b5fe5b759b602p+0,
+      0x1.9e1d7c3c5af2ep+0, -0x1.8311f748e8a6dp+0, 0x1.6999bfeedc85cp+0,
+      -0x1.4c0ca7a9a9a34p+0 },
+    { 0x1.5p+0, 0x0p+0, 0x1.1e94ccc16391cp+0, -0x1.2b426f907c826p+0,
+      0x1.2880ee530dd4ap+0, -0x1.1a1b68021d267p+0, 0x1.0405304a46d8p+0,
+      -0x1.d36400374e80dp-1, 0x1.9ba5d812881fep-1, -0x1.64a35e22a0619p-1,
+      0x1.30d4b62e8844ap-1, -0x1.01a7f77ff8c09p-1, 0x1.b2b43cf741ba3p-2,
+      -0x1.6919f7d5ab593p-2 },
+    { 0x1.7p+0, 0x0p+0, 0x1.faa0205f510bap-1, -0x1.d927d475b5d53p-1,
+      0x1.a65c12006a86ap-1, -0x1.6bbdec43234c6p-1, 0x1.30639ab2ae12fp-1,
+      -0x1.f1bd71283a6eap-2, 0x1.8f4f4ec3b3c4cp-2, -0x1.3b624c4a4c7fcp-2,
+      0x1.ebc73d1beb71ap-3, -0x1.7b4a13611c605p-3, 0x1.23a8e2ef4a854p-3,
+      -0x1.ba50a76124856p-4 },
+    { 0x1.9p+0, 0x0p+0, 0x1.c56ff90b35b22p-1, -0x1.7e8251ce09d71p-1,
+      0x1.364621c5e38bdp-1, -0x1.e798bf7d26825p-2, 0x1.754b1e2b3c9a3p-2,
+      -0x1.17bbff2c03f96p-2, 0x1.9be27579e8607p-3, -0x1.2ac9a394e8b5ap-3,
+      0x1.ac26bfba21831p-4, -0x1.2f9349cc112b2p-4, 0x1.ace936d131c59p-5,
+      -0x1.2b1f487e2c188p-5 },
+    { 0x1.bp+0, 0x0p+0, 0x1.9a098b5f5bbf4p-1, -0x1.3b106b01e8d3p-1,
+      0x1.d3e68a8e35a72p-2, -0x1.51baa36e0925p-2, 0x1.dc2dee2d1d83p-3,
+      -0x1.4924a8b619bc9p-3, 0x1.bf8e637746eebp-4, -0x1.2c127b39d4db8p-4,
+      0x1.8da6724f168d4p-5, -0x1.04d82a4712f9ep-5, 0x1.54ca422be7bafp-6,
+      -0x1.b7f591511b323p-7 },
+    { 0x1.dp+0, 0x0p+0, 0x1.7601b5781c867p-1, -0x1.07a7360935289p-1,
+      0x1.68b9aa0eb9d03p-2, -0x1.e12fc2765514cp-3, 0x1.3a2286d6ec0fap-3,
+      -0x1.92c73db279c7ap-4, 0x1.fc8870806c75ap-5, -0x1.3cd6039d8f845p-5,
+      0x1.866308a2bad3cp-6, -0x1.dc6493405ee4ep-7, 0x1.2160a000f21e3p-7,
+      -0x1.5baacec705b5fp-8 },
+    { 0x1.fp+0, 0x0p+0, 0x1.57a6a74a1ce54p-1, -0x1.bf49ba0bacb82p-2,
+      0x1.1b788ef6545e2p-2, -0x1.5f38da685fdbp-3, 0x1.aac32d337501cp-4,
+      -0x1.fdf241e01628fp-5, 0x1.2c52e48cf73e1p-5, -0x1.5d63c02cea67bp-6,
+      0x1.92269cea68428p-7, -0x1.ca9ec045885f9p-8, 0x1.044b1c45c6f8bp-8,
+      -0x1.24666a7958e48p-9 },
+    { 0x1.08p+1, 0x0p+0, 0x1.3dc02fd3e40afp-1, -0x1.7fe3d61e9171ap-2,
+      0x1.c4ff5d94dc986p-3, -0x1.05da51e960abfp-3, 0x1.29634f45dc06cp-4,
+      -0x1.4c9255cba9561p-5, 0x1.6ef77c99fe2b5p-6, -0x1.903aeedba0c78p-7,
+      0x1.b01a98805b433p-8, -0x1.ce68c1bc1906p-9, 0x1.ec7d1f51b9a07p-10,
+      -0x1.03b47fa6652d6p-10 },
+    { 0x1.18p+1, 0x0p+0, 0x1.27686268b813fp-1, -0x1.4cde557eecfbp-2,
+      0x1.6f45ad140eb48p-3, -0x1.8dcbb4a24ffd7p-4, 0x1.a7e7dd1a7696dp-5,
+      -0x1.bd555036b309dp-6, 0x1.ce08676244112p-7, -0x1.da227cfacd904p-8,
+      0x1.e1e589d046ab6p-9, -0x1.e5aa9083e666bp-10, 0x1.e71f75ccc3e5bp-11,
+      -0x1.e41ccd8af18cdp-12 },
+    { 0x1.28p+1, 0x0p+0, 0x1.13f273c746d92p-1, -0x1.233d1a806b0ebp-2,
+      0x1.2da16a02a7cefp-3, -0x1.3330564ef9598p-4, 0x1.3438c5d19f01bp-5,
+      -0x1.313492dc35aa2p-6, 0x1.2ab6d0a22678ep-7, -0x1.215ce19165c2p-8,
+      0x1.15c2d77ff17e6p-9, -0x1.087bf846828b1p-10, 0x1.f54809eddd2cap-12,
+      -0x1.d6f3109756f2fp-13 },
+    { 0x1.38p+1, 0x0p+0, 0x1.02da32c301ae4p-1, -0x1.00dafd7b40e94p-2,
+      0x1.f5261d7d110b9p-4, -0x1.e179c33923c86p-5, 0x1.c8493e62ef7b9p-6,
+      -0x1.ab298949a207dp-7, 0x1.8b90c03119f37p-8, -0x1.6ac5414faea5dp-9,
+      0x1.49d590a68394p-10, -0x1.2997a70057876p-11, 0x1.0b3c4fed1c21bp-12,
+      -0x1.dc09311dcf7edp-14 },
+    { 0x1.48p+1, 0x0p+0, 0x1.e771c364a7316p-2, -0x1.c84b5f0aabf8ep-3,
+      0x1.a49b795ce7c7dp-4, -0x1.7e560efd55336p-5, 0x1.5732013abe028p-6,
+      -0x1.30969b8f38994p-7, 0x1.0b961db9facbp-8, -0x1.d1e3266a44f32p-10,
+      0x1.9244a5f5a1a1ap-11, -0x1.58cd474568153p-12, 0x1.262ca4b2358ffp-13,
+      -0x1.f20c1086812b2p-15 },
+    { 0x1.58p+1, 0x0p+0, 0x1.cc7b08b2c6f2p-2, -0x1.97e2ba2439b32p-3,
+      0x1.6446b51653c54p-4, -0x1.333e42bb54788p-5, 0x1.05e54ccebc4edp-6,
+      -0x1.b9cd92346e133p-8, 0x1.711dac0089b4dp-9, -0x1.31bfa3a5db332p-10,
+      0x1.f69c3b5e35117p-12, -0x1.9a3d68ff6b628p-13, 0x1.4d537e824ca97p-14,
+      -0x1.0cd34b4ca92b8p-15 },
+    { 0x1.68p+1, 0x0p+0, 0x1.b44ee8a7c698ap-2, -0x1.6eb634357fc51p-3,
+      0x1.304e6cc06c714p-4, -0x1.f3251e0f68782p-6, 0x1.94fd2c470bf18p-7,
+      -0x1.45633022b0bd6p-8, 0x1.031c3b9286191p-9, -0x1.99568936625e7p-11,
+      0x1.40f7c7d2cc0b7p-12, -0x1.f4044240692cfp-14, 0x1.83c01a32f158bp-15,
+      -0x1.2a97ae5f92781p-16 },
+    { 0x1.78p+1, 0x0p+0, 0x1.9e84fb773077bp-2, -0x1.4b697e2dfbdep-3,
+      0x1.05e353ba4cf92p-4, -0x1.9971bfa8cbed2p-6, 0x1.3ce57158da72ep-7,
+      -0x1.e612063c7e927p-9, 0x1.71ac9f8244d03p-10, -0x1.17034b35087ccp-11,
+      0x1.a2407a43c324cp-13, -0x1.37827fefd21c1p-14, 0x1.ce064a78d3943p-16,
+      -0x1.548c0cbf4d8b4p-17 },
+    { 0x1.88p+1, 0x0p+0, 0x1.8ac8128cbf633p-2, -0x1.2cede065cc338p-3,
+      0x1.c5e0f6c9bc04cp-5, -0x1.52e16e46389f4p-6, 0x1.f560c359e6dbp-8,
+      -0x1.6fbebd4b0b44ap-9, 0x1.0b9ed68e146e3p-10, -0x1.82b7bc61b70bcp-12,
+      0x1.1592381d3cb5ep-13, -0x1.8c1049a3222f3p-15, 0x1.19646c6d46373p-16,
+      -0x1.8dacdbd6e840ep-18 },
+    { 0x1.98p+1, 0x0p+0, 0x1.78d205cf8eaacp-2, -0x1.126e80ebc89c1p-3,
+      0x1.8bcb483bedf88p-5, -0x1.1ac92075610eep-6, 0x1.909f9aef71461p-8,
+      -0x1.1986b2d57d7cep-9, 0x1.88c29a1d71999p-11, -0x1.101d824eac4adp-12,
+      0x1.76b4e292cdbf5p-14, -0x1.008291fdedd62p-15, 0x1.5dc6dc420d03cp-17,
+      -0x1.da10346667236p-19 },
+    { 0x1.a8p+1, 0x0p+0, 0x1.68688d0cc6eafp-2, -0x1.f6847d02722f2p-4,
+      0x1.5b24e349e53abp-5, -0x1.db85898642b7p-7, 0x1.43155c3bc0598p-8,
+      -0x1.b3c13f1801f1ep-10, 0x1.23d3bcce505f2p-11, -0x1.845f4e268ff75p-13,
+      0x1.00e61ddf691b4p-14, -0x1.520223c652316p-16, 0x1.bafe0edd0cfbep-18,
+      -0x1.21070b3eea747p-19 },
+    { 0x1.b8p+1, 0x0p+0, 0x1.595adb010c482p-2, -0x1.cdc2ccd6277c5p-4,
+      0x1.3219924075967p-5, -0x1.929906ee065f4p-7, 0x1.06c7d29c046b5p-8,
+      -0x1.54a49b2a29081p-10, 0x1.b6b2e8084108cp-12, -0x1.18c752d33f8dbp-13,
+      0x1.6563f13a3b894p-15, -0x1.c4895b1c48d15p-17, 0x1.1d6dad70c2e2fp-18,
+      -0x1.66e210793588dp-20 },
+    { 0x1.c8p+1, 0x0p+0, 0x1.4b7fc62268251p-2, -0x1.a9bc3d46869f8p-4,
+      0x1.0f3d622b95d1bp-5, -0x1.570e36a3b0eaep-7, 0x1.aeda24ebb73e2p-9,
+      -0x1.0cc851010db8ep-10, 0x1.4d4b02f7ded4cp-12, -0x1.9aea6c9b24746p-14,
+      0x1.f7e8daf052162p-16, -0x1.3370cf38a059p-17, 0x1.75c7d84fbf8b6p-19,
+      -0x1.c32a212a3ae14p-21 },
+    { 0x1.d8p+1, 0x0p+0, 0x1.3eb45a8631f84p-2, -0x1.89bd79b7d5b45p-4,
+      0x1.e2e54ba5543a6p-6, -0x1.261151abd9f75p-7, 0x1.63cea2a2c82f1p-9,
+      -0x1.abd9579b84291p-11, 0x1.ff7dd4321f31fp-13, -0x1.3014a915505c4p-14,
+      0x1.67b6b938ceeb3p-16, -0x1.a7823a95ae89p-18, 0x1.f0ded3dc5a84bp-20,
+      -0x1.221bd051333eap-21 },
+    { 0x1.e8p+1, 0x0p+0, 0x1.32dabaa37a3d2p-2, -0x1.6d3301f85f3bdp-4,
+      0x1.afae2dc8e4511p-6, -0x1.faf431a83308ap-8, 0x1.27d800975ba86p-9,
+      -0x1.57481d363ccb1p-11, 0x1.8c24061a843bep-13, -0x1.c6c82696cb1d1p-15,
+      0x1.03ca28ce4c2fp-16, -0x1.2774bdd4e2fd2p-18, 0x1.4ee5cd9e51d39p-20,
+      -0x1.82c1c5ad5cf54p-22 },
+    { 0x1.f8p+1, 0x0p+0, 0x1.27d93be6717b4p-2, -0x1.53a2a664d45e4p-4,
+      0x1.836bf1063276bp-6, -0x1.b73e289a1923cp-8, 0x1.ef1c8080e3dafp-10,
+      -0x1.15829e2b390a7p-11, 0x1.357954384b357p-13, -0x1.576e09dad38aep-15,
+      0x1.7b5b597cad219p-17, -0x1.a13a25df3cc6ap-19, 0x1.c965173877345p-21,
+      -0x1.fa0dc26de50a3p-23 },
+    { 0x1.04p+2, 0x0p+0, 0x1.1d99b118d9674p-2, -0x1.3ca68387f1429p-4,
+      0x1.5cfb94e520e6cp-6, -0x1.7e6aff500514fp-8, 0x1.a0c5220051674p-10,
+      -0x1.c3d9d44ad7b5dp-12, 0x1.e77977ff5875fp-14, -0x1.05baf1fab2601p-15,
+      0x1.17d18d86e4e22p-17, -0x1.29eb62cf4d016p-19, 0x1.3c33bcf8d8478p-21,
+      -0x1.51ad448329ed7p-23 },
+    { 0x1.0cp+2, 0x0p+0, 0x1.1408d83d985p-2, -0x1.27e91c04d69aap-4,
+      0x1.3b711c185e8c5p-6, -0x1.4e740f6ea1b14p-8, 0x1.60c90394da462p-10,
+      -0x1.724b906848088p-12, 0x1.82dc4f4163b72p-14, -0x1.9261193517776p-16,
+      0x1.a0c50db08885cp-18, -0x1.adf8942b175c8p-20, 0x1.ba4035216a70fp-22,
+      -0x1.c4aaf84f3d9afp-24 },
+    { 0x1.14p+2, 0x0p+0, 0x1.0b15e4159dff7p-2, -0x1.15224a603fa92p-4,
+      0x1.1e0bd520b765bp-6, -0x1.25bf7e330af73p-8, 0x1.2c30a3936a658p-10,
+      -0x1.3158d5b2bef85p-12, 0x1.353772c366508p-14, -0x1.37d11b17f82d4p-16,
+      0x1.392f089d41d8bp-18, -0x1.3960db346ec6fp-20, 0x1.38a4631bd2cf2p-22,
+      -0x1.28599bbf722e9p-24 },
+    { 0x1.1cp+2, 0x0p+0, 0x1.02b21b67f4abap-2, -0x1.0414d714c6a51p-4,
+      0x1.042d64ee38d5cp-6, -0x1.0307008ef1d74p-8, 0x1.00b21fd15eee7p-10,
+      -0x1.fa870f70d6f94p-13, 0x1.f1a6aa4cdee19p-15, -0x1.e6f80e334624fp-17,
+      0x1.dab3230ad8559p-19, -0x1.cd09a1a1bf4c2p-21, 0x1.be9251dd301afp-23,
+      -0x1.da9d7aae40c46p-25 },
+    { 0x1.24p+2, 0x0p+0, 0x1.f5a113159dc87p-3, -0x1.e91919935875ap-5,
+      0x1.daa5bceed5f3ap-7, -0x1.ca8a005c9ac3p-9, 0x1.b90bdf32919e6p-11,
+      -0x1.a672163324c27p-13, 0x1.93022d49c7b7dp-15, -0x1.7efecf921ad51p-17,
+      0x1.6aa6754e9c1ffp-19, -0x1.56324c90e813ep-21, 0x1.4206bdca3c7d5p-23,
+      -0x1.2ecc49dd3d4bap-25 },
+    { 0x1.2cp+2, 0x0p+0, 0x1.e6cb7967e0724p-3, -0x1.ccb95c58dc3c9p-5,
+      0x1.b21ec880a9cddp-7, -0x1.974cc928e7a4dp-9, 0x1.7c8e7c8afdbdfp-11,
+      -0x1.6227af2266bb3p-13, 0x1.4853eafab6c0dp-15, -0x1.2f45f387fdc2ap-17,
+      0x1.1727a2ff28968p-19, -0x1.00212b9e03e5dp-21, 0x1.d4af3846a687p-24,
+      -0x1.593dc1f39c05dp-26 },
+    { 0x1.34p+2, 0x0p+0, 0x1.d8cf1eba77d06p-3, -0x1.b2bd6fe754285p-5,
+      0x1.8e0fe81a0c57cp-7, -0x1.6aff89d444163p-9, 0x1.49b91fe49a354p-11,
+      -0x1.2a5d7440d8437p-13, 0x1.0d01edb74ab7fp-15, -0x1.e362f91af106dp-18,
+      0x1.b0db797d0d31cp-20, -0x1.82610879a67bdp-22, 0x1.580619b6a16c5p-24,
+      -0x1.2e2aa3dfdb346p-26 },
+    { 0x1.3cp+2, 0x0p+0, 0x1.cb99f540a9f1fp-3, -0x1.9ae2bd73df8eap-5,
+      0x1.6de02c3456f0ap-7, -0x1.448a41294952ap-9, 0x1.1eccbbdf9bd61p-11,
+      -0x1.f911d8a4f4c33p-14, 0x1.bb2f421a367a9p-16, -0x1.83962f81c0877p-18,
+      0x1.51e1b08f5069cp-20, -0x1.25a37e58241bfp-22, 0x1.fd3117d4d8adfp-25,
+      -0x1.df868556990e9p-27 },
+    { 0x1.44p+2, 0x0p+0, 0x1.bf1bdfbd7bca1p-3, -0x1.84ef78622b58fp-5,
+      0x1.510e76928ddbp-7, -0x1.2306f6766b61cp-9, 0x1.f4c82524ab14fp-12,
+      -0x1.ad608f2aa74e1p-14, 0x1.6eef2dc4a3156p-16, -0x1.3892b32ac12fp-18,
+      0x1.097374ec175cbp-20, -0x1.c17d62379c6bp-23, 0x1.7bc4e542ca8f9p-25,
+      -0x1.91d49ebeab48cp-27 },
+    { 0x1.4cp+2, 0x0p+0, 0x1.b34670c7d601cp-3, -0x1.70b144128d75dp-5,
+      0x1.372d459cfa979p-7, -0x1.05b7ca11c9bf6p-9, 0x1.b6bfebf33b298p-12,
+      -0x1.6e8f273775c35p-14, 0x1.3146ef2fc475ap-16, -0x1.faedeca2a4bc7p-19,
+      0x1.a3a85cd5ab1e8p-21, -0x1.5a6b9395407acp-23, 0x1.1d57c4c432953p-25,
+      -0x1.fa39193ea3a2fp-28 },
+    { 0x1.54p+2, 0x0p+0, 0x1.a80cb3e5c363ap-3, -0x1.5dfc161a859dcp-5,
+      0x1.1fdf5317ba55dp-7, -0x1.d7fe5dce234e9p-10, 0x1.81b0766d9fab9p-12,
+      -0x1.3a2dcf23fb249p-14, 0x1.fe4deaf3de485p-17, -0x1.9d381b137f4aap-19,
+      0x1.4da9adf79ecabp-21, -0x1.0cc1b8f40dabcp-23, 0x1.afd0eea0f8f5ap-26,
+      -0x1.424e9705eb8p-29 },
+    { 0x1.5cp+2, 0x0p+0, 0x1.9d62fecc414c5p-3, -0x1.4ca9492dc6e71p-5,
+      0x1.0ad4d8c1b4c09p-7, -0x1.aab395d03d586p-10, 0x1.54205ba4a6862p-12,
+      -0x1.0e4e267eb356bp-14, 0x1.ac636fe5dbe13p-17, -0x1.5282c2e34f3d8p-19,
+      0x1.0ac45ea7c8a6ap-21, -0x1.a315ab85c4479p-24, 0x1.48efa550473dcp-26,
+      -0x1.50ad50fb1fc8cp-27 },
+    { 0x1.64p+2, 0x0p+0, 0x1.933ec9647f16p-3, -0x1.3c96d77c573ccp-5,
+      0x1.ef92affc58082p-8, -0x1.82b33a245e963p-10, 0x1.2cdb46f6a0e5dp-12,
+      -0x1.d2cc465b49a47p-15, 0x1.692098efb80bep-17, -0x1.16a07488fd41ep-19,
+      0x1.acd4d4c0a57acp-22, -0x1.4931100ac27a5p-24, 0x1.f85951f71cff7p-27,
+      -0x1.5c10607239974p-29 },
+    { 0x1.6cp+2, 0x0p+0, 0x1.89968b794311ap-3, -0x1.2da6b535ad833p-5,
+      0x1.cd0393369e8ddp-8, -0x1.5f443f7fa7678p-10, 0x1.0ae41835d0f16p-12,
+      -0x1.9473fa3b6a033p-15, 0x1.31a488a03d53ap-17, -0x1.ccc0a8da1b31fp-20,
+      0x1.5a6c3bf7a0336p-22, -0x1.03eef2d54e621p-24, 0x1.85053b4a5ad91p-27,
+      0x1.216db07328ba3p-36 },
+    { 0x1.74p+2, 0x0p+0, 0x1.80619f2379d7fp-3, -0x1.1fbe455d5e2e3p-5,
+      0x1.ad96418f9f644p-8, -0x1.3fca5f69f23cdp-10, 0x1.dad4130310084p-13,
+      -0x1.5f96a3e76c66dp-15, 0x1.03ab6c174282ep-17, -0x1.7e9cea3745ffcp-20,
+      0x1.1934b5ee3d0f4p-22, -0x1.9c45d8c6a76a4p-25, 0x1.2dd2097d95577p-27,
+      -0x1.8e50179b48d17p-29 },
+    { 0x1.7cp+2, 0x0p+0, 0x1.77982736bcbb5p-3, -0x1.12c5e446a0059p-5,
+      0x1.90f221b36af56p-8, -0x1.23c11af113455p-10, 0x1.a7804b7b66e3fp-13,
+      -0x1.32986043b30cdp-15, 0x1.bad50226f03d3p-18, -0x1.3f0a7dc9cafc1p-20,
+      0x1.caa5d0b2b8f5cp-23, -0x1.489cad48e799cp-25, 0x1.d6f4c399a2506p-28,
+      -0x1.449f0ac93628cp-28 },
+    { 0x1.84p+2, 0x0p+0, 0x1.6f32f91029e3cp-3, -0x1.06a883f4a071bp-5,
+      0x1.76ca120e7d203p-8, -0x1.0ab7b0c85e0c4p-10, 0x1.7aad0f8931fc5p-13,
+      -0x1.0c2a2534eccd6p-15, 0x1.7ae9cd39c0a22p-18, -0x1.0b160e2d76db3p-20,
+      0x1.77afb333e61cdp-23, -0x1.0754e81d9ef96p-25, 0x1.7168328e8ae1dp-28,
+      -0x1.2fb170a8387a3p-28 },
+    { 0x1.8cp+2, 0x0p+0, 0x1.672b8944fe408p-3, -0x1.f6a6aeaa376f6p-6,
+      0x1.5edab7c7949f7p-8, -0x1.e89ba8e6c3232p-11, 0x1.5369f75834ecbp-13,
+      -0x1.d6745baf1734p-16, 0x1.454de2c01a34bp-18, -0x1.c0e1d23d1cabbp-21,
+      0x1.3509dfa40459fp-23, -0x1.a86e7195b03a8p-26, 0x1.233e628756191p-28,
+      -0x1.fb5ce1e038p-30 },
+    { 0x1.94p+2, 0x0p+0, 0x1.5f7bdac459b1bp-3, -0x1.e16b13b8516bdp-6,
+      0x1.48e9151206338p-8, -0x1.c061fea471d8p-11, 0x1.30ed682e3adap-13,
+      -0x1.9dcf994ed9c28p-16, 0x1.182cb7f0bf94dp-18, -0x1.7a955aaf1a383p-21,
+      0x1.fe8000d1dcfebp-24, -0x1.581c0a2f3a0f5p-26, 0x1.cd80a600a798cp-29,
+      0x1.78371aeaec8p-29 },
+    { 0x1.9cp+2, 0x0p+0, 0x1.581e70117d328p-3, -0x1.cd8002f8324a3p-6,
+      0x1.34c159e9a36b3p-8, -0x1.9c3479e595013p-11, 0x1.128dafcf76e67p-13,
+      -0x1.6cf3b1db4c139p-16, 0x1.e41873dae69e5p-19, -0x1.4068f61ef9127p-21,
+      0x1.a74babad832cap-24, -0x1.15d1b48d79d37p-26, 0x1.6f60abe74fb0cp-29,
+      -0x1.eefa192e6cd74p-28 },
+    { 0x1.a4p+2, 0x0p+0, 0x1.510e3e4a7ac16p-3, -0x1.baca52a2573b3p-6,
+      0x1.2235e4d5dd299p-8, -0x1.7b98b531c422bp-11, 0x1.ef76e9b6f7a85p-14,
+      -0x1.42ae3dc7a1147p-16, 0x1.a373f83b53e28p-19, -0x1.1015d2653d56ep-21,
+      0x1.604e4e0687d8fp-24, -0x1.c70cb83332755p-27, 0x1.25c7aa56841cp-29,
+      -0x1.2b2d2ebad7517p-30 },
+    { 0x1.acp+2, 0x0p+0, 0x1.4a46a1bb5b3e6p-3, -0x1.a93187470cbf7p-6,
+      0x1.111e6b53d5d26p-8, -0x1.5e24cdfb062bp-11, 0x1.bffa6a4e53864p-14,
+      -0x1.1e00bdffe87a6p-16, 0x1.6c792b9652dfep-19, -0x1.cf9692e9b9558p-22,
+      0x1.2647c55f9f6a7p-24, -0x1.7631425d04185p-27, 0x1.d7e8495333e74p-30,
+      0x1.aee49cf7b745dp-29 },
+    { 0x1.b4p+2, 0x0p+0, 0x1.43c353c7b0a91p-3, -0x1.989f843cb3995p-6,
+      0x1.0157431e09f5cp-8, -0x1.437ce662e0ee4p-11, 0x1.95d735c7d2657p-14,
+      -0x1.fc2e11b0fcb9dp-17, 0x1.3d90640969223p-19, -0x1.8c2a0e0cb6fc8p-22,
+      0x1.ed54c308d2d2p-25, -0x1.31ec25e0a6884p-27, 0x1.7c9d447140a46p-30,
+      -0x1.23ffb6bf6c05dp-29 },
+    { 0x1.bcp+2, 0x0p+0, 0x1.3d8061fcc945p-3, -0x1.89004698293d6p-6,
+      0x1.e5818d97d5a3bp-9, -0x1.2b51113a2d7a6p-11, 0x1.705cfae960336p-14,
+      -0x1.c47f3d10d4e5p-17, 0x1.156b27ca7ac0bp-19, -0x1.538ea527c021bp-22,
+      0x1.9ee472e3fca9ep-25, -0x1.f81275e993decp-28, 0x1.3439f100570bap-30,
+      -0x1.8de7da5707p-29 },
+    { 0x1.c4p+2, 0x0p+0, 0x1.377a26259389dp-3, -0x1.7a41a91f204a7p-6,
+      0x1.ca7da28ce3f49p-9, -0x1.155b94f9586d4p-11, 0x1.4ef4d82882de1p-14,
+      -0x1.93cafad5f792bp-17, 0x1.e5ebffb153799p-20, -0x1.23e02e52a922bp-22,
+      0x1.5e0c97fd06bc7p-25, -0x1.9fe9c3a34da98p-28, 0x1.f5290d494495dp-31,
+      -0x1.34c1ff7f3802fp-28 },
+    { 0x1.ccp+2, 0x0p+0, 0x1.31ad3f3efc51bp-3, -0x1.6c532fe5abf8fp-6,
+      0x1.b17098bca668ap-9, -0x1.015f763309189p-11, 0x1.311d4f2baef45p-14,
+      -0x1.69164b824a78p-17, 0x1.aa9a7686fee31p-20, -0x1.f72b8cd50dbf2p-23,
+      0x1.2841e1a79c1dcp-25, -0x1.5b96faf3df719p-28, 0x1.98f6e6844fd46p-31,
+      -0x1.297f48f345174p-30 },
+    { 0x1.d4p+2, 0x0p+0, 0x1.2c168b305c9afp-3, -0x1.5f25da7e0cc2ap-6,
+      0x1.9a2d9eef94045p-9, -0x1.de4e79fb35d6p-12, 0x1.1666ec291204ap-14,
+      -0x1.438d1d04e14a5p-17, 0x1.7767fa2099fbfp-20, -0x1.b2df3f47b1d4dp-23,
+      0x1.f6f71bfcb383fp-26, -0x1.221c1eca50a45p-28, 0x1.4ef105a2a3574p-31,
+      -0x1.12218b5c8ap-31 },
+    { 0x1.dcp+2, 0x0p+0, 0x1.26b3212f94692p-3, -0x1.52abfbce2b5d3p-6,
+      0x1.848c978ee073ap-9, -0x1.bd07d65aa8208p-12, 0x1.fce2fede9f834p-15,
+      -0x1.227bb4f55b632p-17, 0x1.4b1a2af703603p-20, -0x1.78d091cb3ae7ap-23,
+      0x1.ac2f211dbf49dp-26, -0x1.dde5b80037284p-29, 0x1.134753412885dp-31,
+      -0x1.7631a9e3f8b46p-28 },
+    { 0x1.e4p+2, 0x0p+0, 0x1.21804cbbd6de7p-3, -0x1.46d916c2e9cb3p-6,
+      0x1.706988132cb99p-9, -0x1.9e9836385f795p-12, 0x1.d1d39c50bd569p-15,
+      -0x1.05494edbf1b0cp-17, 0x1.24aa89112cbd4p-20, -0x1.47522e3a280f5p-23,
+      0x1.6d8a0496db44fp-26, -0x1.97925e58e52e4p-29, 0x1.c604fb22a68p-32,
+      -0x1.a9b064b79dd17p-34 },
+    { 0x1.ecp+2, 0x0p+0, 0x1.1c7b891d0c224p-3, -0x1.3ba1bf37f48f5p-6,
+      0x1.5da41beeadb2fp-9, -0x1.82b6807da3277p-12, 0x1.ab0f4970f904cp-15,
+      -0x1.d6e7645f752efp-18, 0x1.033d33f2879adp-20, -0x1.1d035b6f227d7p-23,
+      0x1.38e6b85eb8d12p-26, -0x1.55ef44ff0c8bep-29, 0x1.77a2832c1305dp-32,
+      -0x1.b420e09401d17p-31 },
+    { 0x1.f4p+2, 0x0p+0, 0x1.17a27d581ea2ep-3, -0x1.30fb7e842b527p-6,
+      0x1.4c1f380c2aeb3p-9, -0x1.692207fa59bc8p-12, 0x1.8818729d6e978p-15,
+      -0x1.a91720a42ee08p-18, 0x1.cc32de9770db4p-21, -0x1.f1808be9a07eep-24,
+      0x1.0c8abad069dc1p-26, -0x1.23bcaeff486adp-29, 0x1.37c44daf2aa5dp-32,
+      0x1.9399252b65dd1p-30 },
+    { 0x1.fcp+2, 0x0p+0, 0x1.12f2f88a9d18bp-3, -0x1.26dcbb2ffab6fp-6,
+      0x1.3bc09c74ecf28p-9, -0x1.51a17480cbab5p-12, 0x1.6881a122f42b2p-15,
+      -0x1.8063091865211p-18, 0x1.99472075a83cp-21, -0x1.b32efa008092p-24,
+      0x1.ce1b1177d0f81p-27, -0x1.e7107203b9548p-30, 0x1.038cf81148e8cp-32,
+      -0x1.1e2932a19f974p-30 },
+  },
+};
@@ -0,0 +1,79 @@
+/*
+ * Fixed-point vector exp2 array routine.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <string.h>
+#include "mathlib.h"
+#include "v_math.h"
+
+#define N (1 << V_EXP2_FIXED_TABLE_BITS)
+
+static inline int32x4_t
+lookup (uint32x4_t i)
+{
+  const int32_t *t = __v_exp2_fixed_data.tab;
+  return (int32x4_t){ t[i[0]], t[i[1]], t[i[2]], t[i[3]] };
+}
+
+/* 2^x for x in Q(qin), in Q(qout), without conversion to floating point.
+   With x = n + f, f in [0, 1) in Q31 is split as in exp2f into
+   f = i/32 + r, with |r| <= 1/64, and
+     2^x = 2^n 2^(i/32) (1 + r P(r)),
+   with 2^(i/32) read from a table in Q30, and the exp2f polynomial
+   evaluated in Q31 with rounding doubling multiplies.  The result is then
+   scaled by 2^n with a saturating rounding shift.  */
+static inline uint32x4_t
+v_exp2_fixed_inline (int32x4_t x, int32x4_t nqin, int32x4_t fshift,
+		     int32x4_t qout)
+{
+  const struct v_exp2_fixed_data *d = ptr_barrier (&__v_exp2_fixed_data);
+
+  int32x4_t n = vshlq_s32 (x, nqin);
+  uint32x4_t f = vandq_u32 (vshlq_u32 (vreinterpretq_u32_s32 (x), fshift),
+			    v_u32 (0x7fffffff));
+  /* Round f to the nearest multiple of 1/32.  */
+  uint32x4_t u = vaddq_u32 (f, v_u32 (1 << 25));
+  uint32x4_t i = vandq_u32 (vshrq_n_u32 (u, 26), v_u32 (N - 1));
+  n = vaddq_s32 (n, vreinterpretq_s32_u32 (vshrq_n_u32 (u, 31)));
+  int32x4_t r = vreinterpretq_s32_u32 (
+      vsubq_u32 (f, vbicq_u32 (u, v_u32 ((1 << 26) - 1))));
+
+  int32x4_t q = vdupq_n_s32 (d->poly[0]);
+  q = vaddq_s32 (v_s32 (d->poly[1]), vqrdmulhq_s32 (r, q));
+  q = vaddq_s32 (v_s32 (d->poly[2]), vqrdmulhq_s32 (r, q));
+  q = vqrdmulhq_s32 (r, q);
+  int32x4_t s = lookup (i);
+  s = vaddq_s32 (s, vqrdmulhq_s32 (s, q));
+
+  /* y = s 2^(n + qout - 30), which saturates for n > 31 and is 0 for
+     n < -33.  n is clamped so that the shift fits in the low byte.  */
+  n = vmaxq_s32 (vminq_s32 (n, v_s32 (64)), v_s32 (-64));
+  return vqrshlq_u32 (vreinterpretq_u32_s32 (s), vaddq_s32 (n, qout));
+}
+
+/* Fixed-point exp2.  For i < n,
+     y[i] = 2^(x[i] / 2^qin) * 2^qout,
+   rounded to an integer, for qin and qout in [0, 31].  Results above
+   UINT32_MAX saturate.  No floating-point arithmetic is used.  The result is
+   bit-exact with the scalar reference exp2_fixed_ref.
+   Maximum measured error is 0.93 LSB, and the relative error is below
+   2^-29 for results above 2^29.  */
+void
+exp2_fixed (uint32_t *y, const int32_t *x, size_t n, int qin, int qout)
+{
+  int32x4_t nqin = vdupq_n_s32 (-qin), fshift = vdupq_n_s32 (31 - qin);
+  int32x4_t vqout = vdupq_n_s32 (qout - 30);
+  for (; n >= 4; n -= 4, x += 4, y += 4)
+    vst1q_u32 (y, v_exp2_fixed_inline (vld1q_s32 (x), nqin, fshift, vqout));
+  if (n > 0)
+    {
+      int32_t tmp[4] = { 0 };
+      memcpy (tmp, x, n * sizeof (int32_t));
+      uint32x4_t r = v_exp2_fixed_inline (vld1q_s32 (tmp), nqin, fshift, vqout);
+      vst1q_s32 (tmp, vreinterpretq_s32_u32 (r));
+      memcpy (y, tmp, n * sizeof (uint32_t));
+    }
+}
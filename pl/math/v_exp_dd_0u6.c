@@ -0,0 +1,103 @@
+/*
+ * Double-precision vector e^x function with extra precision argument.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "pl_test.h"
+
+#define N (1 << EXP_TABLE_BITS)
+#define SmallExp 0x3c9 /* top12(0x1p-54).  */
+#define ThresExp 0x03f /* top12(512.0) - SmallExp.  */
+
+static const struct data
+{
+  float64x2_t inv_ln2_n, shift, ln2_hi_n, ln2_lo_n;
+  float64x2_t c2, c3, c4, c5;
+} data = {
+  .inv_ln2_n = V2 (0x1.71547652b82fep7), /* N/ln2.  */
+  .shift = V2 (0x1.8p52),
+  .ln2_hi_n = V2 (0x1.62e42fefa0000p-8), /* ln2/N.  */
+  .ln2_lo_n = V2 (0x1.cf79abc9e3b3ap-47),
+  /* Same polynomial as scalar exp, valid for |r| < ln2/256.  */
+  .c2 = V2 (0x1.ffffffffffdbdp-2),
+  .c3 = V2 (0x1.555555555543cp-3),
+  .c4 = V2 (0x1.55555cf172b91p-5),
+  .c5 = V2 (0x1.1111167a4d017p-7),
+};
+
+double
+__exp_dd (double, double);
+
+/* Table entries are pairs of tail and the bits of 2^(i/N).  */
+static inline void
+lookup (uint64x2_t i, float64x2_t *tail, uint64x2_t *sbits)
+{
+  uint64x2_t e0 = vld1q_u64 (__exp_data.tab + 2 * i[0]);
+  uint64x2_t e1 = vld1q_u64 (__exp_data.tab + 2 * i[1]);
+  *tail = vreinterpretq_f64_u64 (vuzp1q_u64 (e0, e1));
+  *sbits = vuzp2q_u64 (e0, e1);
+}
+
+static float64x2_t VPCS_ATTR NOINLINE
+special_case (float64x2_t x, float64x2_t xtail, float64x2_t y,
+	      uint64x2_t special)
+{
+  return v_call2_f64 (__exp_dd, x, xtail, y, special);
+}
+
+/* Double-precision vector exp(x + xtail) where |xtail| < 2^-15 and
+   |xtail| <= |x|, for example the hi and lo results of _ZGVnN2v_log_dd scaled
+   by y give an accurate pow.  Uses the table and polynomial of scalar exp,
+   2^(k/N) is looked up with its tail.  Lanes where |x| < 0x1p-54 or
+   |x| >= 512, and inf or nan, fall back to scalar __exp_dd.
+   Maximum measured error is 0.51 ULP:
+   _ZGVnN2vv_exp_dd(-0x1.88ac71531158ep-6, 0) got 0x1.f3dff4f67620fp-1
+					     want 0x1.f3dff4f67620e7e8p-1.  */
+VPCS_ATTR float64x2_t
+_ZGVnN2vv_exp_dd (float64x2_t x, float64x2_t xtail)
+{
+  const struct data *d = ptr_barrier (&data);
+  uint64x2_t abstop
+      = vandq_u64 (vshrq_n_u64 (vreinterpretq_u64_f64 (x), 52), v_u64 (0x7ff));
+  uint64x2_t special
+      = vcgeq_u64 (vsubq_u64 (abstop, v_u64 (SmallExp)), v_u64 (ThresExp));
+
+  /* exp(x) = 2^(k/N) * exp(r), with exp(r) in [2^(-1/2N),2^(1/2N)].  */
+  /* x = ln2/N*k + r, with k integer and r in [-ln2/2N, ln2/2N].  */
+  float64x2_t z = vmulq_f64 (d->inv_ln2_n, x);
+  float64x2_t kd = vaddq_f64 (z, d->shift);
+  uint64x2_t ki = vreinterpretq_u64_f64 (kd);
+  kd = vsubq_f64 (kd, d->shift);
+  float64x2_t r = vfmsq_f64 (x, kd, d->ln2_hi_n);
+  r = vfmsq_f64 (r, kd, d->ln2_lo_n);
+  r = vaddq_f64 (r, xtail);
+
+  /* 2^(k/N) ~= scale * (1 + tail).  */
+  float64x2_t tail;
+  uint64x2_t sbits;
+  lookup (vandq_u64 (ki, v_u64 (N - 1)), &tail, &sbits);
+  sbits = vaddq_u64 (sbits, vshlq_n_u64 (ki, 52 - EXP_TABLE_BITS));
+  float64x2_t scale = vreinterpretq_f64_u64 (sbits);
+
+  /* exp(x) = 2^(k/N) * exp(r) ~= scale + scale * (tail + exp(r) - 1).  */
+  float64x2_t r2 = vmulq_f64 (r, r);
+  float64x2_t p23 = vfmaq_f64 (d->c2, r, d->c3);
+  float64x2_t p45 = vfmaq_f64 (d->c4, r, d->c5);
+  float64x2_t tmp = vfmaq_f64 (p23, r2, p45);
+  tmp = vfmaq_f64 (vaddq_f64 (tail, r), r2, tmp);
+  float64x2_t y = vfmaq_f64 (scale, scale, tmp);
+
+  if (unlikely (v_any_u64 (special)))
+    return special_case (x, xtail, y, special);
+  return y;
+}
+
+PL_TEST_ULP (_ZGVnN2vv_exp_dd, 0.01)
+PL_TEST_INTERVAL (_ZGVnN2vv_exp_dd, 0, 0xffff000000000000, 10000)
+PL_TEST_INTERVAL (_ZGVnN2vv_exp_dd, 0x1p-6, 0x1p6, 400000)
+PL_TEST_INTERVAL (_ZGVnN2vv_exp_dd, -0x1p-6, -0x1p6, 400000)
+PL_TEST_INTERVAL (_ZGVnN2vv_exp_dd, 633.3, 733.3, 10000)
+PL_TEST_INTERVAL (_ZGVnN2vv_exp_dd, -633.3, -777.3, 10000)
@@ -0,0 +1,404 @@
+/*
+ * Core approximations for double-precision vector regularised incomplete
+ * gamma functions
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+#ifndef PL_MATH_V_GAMMA_INC_COMMON_H
+#define PL_MATH_V_GAMMA_INC_COMMON_H
+
+#include "v_math.h"
+#include "poly_advsimd_f64.h"
+#include "v_pow_inline.h"
+
+/* The regularised incomplete gamma functions are
+     P(a, x) = gamma(a, x) / Gamma(a) and Q(a, x) = 1 - P(a, x).
+   Both are the product of the prefix x^a e^-x / Gamma(a) and either the power
+   series of P, used for x < max (a, 0.75), or the continued fraction of Q
+   otherwise, so that the other function is only computed as 1 - y where y is
+   not close to 1.  The exception is Q for small a and x < 0.75, where P is
+   close to 1 and Q is computed from a separate series.
+
+   The prefix is evaluated as exp(a log(x) - x - lgamma(a)), with the logs
+   from the double-double log core of pow and lgamma from Stirling's series
+   after shifting a to at least 16, so that the large cancellation in the
+   exponent loses no accuracy.  The exponent is only accurate to about
+   2^-68 a log(x) in absolute terms, so the error grows slowly with a.
+
+   The series and the continued fraction converge in O(sqrt(a)) iterations
+   close to x = a, and the number of iterations is capped, which limits the
+   results to a up to about 10^8.  The rounding errors of the terms grow
+   slowly with their number, from about 4 ULP for a < 100 to about 7 ULP for
+   a = 1000.  */
+static const struct v_gamma_inc_consts
+{
+  float64x2_t stirling_poly[7], lgamma1p_poly[13];
+  float64x2_t neg_euler_hi, neg_euler_lo, half_ln2pi_hi, half_ln2pi_lo;
+} v_gamma_inc_consts = {
+  /* B_2k / (2k (2k - 1)) for k = 1, ..., 7.  The first omitted term is below
+     2^-65 for z >= 16.  */
+  .stirling_poly = { V2 (0x1.5555555555555p-4), V2 (-0x1.6c16c16c16c17p-9),
+		     V2 (0x1.a01a01a01a01ap-11), V2 (-0x1.3813813813814p-11),
+		     V2 (0x1.b951e2b18ff23p-11), V2 (-0x1.f6ab0d9993c7dp-10),
+		     V2 (0x1.a41a41a41a41ap-8) },
+  /* (-1)^k zeta(k) / k for k = 2, ..., 14, so that
+     lgamma(1 + a) = -euler_gamma a + a^2 P(a), with a relative error below
+     2^-55 for a < 1/16.  */
+  .lgamma1p_poly = { V2 (0x1.a51a6625307d3p-1), V2 (-0x1.9a4d55beab2d7p-2),
+		     V2 (0x1.151322ac7d848p-2), V2 (-0x1.a8b9c17aa6149p-3),
+		     V2 (0x1.5b40cb100c306p-3), V2 (-0x1.2703a1dcea3aep-3),
+		     V2 (0x1.010b36af86397p-3), V2 (-0x1.c806706d57db4p-4),
+		     V2 (0x1.9a01e385d5f8fp-4), V2 (-0x1.748c33114c6d6p-4),
+		     V2 (0x1.556ad63243bc4p-4), V2 (-0x1.3b1d971fc5985p-4),
+		     V2 (0x1.2496df8320c5fp-4) },
+  /* -euler_gamma.  */
+  .neg_euler_hi = V2 (-0x1.2788cfc6fb619p-1),
+  .neg_euler_lo = V2 (0x1.6cb90701fbfabp-58),
+  /* log(2 pi) / 2.  */
+  .half_ln2pi_hi = V2 (0x1.d67f1c864beb5p-1),
+  .half_ln2pi_lo = V2 (-0x1.65b5a1b7ff5dfp-55),
+};
+
+/* Shifts used by lgamma, so that Stirling's series is only used for
+   z >= V_GAMMA_INC_SHIFT.  */
+#define V_GAMMA_INC_SHIFT 16
+/* Number of terms of expm1 and of the series S in v_gamma_q_small_a.  */
+#define V_GAMMA_INC_EXPM1_TERMS 20
+#define V_GAMMA_INC_SMALL_TERMS 18
+/* Cap on the number of iterations of the series and the continued
+   fraction.  */
+#define V_GAMMA_INC_MAX_ITER (1 << 16)
+
+/* s + e = a + b exactly.  */
+static inline float64x2_t
+v_two_sum_f64 (float64x2_t a, float64x2_t b, float64x2_t *e)
+{
+  float64x2_t s = vaddq_f64 (a, b);
+  float64x2_t bb = vsubq_f64 (s, a);
+  *e = vaddq_f64 (vsubq_f64 (a, vsubq_f64 (s, bb)), vsubq_f64 (b, bb));
+  return s;
+}
+
+/* log(x) as hi + *lo for x positive and finite, including subnormals.  */
+static inline float64x2_t
+v_log_dd_inline (float64x2_t x, float64x2_t *lo, const struct v_pow_data *pd)
+{
+  uint64x2_t ix = vreinterpretq_u64_f64 (x);
+  uint64x2_t sub = vcltq_f64 (x, v_f64 (0x1p-1022));
+  if (unlikely (v_any_u64 (sub)))
+    {
+      /* Normalize subnormal x so exponent becomes negative, as in pow.  */
+      uint64x2_t in
+	  = vreinterpretq_u64_f64 (vmulq_f64 (x, v_f64 (0x1p52)));
+      ix = vbslq_u64 (sub, vsubq_u64 (in, v_u64 (52ULL << 52)), ix);
+    }
+  return v_pow_log_inline (ix, lo, pd);
+}
+
+/* lgamma(ah + al) as hi + *lo, for ah > 0 finite and |al| <= ulp(ah).  The
+   absolute error is about 2^-61 + 2^-68 a log(a).  */
+static inline float64x2_t
+v_lgamma_dd_inline (float64x2_t ah, float64x2_t al, float64x2_t *lo,
+		    const struct v_gamma_inc_consts *d,
+		    const struct v_pow_data *pd)
+{
+  /* lgamma(a) = lgamma(z) - log(a (a + 1) ... (a + n - 1)), with z = a + n
+     and n = ceil(16 - a) the number of shifts needed.  The product is
+     accumulated as a double-double.  */
+  float64x2_t n = vmaxnmq_f64 (
+      vrndpq_f64 (vsubq_f64 (v_f64 (V_GAMMA_INC_SHIFT), ah)), v_f64 (0));
+  float64x2_t ph = v_f64 (1), pl = v_f64 (0);
+  for (int k = 0; k < V_GAMMA_INC_SHIFT; k++)
+    {
+      uint64x2_t m = vcltq_f64 (v_f64 (k), n);
+      if (!v_any_u64 (m))
+	break;
+      float64x2_t tl, th = v_two_sum_f64 (ah, v_f64 (k), &tl);
+      th = vbslq_f64 (m, th, v_f64 (1));
+      tl = vreinterpretq_f64_u64 (
+	  vandq_u64 (m, vreinterpretq_u64_f64 (vaddq_f64 (tl, al))));
+      float64x2_t h = vmulq_f64 (ph, th);
+      float64x2_t e = vfmaq_f64 (vnegq_f64 (h), ph, th);
+      e = vfmaq_f64 (vfmaq_f64 (e, ph, tl), pl, th);
+      ph = vaddq_f64 (h, e);
+      pl = vsubq_f64 (e, vsubq_f64 (ph, h));
+    }
+
+  /* Stirling's series for z >= 16,
+     lgamma(z) = (z - 1/2) log(z) - z + log(2 pi) / 2 + S(1/z).  */
+  float64x2_t zl, zh = v_two_sum_f64 (ah, n, &zl);
+  zl = vaddq_f64 (zl, al);
+  float64x2_t lzl, lzh = v_log_dd_inline (zh, &lzl, pd);
+  lzl = vaddq_f64 (lzl, vdivq_f64 (zl, zh));
+  float64x2_t m = vsubq_f64 (zh, v_f64 (0.5));
+  float64x2_t hi = vmulq_f64 (m, lzh);
+  float64x2_t l = vfmaq_f64 (vnegq_f64 (hi), m, lzh);
+  l = vfmaq_f64 (vfmaq_f64 (l, m, lzl), zl, lzh);
+  float64x2_t e;
+  hi = v_two_sum_f64 (hi, vnegq_f64 (zh), &e);
+  l = vaddq_f64 (l, vsubq_f64 (e, zl));
+  hi = v_two_sum_f64 (hi, d->half_ln2pi_hi, &e);
+  l = vaddq_f64 (l, vaddq_f64 (e, d->half_ln2pi_lo));
+  float64x2_t iz = vdivq_f64 (v_f64 (1), zh);
+  float64x2_t s
+      = vmulq_f64 (iz, v_horner_6_f64 (vmulq_f64 (iz, iz), d->stirling_poly));
+  l = vaddq_f64 (l, s);
+
+  float64x2_t lpl, lph = v_log_dd_inline (ph, &lpl, pd);
+  lpl = vaddq_f64 (lpl, vdivq_f64 (pl, ph));
+  hi = v_two_sum_f64 (hi, vnegq_f64 (lph), &e);
+  l = vsubq_f64 (vaddq_f64 (l, e), lpl);
+  hi = v_two_sum_f64 (hi, l, lo);
+  return hi;
+}
+
+/* exp(hi + lo) for |lo| <= ulp(hi) / 2 or hi = 0.  */
+static inline float64x2_t
+v_exp_dd_inline (float64x2_t hi, float64x2_t lo, const struct v_pow_data *pd)
+{
+  return v_pow_exp_inline (hi, lo, pd);
+}
+
+/* -expm1(t) - (1 + expm1(t)) a S(a, x), with t = th + tl, which is Q(a, x)
+   for small a and x < 0.75, see v_gamma_inc_inline.  The two terms can
+   cancel, so both are computed as double-doubles.  The caller guarantees
+   |t| < 0.8, so expm1 is computed from its Taylor series.  */
+static inline float64x2_t
+v_gamma_q_small_a (float64x2_t a, float64x2_t x, float64x2_t th,
+		   float64x2_t tl)
+{
+  float64x2_t one = v_f64 (1), e;
+  /* expm1(t) = t + t^2 (1/2 + t/6 + ...), with the leading term exact.  */
+  float64x2_t p = one;
+  for (int k = V_GAMMA_INC_EXPM1_TERMS; k >= 3; k--)
+    p = vfmaq_f64 (one, p, vmulq_f64 (th, v_f64 (1.0 / k)));
+  float64x2_t t2 = vmulq_f64 (th, th);
+  float64x2_t t2l = vfmaq_f64 (vnegq_f64 (t2), th, th);
+  p = vmulq_f64 (p, v_f64 (0.5));
+  float64x2_t em1 = v_two_sum_f64 (th, vmulq_f64 (t2, p), &e);
+  float64x2_t em1l = vfmaq_f64 (e, t2l, p);
+  em1l = vfmaq_f64 (em1l, tl, vaddq_f64 (one, em1));
+
+  /* S = sum_n (-x)^n / (n! (a + n)) for n >= 1, with a fixed number of terms
+     which is enough for x < 0.75.  The ratios 1 / (a + n) are corrected for
+     the rounding error of a + n, and the leading term is kept as a
+     double-double.  */
+  float64x2_t s
+      = vdivq_f64 (one, vaddq_f64 (a, v_f64 (V_GAMMA_INC_SMALL_TERMS)));
+  for (int k = V_GAMMA_INC_SMALL_TERMS - 1; k >= 2; k--)
+    {
+      float64x2_t akl, akh = v_two_sum_f64 (a, v_f64 (k), &akl);
+      float64x2_t r = vdivq_f64 (one, akh);
+      r = vfmsq_f64 (r, vmulq_f64 (r, r), akl);
+      s = vfmsq_f64 (r, vmulq_f64 (x, v_f64 (1.0 / (k + 1))), s);
+    }
+  float64x2_t akl, akh = v_two_sum_f64 (a, one, &akl);
+  float64x2_t r = vdivq_f64 (one, akh);
+  float64x2_t rl = vfmsq_f64 (vfmsq_f64 (one, r, akh), r, akl);
+  rl = vdivq_f64 (rl, akh);
+  float64x2_t hx = vmulq_f64 (x, v_f64 (0.5));
+  float64x2_t u = vmulq_f64 (hx, s);
+  float64x2_t ul = vfmaq_f64 (vnegq_f64 (u), hx, s);
+  s = v_two_sum_f64 (r, vnegq_f64 (u), &e);
+  float64x2_t sl = vsubq_f64 (vaddq_f64 (e, rl), ul);
+
+  /* -a S = a x s = m + ml, with a x split exactly.  */
+  float64x2_t ax = vmulq_f64 (a, x);
+  float64x2_t axl = vfmaq_f64 (vnegq_f64 (ax), a, x);
+  float64x2_t m = vmulq_f64 (ax, s);
+  float64x2_t ml = vfmaq_f64 (vnegq_f64 (m), ax, s);
+  ml = vfmaq_f64 (vfmaq_f64 (ml, ax, sl), axl, s);
+
+  /* (1 + em1) (m + ml) - em1.  */
+  float64x2_t y = v_two_sum_f64 (m, vnegq_f64 (em1), &e);
+  float64x2_t yl = vsubq_f64 (vaddq_f64 (e, ml), em1l);
+  yl = vfmaq_f64 (yl, em1, vaddq_f64 (m, ml));
+  return vaddq_f64 (y, yl);
+}
+
+/* P(a, x), or Q(a, x) if upper is set, for a and x positive and finite.  */
+static inline float64x2_t
+v_gamma_inc_inline (float64x2_t a, float64x2_t x, int upper, double eps,
+		    int max_iter, const struct v_gamma_inc_consts *d,
+		    const struct v_pow_data *pd)
+{
+  float64x2_t one = v_f64 (1);
+
+  /* prefix = x^a e^-x / Gamma(a).  */
+  float64x2_t gl, gh = v_lgamma_dd_inline (a, v_f64 (0), &gl, d, pd);
+  float64x2_t lxl, lxh = v_log_dd_inline (x, &lxl, pd);
+  float64x2_t alh = vmulq_f64 (a, lxh);
+  float64x2_t all = vfmaq_f64 (vfmaq_f64 (vnegq_f64 (alh), a, lxh), a, lxl);
+  float64x2_t e, lo = all;
+  float64x2_t hi = v_two_sum_f64 (alh, vnegq_f64 (x), &e);
+  lo = vaddq_f64 (lo, e);
+  hi = v_two_sum_f64 (hi, vnegq_f64 (gh), &e);
+  lo = vsubq_f64 (vaddq_f64 (lo, e), gl);
+  hi = v_two_sum_f64 (hi, lo, &lo);
+  float64x2_t prefix = v_exp_dd_inline (hi, lo, pd);
+
+  /* The continued fraction is used for x >= max (a, 0.75), and the series
+     otherwise.  For Q with small a and x < 0.75, 1 - P cancels badly, so Q
+     is computed directly by v_gamma_q_small_a instead, where that is
+     accurate: a log(x) >= -0.8 for x < 0.5 and a <= x otherwise.  */
+  uint64x2_t cf = vandq_u64 (vcgeq_f64 (x, v_f64 (0.75)), vcgeq_f64 (x, a));
+  uint64x2_t small = v_u64 (0);
+  if (upper)
+    {
+      uint64x2_t tiny_x = vcltq_f64 (x, v_f64 (0.5));
+      small = vbslq_u64 (tiny_x, vcgeq_f64 (alh, v_f64 (-0.8)),
+			 vcleq_f64 (a, x));
+      small = vbicq_u64 (small, cf);
+    }
+  uint64x2_t series = vmvnq_u64 (vorrq_u64 (cf, small));
+  float64x2_t ys = v_f64 (0), yc = v_f64 (0), yq = v_f64 (0);
+
+  /* The series and the continued fraction are first evaluated forwards, only
+     to find how many terms are needed: each lane drops out of the loop as
+     soon as its own terms are negligible, and the loop stops once all lanes
+     have converged.  They are then summed backwards over that many terms,
+     which is cheaper than the forward evaluation and does not accumulate
+     rounding errors.  The extra terms do not change the lanes which
+     converged early.  */
+  if (v_any_u64 (series))
+    {
+      /* P = prefix / a * (1 + x / (a + 1) (1 + x / (a + 2) (1 + ...))).  */
+      float64x2_t t = one, sum = one, an = a;
+      uint64x2_t active = series;
+      int n = 0;
+      while (n < max_iter && v_any_u64 (active))
+	{
+	  n++;
+	  an = vaddq_f64 (an, one);
+	  t = vmulq_f64 (t, vdivq_f64 (x, an));
+	  sum = vaddq_f64 (sum, t);
+	  active = vandq_u64 (active,
+			      vcgtq_f64 (t, vmulq_f64 (sum, v_f64 (eps))));
+	}
+      /* a + n is rounded once it is in a larger binade than a, with errors
+	 of the same sign for every n, so the rounding error of the sum is
+	 corrected for in the ratios x / (a + n).  1/x is kept finite for
+	 subnormal x, where the correction is negligible.  */
+      float64x2_t s = one;
+      float64x2_t ix = vdivq_f64 (one, vmaxq_f64 (x, v_f64 (0x1p-1022)));
+      for (; n > 0; n--)
+	{
+	  float64x2_t ahl, ah = v_two_sum_f64 (a, v_f64 (n), &ahl);
+	  float64x2_t r = vdivq_f64 (x, ah);
+	  r = vfmsq_f64 (r, r, vmulq_f64 (vmulq_f64 (ahl, r), ix));
+	  s = vfmaq_f64 (one, s, r);
+	}
+      ys = vmulq_f64 (prefix, vdivq_f64 (s, a));
+    }
+
+  if (v_any_u64 (cf))
+    {
+      /* Q = prefix / (b_0 + a_1 / (b_1 + a_2 / (b_2 + ...))), with
+	 a_i = i (a - i) and b_i = x - a + 2i + 1.  The forward pass uses the
+	 modified Lentz algorithm, with D_i = 1 / (b_i + a_i D_(i-1)).  The
+	 difference between successive convergents h_i is
+	 w_i = w_(i-1) a_i D_(i-1) D_i, which unlike h_i / h_(i-1) - 1 stays
+	 accurate below the rounding error of h_i.  Close to x = 0.75 the
+	 convergence is slow, so that the remaining terms add up to much more
+	 than the last one, and the test uses a smaller tolerance.  */
+      float64x2_t cf_eps = v_f64 (eps * 0x1p-8);
+      float64x2_t b = vsubq_f64 (vaddq_f64 (x, one), a);
+      float64x2_t dn = vdivq_f64 (one, b);
+      float64x2_t c = v_f64 (0x1p1000), h = dn, w = dn;
+      uint64x2_t active = cf;
+      int n = 0;
+      while (n < max_iter && v_any_u64 (active))
+	{
+	  n++;
+	  float64x2_t fn = v_f64 (n);
+	  float64x2_t an = vmulq_f64 (fn, vsubq_f64 (a, fn));
+	  b = vaddq_f64 (b, v_f64 (2));
+	  w = vmulq_f64 (w, vmulq_f64 (an, dn));
+	  dn = vdivq_f64 (one, vfmaq_f64 (b, an, dn));
+	  c = vaddq_f64 (b, vdivq_f64 (an, c));
+	  h = vmulq_f64 (h, vmulq_f64 (dn, c));
+	  w = vmulq_f64 (w, dn);
+	  active = vandq_u64 (active, vcagtq_f64 (w, vmulq_f64 (h, cf_eps)));
+	}
+      float64x2_t xa = vsubq_f64 (x, a), t = v_f64 (0);
+      for (; n > 0; n--)
+	{
+	  float64x2_t fn = v_f64 (n);
+	  float64x2_t an = vmulq_f64 (fn, vsubq_f64 (a, fn));
+	  t = vdivq_f64 (an, vaddq_f64 (vaddq_f64 (xa, v_f64 (2 * n + 1)), t));
+	}
+      yc = vdivq_f64 (prefix, vaddq_f64 (vaddq_f64 (xa, one), t));
+    }
+
+  if (upper && v_any_u64 (small))
+    {
+      /* t = log(x^a / Gamma(1 + a)), as a double-double.  lgamma(1 + a)
+	 from v_lgamma_dd_inline has an absolute error of about 2^-62, which
+	 is too large relative to lgamma(1 + a) ~ -0.58 a for tiny a, so its
+	 Taylor series is used instead for a < 1/16, with the leading term
+	 as a double-double.  */
+      float64x2_t al, ah = v_two_sum_f64 (one, a, &al);
+      gh = v_lgamma_dd_inline (ah, al, &gl, d, pd);
+      uint64x2_t tiny_a = vcltq_f64 (a, v_f64 (0x1p-4));
+      if (v_any_u64 (tiny_a))
+	{
+	  float64x2_t a2 = vmulq_f64 (a, a);
+	  float64x2_t p = vmulq_f64 (
+	      a2, v_pw_horner_12_f64 (a, a2, d->lgamma1p_poly));
+	  float64x2_t th = vmulq_f64 (a, d->neg_euler_hi);
+	  float64x2_t tl = vfmaq_f64 (vnegq_f64 (th), a, d->neg_euler_hi);
+	  tl = vaddq_f64 (tl, vfmaq_f64 (p, a, d->neg_euler_lo));
+	  gh = vbslq_f64 (tiny_a, th, gh);
+	  gl = vbslq_f64 (tiny_a, tl, gl);
+	}
+      lo = all;
+      hi = v_two_sum_f64 (alh, vnegq_f64 (gh), &e);
+      lo = vsubq_f64 (vaddq_f64 (lo, e), gl);
+      hi = v_two_sum_f64 (hi, lo, &lo);
+      yq = v_gamma_q_small_a (a, x, hi, lo);
+    }
+
+  if (upper)
+    return vbslq_f64 (cf, yc, vbslq_f64 (small, yq, vsubq_f64 (one, ys)));
+  return vbslq_f64 (cf, vsubq_f64 (one, yc), ys);
+}
+
+/* Results for lanes where a or x is not positive and finite: P(a, 0) = 0,
+   P(a, inf) = 1 and P(inf, x) = 0, and NaN for invalid arguments.  */
+static inline float64x2_t
+v_gamma_inc_special (float64x2_t a, float64x2_t x, int upper)
+{
+  float64x2_t inf = v_f64 (INFINITY);
+  uint64x2_t xinf = vceqq_f64 (x, inf);
+  uint64x2_t valid = vandq_u64 (vcgtzq_f64 (a), vcgezq_f64 (x));
+  valid = vbicq_u64 (valid, vandq_u64 (xinf, vceqq_f64 (a, inf)));
+  float64x2_t y = vbslq_f64 (xinf, v_f64 (1), v_f64 (0));
+  if (upper)
+    y = vsubq_f64 (v_f64 (1), y);
+  return vbslq_f64 (valid, y, v_f64 (NAN));
+}
+
+/* P(a, x) or Q(a, x) for any a and x.  */
+static inline float64x2_t
+v_gamma_inc (float64x2_t a, float64x2_t x, int upper, double eps,
+	     int max_iter)
+{
+  const struct v_gamma_inc_consts *d = ptr_barrier (&v_gamma_inc_consts);
+  const struct v_pow_data *pd = ptr_barrier (&v_pow_data);
+  /* Lanes where a or x is zero, negative, infinite or NaN.  */
+  uint64x2_t special = vorrq_u64 (
+      vcgeq_u64 (vsubq_u64 (vreinterpretq_u64_f64 (a), v_u64 (1)),
+		 v_u64 (0x7fefffffffffffff)),
+      vcgeq_u64 (vsubq_u64 (vreinterpretq_u64_f64 (x), v_u64 (1)),
+		 v_u64 (0x7fefffffffffffff)));
+  if (likely (!v_any_u64 (special)))
+    return v_gamma_inc_inline (a, x, upper, eps, max_iter, d, pd);
+  /* Replace special lanes with arguments which converge immediately.  */
+  float64x2_t y = v_gamma_inc_inline (vbslq_f64 (special, v_f64 (1), a),
+				      vbslq_f64 (special, v_f64 (1), x),
+				      upper, eps, max_iter, d, pd);
+  return vbslq_f64 (special, v_gamma_inc_special (a, x, upper), y);
+}
+
+#endif
@@ -0,0 +1,35 @@
+/*
+ * Single-precision vector regularised upper incomplete gamma function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_gamma_inc_common.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+/* AdvSIMD approximation for single-precision Q(a, x), see
+   v_gamma_inc_common.h.  The inputs are widened and the double-precision
+   approximation used, with a tolerance of 2^-30 on the series and the
+   continued fraction.  Maximum measured error is 0.56 ULP, for a close to
+   1000.  */
+float32x4_t VPCS_ATTR V_NAME_F2 (gamma_q) (float32x4_t a, float32x4_t x)
+{
+  /* Widen to double precision and evaluate on both halves of the vector.  */
+  float64x2_t lo = v_gamma_inc (vcvt_f64_f32 (vget_low_f32 (a)),
+				vcvt_f64_f32 (vget_low_f32 (x)), 1, 0x1p-30,
+				V_GAMMA_INC_MAX_ITER);
+  float64x2_t hi = v_gamma_inc (vcvt_high_f64_f32 (a), vcvt_high_f64_f32 (x),
+				1, 0x1p-30, V_GAMMA_INC_MAX_ITER);
+  return vcvt_high_f32_f64 (vcvt_f32_f64 (lo), hi);
+}
+
+PL_SIG (V, F, 2, gamma_q, 0.1, 10.0)
+PL_TEST_ULP (V_NAME_F2 (gamma_q), 0.07)
+PL_TEST_INTERVAL2 (V_NAME_F2 (gamma_q), 0x1p-10, 1, 0, 0x1p-10, 10000)
+PL_TEST_INTERVAL2 (V_NAME_F2 (gamma_q), 0x1p-10, 1, 0x1p-10, 4, 100000)
+PL_TEST_INTERVAL2 (V_NAME_F2 (gamma_q), 1, 10, 0, 20, 100000)
+PL_TEST_INTERVAL2 (V_NAME_F2 (gamma_q), 10, 100, 0, 200, 100000)
+PL_TEST_INTERVAL2 (V_NAME_F2 (gamma_q), 100, 1000, 50, 2000, 10000)
+PL_TEST_INTERVAL2 (V_NAME_F2 (gamma_q), 0x1p-10, 100, 100, inf, 10000)
@@ -0,0 +1,28 @@
+/*
+ * Double-precision vector i0(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_bessel_common.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+/* AdvSIMD approximation for the double-precision modified Bessel function of
+   the first kind of order 0, see v_bessel_common.h.
+   Maximum measured error is 4.03 ULP:
+   _ZGVnN2v_i0(0x1.2e30f0945c291p+9) got 0x1.fdfb1711ac585p+865
+				     want 0x1.fdfb1711ac581p+865.  */
+float64x2_t VPCS_ATTR V_NAME_D1 (i0) (float64x2_t x)
+{
+  const struct v_bessel_consts *d = ptr_barrier (&v_bessel_consts);
+  float64x2_t y = v_bessel_i_inline (vabsq_f64 (x), 0, d);
+  return y;
+}
+
+PL_SIG (V, D, 1, i0, -10.0, 10.0)
+PL_TEST_ULP (V_NAME_D1 (i0), 3.59)
+PL_TEST_SYM_INTERVAL (V_NAME_D1 (i0), 0, 16, 100000)
+PL_TEST_SYM_INTERVAL (V_NAME_D1 (i0), 16, 0x1.65p9, 100000)
+PL_TEST_SYM_INTERVAL (V_NAME_D1 (i0), 0x1.65p9, inf, 1000)
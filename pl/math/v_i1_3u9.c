@@ -0,0 +1,32 @@
+/*
+ * Double-precision vector i1(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_bessel_common.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+/* AdvSIMD approximation for the double-precision modified Bessel function of
+   the first kind of order 1, see v_bessel_common.h.
+   Maximum measured error is 3.89 ULP:
+   _ZGVnN2v_i1(0x1.030751db2267cp+4) got 0x1.fb91cbb2c6026p+19
+				     want 0x1.fb91cbb2c6022p+19.  */
+float64x2_t VPCS_ATTR V_NAME_D1 (i1) (float64x2_t x)
+{
+  const struct v_bessel_consts *d = ptr_barrier (&v_bessel_consts);
+  float64x2_t y = v_bessel_i_inline (vabsq_f64 (x), 1, d);
+  /* i1 is odd.  */
+  uint64x2_t sign
+      = vandq_u64 (vreinterpretq_u64_f64 (x), v_u64 (0x8000000000000000));
+  y = vreinterpretq_f64_u64 (veorq_u64 (vreinterpretq_u64_f64 (y), sign));
+  return y;
+}
+
+PL_SIG (V, D, 1, i1, -10.0, 10.0)
+PL_TEST_ULP (V_NAME_D1 (i1), 3.44)
+PL_TEST_SYM_INTERVAL (V_NAME_D1 (i1), 0, 16, 100000)
+PL_TEST_SYM_INTERVAL (V_NAME_D1 (i1), 16, 0x1.65p9, 100000)
+PL_TEST_SYM_INTERVAL (V_NAME_D1 (i1), 0x1.65p9, inf, 1000)
@@ -0,0 +1,91 @@
+/*
+ * Double-precision vector log(1+x) function with extra precision result.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "pl_test.h"
+#include "v_pow_inline.h"
+
+static const struct data
+{
+  float64x2_t c2, c3, c4, c5, small_bound;
+  uint64x2_t minus_one, inf;
+} data = {
+  /* Taylor coefficients of log1p, used for |x| < 2^-20.  */
+  .c2 = V2 (-0x1p-1),
+  .c3 = V2 (0x1.5555555555555p-2),
+  .c4 = V2 (-0x1p-2),
+  .c5 = V2 (0x1.999999999999ap-3),
+  .small_bound = V2 (0x1p-20),
+  .minus_one = V2 (0xbff0000000000000),
+  .inf = V2 (0x7ff0000000000000),
+};
+
+static float64x2x2_t VPCS_ATTR NOINLINE
+log1p_dd_special_case (float64x2_t x, float64x2x2_t y, uint64x2_t special)
+{
+  return (float64x2x2_t){ v_call_f64 (log1p, x, y.val[0], special),
+			  vbslq_f64 (special, v_f64 (0), y.val[1]) };
+}
+
+/* Double-precision vector log1p returning the result as hi + lo.
+   1 + x is computed exactly as u + ulo, then
+   log1p(x) = log(u) + log1p(ulo/u) ~= log(u) + ulo/u, using the log core of
+   vector pow.  For |x| < 2^-20 a Taylor expansion is used instead.
+   Relative error of hi + lo is 1.4 * 2^-68.  For x <= -1, inf and nan hi is
+   log1p(x) and lo is 0.  */
+VPCS_ATTR float64x2x2_t
+_ZGVnN2v_log1p_dd (float64x2_t x)
+{
+  const struct data *d = ptr_barrier (&data);
+  const struct v_pow_data *dp = ptr_barrier (&v_pow_data);
+  uint64x2_t ix = vreinterpretq_u64_f64 (x);
+  uint64x2_t ia = vbicq_u64 (ix, v_u64 (0x8000000000000000));
+  /* x <= -1, inf or nan.  */
+  uint64x2_t special
+      = vorrq_u64 (vcgeq_u64 (ix, d->minus_one), vcgeq_u64 (ia, d->inf));
+
+  /* u + ulo = 1 + x exactly (2Sum).  */
+  float64x2_t u = vaddq_f64 (v_f64 (1.0), x);
+  float64x2_t v = vsubq_f64 (u, x);
+  float64x2_t ulo = vaddq_f64 (vsubq_f64 (v_f64 (1.0), v),
+			       vsubq_f64 (x, vsubq_f64 (u, v)));
+  float64x2_t lo;
+  float64x2_t hi = v_pow_log_inline (vreinterpretq_u64_f64 (u), &lo, dp);
+  /* |ulo/u| <= 2^-53, so the error of the first order term is below
+     2^-107 and for |x| >= 2^-20 that is below 2^-87 relative to log1p(x).  */
+  lo = vaddq_f64 (lo, vdivq_f64 (ulo, u));
+  float64x2_t y = vaddq_f64 (hi, lo);
+  lo = vaddq_f64 (vsubq_f64 (hi, y), lo);
+
+  /* |x| < 2^-20: log1p(x) = x - x^2/2 + x^3/3 - x^4/4 + x^5/5.  */
+  float64x2_t x2 = vmulq_f64 (x, x);
+  float64x2_t p = vfmaq_f64 (d->c4, x, d->c5);
+  p = vfmaq_f64 (d->c3, x, p);
+  p = vfmaq_f64 (d->c2, x, p);
+  p = vmulq_f64 (x2, p);
+  float64x2_t ys = vaddq_f64 (x, p);
+  float64x2_t los = vaddq_f64 (vsubq_f64 (x, ys), p);
+  uint64x2_t small = vcaltq_f64 (x, d->small_bound);
+
+  float64x2x2_t r = { { vbslq_f64 (small, ys, y), vbslq_f64 (small, los, lo) } };
+  if (unlikely (v_any_u64 (special)))
+    return log1p_dd_special_case (x, r, special);
+  return r;
+}
+
+PL_TEST_ULP (_ZGVnN2v_log1p_dd_hi, 0.01)
+PL_TEST_INTERVAL (_ZGVnN2v_log1p_dd_hi, 0, 0xffff000000000000, 10000)
+PL_TEST_INTERVAL (_ZGVnN2v_log1p_dd_hi, -0x1p-20, 0x1p-20, 40000)
+PL_TEST_INTERVAL (_ZGVnN2v_log1p_dd_hi, 0x1p-20, 0x1p4, 40000)
+PL_TEST_INTERVAL (_ZGVnN2v_log1p_dd_hi, -0x1p-20, -1, 40000)
+PL_TEST_INTERVAL (_ZGVnN2v_log1p_dd_hi, 0x1p4, inf, 40000)
+PL_TEST_ULP (_ZGVnN2v_log1p_dd_hilo, 1.3)
+PL_TEST_INTERVAL (_ZGVnN2v_log1p_dd_hilo, 0, 0xffff000000000000, 10000)
+PL_TEST_INTERVAL (_ZGVnN2v_log1p_dd_hilo, -0x1p-20, 0x1p-20, 40000)
+PL_TEST_INTERVAL (_ZGVnN2v_log1p_dd_hilo, 0x1p-20, 0x1p4, 40000)
+PL_TEST_INTERVAL (_ZGVnN2v_log1p_dd_hilo, -0x1p-20, -1, 40000)
+PL_TEST_INTERVAL (_ZGVnN2v_log1p_dd_hilo, 0x1p4, inf, 40000)
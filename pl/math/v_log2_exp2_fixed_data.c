@@ -0,0 +1,49 @@
+/*
+ * Data for fixed-point log2 and exp2.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "math_config.h"
+
+/* The table and polynomial of log2f (see math/log2f_data.c), in fixed point.
+   invc is in Q31 and logc = -log2(invc) is computed for the rounded invc, in
+   Q30.  The polynomial approximates log2(1+r) ~= r * P(r), coefficients are
+   in Q30 and ordered from the highest degree.  */
+const struct v_log2_fixed_data __v_log2_fixed_data = {
+  .tab = {
+    { 0xb30f63d0, -0x1efec65c },
+    { 0xab8f6a55, -0x1b0b6833 },
+    { 0xa4a9cf88, -0x17418b0a },
+    { 0x9e4cad86, -0x139de91b },
+    { 0x9868c864, -0x101d9bf4 },
+    { 0x92f113d8, -0xcbe0e8d },
+    { 0x8dda5251, -0x97cf1ca },
+    { 0x891ac784, -0x65832f0 },
+    { 0x84a9fa0d, -0x34df3b7 },
+    { 0x80000000, 0x0 },
+    { 0x798233f6, 0x4ce32a8 },
+    { 0x7292cc7c, 0xa3b54aa },
+    { 0x6c80d95e, 0xf4205a5 },
+    { 0x670b458f, 0x140645f0 },
+    { 0x621b980e, 0x188e9c2c },
+    { 0x5d9f73d5, 0x1ce0a44f },
+  },
+  .poly = { -0x1712b6f7, 0x1ecabf49, -0x2e2a8f40, 0x5c551d7d },
+};
+
+/* 2^(i/32) in Q30, and the polynomial of exp2f for N = 32 (see
+   math/exp2f_data.c) in Q31, with 2^r - 1 ~= r * P(r) for |r| <= 1/64,
+   ordered from the highest degree.  */
+const struct v_exp2_fixed_data __v_exp2_fixed_data = {
+  .tab = {
+    0x40000000, 0x4166c34c, 0x42d561b4, 0x444c0740, 0x45cae0f2, 0x47521cc6,
+    0x48e1e9ba, 0x4a7a77d4, 0x4c1bf829, 0x4dc69cdd, 0x4f7a9930, 0x51382182,
+    0x52ff6b55, 0x54d0ad5a, 0x56ac1f75, 0x5891fac1, 0x5a82799a, 0x5c7dd7a4,
+    0x5e8451d0, 0x60962665, 0x62b39509, 0x64dcdec3, 0x6712460b, 0x69540ec9,
+    0x6ba27e65, 0x6dfddbcc, 0x70666f76, 0x72dc8374, 0x75606374, 0x77f25cce,
+    0x7a92be8b, 0x7d41d96e,
+  },
+  .poly = { 0x71abe13, 0x1ebfce51, 0x58b90bfc },
+};
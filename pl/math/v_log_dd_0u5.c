@@ -0,0 +1,59 @@
+/*
+ * Double-precision vector log(x) function with extra precision result.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_math.h"
+#include "pl_test.h"
+#include "v_pow_inline.h"
+
+static float64x2x2_t VPCS_ATTR NOINLINE
+log_dd_special_case (float64x2_t x, float64x2x2_t y, uint64x2_t special)
+{
+  return (float64x2x2_t){ v_call_f64 (log, x, y.val[0], special),
+			  vbslq_f64 (special, v_f64 (0), y.val[1]) };
+}
+
+/* Double-precision vector log returning the result as hi + lo, using the
+   same table and polynomial as vector pow (see v_pow_log_data.c).
+   Relative error of hi + lo is 1.3 * 2^-68, so hi is log(x) rounded to
+   nearest except in rare cases.  For x <= 0, inf and nan hi is log(x) and
+   lo is 0.  */
+VPCS_ATTR float64x2x2_t
+_ZGVnN2v_log_dd (float64x2_t x)
+{
+  const struct v_pow_data *d = ptr_barrier (&v_pow_data);
+  uint64x2_t ix = vreinterpretq_u64_f64 (x);
+  uint64x2_t top = vshrq_n_u64 (ix, 52);
+  /* x <= 0, inf or nan.  */
+  uint64x2_t special
+      = vorrq_u64 (vcgeq_u64 (top, v_u64 (0x7ff)), vceqzq_u64 (ix));
+
+  uint64x2_t sub_x = vceqzq_u64 (top);
+  if (unlikely (v_any_u64 (sub_x)))
+    {
+      /* Normalize subnormal x so exponent becomes negative.  */
+      uint64x2_t ix_norm
+	  = vreinterpretq_u64_f64 (vmulq_f64 (x, v_f64 (0x1p52)));
+      ix_norm = vsubq_u64 (ix_norm, v_u64 (52ULL << 52));
+      ix = vbslq_u64 (sub_x, ix_norm, ix);
+    }
+
+  float64x2x2_t y;
+  y.val[0] = v_pow_log_inline (ix, &y.val[1], d);
+
+  if (unlikely (v_any_u64 (special)))
+    return log_dd_special_case (x, y, special);
+  return y;
+}
+
+PL_TEST_ULP (_ZGVnN2v_log_dd_hi, 0.01)
+PL_TEST_INTERVAL (_ZGVnN2v_log_dd_hi, 0, 0xffff000000000000, 10000)
+PL_TEST_INTERVAL (_ZGVnN2v_log_dd_hi, 0x1p-4, 0x1p4, 400000)
+PL_TEST_INTERVAL (_ZGVnN2v_log_dd_hi, 0, inf, 400000)
+PL_TEST_ULP (_ZGVnN2v_log_dd_hilo, 1.3)
+PL_TEST_INTERVAL (_ZGVnN2v_log_dd_hilo, 0, 0xffff000000000000, 10000)
+PL_TEST_INTERVAL (_ZGVnN2v_log_dd_hilo, 0x1p-4, 0x1p4, 400000)
+PL_TEST_INTERVAL (_ZGVnN2v_log_dd_hilo, 0, inf, 400000)
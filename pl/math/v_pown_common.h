@@ -0,0 +1,122 @@
+/*
+ * Helpers for double-precision AdvSIMD pown, rootn and compoundn.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+#ifndef PL_MATH_V_POWN_COMMON_H
+#define PL_MATH_V_POWN_COMMON_H
+
+#include "v_math.h"
+#include "v_pow_inline.h"
+#include "pown_common.h"
+
+/* Lanes of b for which b^n can be computed by repeated squaring, see
+   pown_use_squaring.  */
+static inline uint64x2_t
+v_pown_use_squaring (float64x2_t b, int64x2_t n)
+{
+  uint64x2_t an = vreinterpretq_u64_s64 (vabsq_s64 (n));
+  int64x2_t e = vreinterpretq_s64_u64 (
+      vandq_u64 (vshrq_n_u64 (vreinterpretq_u64_f64 (b), 52), v_u64 (0x7ff)));
+  e = vabsq_s64 (vsubq_s64 (e, v_s64 (0x3ff)));
+  float64x2_t bound = vmulq_f64 (vcvtq_f64_u64 (an),
+				 vcvtq_f64_s64 (vaddq_s64 (e, v_s64 (1))));
+  return vandq_u64 (vcleq_u64 (an, v_u64 (PownMaxSquaring)),
+		    vcleq_f64 (bound, v_f64 (PownSquaringBound)));
+}
+
+/* (bh + bl)^n by repeated squaring in double-double arithmetic, with the same
+   scheme as the scalar pown_squaring.  Lanes are iterated until the largest
+   |n| is exhausted.  */
+static inline float64x2_t
+v_pown_squaring (float64x2_t bh, float64x2_t bl, int64x2_t n)
+{
+  uint64x2_t neg = vcltzq_s64 (n);
+  if (unlikely (v_any_u64 (neg)))
+    {
+      float64x2_t r = vdivq_f64 (v_f64 (1.0), bh);
+      float64x2_t rl = vfmsq_f64 (vfmsq_f64 (v_f64 (1.0), r, bh), r, bl);
+      bl = vbslq_f64 (neg, vdivq_f64 (rl, bh), bl);
+      bh = vbslq_f64 (neg, r, bh);
+    }
+  uint64x2_t m = vreinterpretq_u64_s64 (vabsq_s64 (n));
+  uint64_t max_m = vgetq_lane_u64 (m, 0) | vgetq_lane_u64 (m, 1);
+  float64x2_t yh = v_f64 (1.0), yl = v_f64 (0.0);
+  while (1)
+    {
+      uint64x2_t odd = vtstq_u64 (m, v_u64 (1));
+      float64x2_t h = vmulq_f64 (yh, bh);
+      float64x2_t l = vfmaq_f64 (vnegq_f64 (h), yh, bh);
+      l = vaddq_f64 (l, vfmaq_f64 (vmulq_f64 (yl, bh), yh, bl));
+      yh = vbslq_f64 (odd, h, yh);
+      yl = vbslq_f64 (odd, l, yl);
+      max_m >>= 1;
+      if (max_m == 0)
+	break;
+      m = vshrq_n_u64 (m, 1);
+      h = vmulq_f64 (bh, bh);
+      bl = vfmaq_f64 (vfmaq_f64 (vnegq_f64 (h), bh, bh), vaddq_f64 (bh, bh),
+		      bl);
+      bh = h;
+    }
+  return vaddq_f64 (yh, yl);
+}
+
+/* Split n as nh + *nl exactly, as in pown_split.  */
+static inline float64x2_t
+v_pown_split (int64x2_t n, float64x2_t *nl)
+{
+  uint64x2_t big = vcageq_f64 (vcvtq_f64_s64 (n), v_f64 (0x1p53));
+  int64x2_t nh = vbslq_s64 (big, vandq_s64 (n, v_s64 (~0x7ffLL)), n);
+  *nl = vcvtq_f64_s64 (vsubq_s64 (n, nh));
+  return vcvtq_f64_s64 (nh);
+}
+
+/* exp(hi + lo), with lo the tail of a double-double.  */
+static inline float64x2_t
+v_pown_exp (float64x2_t hi, float64x2_t lo, const struct v_pow_data *d)
+{
+  float64x2_t y = vaddq_f64 (hi, lo);
+  lo = vaddq_f64 (vsubq_f64 (hi, y), lo);
+  return v_pow_exp_inline (y, lo, d);
+}
+
+/* exp(n (lh + ll)), where lh + ll is a log as returned by
+   v_pow_log_inline.  */
+static inline float64x2_t
+v_pown_exp_mul (int64x2_t n, float64x2_t lh, float64x2_t ll,
+		const struct v_pow_data *d)
+{
+  float64x2_t nl, nh = v_pown_split (n, &nl);
+  float64x2_t hi = vmulq_f64 (nh, lh);
+  float64x2_t lo = vfmaq_f64 (vnegq_f64 (hi), nh, lh);
+  lo = vaddq_f64 (lo, vfmaq_f64 (vmulq_f64 (nl, lh), nh, ll));
+  return v_pown_exp (hi, lo, d);
+}
+
+/* Lanes which need special treatment: x is +-0, subnormal, +-inf or nan.  */
+static inline uint64x2_t
+v_pown_special (float64x2_t x)
+{
+  uint64x2_t abstop = vandq_u64 (
+      vshrq_n_u64 (vreinterpretq_u64_f64 (x), 52), v_u64 (0x7ff));
+  return vcgeq_u64 (vsubq_u64 (abstop, v_u64 (1)), v_u64 (0x7fe));
+}
+
+/* Call scalar f on the lanes of x and n selected by p.  */
+static inline float64x2_t
+v_call_pown (double (*f) (double, long long), float64x2_t x, int64x2_t n,
+	     float64x2_t y, uint64x2_t p)
+{
+  double p1 = p[1];
+  double x1 = x[1];
+  long long n1 = n[1];
+  if (likely (p[0]))
+    y[0] = f (x[0], n[0]);
+  if (likely (p1))
+    y[1] = f (x1, n1);
+  return y;
+}
+
+#endif
@@ -0,0 +1,47 @@
+/*
+ * Double-precision vector powr(x, y) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "mathlib.h"
+#include "v_pown_common.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+/* Vector exp(y log(x)) with the log and exp of pow.  Unlike vector pow, only
+   lanes with special x or y fall back to the scalar routine, since powr is
+   not defined for x < 0: x <= 0, subnormal, infinite and nan x, and infinite
+   and nan y use scalar powr.
+   Maximum measured error is 1.04 ULPs:
+   _ZGVnN2vv_powr(0x1.1da32a38c4607p+6, 0x1.74cef8766a9dp+5)
+     got 0x1.f5e4453bf9d73p+286
+    want 0x1.f5e4453bf9d74p+286.  */
+float64x2_t VPCS_ATTR V_NAME_D2 (powr) (float64x2_t x, float64x2_t y)
+{
+  const struct v_pow_data *d = ptr_barrier (&v_pow_data);
+  uint64x2_t special = vorrq_u64 (v_pown_special (x),
+				  vcltzq_s64 (vreinterpretq_s64_f64 (x)));
+  special = vorrq_u64 (special, vcageq_f64 (y, v_f64 (INFINITY)));
+  special = vorrq_u64 (special, vmvnq_u64 (vceqq_f64 (y, y)));
+
+  float64x2_t ax = vbslq_f64 (special, v_f64 (1.0), x);
+  float64x2_t lo, hi = v_pow_log_inline (vreinterpretq_u64_f64 (ax), &lo, d);
+  float64x2_t ehi = vmulq_f64 (y, hi);
+  float64x2_t elo = vsubq_f64 (vmulq_f64 (y, lo), vfmsq_f64 (ehi, y, hi));
+  float64x2_t r = v_pow_exp_inline (ehi, elo, d);
+
+  if (unlikely (v_any_u64 (special)))
+    return v_call2_f64 (powr, x, y, r, special);
+  return r;
+}
+
+PL_TEST_ULP (V_NAME_D2 (powr), 0.55)
+#define V_POWR_INTERVAL2(xlo, xhi, ylo, yhi, n)                               \
+  PL_TEST_INTERVAL2 (V_NAME_D2 (powr), xlo, xhi, ylo, yhi, n)                 \
+  PL_TEST_INTERVAL2 (V_NAME_D2 (powr), xlo, xhi, -ylo, -yhi, n)
+V_POWR_INTERVAL2 (0, inf, 0, inf, 40000)
+V_POWR_INTERVAL2 (0x1p-10, 0x1p10, 0, 1000, 40000)
+V_POWR_INTERVAL2 (0x1.fp-1, 0x1.1p0, 0, 0x1p20, 40000)
+V_POWR_INTERVAL2 (-0, -inf, 0, 10, 1000)
@@ -0,0 +1,133 @@
+/*
+ * Quantised 8-bit activation routines using table lookups.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <string.h>
+#include "mathlib.h"
+#include "v_math.h"
+
+typedef float32x4_t (*v_activation_fn) (float32x4_t);
+
+/* sigmoid(x) = 1 / (1 + e^-x) = 1/2 + 1/2 tanh(x/2).  */
+static float32x4_t
+v_sigmoid (float32x4_t x)
+{
+  float32x4_t t = _ZGVnN4v_tanhf (vmulq_f32 (x, v_f32 (0.5f)));
+  return vfmaq_f32 (v_f32 (0.5f), v_f32 (0.5f), t);
+}
+
+static float32x4_t
+v_tanh (float32x4_t x)
+{
+  return _ZGVnN4v_tanhf (x);
+}
+
+/* gelu(x) = x/2 (1 + erf(x / sqrt(2))).  */
+static float32x4_t
+v_gelu (float32x4_t x)
+{
+  float32x4_t h = vmulq_f32 (x, v_f32 (0.5f));
+  float32x4_t t = _ZGVnN4v_erff (vmulq_f32 (x, v_f32 (0x1.6a09e6p-1f)));
+  return vfmaq_f32 (h, h, t);
+}
+
+static float32x4_t
+v_exp (float32x4_t x)
+{
+  return vaddq_f32 (v_f32 (1.0f), _ZGVnN4v_expm1f (x));
+}
+
+static const v_activation_fn activations[] = {
+  [Q8_SIGMOID] = v_sigmoid,
+  [Q8_TANH] = v_tanh,
+  [Q8_GELU] = v_gelu,
+  [Q8_EXP] = v_exp,
+};
+
+/* Lookup table of activation f for 8-bit quantised values.  For each byte
+   b, with q = b, or q = (int8_t) b if is_signed is set,
+     tab[b] = round(f((q - zero_point) scale) / out_scale) + out_zero_point,
+   saturated to the range of the signed or unsigned 8-bit output.  The
+   division is rounded to nearest, ties to even.  The result only depends on
+   the quantisation parameters, so it is computed once for a layer and
+   applied with q8_lookup.  Each entry is equal to the result of the float
+   routine on the dequantised value, so the lookup is exact with respect to
+   the float path.  */
+void
+q8_activation_table (uint8_t *tab, enum q8_activation f, int is_signed,
+		     float scale, int32_t zero_point, float out_scale,
+		     int32_t out_zero_point)
+{
+  v_activation_fn fn = activations[f];
+  int32x4_t zp = vdupq_n_s32 (zero_point), ozp = vdupq_n_s32 (out_zero_point);
+  float32x4_t s = vdupq_n_f32 (scale), os = vdupq_n_f32 (out_scale);
+  int32x4_t b = { 0, 1, 2, 3 };
+
+  for (int i = 0; i < 256; i += 16)
+    {
+      int32x4_t q[4];
+      for (int j = 0; j < 4; j++, b = vaddq_s32 (b, v_s32 (4)))
+	{
+	  int32x4_t v = b;
+	  if (is_signed)
+	    v = vsubq_s32 (veorq_s32 (v, v_s32 (0x80)), v_s32 (0x80));
+	  float32x4_t x = vmulq_f32 (vcvtq_f32_s32 (vsubq_s32 (v, zp)), s);
+	  float32x4_t y = vdivq_f32 (fn (x), os);
+	  q[j] = vqaddq_s32 (vcvtnq_s32_f32 (y), ozp);
+	}
+      int16x8_t lo = vcombine_s16 (vqmovn_s32 (q[0]), vqmovn_s32 (q[1]));
+      int16x8_t hi = vcombine_s16 (vqmovn_s32 (q[2]), vqmovn_s32 (q[3]));
+      uint8x16_t t;
+      if (is_signed)
+	t = vreinterpretq_u8_s8 (vcombine_s8 (vqmovn_s16 (lo), vqmovn_s16 (hi)));
+      else
+	t = vcombine_u8 (vqmovun_s16 (lo), vqmovun_s16 (hi));
+      vst1q_u8 (tab + i, t);
+    }
+}
+
+/* The 256-byte table is held in 16 registers, and indexed with one TBL and
+   three TBX of 4 registers each.  Indices outside the 64 entries of a TBX
+   leave the result unchanged, so each index is offset by 64 between the
+   lookups.  */
+static inline uint8x16_t
+v_lookup (uint8x16_t x, const uint8x16x4_t t[4])
+{
+  uint8x16_t y = vqtbl4q_u8 (t[0], x);
+  x = vsubq_u8 (x, vdupq_n_u8 (64));
+  y = vqtbx4q_u8 (y, t[1], x);
+  x = vsubq_u8 (x, vdupq_n_u8 (64));
+  y = vqtbx4q_u8 (y, t[2], x);
+  x = vsubq_u8 (x, vdupq_n_u8 (64));
+  return vqtbx4q_u8 (y, t[3], x);
+}
+
+/* Apply a table built with q8_activation_table to n bytes: y[i] = tab[x[i]],
+   for i < n.  64 values are processed per iteration.  */
+void
+q8_lookup (uint8_t *y, const uint8_t *x, size_t n, const uint8_t *tab)
+{
+  uint8x16x4_t t[4];
+  for (int i = 0; i < 4; i++)
+    t[i] = vld1q_u8_x4 (tab + 64 * i);
+
+  for (; n >= 64; n -= 64, x += 64, y += 64)
+    {
+      uint8x16x4_t v = vld1q_u8_x4 (x);
+      for (int i = 0; i < 4; i++)
+	v.val[i] = v_lookup (v.val[i], t);
+      vst1q_u8_x4 (y, v);
+    }
+  for (; n >= 16; n -= 16, x += 16, y += 16)
+    vst1q_u8 (y, v_lookup (vld1q_u8 (x), t));
+  if (n > 0)
+    {
+      uint8_t tmp[16] = { 0 };
+      memcpy (tmp, x, n);
+      vst1q_u8 (tmp, v_lookup (vld1q_u8 (tmp), t));
+      memcpy (y, tmp, n);
+    }
+}
@@ -0,0 +1,56 @@
+/*
+ * Double-precision vector rootn(x, n) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "mathlib.h"
+#include "v_pown_common.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+/* Vector x^(1/n) for integer n, computed as exp(log|x| / n) with the log and
+   exp of pow, as in the scalar rootn.  n = 0, zero, subnormal, infinite and
+   nan x, and negative x with even n fall back to scalar rootn.
+   Maximum measured error is 1.04 ULPs:
+   _ZGVnN2vv_rootn(0x1.e82d8933f3eacp+995, -968)
+     got 0x1.f5dc898c35275p-2
+    want 0x1.f5dc898c35276p-2.  */
+float64x2_t VPCS_ATTR V_NAME_D2 (rootn) (float64x2_t x, int64x2_t n)
+{
+  const struct v_pow_data *d = ptr_barrier (&v_pow_data);
+  uint64x2_t ix = vreinterpretq_u64_f64 (x);
+  uint64x2_t odd = vshlq_n_u64 (vreinterpretq_u64_s64 (n), 63);
+  uint64x2_t special = vorrq_u64 (v_pown_special (x), vceqzq_s64 (n));
+  /* x < 0 and n is even.  */
+  special = vorrq_u64 (special, vcltzq_s64 (vreinterpretq_s64_u64 (
+				    vbicq_u64 (ix, odd))));
+
+  float64x2_t ax = vbslq_f64 (special, v_f64 (1.0), vabsq_f64 (x));
+  int64x2_t m = vbslq_s64 (special, v_s64 (1), n);
+  float64x2_t lo, hi = v_pow_log_inline (vreinterpretq_u64_f64 (ax), &lo, d);
+  /* (hi + lo) / (nh + nl) ~= qh + (hi - qh nh + lo - qh nl) / nh.  */
+  float64x2_t nl, nh = v_pown_split (m, &nl);
+  float64x2_t qh = vdivq_f64 (hi, nh);
+  float64x2_t ql = vaddq_f64 (vfmsq_f64 (hi, qh, nh), lo);
+  ql = vdivq_f64 (vfmsq_f64 (ql, qh, nl), nh);
+  float64x2_t y = v_pown_exp (qh, ql, d);
+  /* Negate if x < 0 and n is odd.  */
+  y = vreinterpretq_f64_u64 (
+      veorq_u64 (vreinterpretq_u64_f64 (y), vandq_u64 (odd, ix)));
+
+  if (unlikely (v_any_u64 (special)))
+    return v_call_pown (rootn, x, n, y, special);
+  return y;
+}
+
+PL_TEST_ULP (V_NAME_D2 (rootn), 0.55)
+#define V_ROOTN_INTERVAL2(xlo, xhi, ylo, yhi, n)                              \
+  PL_TEST_INTERVAL2 (V_NAME_D2 (rootn), xlo, xhi, ylo, yhi, n)                \
+  PL_TEST_INTERVAL2 (V_NAME_D2 (rootn), xlo, xhi, -ylo, -yhi, n)              \
+  PL_TEST_INTERVAL2 (V_NAME_D2 (rootn), -xlo, -xhi, ylo, yhi, n)              \
+  PL_TEST_INTERVAL2 (V_NAME_D2 (rootn), -xlo, -xhi, -ylo, -yhi, n)
+V_ROOTN_INTERVAL2 (0, inf, 0, 64, 40000)
+V_ROOTN_INTERVAL2 (0x1p-10, 0x1p10, 0, 1000, 40000)
+V_ROOTN_INTERVAL2 (0, inf, 0, 0x1p62, 10000)
@@ -0,0 +1,88 @@
+/*
+ * Single-precision vector sinc(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "mathlib.h"
+#include "v_math.h"
+#include "poly_advsimd_f32.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+static const struct data
+{
+  float32x4_t poly[4];
+  float32x4_t range_val, inv_pi, shift, pi_1, pi_2, pi_3;
+} data = {
+  /* Coefficients of P, with sin(r) / r ~= 1 + r^2 P(r^2) in
+     [-pi/2, pi/2], generated using Lawson's algorithm for relative error.
+     Compared to the sinf polynomial, this also minimises the error of
+     sinc close to 0.  */
+  .poly = { V4 (-0x1.55554cp-3f), V4 (0x1.110ed4p-7f), V4 (-0x1.9f6ffep-13f),
+	    V4 (0x1.5dbdf2p-19f) },
+
+  .pi_1 = V4 (0x1.921fb6p+1f),
+  .pi_2 = V4 (-0x1.777a5cp-24f),
+  .pi_3 = V4 (-0x1.ee59dap-49f),
+
+  .inv_pi = V4 (0x1.45f306p-2f),
+  .shift = V4 (0x1.8p+23f),
+  .range_val = V4 (0x1p20f)
+};
+
+static float
+sincf_scalar (float x)
+{
+  return sinf (x) / x;
+}
+
+static float32x4_t VPCS_ATTR NOINLINE
+special_case (float32x4_t x, float32x4_t y, uint32x4_t cmp)
+{
+  /* Fall back to scalar code.  */
+  return v_call_f32 (sincf_scalar, x, y, cmp);
+}
+
+/* Approximation for vector single-precision sinc(x) = sin(x) / x, with
+   sinc(0) = 1.  The argument is reduced as in sinf, to r = |x| - n pi in
+   [-pi/2, pi/2], and sin(r) = r + r^3 P(r^2) is divided by |x|.  For n = 0,
+   r = |x| and the result is 1 + r^2 P(r^2), with no division.
+   Maximum error: 2.84 ULP:
+   _ZGVnN4v_sincf(0x1.36b78ep+17) got 0x1.b456bp-28
+				 want 0x1.b456aap-28.  */
+float32x4_t VPCS_ATTR V_NAME_F1 (sinc) (float32x4_t x)
+{
+  const struct data *d = ptr_barrier (&data);
+  float32x4_t ax = vabsq_f32 (x);
+  uint32x4_t cmp = vcageq_f32 (x, d->range_val);
+
+  /* n = rint(|x|/pi).  */
+  float32x4_t n = vfmaq_f32 (d->shift, d->inv_pi, ax);
+  uint32x4_t odd = vshlq_n_u32 (vreinterpretq_u32_f32 (n), 31);
+  n = vsubq_f32 (n, d->shift);
+
+  /* r = |x| - n*pi  (range reduction into -pi/2 .. pi/2).  */
+  float32x4_t r = vfmsq_f32 (ax, d->pi_1, n);
+  r = vfmsq_f32 (r, d->pi_2, n);
+  r = vfmsq_f32 (r, d->pi_3, n);
+
+  float32x4_t r2 = vmulq_f32 (r, r);
+  float32x4_t p = v_horner_3_f32 (r2, d->poly);
+  float32x4_t small = vfmaq_f32 (v_f32 (1.0f), r2, p);
+
+  float32x4_t y = vfmaq_f32 (r, vmulq_f32 (r, r2), p);
+  y = vreinterpretq_f32_u32 (veorq_u32 (vreinterpretq_u32_f32 (y), odd));
+  y = vbslq_f32 (vceqzq_f32 (n), small, vdivq_f32 (y, ax));
+
+  if (unlikely (v_any_u32 (cmp)))
+    return special_case (x, y, cmp);
+  return y;
+}
+
+PL_TEST_ULP (V_NAME_F1 (sinc), 2.35)
+PL_TEST_SYM_INTERVAL (V_NAME_F1 (sinc), 0, 0x1p-31, 5000)
+PL_TEST_SYM_INTERVAL (V_NAME_F1 (sinc), 0x1p-31, 0x1.921fb6p0, 50000)
+PL_TEST_SYM_INTERVAL (V_NAME_F1 (sinc), 0x1.921fb6p0, 0x1p20, 100000)
+PL_TEST_SYM_INTERVAL (V_NAME_F1 (sinc), 0x1p20, inf, 10000)
@@ -1,7 +1,7 @@
 /*
  * Core approximation for double-precision vector sincos
  *
- * Copyright (c) 2023, Arm Limited.
+ * Copyright (c) 2023-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -34,25 +34,13 @@ check_ge_rangeval (float64x2_t x, const struct v_sincos_data *d)
   return vcagtq_f64 (x, d->range_val);
 }
 
-/* Double-precision vector function allowing calculation of both sin and cos in
-   one function call, using shared argument reduction and separate polynomials.
-   Largest observed error is for sin, 3.22 ULP:
-   v_sincos_sin (0x1.d70eef40f39b1p+12) got -0x1.ffe9537d5dbb7p-3
-				       want -0x1.ffe9537d5dbb4p-3.  */
+/* Evaluate sin and cos of r + n * pi/2, given r in [-pi/4, pi/4].  The
+   argument reduction is left to the caller, so that this can be shared by
+   routines which reduce a different argument.  */
 static inline float64x2x2_t
-v_sincos_inline (float64x2_t x, const struct v_sincos_data *d)
+v_sincos_reduced_inline (float64x2_t r, int64x2_t n,
+			 const struct v_sincos_data *d)
 {
-  /* q = nearest integer to 2 * x / pi.  */
-  float64x2_t q = vsubq_f64 (vfmaq_f64 (d->shift, x, d->inv_pio2), d->shift);
-  int64x2_t n = vcvtq_s64_f64 (q);
-
-  /* Use q to reduce x to r in [-pi/4, pi/4], by:
-     r = x - q * pi/2, in extended precision.  */
-  float64x2_t r = x;
-  r = vfmsq_f64 (r, q, d->pio2[0]);
-  r = vfmsq_f64 (r, q, d->pio2[1]);
-  r = vfmsq_f64 (r, q, d->pio2[2]);
-
   float64x2_t r2 = r * r, r3 = r2 * r, r4 = r2 * r2;
 
   /* Approximate sin(r) ~= r + r^3 * poly_sin(r^2).  */
@@ -84,3 +72,25 @@ v_sincos_inline (float64x2_t x, const struct v_sincos_data *d)
 
   return (float64x2x2_t){ ss, cc };
 }
+
+/* Double-precision vector function allowing calculation of both sin and cos in
+   one function call, using shared argument reduction and separate polynomials.
+   Largest observed error is for sin, 3.22 ULP:
+   v_sincos_sin (0x1.d70eef40f39b1p+12) got -0x1.ffe9537d5dbb7p-3
+				       want -0x1.ffe9537d5dbb4p-3.  */
+static inline float64x2x2_t
+v_sincos_inline (float64x2_t x, const struct v_sincos_data *d)
+{
+  /* q = nearest integer to 2 * x / pi.  */
+  float64x2_t q = vsubq_f64 (vfmaq_f64 (d->shift, x, d->inv_pio2), d->shift);
+  int64x2_t n = vcvtq_s64_f64 (q);
+
+  /* Use q to reduce x to r in [-pi/4, pi/4], by:
+     r = x - q * pi/2, in extended precision.  */
+  float64x2_t r = x;
+  r = vfmsq_f64 (r, q, d->pio2[0]);
+  r = vfmsq_f64 (r, q, d->pio2[1]);
+  r = vfmsq_f64 (r, q, d->pio2[2]);
+
+  return v_sincos_reduced_inline (r, n, d);
+}
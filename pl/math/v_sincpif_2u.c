@@ -0,0 +1,32 @@
+/*
+ * Single-precision vector sinc(pi x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "mathlib.h"
+#include "v_sincpif_inline.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+static const struct v_sincpif_data data = V_SINCPIF_CONSTANTS_TABLE;
+
+/* Approximation for vector single-precision sincpi(x) = sin(pi x) / (pi x),
+   with sincpi(0) = 1, see v_sincpif_inline.h.  The result is exact for
+   x = 0, and no special-case handling is needed.
+   Maximum error: 2.00 ULP:
+   _ZGVnN4v_sincpif(0x1.453c16p+1) got 0x1.fce554p-4
+				  want 0x1.fce55p-4.  */
+float32x4_t VPCS_ATTR V_NAME_F1 (sincpi) (float32x4_t x)
+{
+  const struct v_sincpif_data *d = ptr_barrier (&data);
+  return v_sincpif_inline (vabsq_f32 (x), d);
+}
+
+PL_TEST_ULP (V_NAME_F1 (sincpi), 1.51)
+PL_TEST_SYM_INTERVAL (V_NAME_F1 (sincpi), 0, 0x1p-31, 5000)
+PL_TEST_SYM_INTERVAL (V_NAME_F1 (sincpi), 0x1p-31, 0.5, 50000)
+PL_TEST_SYM_INTERVAL (V_NAME_F1 (sincpi), 0.5, 0x1p10, 50000)
+PL_TEST_SYM_INTERVAL (V_NAME_F1 (sincpi), 0x1p10, 0x1p23, 10000)
+PL_TEST_SYM_INTERVAL (V_NAME_F1 (sincpi), 0x1p23, inf, 10000)
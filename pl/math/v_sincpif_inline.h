@@ -0,0 +1,51 @@
+/*
+ * Helpers for single-precision vector sinc(pi x) and window functions.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+#ifndef PL_MATH_V_SINCPIF_INLINE_H
+#define PL_MATH_V_SINCPIF_INLINE_H
+
+#include "v_math.h"
+#include "poly_advsimd_f32.h"
+
+struct v_sincpif_data
+{
+  float32x4_t poly[5];
+};
+
+/* Coefficients of S, with sin(pi r) / (pi r) ~= 1 + r^2 S(r^2) in
+   [-1/2, 1/2], generated using Lawson's algorithm for relative error.  The
+   leading coefficient is -pi^2/6, so these are the sinpif coefficients
+   divided by pi.  */
+#define V_SINCPIF_CONSTANTS_TABLE                                             \
+  {                                                                           \
+    .poly = { V4 (-0x1.a51a66p+0f), V4 (0x1.9f9cacp-1f),                      \
+	      V4 (-0x1.86a6dcp-3f), V4 (0x1.abe8c2p-6f),                      \
+	      V4 (-0x1.253824p-9f) },                                         \
+  }
+
+/* sinc(pi x) = sin(pi x) / (pi x) of x >= 0.  With n = rint(x) and
+   r = x - n, sin(pi x) = (-1)^n sin(pi r), which is divided by pi x for
+   n != 0.  For n = 0, r = x and the result is 1 + r^2 S(r^2), so it is
+   exact close to 0 and no division is needed.  x above 2^23 is an integer,
+   so r and the result are 0, and infinity gives NaN.  */
+static inline float32x4_t
+v_sincpif_inline (float32x4_t x, const struct v_sincpif_data *d)
+{
+  float32x4_t n = vrndaq_f32 (x);
+  uint32x4_t odd
+      = vshlq_n_u32 (vreinterpretq_u32_s32 (vcvtaq_s32_f32 (x)), 31);
+  float32x4_t r = vsubq_f32 (x, n);
+
+  float32x4_t r2 = vmulq_f32 (r, r);
+  float32x4_t p = v_horner_4_f32 (r2, d->poly);
+  float32x4_t small = vfmaq_f32 (v_f32 (1.0f), r2, p);
+
+  float32x4_t y = vfmaq_f32 (r, vmulq_f32 (r, r2), p);
+  y = vreinterpretq_f32_u32 (veorq_u32 (vreinterpretq_u32_f32 (y), odd));
+  return vbslq_f32 (vceqzq_f32 (n), small, vdivq_f32 (y, x));
+}
+
+#endif
@@ -0,0 +1,173 @@
+/*
+ * Single-precision windowed sinc(pi x) array routines.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <string.h>
+#include "mathlib.h"
+#include "v_sincpif_inline.h"
+#include "v_bessel_common.h"
+#include "poly_advsimd_f64.h"
+#include "pl_test.h"
+
+static const struct window_data
+{
+  struct v_sincpif_data sincpi;
+  float64x2_t poly[5], pi;
+} window_data = {
+  .sincpi = V_SINCPIF_CONSTANTS_TABLE,
+  /* The same coefficients, for evaluation in double precision, where the
+     relative error of sin(pi t) = pi t (1 + t^2 S(t^2)) is below 2^-31 for
+     |t| <= 1/2.  */
+  .poly = { V2 (-0x1.a51a66p+0), V2 (0x1.9f9cacp-1), V2 (-0x1.86a6dcp-3),
+	    V2 (0x1.abe8c2p-6), V2 (-0x1.253824p-9) },
+  .pi = V2 (0x1.921fb54442d18p+1),
+};
+
+/* Parameters of the kernels, broadcast once per call.  */
+struct window
+{
+  float32x4_t c, hw;
+  float64x2_t hw64, beta, scale;
+};
+
+/* The windows are evaluated in double precision, on v = 1 - |u| with
+   u = x / hw.  hw - |x| is exact, so the relative accuracy is kept close to
+   the edge of the window, where w is tiny.  For the Hann and Blackman
+   windows, with s = sin(pi v / 2):
+     hann(u) = 1/2 + 1/2 cos(pi u) = s^2,
+     blackman(u) = 0.42 + 0.5 cos(pi u) + 0.08 cos(2 pi u)
+		 = s^2 (0.36 + 0.64 s^2).  */
+static inline float64x2_t
+v_hann (float64x2_t ax, const struct window *w, const struct window_data *d)
+{
+  float64x2_t v = vdivq_f64 (vsubq_f64 (w->hw64, ax), w->hw64);
+  float64x2_t t = vmulq_f64 (v, v_f64 (0.5));
+  float64x2_t t2 = vmulq_f64 (t, t);
+  float64x2_t s = vfmaq_f64 (v_f64 (1.0), t2, v_horner_4_f64 (t2, d->poly));
+  s = vmulq_f64 (vmulq_f64 (d->pi, t), s);
+  return vmulq_f64 (s, s);
+}
+
+static inline float64x2_t
+v_blackman (float64x2_t ax, const struct window *w, const struct window_data *d)
+{
+  float64x2_t s2 = v_hann (ax, w, d);
+  return vmulq_f64 (s2, vfmaq_f64 (v_f64 (0.36), v_f64 (0.64), s2));
+}
+
+/* kaiser(u) = i0(beta sqrt(1 - u^2)) / i0(beta), with 1 - u^2 = v (2 - v).  */
+static inline float64x2_t
+v_kaiser (float64x2_t ax, const struct window *w, const struct window_data *d)
+{
+  const struct v_bessel_consts *bd = ptr_barrier (&v_bessel_consts);
+  float64x2_t v = vdivq_f64 (vsubq_f64 (w->hw64, ax), w->hw64);
+  float64x2_t t = vmulq_f64 (v, vsubq_f64 (v_f64 (2.0), v));
+  t = vmulq_f64 (w->beta, vsqrtq_f64 (t));
+  return vmulq_f64 (v_bessel_i_inline (t, 0, bd), w->scale);
+}
+
+typedef float64x2_t (*v_window_fn) (float64x2_t, const struct window *,
+				    const struct window_data *);
+
+/* sincpi(c x) w(x / hw), and 0 outside the window.  The product is computed
+   in double precision, so only the error of sincpi and the final rounding
+   remain.  */
+static inline float32x4_t
+v_windowed_sincpif (float32x4_t x, const struct window *w, v_window_fn f,
+		    const struct window_data *d)
+{
+  float32x4_t ax = vabsq_f32 (x);
+  float32x4_t y
+      = v_sincpif_inline (vabsq_f32 (vmulq_f32 (w->c, x)), &d->sincpi);
+  float64x2_t lo = vmulq_f64 (vcvt_f64_f32 (vget_low_f32 (y)),
+			      f (vcvt_f64_f32 (vget_low_f32 (ax)), w, d));
+  float64x2_t hi
+      = vmulq_f64 (vcvt_high_f64_f32 (y), f (vcvt_high_f64_f32 (ax), w, d));
+  y = vcvt_high_f32_f64 (vcvt_f32_f64 (lo), hi);
+  return vreinterpretq_f32_u32 (
+      vbicq_u32 (vreinterpretq_u32_f32 (y), vcgtq_f32 (ax, w->hw)));
+}
+
+static inline void
+v_windowed_sincpif_array (float *y, const float *x, size_t n,
+			  const struct window *w, v_window_fn f)
+{
+  const struct window_data *d = ptr_barrier (&window_data);
+  for (; n >= 4; n -= 4, x += 4, y += 4)
+    vst1q_f32 (y, v_windowed_sincpif (vld1q_f32 (x), w, f, d));
+  if (n > 0)
+    {
+      /* Pad the last vector with zeros.  */
+      float tmp[4] = { 0 };
+      memcpy (tmp, x, n * sizeof (float));
+      vst1q_f32 (tmp, v_windowed_sincpif (vld1q_f32 (tmp), w, f, d));
+      memcpy (y, tmp, n * sizeof (float));
+    }
+}
+
+/* Windowed sinc kernels, for filter design and resampling.  For i < n,
+     y[i] = sincpi(c x[i]) w(x[i] / hw),
+   where sincpi(x) = sin(pi x) / (pi x) and w is the window function, which
+   is 0 outside [-1, 1], for hw > 0.  c x[i] is rounded to single
+   precision.  The sign of zero results is unspecified.  This is one pass over
+   x, which is cheaper than separate calls to sinpi and the window.
+   Maximum measured error, for c = 0.75 and hw = 8, is 2.61 ULP for the Hann
+   window:
+   windowed_sincpif_hann(0x1.95c508p-1) got 0x1.ffd8a2p-2
+				       want 0x1.ffd8a8p-2.  */
+void
+windowed_sincpif_hann (float *y, const float *x, size_t n, float c, float hw)
+{
+  struct window w = { .c = vdupq_n_f32 (c),
+		      .hw = vdupq_n_f32 (hw),
+		      .hw64 = vdupq_n_f64 (hw) };
+  v_windowed_sincpif_array (y, x, n, &w, v_hann);
+}
+
+/* As above, with the Blackman window.
+   Maximum measured error is 2.65 ULP:
+   windowed_sincpif_blackman(0x1.a6a5a6p+1) got 0x1.ff78eep-5
+					   want 0x1.ff78e8p-5.  */
+void
+windowed_sincpif_blackman (float *y, const float *x, size_t n, float c,
+			   float hw)
+{
+  struct window w = { .c = vdupq_n_f32 (c),
+		      .hw = vdupq_n_f32 (hw),
+		      .hw64 = vdupq_n_f64 (hw) };
+  v_windowed_sincpif_array (y, x, n, &w, v_blackman);
+}
+
+/* As above, with the Kaiser window of parameter beta, in [0, 700].
+   Maximum measured error, for beta = 8.6, is 2.82 ULP:
+   windowed_sincpif_kaiser(0x1.a88f44p+1) got 0x1.fb32ep-5
+					 want 0x1.fb32e6p-5.  */
+void
+windowed_sincpif_kaiser (float *y, const float *x, size_t n, float c,
+			 float hw, float beta)
+{
+  const struct v_bessel_consts *bd = ptr_barrier (&v_bessel_consts);
+  float64x2_t b = vdupq_n_f64 (beta);
+  struct window w = { .c = vdupq_n_f32 (c),
+		      .hw = vdupq_n_f32 (hw),
+		      .hw64 = vdupq_n_f64 (hw),
+		      .beta = b,
+		      .scale = vdivq_f64 (v_f64 (1.0),
+					  v_bessel_i_inline (b, 0, bd)) };
+  v_windowed_sincpif_array (y, x, n, &w, v_kaiser);
+}
+
+PL_TEST_ULP (windowed_sincpif_hann, 2.11)
+PL_TEST_ULP (windowed_sincpif_blackman, 2.15)
+PL_TEST_ULP (windowed_sincpif_kaiser, 2.32)
+#define WINDOW_INTERVAL(f)                                                    \
+  PL_TEST_SYM_INTERVAL (f, 0, 0x1p-20, 5000)                                  \
+  PL_TEST_SYM_INTERVAL (f, 0x1p-20, 1, 50000)                                 \
+  PL_TEST_SYM_INTERVAL (f, 1, 8, 100000)                                      \
+  PL_TEST_SYM_INTERVAL (f, 8, inf, 5000)
+WINDOW_INTERVAL (windowed_sincpif_hann)
+WINDOW_INTERVAL (windowed_sincpif_blackman)
+WINDOW_INTERVAL (windowed_sincpif_kaiser)
@@ -0,0 +1,47 @@
+/*
+ * Double-precision vector y0(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_bessel_common.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+static float64x2_t NOINLINE VPCS_ATTR
+special_case (float64x2_t x, float64x2_t y, uint64x2_t special)
+{
+  return v_call_f64 (y0, x, y, special);
+}
+
+/* AdvSIMD approximation for the double-precision Bessel function of the second
+   kind of order 0, see v_bessel_common.h.
+   Maximum measured error away from the zeros above 16 is 6.17 ULP:
+   _ZGVnN2v_y0(0x1.deb3583ef27ecp+5) got 0x1.f8b9a25664422p-5
+				     want 0x1.f8b9a25664428p-5.
+   Close to those zeros the absolute error is below 2^-66.5 sqrt(2/(pi x)),
+   so the error in ULP is unbounded:
+   _ZGVnN2v_y0(0x1.0803c74003214p+4) got 0x1.cd82d691c1122p-53
+				     want 0x1.cd827f6c074a2p-53.  */
+float64x2_t VPCS_ATTR V_NAME_D1 (y0) (float64x2_t x)
+{
+  const struct v_bessel_consts *d = ptr_barrier (&v_bessel_consts);
+  /* Fall back to scalar for x <= 0, subnormal x, x >= 2^23 and NaN.  */
+  uint64x2_t special = vceqzq_u64 (
+      vandq_u64 (vcgeq_f64 (x, d->y_min), vcltq_f64 (x, d->range_val)));
+
+  float64x2_t y = v_bessel_y_inline (x, 0, d);
+
+  if (unlikely (v_any_u64 (special)))
+    return special_case (x, y, special);
+  return y;
+}
+
+PL_SIG (V, D, 1, y0, 0.01, 10.0)
+PL_TEST_ULP (V_NAME_D1 (y0), 5.73)
+PL_TEST_INTERVAL (V_NAME_D1 (y0), 0, 2, 100000)
+PL_TEST_INTERVAL (V_NAME_D1 (y0), 2, 16, 100000)
+PL_TEST_INTERVAL (V_NAME_D1 (y0), 16, 0x1p23, 100000)
+PL_TEST_INTERVAL (V_NAME_D1 (y0), 0x1p23, inf, 1000)
+PL_TEST_INTERVAL (V_NAME_D1 (y0), -0, -inf, 1000)
@@ -0,0 +1,47 @@
+/*
+ * Double-precision vector y1(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_bessel_common.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+static float64x2_t NOINLINE VPCS_ATTR
+special_case (float64x2_t x, float64x2_t y, uint64x2_t special)
+{
+  return v_call_f64 (y1, x, y, special);
+}
+
+/* AdvSIMD approximation for the double-precision Bessel function of the second
+   kind of order 1, see v_bessel_common.h.
+   Maximum measured error away from the zeros above 16 is 6.30 ULP:
+   _ZGVnN2v_y1(0x1.562b4ab5e907dp+9) got -0x1.fc018fd825d5ep-8
+				     want -0x1.fc018fd825d58p-8.
+   Close to those zeros the absolute error is below 2^-65.5 sqrt(2/(pi x)),
+   so the error in ULP is unbounded:
+   _ZGVnN2v_y1(0x1.20b1c695f1e3bp+4) got -0x1.39d459ad9a2e8p-52
+				     want -0x1.39d4c41d5839fp-52.  */
+float64x2_t VPCS_ATTR V_NAME_D1 (y1) (float64x2_t x)
+{
+  const struct v_bessel_consts *d = ptr_barrier (&v_bessel_consts);
+  /* Fall back to scalar for x <= 0, subnormal x, x >= 2^23 and NaN.  */
+  uint64x2_t special = vceqzq_u64 (
+      vandq_u64 (vcgeq_f64 (x, d->y_min), vcltq_f64 (x, d->range_val)));
+
+  float64x2_t y = v_bessel_y_inline (x, 1, d);
+
+  if (unlikely (v_any_u64 (special)))
+    return special_case (x, y, special);
+  return y;
+}
+
+PL_SIG (V, D, 1, y1, 0.01, 10.0)
+PL_TEST_ULP (V_NAME_D1 (y1), 5.86)
+PL_TEST_INTERVAL (V_NAME_D1 (y1), 0, 2, 100000)
+PL_TEST_INTERVAL (V_NAME_D1 (y1), 2, 16, 100000)
+PL_TEST_INTERVAL (V_NAME_D1 (y1), 16, 0x1p23, 100000)
+PL_TEST_INTERVAL (V_NAME_D1 (y1), 0x1p23, inf, 1000)
+PL_TEST_INTERVAL (V_NAME_D1 (y1), -0, -inf, 1000)
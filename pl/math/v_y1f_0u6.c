@@ -0,0 +1,48 @@
+/*
+ * Single-precision vector y1(x) function.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include "v_bessel_common.h"
+#include "pl_sig.h"
+#include "pl_test.h"
+
+static float32x4_t NOINLINE VPCS_ATTR
+special_case (float32x4_t x, float32x4_t y, uint32x4_t special)
+{
+  return v_call_f32 (y1f, x, y, special);
+}
+
+/* AdvSIMD approximation for the single-precision Bessel function of the
+   second kind of order 1, see v_bessel_common.h.  The input is widened and
+   the double-precision approximation used, so the result is correctly
+   rounded except in rare double rounding cases.  Maximum measured error is
+   0.50 ULP.  */
+float32x4_t VPCS_ATTR V_NAME_F1 (y1) (float32x4_t x)
+{
+  const struct v_bessel_consts *d = ptr_barrier (&v_bessel_consts);
+  /* Fall back to scalar for x <= 0, x >= 2^23 and NaN.  Subnormal inputs
+     are normal in double precision.  */
+  uint32x4_t special = vceqzq_u32 (
+      vandq_u32 (vcgtzq_f32 (x), vcltq_f32 (x, v_f32 (0x1p23f))));
+
+  /* Widen to double precision, which the core approximation needs anyway for
+     the phase, and evaluate on both halves of the vector.  */
+  float64x2_t lo = v_bessel_y_inline (vcvt_f64_f32 (vget_low_f32 (x)), 1, d);
+  float64x2_t hi = v_bessel_y_inline (vcvt_high_f64_f32 (x), 1, d);
+  float32x4_t y = vcvt_high_f32_f64 (vcvt_f32_f64 (lo), hi);
+
+  if (unlikely (v_any_u32 (special)))
+    return special_case (x, y, special);
+  return y;
+}
+
+PL_SIG (V, F, 1, y1, 0.01, 10.0)
+PL_TEST_ULP (V_NAME_F1 (y1), 0.01)
+PL_TEST_INTERVAL (V_NAME_F1 (y1), 0, 2, 100000)
+PL_TEST_INTERVAL (V_NAME_F1 (y1), 2, 16, 100000)
+PL_TEST_INTERVAL (V_NAME_F1 (y1), 16, 0x1p23, 100000)
+PL_TEST_INTERVAL (V_NAME_F1 (y1), 0x1p23, inf, 1000)
+PL_TEST_INTERVAL (V_NAME_F1 (y1), -0, -inf, 1000)
@@ -1,6 +1,6 @@
 # Makefile fragment - requires GNU make
 #
-# Copyright (c) 2019-2021, Arm Limited.
+# Copyright (c) 2019-2026, Arm Limited.
 # SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
 
 S := $(srcdir)/string
@@ -24,11 +24,18 @@ string-libs := \
 
 string-tests := \
 	build/bin/test/memcpy \
+	build/bin/test/memcpy_mc \
+	build/bin/test/memcpy_2d \
 	build/bin/test/memmove \
 	build/bin/test/memset \
+	build/bin/test/memset_2d \
 	build/bin/test/memchr \
 	build/bin/test/memrchr \
 	build/bin/test/memcmp \
+	build/bin/test/memiszero \
+	build/bin/test/copy_page \
+	build/bin/test/clear_page \
+	build/bin/test/find \
 	build/bin/test/__mtag_tag_region \
 	build/bin/test/__mtag_tag_zero_region \
 	build/bin/test/strcpy \
@@ -42,7 +49,14 @@ string-tests := \
 	build/bin/test/strncmp
 
 string-benches := \
+	build/bin/bench/apps \
+	build/bin/bench/copy_page \
+	build/bin/bench/find \
 	build/bin/bench/memcpy \
+	build/bin/bench/memcpy_2d \
+	build/bin/bench/memcpy_persist \
+	build/bin/bench/memcpy_preserve \
+	build/bin/bench/memiszero \
 	build/bin/bench/strlen
 
 string-lib-objs := $(patsubst $(S)/%,$(B)/%.o,$(basename $(string-lib-srcs)))
@@ -61,6 +75,7 @@ string-files := \
 	$(string-tests) \
 	$(string-benches) \
 	$(string-includes) \
+	build/string/libstringlib.map \
 
 all-string: $(string-libs) $(string-tests) $(string-benches) $(string-includes)
 
@@ -69,8 +84,18 @@ $(string-objs): CFLAGS_ALL += $(string-cflags)
 
 $(string-test-objs): CFLAGS_ALL += -D_GNU_SOURCE
 
+ifneq ($(string-routines),)
+build/lib/libstringlib.so: build/string/libstringlib.map
+build/lib/libstringlib.so: LDFLAGS += -Wl,--gc-sections \
+	-Wl,--version-script=build/string/libstringlib.map
+endif
+
+build/string/libstringlib.map: $(wildcard config.mk)
+	{ echo '{ global:'; printf '  %s;\n' $(string-routines); \
+	  echo 'local: *; };'; } > $@
+
 build/lib/libstringlib.so: $(string-lib-objs:%.o=%.os)
-	$(CC) $(CFLAGS_ALL) $(LDFLAGS) -shared -o $@ $^
+	$(CC) $(CFLAGS_ALL) $(LDFLAGS) -shared -o $@ $(filter %.os,$^)
 
 build/lib/libstringlib.a: $(string-lib-objs)
 	rm -f $@
@@ -101,6 +126,16 @@ check-string: $(string-tests-out)
 bench-string: $(string-benches)
 	$(EMULATOR) build/bin/bench/strlen
 	$(EMULATOR) build/bin/bench/memcpy
+	$(EMULATOR) build/bin/bench/memcpy_2d
+	$(EMULATOR) build/bin/bench/memcpy_persist
+	$(EMULATOR) build/bin/bench/memcpy_preserve
+	$(EMULATOR) build/bin/bench/memiszero
+	$(EMULATOR) build/bin/bench/copy_page
+	$(EMULATOR) build/bin/bench/find
+	$(EMULATOR) build/bin/bench/apps
+
+mca-string: build/lib/libstringlib.a
+	$(srcdir)/math/test/mca.sh $(mca-flags) build/lib/libstringlib.a
 
 install-string: \
  $(string-libs:build/lib/%=$(DESTDIR)$(libdir)/%) \
@@ -110,4 +145,4 @@ clean-string:
 	rm -f $(string-files)
 endif
 
-.PHONY: all-string bench-string check-string install-string clean-string
+.PHONY: all-string bench-string check-string mca-string install-string clean-string
@@ -1,7 +1,7 @@
 /*
  * Macros for asm code.  AArch64 version.
  *
- * Copyright (c) 2019-2023, Arm Limited.
+ * Copyright (c) 2019-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -94,6 +94,17 @@ GNU_PROPERTY (FEATURE_1_AND, FEATURE_1_BTI|FEATURE_1_PAC)
 #define SIZE_ARG(n)
 #endif
 
+/* Clean the cache line containing address reg to the point of persistence
+   (DC CVAP) if flag is non-zero, otherwise to the point of coherency
+   (DC CVAC).  DC CVAP is encoded with SYS so no -march=armv8.2-a is needed.  */
+#define DC_PERSIST(flag, reg)		\
+  cbz	flag, 1f;			\
+  sys	#3, c7, c12, #1, reg;		\
+  b	2f;				\
+1:					\
+  dc	cvac, reg;			\
+2:
+
 /* Compiler supports SVE instructions  */
 #ifndef HAVE_SVE
 # if __aarch64__ && (__GNUC__ >= 8 || __clang_major__ >= 5)
@@ -0,0 +1,44 @@
+/*
+ * Signal handler support for __memcpy_mc.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#if __linux__
+# include <ucontext.h>
+#endif
+#include "stringlib.h"
+
+/* Code range that may fault and the address to continue at.  */
+struct memcpy_mc_extable
+{
+  uint64_t start;
+  uint64_t end;
+  uint64_t fixup;
+};
+
+extern const struct memcpy_mc_extable __memcpy_mc_extable[]
+    __attribute__ ((visibility ("hidden")));
+
+/* Called from a SIGSEGV or SIGBUS handler with its ucontext argument.  If the
+   fault happened inside __memcpy_mc, the context is changed so that returning
+   from the handler makes __memcpy_mc return the number of bytes copied, and
+   1 is returned.  Otherwise the context is not changed and 0 is returned.  */
+int
+__memcpy_mc_fixup (void *ucontext)
+{
+#if __linux__
+  ucontext_t *uc = ucontext;
+  uint64_t pc = uc->uc_mcontext.pc;
+  for (const struct memcpy_mc_extable *e = __memcpy_mc_extable; e->start; e++)
+    if (pc >= e->start && pc < e->end)
+      {
+	uc->uc_mcontext.pc = e->fixup;
+	return 1;
+      }
+#endif
+  return 0;
+}
@@ -0,0 +1,26 @@
+/*
+ * CPU feature detection for __memcpy_persist and __memset_persist.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#if __linux__
+# include <sys/auxv.h>
+#endif
+
+#ifndef HWCAP_DCPOP
+# define HWCAP_DCPOP (1 << 16)
+#endif
+
+/* Non-zero if DC CVAP is supported, otherwise DC CVAC is used which cleans
+   to the point of coherency only.  */
+unsigned char __persist_dc_cvap __attribute__ ((visibility ("hidden")));
+
+static void __attribute__ ((constructor))
+init_persist_dc_cvap (void)
+{
+#if __linux__
+  __persist_dc_cvap = (getauxval (AT_HWCAP) & HWCAP_DCPOP) != 0;
+#endif
+}
@@ -0,0 +1,511 @@
+/*
+ * Application-level string benchmark.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include "stringlib.h"
+#include "benchlib.h"
+
+/* Small programs that call the string routines the way real code does:
+   many short calls on data of realistic shape, interleaved with the
+   surrounding logic.  Each program runs with every set of routines and the
+   end-to-end throughput is reported in bytes of input per ns.  The result
+   of every run is checked against the one with the libc routines.  */
+
+#define ITERS 200
+
+/* A set of routines used by the programs.  Routines without a variant of
+   their own in a set use the generic AArch64 one.  */
+struct set
+{
+  const char *name;
+  void *(*mchr) (const void *, int, size_t);
+  int (*mcmp) (const void *, const void *, size_t);
+  void *(*mcpy) (void *__restrict, const void *__restrict, size_t);
+  char *(*schr) (const char *, int);
+  char *(*srchr) (const char *, int);
+  size_t (*slen) (const char *);
+  char *(*scpy) (char *__restrict, const char *__restrict);
+};
+
+static const struct set sets[] =
+{
+  {"libc", memchr, memcmp, memcpy, strchr, strrchr, strlen, strcpy},
+#if __aarch64__
+  {"__aarch64", __memchr_aarch64, __memcmp_aarch64, __memcpy_aarch64,
+   __strchr_aarch64, __strrchr_aarch64, __strlen_aarch64, __strcpy_aarch64},
+  {"__aarch64_mte", __memchr_aarch64_mte, __memcmp_aarch64, __memcpy_aarch64,
+   __strchr_aarch64_mte, __strrchr_aarch64_mte, __strlen_aarch64_mte,
+   __strcpy_aarch64},
+# if __ARM_NEON
+  {"__aarch64_simd", __memchr_aarch64, __memcmp_aarch64, __memcpy_aarch64_simd,
+   __strchr_aarch64, __strrchr_aarch64, __strlen_aarch64, __strcpy_aarch64},
+# endif
+# if __ARM_FEATURE_SVE
+  {"__aarch64_sve", __memchr_aarch64_sve, __memcmp_aarch64_sve,
+   __memcpy_aarch64_sve, __strchr_aarch64_sve, __strrchr_aarch64_sve,
+   __strlen_aarch64_sve, __strcpy_aarch64_sve},
+# endif
+# if WANT_MOPS
+  {"__aarch64_mops", __memchr_aarch64, __memcmp_aarch64, __memcpy_aarch64_mops,
+   __strchr_aarch64, __strrchr_aarch64, __strlen_aarch64, __strcpy_aarch64},
+# endif
+#endif
+  {0}
+};
+
+static const char *const words[] =
+{
+  "GET", "user", "id", "session", "cache", "miss", "hit", "ok", "upstream",
+  "latency_ms", "bytes", "request", "handler", "worker", "queue", "retry",
+  "db", "query", "INFO", "WARN", "conn", "closed", "opened", "path", "/api/v2",
+  "region=eu-west", "status=200", "status=404", "shard", "tenant", "epoch",
+};
+#define NWORDS (sizeof (words) / sizeof (words[0]))
+
+static char *
+append (char *p, const char *s)
+{
+  size_t n = strlen (s);
+  memcpy (p, s, n);
+  return p + n;
+}
+
+/* Log grep: find the lines of a log that contain a string, like
+   grep -F does, with memmem built from memchr and memcmp.  */
+#define LOG_SIZE (256 * 1024)
+static const char grep_pat[] = "status=503";
+static char log_buf[LOG_SIZE + 512];
+static size_t log_len;
+
+static void
+grep_init (void)
+{
+  char *p = log_buf;
+  while (p < log_buf + LOG_SIZE)
+    {
+      p += sprintf (p, "%u.%03u ", rand32 (0) % 100000, rand32 (0) % 1000);
+      int n = 4 + rand32 (0) % 16;
+      for (int i = 0; i < n; i++)
+	{
+	  p = append (p, words[rand32 (0) % NWORDS]);
+	  *p++ = ' ';
+	}
+      if (rand32 (0) % 32 == 0)
+	p = append (p, grep_pat);
+      *p++ = '\n';
+    }
+  log_len = p - log_buf;
+}
+
+static const char *
+find (const struct set *s, const char *p, size_t n, const char *pat,
+      size_t m)
+{
+  while (n >= m)
+    {
+      const char *q = s->mchr (p, pat[0], n - m + 1);
+      if (q == NULL)
+	return NULL;
+      if (s->mcmp (q + 1, pat + 1, m - 1) == 0)
+	return q;
+      n -= q + 1 - p;
+      p = q + 1;
+    }
+  return NULL;
+}
+
+static uint64_t
+grep_run (const struct set *s)
+{
+  const char *p = log_buf, *end = log_buf + log_len;
+  uint64_t r = 0;
+  while ((p = find (s, p, end - p, grep_pat, sizeof (grep_pat) - 1)))
+    {
+      const char *eol = s->mchr (p, '\n', end - p);
+      r = r * 31 + (eol - log_buf);
+      p = eol + 1;
+    }
+  return r;
+}
+
+/* HTTP header parsing: each request is copied into a work buffer, split
+   into lines which are terminated in place, and the header names are
+   matched case-insensitively against the headers the server handles.  The
+   library has no strncasecmp, so all sets use the libc one after a memcmp
+   fast path for lower-case names.  */
+#define HTTP_REQS 256
+#define HTTP_MAX 2048
+static const char *const http_names[] =
+{
+  "host", "user-agent", "accept", "accept-encoding", "accept-language",
+  "connection", "content-length", "content-type", "cookie", "referer",
+  "cache-control", "authorization",
+};
+static const char *const http_sent[] =
+{
+  "Host", "User-Agent", "Accept", "Accept-Encoding", "Accept-Language",
+  "Connection", "Content-Length", "Content-Type", "Cookie", "Referer",
+  "Cache-Control", "Authorization", "X-Request-Id", "X-Forwarded-For",
+  "Sec-Fetch-Mode", "Upgrade-Insecure-Requests",
+};
+#define HTTP_NAMES (sizeof (http_names) / sizeof (http_names[0]))
+#define HTTP_SENT (sizeof (http_sent) / sizeof (http_sent[0]))
+static char http_buf[HTTP_REQS][HTTP_MAX];
+static size_t http_len[HTTP_REQS], http_bytes;
+static size_t http_name_len[HTTP_NAMES];
+
+static void
+http_init (void)
+{
+  for (int i = 0; i < HTTP_NAMES; i++)
+    http_name_len[i] = strlen (http_names[i]);
+  for (int r = 0; r < HTTP_REQS; r++)
+    {
+      char *p = http_buf[r];
+      p += sprintf (p, "GET /api/v2/item/%u HTTP/1.1\r\n", rand32 (0) % 10000);
+      int n = 6 + rand32 (0) % 10;
+      int lower = rand32 (0) % 2;
+      for (int i = 0; i < n; i++)
+	{
+	  const char *name = http_sent[rand32 (0) % HTTP_SENT];
+	  char *q = p;
+	  p = append (p, name);
+	  for (; lower && q < p; q++)
+	    *q = *q >= 'A' && *q <= 'Z' ? *q + 32 : *q;
+	  p = append (p, ": ");
+	  int m = 1 + rand32 (0) % 6;
+	  for (int j = 0; j < m && p < http_buf[r] + HTTP_MAX - 64; j++)
+	    p = append (p, words[rand32 (0) % NWORDS]);
+	  p = append (p, "\r\n");
+	}
+      p = append (p, "\r\n");
+      http_len[r] = p - http_buf[r];
+      http_bytes += http_len[r];
+    }
+}
+
+static uint64_t
+http_run (const struct set *s)
+{
+  static char work[HTTP_MAX];
+  uint64_t r = 0;
+  for (int i = 0; i < HTTP_REQS; i++)
+    {
+      size_t len = http_len[i];
+      char *p = s->mcpy (work, http_buf[i], len);
+      char *end = work + len;
+      /* Skip the request line.  */
+      p = (char *) s->mchr (p, '\n', end - p) + 1;
+      while (p < end && *p != '\r')
+	{
+	  char *eol = s->mchr (p, '\n', end - p);
+	  eol[-1] = '\0';
+	  char *colon = s->schr (p, ':');
+	  size_t n = colon - p;
+	  for (int h = 0; h < HTTP_NAMES; h++)
+	    if (n == http_name_len[h]
+		&& (s->mcmp (p, http_names[h], n) == 0
+		    || strncasecmp (p, http_names[h], n) == 0))
+	      {
+		r = r * 31 + h * 1024 + (eol - colon);
+		break;
+	      }
+	  p = eol + 1;
+	}
+    }
+  return r;
+}
+
+/* Key-value store probe: an open-addressing hash table keyed by strings
+   with long common prefixes.  A probe compares the stored hash, then the
+   key, and copies the value out on a hit.  Half of the probes miss.  */
+#define KV_KEYS 4096
+#define KV_SLOTS (2 * KV_KEYS)
+#define KV_PROBES (2 * KV_KEYS)
+struct kv
+{
+  uint32_t hash, klen, vlen;
+  const char *key, *val;
+};
+static const char *const kv_prefix[] =
+{
+  "user:", "session:token:", "cart:item:", "profile:avatar:url:",
+};
+static struct kv kv_table[KV_SLOTS];
+static struct kv kv_probe[KV_PROBES];
+static char kv_arena[KV_KEYS * 320 + KV_PROBES / 2 * 64];
+static size_t kv_bytes;
+
+static uint32_t
+kv_hash (const char *k, size_t n)
+{
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < n; i++)
+    h = (h ^ (uint8_t) k[i]) * 16777619u;
+  return h;
+}
+
+static char *
+kv_key (char *p, uint32_t *klen)
+{
+  char *k = p;
+  p = append (p, kv_prefix[rand32 (0) % 4]);
+  p += sprintf (p, "%08x", rand32 (0));
+  for (int n = rand32 (0) % 24; n > 0; n--)
+    *p++ = 'a' + rand32 (0) % 26;
+  *klen = p - k;
+  return p;
+}
+
+static void
+kv_init (void)
+{
+  char *p = kv_arena;
+  for (int i = 0; i < KV_KEYS; i++)
+    {
+      struct kv e;
+      e.key = p;
+      p = kv_key (p, &e.klen);
+      e.hash = kv_hash (e.key, e.klen);
+      e.val = p;
+      e.vlen = 16 + rand32 (0) % 240;
+      for (int j = 0; j < e.vlen; j++)
+	*p++ = rand32 (0);
+      uint32_t h = e.hash % KV_SLOTS;
+      while (kv_table[h].key)
+	h = (h + 1) % KV_SLOTS;
+      kv_table[h] = e;
+      if (2 * i < KV_PROBES)
+	kv_probe[2 * i] = e;
+    }
+  for (int i = 1; i < KV_PROBES; i += 2)
+    {
+      struct kv *e = &kv_probe[i];
+      e->key = p;
+      p = kv_key (p, &e->klen);
+      e->hash = kv_hash (e->key, e->klen);
+    }
+  for (int i = 0; i < KV_PROBES; i++)
+    kv_bytes += kv_probe[i].klen + kv_probe[i].vlen;
+}
+
+static uint64_t
+kv_run (const struct set *s)
+{
+  static char out[256];
+  uint64_t r = 0;
+  for (int i = 0; i < KV_PROBES; i++)
+    {
+      const struct kv *q = &kv_probe[i];
+      for (uint32_t h = q->hash % KV_SLOTS; kv_table[h].key;
+	   h = (h + 1) % KV_SLOTS)
+	{
+	  const struct kv *e = &kv_table[h];
+	  if (e->hash == q->hash && e->klen == q->klen
+	      && s->mcmp (e->key, q->key, q->klen) == 0)
+	    {
+	      s->mcpy (out, e->val, e->vlen);
+	      r = r * 31 + (uint8_t) out[e->vlen - 1] + e->vlen;
+	      break;
+	    }
+	}
+    }
+  return r;
+}
+
+/* Path canonicaliser: remove empty and "." components and resolve ".."
+   components of absolute paths.  Components are found with strchr and
+   appended with strcpy, and ".." truncates at the last '/'.  */
+#define PATHS 2048
+#define PATH_MAX_LEN 512
+static const char *const path_comp[] =
+{
+  "usr", "local", "lib", "..", ".", "", "share", "include", "bin", "home",
+  "user", "projects", "src", "build", "x86_64-linux-gnu", "aarch64-linux-gnu",
+  "node_modules", "..", "third_party", "arm-optimized-routines",
+};
+#define PATH_COMPS (sizeof (path_comp) / sizeof (path_comp[0]))
+static char paths[PATHS][PATH_MAX_LEN];
+static size_t path_bytes;
+
+static void
+path_init (void)
+{
+  for (int i = 0; i < PATHS; i++)
+    {
+      char *p = paths[i];
+      int n = 2 + rand32 (0) % 12;
+      for (int j = 0; j < n; j++)
+	{
+	  *p++ = '/';
+	  p = append (p, path_comp[rand32 (0) % PATH_COMPS]);
+	}
+      *p = '\0';
+      path_bytes += p - paths[i];
+    }
+}
+
+static size_t
+canon (const struct set *s, char *out, const char *p)
+{
+  char *end = out;
+  *end = '\0';
+  for (;;)
+    {
+      while (*p == '/')
+	p++;
+      if (*p == '\0')
+	break;
+      const char *q = s->schr (p, '/');
+      size_t n = q ? q - p : s->slen (p);
+      if (n == 2 && p[0] == '.' && p[1] == '.')
+	{
+	  char *slash = s->srchr (out, '/');
+	  end = slash ? slash : out;
+	  *end = '\0';
+	}
+      else if (n != 1 || p[0] != '.')
+	{
+	  *end = '/';
+	  s->scpy (end + 1, p);
+	  end += n + 1;
+	  *end = '\0';
+	}
+      p += n;
+    }
+  if (end == out)
+    {
+      *end++ = '/';
+      *end = '\0';
+    }
+  return end - out;
+}
+
+static uint64_t
+path_run (const struct set *s)
+{
+  static char out[PATH_MAX_LEN];
+  uint64_t r = 0;
+  for (int i = 0; i < PATHS; i++)
+    {
+      size_t n = canon (s, out, paths[i]);
+      r = r * 31 + n + (uint8_t) out[n - 1];
+    }
+  return r;
+}
+
+/* Protobuf-like serializer: records of small fixed-size and
+   length-delimited fields are encoded as a tag, a varint length for
+   length-delimited fields and the field bytes.  */
+#define RECS 1024
+#define FIELDS 12
+struct field
+{
+  uint8_t tag, len;
+  const void *data;
+};
+static struct field recs[RECS][FIELDS];
+static char field_arena[RECS * FIELDS * 64];
+static char ser_out[RECS * FIELDS * 80];
+static size_t ser_bytes;
+
+static void
+ser_init (void)
+{
+  char *p = field_arena;
+  for (int i = 0; i < RECS; i++)
+    for (int j = 0; j < FIELDS; j++)
+      {
+	struct field *f = &recs[i][j];
+	int type = rand32 (0) % 4;
+	f->tag = (j + 1) << 3 | type;
+	f->len = type == 0 ? 4 : type == 1 ? 8 : rand32 (0) % (type == 2 ? 24 : 64);
+	f->data = p;
+	for (int k = 0; k < f->len; k++)
+	  *p++ = rand32 (0);
+	ser_bytes += 1 + (type >= 2) + f->len;
+      }
+}
+
+static uint64_t
+ser_run (const struct set *s)
+{
+  char *p = ser_out;
+  for (int i = 0; i < RECS; i++)
+    for (int j = 0; j < FIELDS; j++)
+      {
+	const struct field *f = &recs[i][j];
+	*p++ = f->tag;
+	if ((f->tag & 7) >= 2)
+	  *p++ = f->len;
+	s->mcpy (p, f->data, f->len);
+	p += f->len;
+      }
+  size_t n = p - ser_out;
+  uint64_t r = n;
+  for (size_t i = 0; i < n; i += 61)
+    r = r * 31 + (uint8_t) ser_out[i];
+  return r;
+}
+
+static const struct app
+{
+  const char *name;
+  void (*init) (void);
+  uint64_t (*run) (const struct set *);
+  /* Bytes of input processed by a run.  */
+  size_t *bytes;
+} apps[] =
+{
+  {"log_grep", grep_init, grep_run, &log_len},
+  {"http_hdr", http_init, http_run, &http_bytes},
+  {"kv_probe", kv_init, kv_run, &kv_bytes},
+  {"path_canon", path_init, path_run, &path_bytes},
+  {"serialize", ser_init, ser_run, &ser_bytes},
+  {0}
+};
+
+int main (void)
+{
+  uint64_t ref[sizeof (apps) / sizeof (apps[0])];
+  int fail = 0;
+
+  rand32 (0x12345678);
+  for (int a = 0; apps[a].name != 0; a++)
+    {
+      apps[a].init ();
+      ref[a] = apps[a].run (&sets[0]);
+    }
+
+  printf ("\nString applications (bytes/ns):\n%16s", "");
+  for (int a = 0; apps[a].name != 0; a++)
+    printf (" %10s", apps[a].name);
+  printf ("\n");
+  for (int f = 0; sets[f].name != 0; f++)
+    {
+      printf ("%16s", sets[f].name);
+      for (int a = 0; apps[a].name != 0; a++)
+	{
+	  uint64_t r = apps[a].run (&sets[f]);
+	  uint64_t t = clock_get_ns ();
+	  for (int i = 0; i < ITERS; i++)
+	    apps[a].run (&sets[f]);
+	  t = clock_get_ns () - t;
+	  printf (" %10.2f%s", (double) *apps[a].bytes * ITERS / t,
+		  r == ref[a] ? "" : " FAIL");
+	  fail |= r != ref[a];
+	}
+      printf ("\n");
+    }
+  printf ("\n");
+
+  return fail;
+}
@@ -0,0 +1,151 @@
+/*
+ * copy_page and clear_page benchmark.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "stringlib.h"
+#include "benchlib.h"
+
+#define MAX_PAGE 65536
+#define NPAGES 64
+#define BYTES (64 * 1024 * 1024)
+
+static uint8_t a[NPAGES * MAX_PAGE] __attribute__((__aligned__(MAX_PAGE)));
+static uint8_t b[NPAGES * MAX_PAGE] __attribute__((__aligned__(MAX_PAGE)));
+
+#if __aarch64__
+/* Batched calls, the list is set up once per page size.  */
+static void *dsts[NPAGES];
+static const void *srcs[NPAGES];
+
+static void *
+copy_pages (void *dst, const void *src, size_t size)
+{
+  __copy_pages (dsts, srcs, NPAGES, size);
+  return dst;
+}
+
+static void *
+clear_pages (void *dst, int c, size_t size)
+{
+  __clear_pages (dsts, NPAGES, size);
+  return dst;
+}
+
+static void *
+copy_page (void *dst, const void *src, size_t size)
+{
+  return __copy_page (dst, src, size);
+}
+
+static void *
+clear_page (void *dst, int c, size_t size)
+{
+  return __clear_page (dst, size);
+}
+#endif
+
+/* Each call copies or sets one page, or all NPAGES pages if batch is
+   set.  */
+#define F(x, batch) {#x, x, batch},
+
+static const struct fun
+{
+  const char *name;
+  void *(*fun)(void *, const void *, size_t);
+  int batch;
+} funtab[] =
+{
+#if __aarch64__
+  F(copy_page, 0)
+  F(copy_pages, 1)
+  F(__memcpy_aarch64, 0)
+#endif
+  F(memcpy, 0)
+  {0, 0, 0}
+};
+
+static const struct sfun
+{
+  const char *name;
+  void *(*fun)(void *, int, size_t);
+  int batch;
+} sfuntab[] =
+{
+#if __aarch64__
+  F(clear_page, 0)
+  F(clear_pages, 1)
+  F(__memset_aarch64, 0)
+#endif
+  F(memset, 0)
+  {0, 0, 0}
+};
+#undef F
+
+int main (void)
+{
+  memset (a, 1, sizeof (a));
+  memset (b, 1, sizeof (b));
+
+  printf ("Copy %d pages round robin (bytes/ns):\n", NPAGES);
+  for (int f = 0; funtab[f].name != 0; f++)
+    {
+      printf ("%22s ", funtab[f].name);
+
+      for (size_t size = 4096; size <= MAX_PAGE; size *= 4)
+	{
+	  int iters = BYTES / size;
+#if __aarch64__
+	  for (int i = 0; i < NPAGES; i++)
+	    {
+	      dsts[i] = b + i * size;
+	      srcs[i] = a + (NPAGES - 1 - i) * size;
+	    }
+#endif
+	  uint64_t t = clock_get_ns ();
+	  if (funtab[f].batch)
+	    for (int i = 0; i < iters; i += NPAGES)
+	      funtab[f].fun (b, a, size);
+	  else
+	    for (int i = 0; i < iters; i++)
+	      funtab[f].fun (b + (i % NPAGES) * size,
+			     a + (NPAGES - 1 - i % NPAGES) * size, size);
+	  t = clock_get_ns () - t;
+	  printf ("%zuK: %.2f ", size / 1024, (double)size * iters / t);
+	}
+      printf ("\n");
+    }
+
+  printf ("\nClear %d pages round robin (bytes/ns):\n", NPAGES);
+  for (int f = 0; sfuntab[f].name != 0; f++)
+    {
+      printf ("%22s ", sfuntab[f].name);
+
+      for (size_t size = 4096; size <= MAX_PAGE; size *= 4)
+	{
+	  int iters = BYTES / size;
+#if __aarch64__
+	  for (int i = 0; i < NPAGES; i++)
+	    dsts[i] = b + (NPAGES - 1 - i) * size;
+#endif
+	  uint64_t t = clock_get_ns ();
+	  if (sfuntab[f].batch)
+	    for (int i = 0; i < iters; i += NPAGES)
+	      sfuntab[f].fun (b, 0, size);
+	  else
+	    for (int i = 0; i < iters; i++)
+	      sfuntab[f].fun (b + (NPAGES - 1 - i % NPAGES) * size, 0, size);
+	  t = clock_get_ns () - t;
+	  printf ("%zuK: %.2f ", size / 1024, (double)size * iters / t);
+	}
+      printf ("\n");
+    }
+
+  return 0;
+}
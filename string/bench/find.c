@@ -0,0 +1,111 @@
+/*
+ * find and argmin benchmark.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "stringlib.h"
+#include "benchlib.h"
+
+#define ITERS 20000
+#define MAX_LEN (64 * 1024)
+
+static uint32_t a[MAX_LEN] __attribute__((__aligned__(64)));
+
+/* Scalar loops as a compiler would generate them.  */
+static size_t
+find_loop (const uint32_t *p, size_t n, uint32_t v)
+{
+  for (size_t i = 0; i < n; i++)
+    if (p[i] == v)
+      return i;
+  return n;
+}
+
+static size_t
+count_loop (const uint32_t *p, size_t n, uint32_t v)
+{
+  size_t c = 0;
+  for (size_t i = 0; i < n; i++)
+    c += p[i] == v;
+  return c;
+}
+
+static size_t
+argmin_loop (const uint32_t *p, size_t n, uint32_t v)
+{
+  size_t m = 0;
+  for (size_t i = 1; i < n; i++)
+    if ((int32_t) p[i] < (int32_t) p[m])
+      m = i;
+  return n == 0 ? 0 : m;
+}
+
+#if __aarch64__
+static size_t
+argmin (const uint32_t *p, size_t n, uint32_t v)
+{
+  return __argmin_s32 ((const int32_t *) p, n);
+}
+#endif
+
+/* Searches stop at the match, so they are timed over a long array with the
+   value at an increasing index.  Counts and argmin read the whole array, so
+   they are timed over increasing lengths with the minimum in the middle.  */
+#define F(x, full) {#x, x, full},
+
+static const struct fun
+{
+  const char *name;
+  size_t (*fun)(const uint32_t *, size_t, uint32_t);
+  int full;
+} funtab[] =
+{
+#if __aarch64__
+  F(__find_u32, 0)
+  F(__count_u32, 1)
+  F(argmin, 1)
+#endif
+  F(find_loop, 0)
+  F(count_loop, 1)
+  F(argmin_loop, 1)
+#undef F
+  {0, 0, 0}
+};
+
+int main (void)
+{
+  size_t r = 0;
+
+  for (int i = 0; i < MAX_LEN; i++)
+    a[i] = i + 1;
+
+  printf ("Search up to index or array length (G elements/s):\n");
+  for (int f = 0; funtab[f].name != 0; f++)
+    {
+      printf ("%16s ", funtab[f].name);
+
+      for (int pos = 4; pos <= MAX_LEN; pos *= 4)
+	{
+	  int iters = ITERS * 64 / pos + 16;
+	  int n = funtab[f].full ? pos : MAX_LEN;
+	  int at = funtab[f].full ? pos / 2 : pos - 1;
+	  uint32_t v = a[at];
+	  a[at] = 0;
+	  uint64_t t = clock_get_ns ();
+	  for (int i = 0; i < iters; i++)
+	    r += funtab[f].fun (a, n, 0);
+	  t = clock_get_ns () - t;
+	  a[at] = v;
+	  printf ("%d: %.2f ", pos, (double)pos * iters / t);
+	}
+      printf ("\n");
+    }
+
+  return r == 0;
+}
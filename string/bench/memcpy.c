@@ -1,7 +1,7 @@
 /*
  * memcpy benchmark.
  *
- * Copyright (c) 2020-2022, Arm Limited.
+ * Copyright (c) 2020-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -23,6 +23,17 @@
 static uint8_t a[MAX_SIZE + 4096 + 64] __attribute__((__aligned__(64)));
 static uint8_t b[MAX_SIZE + 4096 + 64] __attribute__((__aligned__(64)));
 
+#if __aarch64__
+/* __memcpy_mc returns the number of bytes copied, call it through a
+   wrapper with the memcpy signature.  */
+static void *
+memcpy_mc (void *dst, const void *src, size_t n)
+{
+  __memcpy_mc (dst, src, n);
+  return dst;
+}
+#endif
+
 #define F(x) {#x, x},
 
 static const struct fun
@@ -36,6 +47,7 @@ static const struct fun
 # if __ARM_NEON
   F(__memcpy_aarch64_simd)
 # endif
+  {"__memcpy_mc", memcpy_mc},
 # if __ARM_FEATURE_SVE
   F(__memcpy_aarch64_sve)
 # endif
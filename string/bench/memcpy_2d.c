@@ -0,0 +1,128 @@
+/*
+ * memcpy_2d and memset_2d benchmark.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "stringlib.h"
+#include "benchlib.h"
+
+#define ITERS 20000
+#define ROWS 64
+#define STRIDE 1024
+
+/* A tile of ROWS rows out of an image with STRIDE bytes per row, the
+   tile fits in the L1 cache.  */
+static uint8_t a[ROWS * STRIDE] __attribute__((__aligned__(64)));
+static uint8_t b[ROWS * STRIDE] __attribute__((__aligned__(64)));
+
+static const int widths[] = { 12, 16, 24, 32, 48, 64, 96, 128, 192, 256, 0 };
+
+/* The usual replacement: one memcpy or memset call per row.  */
+static void *
+memcpy_rows (void *dst, const void *src, size_t rows, size_t n,
+	     size_t dstride, size_t sstride)
+{
+  for (size_t i = 0; i < rows; i++)
+    memcpy ((char *) dst + i * dstride, (const char *) src + i * sstride, n);
+  return dst;
+}
+
+static void *
+memset_rows (void *dst, int c, size_t rows, size_t n, size_t dstride)
+{
+  for (size_t i = 0; i < rows; i++)
+    memset ((char *) dst + i * dstride, c, n);
+  return dst;
+}
+
+#if __aarch64__
+static void *
+memcpy_aarch64_rows (void *dst, const void *src, size_t rows, size_t n,
+		     size_t dstride, size_t sstride)
+{
+  for (size_t i = 0; i < rows; i++)
+    __memcpy_aarch64 ((char *) dst + i * dstride,
+		      (const char *) src + i * sstride, n);
+  return dst;
+}
+#endif
+
+#define F(x) {#x, x},
+
+static const struct fun
+{
+  const char *name;
+  void *(*fun)(void *, const void *, size_t, size_t, size_t, size_t);
+} funtab[] =
+{
+#if __aarch64__
+  F(__memcpy_2d)
+# if __ARM_FEATURE_SVE
+  F(__memcpy_2d_sve)
+# endif
+  F(memcpy_aarch64_rows)
+#endif
+  F(memcpy_rows)
+  {0, 0}
+};
+
+static const struct sfun
+{
+  const char *name;
+  void *(*fun)(void *, int, size_t, size_t, size_t);
+} sfuntab[] =
+{
+#if __aarch64__
+  F(__memset_2d)
+#endif
+  F(memset_rows)
+  {0, 0}
+};
+#undef F
+
+int main (void)
+{
+  memset (a, 1, sizeof (a));
+
+  printf ("Copy %d rows with stride %d (bytes/ns):\n", ROWS, STRIDE);
+  for (int f = 0; funtab[f].name != 0; f++)
+    {
+      printf ("%22s ", funtab[f].name);
+
+      for (int w = 0; widths[w] != 0; w++)
+	{
+	  uint64_t t = clock_get_ns ();
+	  for (int i = 0; i < ITERS; i++)
+	    funtab[f].fun (b + 8, a + 3, ROWS, widths[w], STRIDE, STRIDE);
+	  t = clock_get_ns () - t;
+	  printf ("%dB: %.2f ", widths[w],
+		  (double) widths[w] * ROWS * ITERS / t);
+	}
+      printf ("\n");
+    }
+
+  printf ("\nSet %d rows with stride %d (bytes/ns):\n", ROWS, STRIDE);
+  for (int f = 0; sfuntab[f].name != 0; f++)
+    {
+      printf ("%22s ", sfuntab[f].name);
+
+      for (int w = 0; widths[w] != 0; w++)
+	{
+	  uint64_t t = clock_get_ns ();
+	  for (int i = 0; i < ITERS; i++)
+	    sfuntab[f].fun (b + 8, 0, ROWS, widths[w], STRIDE);
+	  t = clock_get_ns () - t;
+	  printf ("%dB: %.2f ", widths[w],
+		  (double) widths[w] * ROWS * ITERS / t);
+	}
+      printf ("\n");
+    }
+
+  return 0;
+}
@@ -0,0 +1,173 @@
+/*
+ * memcpy_persist and memset_persist benchmark.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "stringlib.h"
+#include "benchlib.h"
+
+#define ITERS 2000
+#define MAX_SIZE (1024 * 1024)
+
+/* The destination is a shared file mapping on tmpfs, which stands in for a
+   DAX mapping of persistent memory.  */
+static uint8_t *pmem;
+static uint8_t a[MAX_SIZE + 64] __attribute__((__aligned__(64)));
+
+#if __aarch64__
+# include <sys/auxv.h>
+# ifndef HWCAP_DCPOP
+#  define HWCAP_DCPOP (1 << 16)
+# endif
+
+/* Clean to the point of persistence with DC CVAP if supported, otherwise
+   to the point of coherency with DC CVAC, as the routines under test do.
+   DC CVAP is spelled as a SYS instruction for older assemblers.  */
+static int dc_cvap;
+
+static void
+clean_range (void *dst, size_t n)
+{
+  uint64_t ctr;
+  __asm__ ("mrs %0, ctr_el0" : "=r" (ctr));
+  uintptr_t line = 4 << ((ctr >> 16) & 15);
+  uintptr_t p = (uintptr_t) dst & -line;
+  if (dc_cvap)
+    for (; p < (uintptr_t) dst + n; p += line)
+      __asm__ volatile ("sys #3, c7, c12, #1, %0" : : "r" (p) : "memory");
+  else
+    for (; p < (uintptr_t) dst + n; p += line)
+      __asm__ volatile ("dc cvac, %0" : : "r" (p) : "memory");
+  __asm__ volatile ("dsb sy" ::: "memory");
+}
+
+/* Reference implementation: copy, then clean in a separate pass.  */
+static void *
+memcpy_then_clean (void *dst, const void *src, size_t n)
+{
+  memcpy (dst, src, n);
+  clean_range (dst, n);
+  return dst;
+}
+
+static void *
+memset_then_clean (void *dst, int c, size_t n)
+{
+  memset (dst, c, n);
+  clean_range (dst, n);
+  return dst;
+}
+#endif
+
+#define F(x) {#x, x},
+
+static const struct fun
+{
+  const char *name;
+  void *(*fun)(void *, const void *, size_t);
+} funtab[] =
+{
+#if __aarch64__
+  F(memcpy_then_clean)
+  F(__memcpy_persist)
+#endif
+  F(memcpy)
+  {0, 0}
+};
+
+static const struct sfun
+{
+  const char *name;
+  void *(*fun)(void *, int, size_t);
+} sfuntab[] =
+{
+#if __aarch64__
+  F(memset_then_clean)
+  F(__memset_persist)
+#endif
+  F(memset)
+  {0, 0}
+};
+#undef F
+
+static uint8_t *
+map_tmpfs (size_t size)
+{
+  char name[] = "/dev/shm/memcpy_persist.XXXXXX";
+  int fd = mkstemp (name);
+  if (fd < 0)
+    {
+      printf ("mkstemp failed: %m\n");
+      exit (1);
+    }
+  unlink (name);
+  if (ftruncate (fd, size))
+    {
+      printf ("ftruncate failed: %m\n");
+      exit (1);
+    }
+  void *p = mmap (0, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (p == MAP_FAILED)
+    {
+      printf ("mmap failed: %m\n");
+      exit (1);
+    }
+  close (fd);
+  return p;
+}
+
+int main (void)
+{
+#if __aarch64__
+  dc_cvap = (getauxval (AT_HWCAP) & HWCAP_DCPOP) != 0;
+  printf ("Cleaning with DC %s\n\n", dc_cvap ? "CVAP" : "CVAC");
+#endif
+  pmem = map_tmpfs (MAX_SIZE + 64);
+  memset (a, 1, sizeof (a));
+
+  printf ("Copy to persistent memory (bytes/ns):\n");
+  for (int f = 0; funtab[f].name != 0; f++)
+    {
+      printf ("%22s ", funtab[f].name);
+
+      for (int size = 64; size <= MAX_SIZE; size *= 4)
+	{
+	  int iters = ITERS * 64 / size + 16;
+	  uint64_t t = clock_get_ns ();
+	  for (int i = 0; i < iters; i++)
+	    funtab[f].fun (pmem + 8, a, size);
+	  t = clock_get_ns () - t;
+	  printf ("%dB: %.2f ", size, (double)size * iters / t);
+	}
+      printf ("\n");
+    }
+
+  printf ("\nSet persistent memory (bytes/ns):\n");
+  for (int f = 0; sfuntab[f].name != 0; f++)
+    {
+      printf ("%22s ", sfuntab[f].name);
+
+      for (int size = 64; size <= MAX_SIZE; size *= 4)
+	{
+	  int iters = ITERS * 64 / size + 16;
+	  uint64_t t = clock_get_ns ();
+	  for (int i = 0; i < iters; i++)
+	    sfuntab[f].fun (pmem + 8, 0, size);
+	  t = clock_get_ns () - t;
+	  printf ("%dB: %.2f ", size, (double)size * iters / t);
+	}
+      printf ("\n");
+    }
+
+  return 0;
+}
@@ -0,0 +1,167 @@
+/*
+ * memcpy_preserve and memset_preserve benchmark.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "stringlib.h"
+#include "benchlib.h"
+
+#if __aarch64__
+# include <arm_neon.h>
+
+#define ITERS 2000000
+#define MAX_SIZE 1024
+
+static uint8_t a[MAX_SIZE + 64] __attribute__((__aligned__(64)));
+static uint8_t b[MAX_SIZE + 64] __attribute__((__aligned__(64)));
+
+/* Calls with the reduced clobber set of the _preserve routines, as a
+   compiler or JIT would emit them.  */
+static inline void
+memcpy_preserve (void *dst, const void *src, size_t n)
+{
+  register void *x0 __asm__ ("x0") = dst;
+  register const void *x1 __asm__ ("x1") = src;
+  register size_t x2 __asm__ ("x2") = n;
+  __asm__ volatile ("bl __memcpy_preserve"
+		    : "+r" (x0)
+		    : "r" (x1), "r" (x2)
+		    : "x16", "x17", "x30", "v24", "v25", "v26", "v27", "v28",
+		      "v29", "v30", "v31", "cc", "memory");
+}
+
+static inline void
+memset_preserve (void *dst, int c, size_t n)
+{
+  register void *x0 __asm__ ("x0") = dst;
+  register int x1 __asm__ ("x1") = c;
+  register size_t x2 __asm__ ("x2") = n;
+  __asm__ volatile ("bl __memset_preserve"
+		    : "+r" (x0)
+		    : "r" (x1), "r" (x2)
+		    : "x16", "x17", "x30", "v24", "v25", "v26", "v27", "v28",
+		      "v29", "v30", "v31", "cc", "memory");
+}
+
+/* A caller loop that keeps 16 vectors and 8 integers live across a copy
+   or set of n bytes, like an unrolled kernel copying a struct.  With a
+   normal call the vectors and the integers that do not fit in x19-x28
+   are spilled and reloaded around every call, with the _preserve calls
+   they stay in registers.  The sum of the live values is returned so the
+   different calls can be checked against each other.  */
+#define KERNEL(name, call)						\
+static uint64_t								\
+name (size_t n)								\
+{									\
+  float32x4_t k = vdupq_n_f32 (0.5f);					\
+  float32x4_t v0 = vdupq_n_f32 (0), v1 = vdupq_n_f32 (1);		\
+  float32x4_t v2 = vdupq_n_f32 (2), v3 = vdupq_n_f32 (3);		\
+  float32x4_t v4 = vdupq_n_f32 (4), v5 = vdupq_n_f32 (5);		\
+  float32x4_t v6 = vdupq_n_f32 (6), v7 = vdupq_n_f32 (7);		\
+  float32x4_t v8 = vdupq_n_f32 (8), v9 = vdupq_n_f32 (9);		\
+  float32x4_t v10 = vdupq_n_f32 (10), v11 = vdupq_n_f32 (11);		\
+  float32x4_t v12 = vdupq_n_f32 (12), v13 = vdupq_n_f32 (13);		\
+  float32x4_t v14 = vdupq_n_f32 (14), v15 = vdupq_n_f32 (15);		\
+  uint64_t g0 = 0, g1 = 1, g2 = 2, g3 = 3, g4 = 4, g5 = 5, g6 = 6, g7 = 7; \
+  for (int i = 0; i < ITERS; i++)					\
+    {									\
+      call;								\
+      v0 = vfmaq_f32 (k, v0, k); v1 = vfmaq_f32 (k, v1, k);		\
+      v2 = vfmaq_f32 (k, v2, k); v3 = vfmaq_f32 (k, v3, k);		\
+      v4 = vfmaq_f32 (k, v4, k); v5 = vfmaq_f32 (k, v5, k);		\
+      v6 = vfmaq_f32 (k, v6, k); v7 = vfmaq_f32 (k, v7, k);		\
+      v8 = vfmaq_f32 (k, v8, k); v9 = vfmaq_f32 (k, v9, k);		\
+      v10 = vfmaq_f32 (k, v10, k); v11 = vfmaq_f32 (k, v11, k);		\
+      v12 = vfmaq_f32 (k, v12, k); v13 = vfmaq_f32 (k, v13, k);		\
+      v14 = vfmaq_f32 (k, v14, k); v15 = vfmaq_f32 (k, v15, k);		\
+      g0 += g1 ^ i; g1 += g2 ^ i; g2 += g3 ^ i; g3 += g4 ^ i;		\
+      g4 += g5 ^ i; g5 += g6 ^ i; g6 += g7 ^ i; g7 += g0 ^ i;		\
+    }									\
+  float32x4_t s = vaddq_f32 (vaddq_f32 (vaddq_f32 (v0, v1),		\
+					vaddq_f32 (v2, v3)),		\
+			     vaddq_f32 (vaddq_f32 (v4, v5),		\
+					vaddq_f32 (v6, v7)));		\
+  s = vaddq_f32 (s, vaddq_f32 (vaddq_f32 (vaddq_f32 (v8, v9),		\
+					  vaddq_f32 (v10, v11)),	\
+			       vaddq_f32 (vaddq_f32 (v12, v13),		\
+					  vaddq_f32 (v14, v15))));	\
+  return (uint64_t) vaddvq_f32 (s) + g0 + g1 + g2 + g3 + g4 + g5 + g6 + g7; \
+}
+
+static void *(*volatile memcpy_fn) (void *, const void *, size_t)
+  = __memcpy_aarch64;
+static void *(*volatile memset_fn) (void *, int, size_t) = __memset_aarch64;
+
+KERNEL (copy_call, memcpy_fn (b + (i & 7), a, n))
+KERNEL (copy_preserve, memcpy_preserve (b + (i & 7), a, n))
+KERNEL (set_call, memset_fn (b + (i & 7), i & 255, n))
+KERNEL (set_preserve, memset_preserve (b + (i & 7), i & 255, n))
+
+static const struct fun
+{
+  const char *name;
+  uint64_t (*fun) (size_t);
+} funtab[] =
+{
+  {"__memcpy_aarch64", copy_call},
+  {"__memcpy_preserve", copy_preserve},
+  {"__memset_aarch64", set_call},
+  {"__memset_preserve", set_preserve},
+  {0, 0}
+};
+
+#define NSIZES 7
+
+int main (void)
+{
+  memset (a, 1, sizeof (a));
+
+  printf ("Caller loop with 16 live vectors and 8 live integers "
+	  "(ns per call):\n");
+  for (int f = 0; funtab[f].name != 0; f += 2)
+    {
+      double ns[2][NSIZES];
+
+      for (int s = 0, size = 16; s < NSIZES; s++, size *= 2)
+	{
+	  uint64_t r[2];
+	  for (int j = 0; j < 2; j++)
+	    {
+	      uint64_t t = clock_get_ns ();
+	      r[j] = funtab[f + j].fun (size);
+	      ns[j][s] = (double)(clock_get_ns () - t) / ITERS;
+	    }
+	  if (r[0] != r[1])
+	    {
+	      printf ("%s corrupted live registers\n", funtab[f + 1].name);
+	      return 1;
+	    }
+	}
+      for (int j = 0; j < 2; j++)
+	{
+	  printf ("%22s ", funtab[f + j].name);
+	  for (int s = 0; s < NSIZES; s++)
+	    printf ("%dB: %.2f ", 16 << s, ns[j][s]);
+	  printf ("\n");
+	}
+      printf ("%22s ", "saved");
+      for (int s = 0; s < NSIZES; s++)
+	printf ("%dB: %.2f ", 16 << s, ns[0][s] - ns[1][s]);
+      printf ("\n\n");
+    }
+
+  return 0;
+}
+#else
+int main (void)
+{
+  printf ("__memcpy_preserve and __memset_preserve are AArch64 only\n");
+  return 0;
+}
+#endif
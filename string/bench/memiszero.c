@@ -0,0 +1,98 @@
+/*
+ * memiszero benchmark.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "stringlib.h"
+#include "benchlib.h"
+
+#define ITERS 20000
+#define MAX_SIZE (1024 * 1024)
+
+static uint8_t a[MAX_SIZE + 64] __attribute__((__aligned__(64)));
+static const uint8_t zero[MAX_SIZE + 64] __attribute__((__aligned__(64)));
+
+/* Common replacements: memcmp against a zero buffer and an OR loop.  */
+static int
+memcmp_zero (const void *s, size_t n)
+{
+  return memcmp (s, zero, n) == 0;
+}
+
+static int
+or_loop (const void *s, size_t n)
+{
+  const uint8_t *p = s;
+  uint8_t r = 0;
+  for (size_t i = 0; i < n; i++)
+    r |= p[i];
+  return r == 0;
+}
+
+#define F(x) {#x, x},
+
+static const struct fun
+{
+  const char *name;
+  int (*fun)(const void *, size_t);
+} funtab[] =
+{
+#if __aarch64__ || __x86_64__
+  F(__memiszero)
+#endif
+#if __aarch64__ && __ARM_FEATURE_SVE
+  F(__memiszero_sve)
+#endif
+  F(memcmp_zero)
+  F(or_loop)
+#undef F
+  {0, 0}
+};
+
+int main (void)
+{
+  int r = 0;
+
+  printf ("Zero buffers (GB/s):\n");
+  for (int f = 0; funtab[f].name != 0; f++)
+    {
+      printf ("%22s ", funtab[f].name);
+
+      for (int size = 64; size <= MAX_SIZE; size *= 4)
+	{
+	  int iters = ITERS * 1024 / size + 16;
+	  uint64_t t = clock_get_ns ();
+	  for (int i = 0; i < iters; i++)
+	    r += funtab[f].fun (a + 8, size);
+	  t = clock_get_ns () - t;
+	  printf ("%dB: %.2f ", size, (double)size * iters / t);
+	}
+      printf ("\n");
+    }
+
+  printf ("\nUnaligned 4KiB page with non-zero byte at offset (GB/s):\n");
+  for (int f = 0; funtab[f].name != 0; f++)
+    {
+      printf ("%22s ", funtab[f].name);
+
+      for (int pos = 64; pos <= 4096; pos *= 4)
+	{
+	  a[3 + pos - 1] = 1;
+	  uint64_t t = clock_get_ns ();
+	  for (int i = 0; i < ITERS * 8; i++)
+	    r += funtab[f].fun (a + 3, 4096);
+	  t = clock_get_ns () - t;
+	  a[3 + pos - 1] = 0;
+	  printf ("%dB: %.2f ", pos, (double)pos * ITERS * 8 / t);
+	}
+      printf ("\n");
+    }
+
+  return r == 0;
+}
@@ -1,11 +1,12 @@
 /*
  * Public API.
  *
- * Copyright (c) 2019-2022, Arm Limited.
+ * Copyright (c) 2019-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
 #include <stddef.h>
+#include <stdint.h>
 
 /* restrict is not needed, but kept for documenting the interface contract.  */
 #ifndef __restrict
@@ -28,11 +29,42 @@ char *__strchrnul_aarch64 (const char *, int );
 size_t __strlen_aarch64 (const char *);
 size_t __strnlen_aarch64 (const char *, size_t);
 int __strncmp_aarch64 (const char *, const char *, size_t);
+/* memchr, strchr, strchrnul, strlen and strrchr may read beyond the MTE
+   granule holding the end of the input, their _mte variants do not.  The
+   other routines are MTE compatible.  */
 void * __memchr_aarch64_mte (const void *, int, size_t);
 char *__strchr_aarch64_mte (const char *, int);
 char * __strchrnul_aarch64_mte (const char *, int );
 size_t __strlen_aarch64_mte (const char *);
 char *__strrchr_aarch64_mte (const char *, int);
+size_t __memcpy_mc (void *__restrict, const void *__restrict, size_t);
+int __memcpy_mc_fixup (void *);
+void *__memcpy_persist (void *__restrict, const void *__restrict, size_t);
+void *__memset_persist (void *, int, size_t);
+/* Only clobber x16, x17, v24-v31 (z24-z31) and the flags, return dst in x0
+   and keep x1 and x2.  */
+void *__memcpy_preserve (void *__restrict, const void *__restrict, size_t);
+void *__memset_preserve (void *, int, size_t);
+int __memiszero (const void *, size_t);
+size_t __memiszero_pages (const void *const *, size_t, size_t, uint64_t *);
+/* Pages are aligned to 4096 bytes and their size is a multiple of 4096.  */
+void *__copy_page (void *__restrict, const void *__restrict, size_t);
+void __copy_pages (void *const *, const void *const *, size_t, size_t);
+void *__clear_page (void *, size_t);
+void __clear_pages (void *const *, size_t, size_t);
+void *__memcpy_2d (void *__restrict, const void *__restrict, size_t, size_t,
+		   size_t, size_t);
+void *__memset_2d (void *, int, size_t, size_t, size_t);
+size_t __find_u16 (const uint16_t *, size_t, uint16_t);
+size_t __find_u32 (const uint32_t *, size_t, uint32_t);
+size_t __find_u64 (const uint64_t *, size_t, uint64_t);
+size_t __count_u32 (const uint32_t *, size_t, uint32_t);
+size_t __argmin_s32 (const int32_t *, size_t);
+size_t __argmax_s32 (const int32_t *, size_t);
+size_t __argmin_u32 (const uint32_t *, size_t);
+size_t __argmax_u32 (const uint32_t *, size_t);
+size_t __argmin_f32 (const float *, size_t);
+size_t __argmax_f32 (const float *, size_t);
 #if __ARM_NEON
 void *__memcpy_aarch64_simd (void *__restrict, const void *__restrict, size_t);
 void *__memmove_aarch64_simd (void *, const void *, size_t);
@@ -51,6 +83,9 @@ char *__stpcpy_aarch64_sve (char *__restrict, const char *__restrict);
 size_t __strlen_aarch64_sve (const char *);
 size_t __strnlen_aarch64_sve (const char *, size_t);
 int __strncmp_aarch64_sve (const char *, const char *, size_t);
+int __memiszero_sve (const void *, size_t);
+void *__memcpy_2d_sve (void *__restrict, const void *__restrict, size_t,
+		       size_t, size_t, size_t);
 # endif
 # if WANT_MOPS
 void *__memcpy_aarch64_mops (void *__restrict, const void *__restrict, size_t);
@@ -61,6 +96,9 @@ void *__memset_aarch64_mops (void *, int, size_t);
 void *__mtag_tag_region (void *, size_t);
 void *__mtag_tag_zero_region (void *, size_t);
 # endif
+#elif __x86_64__
+int __memiszero (const void *, size_t);
+size_t __memiszero_pages (const void *const *, size_t, size_t, uint64_t *);
 #elif __arm__
 void *__memcpy_arm (void *__restrict, const void *__restrict, size_t);
 void *__memset_arm (void *, int, size_t);
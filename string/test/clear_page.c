@@ -0,0 +1,126 @@
+/*
+ * clear_page test.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stringlib.h"
+#include "stringtest.h"
+
+#define F(x) {#x, x},
+
+static const struct fun
+{
+  const char *name;
+  void *(*fun) (void *, size_t);
+} funtab[] = {
+  // clang-format off
+#if __aarch64__
+  F(__clear_page)
+#endif
+  {0, 0}
+  // clang-format on
+};
+
+static const struct bfun
+{
+  const char *name;
+  void (*fun) (void *const *, size_t, size_t);
+} bfuntab[] = {
+  // clang-format off
+#if __aarch64__
+  F(__clear_pages)
+#endif
+  {0, 0}
+  // clang-format on
+};
+#undef F
+
+#define MAX_PAGE 65536
+#define NPAGES 6
+
+/* NPAGES pages with a guard page on either side.  */
+static unsigned char buf[(NPAGES + 2) * MAX_PAGE]
+  __attribute__ ((__aligned__ (MAX_PAGE)));
+
+static void
+check (const char *name, size_t page, int i, const unsigned char *p,
+       int want)
+{
+  for (size_t j = 0; j < page; j++)
+    if (p[j] != want)
+      {
+	ERR ("%s(%zu): page %d byte %zu is %d, want %d\n", name, page, i, j,
+	     p[j], want);
+	return;
+      }
+}
+
+static void
+test (const struct fun *fun, size_t page)
+{
+  unsigned char *p = buf + page;
+
+  if (err_count >= ERR_LIMIT)
+    return;
+  memset (buf, 0x55, (NPAGES + 2) * page);
+  void *r = fun->fun (p + page, page);
+  if (r != p + page)
+    ERR ("%s(%zu) returned %p, want %p\n", fun->name, page, r, p + page);
+  for (int i = -1; i <= NPAGES; i++)
+    check (fun->name, page, i, p + i * page, i == 1 ? 0 : 0x55);
+}
+
+static void
+test_batch (const struct bfun *fun, size_t page)
+{
+  unsigned char *p = buf + page;
+  void *pages[NPAGES];
+
+  if (err_count >= ERR_LIMIT)
+    return;
+
+  /* Clear every other page, in reverse order.  */
+  memset (buf, 0x55, (NPAGES + 2) * page);
+  for (int i = 0; i < NPAGES / 2; i++)
+    pages[i] = p + (NPAGES - 2 - 2 * i) * page;
+  fun->fun (pages, NPAGES / 2, page);
+  for (int i = -1; i <= NPAGES; i++)
+    check (fun->name, page, i, p + i * page,
+	   i >= 0 && i < NPAGES && i % 2 == 0 ? 0 : 0x55);
+
+  memset (buf, 0x55, (NPAGES + 2) * page);
+  fun->fun (pages, 0, page);
+  for (int i = -1; i <= NPAGES; i++)
+    check (fun->name, page, i, p + i * page, 0x55);
+}
+
+int
+main (void)
+{
+  int r = 0;
+  for (int i = 0; funtab[i].name; i++)
+    {
+      err_count = 0;
+      for (size_t page = 4096; page <= MAX_PAGE; page *= 4)
+	test (funtab + i, page);
+      printf ("%s %s\n", err_count ? "FAIL" : "PASS", funtab[i].name);
+      if (err_count)
+	r = -1;
+    }
+  for (int i = 0; bfuntab[i].name; i++)
+    {
+      err_count = 0;
+      for (size_t page = 4096; page <= MAX_PAGE; page *= 4)
+	test_batch (bfuntab + i, page);
+      printf ("%s %s\n", err_count ? "FAIL" : "PASS", bfuntab[i].name);
+      if (err_count)
+	r = -1;
+    }
+  return r;
+}
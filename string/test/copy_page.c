@@ -0,0 +1,148 @@
+/*
+ * copy_page test.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stringlib.h"
+#include "stringtest.h"
+
+#define F(x) {#x, x},
+
+static const struct fun
+{
+  const char *name;
+  void *(*fun) (void *__restrict, const void *__restrict, size_t);
+} funtab[] = {
+  // clang-format off
+#if __aarch64__
+  F(__copy_page)
+#endif
+  {0, 0}
+  // clang-format on
+};
+
+static const struct bfun
+{
+  const char *name;
+  void (*fun) (void *const *, const void *const *, size_t, size_t);
+} bfuntab[] = {
+  // clang-format off
+#if __aarch64__
+  F(__copy_pages)
+#endif
+  {0, 0}
+  // clang-format on
+};
+#undef F
+
+#define MAX_PAGE 65536
+#define NPAGES 6
+
+/* Room for NPAGES source pages, NPAGES destination pages and a guard page
+   on either side of the destinations.  */
+static unsigned char buf[(2 * NPAGES + 2) * MAX_PAGE]
+  __attribute__ ((__aligned__ (MAX_PAGE)));
+
+static void
+fill (unsigned char *p, size_t n, int seed)
+{
+  for (size_t i = 0; i < n; i++)
+    p[i] = (i * 29 + seed) % 251 + 1;
+}
+
+static void
+check_guard (const char *name, const unsigned char *p, size_t n)
+{
+  for (size_t i = 0; i < n; i++)
+    if (p[i] != 0x55)
+      {
+	ERR ("%s wrote outside the pages\n", name);
+	return;
+      }
+}
+
+static void
+test (const struct fun *fun, size_t page)
+{
+  unsigned char *src = buf;
+  unsigned char *guard = buf + NPAGES * page;
+  unsigned char *dst = guard + page;
+
+  if (err_count >= ERR_LIMIT)
+    return;
+  for (int i = 0; i < NPAGES; i++)
+    fill (src + i * page, page, i);
+  memset (guard, 0x55, (NPAGES + 2) * page);
+
+  void *r = fun->fun (dst, src + page, page);
+  if (r != dst)
+    ERR ("%s(%zu) returned %p, want %p\n", fun->name, page, r, dst);
+  if (memcmp (dst, src + page, page) != 0)
+    ERR ("%s(%zu) copied the wrong data\n", fun->name, page);
+  check_guard (fun->name, guard, page);
+  check_guard (fun->name, dst + page, NPAGES * page);
+}
+
+static void
+test_batch (const struct bfun *fun, size_t page)
+{
+  unsigned char *src = buf;
+  unsigned char *guard = buf + NPAGES * page;
+  unsigned char *dst = guard + page;
+  void *dsts[NPAGES];
+  const void *srcs[NPAGES];
+
+  if (err_count >= ERR_LIMIT)
+    return;
+  for (int i = 0; i < NPAGES; i++)
+    fill (src + i * page, page, i);
+  memset (guard, 0x55, (NPAGES + 2) * page);
+
+  /* Copy the pages in reverse order, the last one is not copied.  */
+  for (int i = 0; i < NPAGES - 1; i++)
+    {
+      dsts[i] = dst + i * page;
+      srcs[i] = src + (NPAGES - 1 - i) * page;
+    }
+  fun->fun (dsts, srcs, NPAGES - 1, page);
+  for (int i = 0; i < NPAGES - 1; i++)
+    if (memcmp (dsts[i], srcs[i], page) != 0)
+      ERR ("%s(%zu) copied the wrong data to page %d\n", fun->name, page, i);
+  check_guard (fun->name, guard, page);
+  check_guard (fun->name, dst + (NPAGES - 1) * page, 2 * page);
+
+  memset (guard, 0x55, (NPAGES + 2) * page);
+  fun->fun (dsts, srcs, 0, page);
+  check_guard (fun->name, guard, (NPAGES + 2) * page);
+}
+
+int
+main (void)
+{
+  int r = 0;
+  for (int i = 0; funtab[i].name; i++)
+    {
+      err_count = 0;
+      for (size_t page = 4096; page <= MAX_PAGE; page *= 4)
+	test (funtab + i, page);
+      printf ("%s %s\n", err_count ? "FAIL" : "PASS", funtab[i].name);
+      if (err_count)
+	r = -1;
+    }
+  for (int i = 0; bfuntab[i].name; i++)
+    {
+      err_count = 0;
+      for (size_t page = 4096; page <= MAX_PAGE; page *= 4)
+	test_batch (bfuntab + i, page);
+      printf ("%s %s\n", err_count ? "FAIL" : "PASS", bfuntab[i].name);
+      if (err_count)
+	r = -1;
+    }
+  return r;
+}
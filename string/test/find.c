@@ -0,0 +1,285 @@
+/*
+ * find, count, argmin and argmax test.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mte.h"
+#include "stringlib.h"
+#include "stringtest.h"
+
+#define A 64
+#define LEN 1000
+static unsigned char *sbuf;
+
+static void *
+alignup (void *p)
+{
+  return (void *) (((uintptr_t) p + A - 1) & -A);
+}
+
+#if __aarch64__
+static size_t
+find16 (const void *p, size_t n, uint64_t v)
+{
+  return __find_u16 (p, n, v);
+}
+
+static size_t
+find32 (const void *p, size_t n, uint64_t v)
+{
+  return __find_u32 (p, n, v);
+}
+
+static size_t
+find64 (const void *p, size_t n, uint64_t v)
+{
+  return __find_u64 (p, n, v);
+}
+
+static size_t
+count32 (const void *p, size_t n, uint64_t v)
+{
+  return __count_u32 (p, n, v);
+}
+#endif
+
+#define F(x, f, size, count) {#x, f, size, count},
+
+static const struct fun
+{
+  const char *name;
+  size_t (*fun) (const void *p, size_t n, uint64_t v);
+  int size;
+  int count;
+} funtab[] = {
+  // clang-format off
+#if __aarch64__
+  F(__find_u16, find16, 2, 0)
+  F(__find_u32, find32, 4, 0)
+  F(__find_u64, find64, 8, 0)
+  F(__count_u32, count32, 4, 1)
+#endif
+  {0, 0, 0, 0}
+  // clang-format on
+};
+#undef F
+
+/* Element types and orderings for argmin and argmax.  */
+enum { S32, U32, F32 };
+
+#define F(x, type, max) {#x, (size_t (*) (const void *, size_t)) x, type, max},
+
+static const struct argfun
+{
+  const char *name;
+  size_t (*fun) (const void *p, size_t n);
+  int type;
+  int max;
+} argtab[] = {
+  // clang-format off
+#if __aarch64__
+  F(__argmin_s32, S32, 0)
+  F(__argmax_s32, S32, 1)
+  F(__argmin_u32, U32, 0)
+  F(__argmax_u32, U32, 1)
+  F(__argmin_f32, F32, 0)
+  F(__argmax_f32, F32, 1)
+#endif
+  {0, 0, 0, 0}
+  // clang-format on
+};
+#undef F
+
+static void
+set (void *p, int size, size_t i, uint64_t v)
+{
+  if (size == 2)
+    ((uint16_t *) p)[i] = v;
+  else if (size == 4)
+    ((uint32_t *) p)[i] = v;
+  else
+    ((uint64_t *) p)[i] = v;
+}
+
+/* Search n elements at element offset align with the value at pos, and
+   again at pos2, or nowhere if pos >= n.  The value is also stored just
+   outside the array to catch out of bounds reads.  */
+static void
+test (const struct fun *fun, int align, size_t n, size_t pos, size_t pos2)
+{
+  int size = fun->size;
+  unsigned char *src = alignup (sbuf);
+  unsigned char *s = src + A + align * size;
+  /* A value whose halves differ catches comparisons of the wrong width.  */
+  uint64_t v = 0x8001000380050007 & (~0ULL >> (64 - 8 * size));
+  size_t want;
+
+  if (err_count >= ERR_LIMIT)
+    return;
+  if (n > LEN || align * size >= A)
+    abort ();
+
+  for (size_t i = 0; i < n + (2 * A) / size; i++)
+    set (src, size, i, v);
+  for (size_t i = 0; i < n; i++)
+    set (s, size, i, v ^ (1 + i % 7) << (i % 3 * 4));
+  want = fun->count ? 0 : n;
+  if (pos < n)
+    {
+      set (s, size, pos, v);
+      want = fun->count ? 1 : pos;
+    }
+  if (pos2 < n && pos2 != pos)
+    {
+      set (s, size, pos2, v);
+      if (fun->count)
+	want++;
+      else if (pos2 < want)
+	want = pos2;
+    }
+
+  s = tag_buffer (s, n * size, 1);
+  size_t r = fun->fun (s, n, v);
+  untag_buffer (s, n * size, 1);
+
+  if (r != want)
+    {
+      ERR ("%s(align %d, %zu) with value at %zu and %zu returned %zu, "
+	   "expected %zu\n",
+	   fun->name, align, n, pos, pos2, r, want);
+      quoteat ("input", s, n * size, pos * size);
+    }
+}
+
+static int
+less (int type, uint32_t x, uint32_t y)
+{
+  if (type == S32)
+    return (int32_t) x < (int32_t) y;
+  if (type == U32)
+    return x < y;
+  float fx, fy;
+  memcpy (&fx, &x, 4);
+  memcpy (&fy, &y, 4);
+  if (fx == 0 && fy == 0)
+    return signbit (fx) && !signbit (fy);
+  return fx < fy;
+}
+
+static int
+isnan32 (int type, uint32_t x)
+{
+  return type == F32 && (x & 0x7fffffff) > 0x7f800000;
+}
+
+/* Find the extremum of n random elements, with values from a small range so
+   that it occurs several times.  */
+static void
+test_arg (const struct argfun *fun, int align, size_t n, unsigned seed)
+{
+  static const float fvals[] = {-2.5f, -0.0f, 0.0f, 1.0f, 3.0f, NAN};
+  unsigned char *src = alignup (sbuf);
+  uint32_t *s = (uint32_t *) (src + A + align * 4);
+  uint32_t extreme;
+  size_t want = n;
+
+  if (err_count >= ERR_LIMIT)
+    return;
+  if (n > LEN || align * 4 >= A)
+    abort ();
+
+  /* Values outside the array are more extreme than any inside.  */
+  if (fun->type == F32)
+    {
+      float f = fun->max ? INFINITY : -INFINITY;
+      memcpy (&extreme, &f, 4);
+    }
+  else if (fun->type == S32)
+    extreme = fun->max ? 0x7fffffff : 0x80000000;
+  else
+    extreme = fun->max ? 0xffffffff : 0;
+  for (size_t i = 0; i < n + (2 * A) / 4; i++)
+    ((uint32_t *) src)[i] = extreme;
+
+  srand (seed);
+  for (size_t i = 0; i < n; i++)
+    {
+      int k = rand () % 6;
+      if (fun->type == F32)
+	memcpy (s + i, fvals + k, 4);
+      else
+	s[i] = (uint32_t) (k - 3) * 0x01010101;
+    }
+  /* Not all NaN, the result is unspecified then.  */
+  if (n > 0 && isnan32 (fun->type, s[0]))
+    s[0] = 0;
+  for (size_t i = 0; i < n; i++)
+    {
+      if (isnan32 (fun->type, s[i]))
+	continue;
+      if (want == n
+	  || (fun->max ? less (fun->type, s[want], s[i])
+		       : less (fun->type, s[i], s[want])))
+	want = i;
+    }
+
+  s = tag_buffer (s, n * 4, 1);
+  size_t r = fun->fun (s, n);
+  untag_buffer (s, n * 4, 1);
+
+  if (r != want)
+    {
+      ERR ("%s(align %d, %zu) seed %u returned %zu, expected %zu\n",
+	   fun->name, align, n, seed, r, want);
+      quoteat ("input", s, n * 4, want * 4);
+    }
+}
+
+int
+main (void)
+{
+  int r = 0;
+  sbuf = mte_mmap (LEN * 8 + 3 * A);
+  for (int i = 0; funtab[i].name; i++)
+    {
+      err_count = 0;
+      for (int a = 0; a * funtab[i].size < A; a += 3)
+	for (size_t n = 0; n < 130; n++)
+	  {
+	    test (funtab + i, a, n, n, n);
+	    for (size_t pos = 0; pos < n; pos++)
+	      {
+		test (funtab + i, a, n, pos, n);
+		test (funtab + i, a, n, pos, n - 1);
+		test (funtab + i, a, n, pos, pos + 3);
+	      }
+	  }
+      for (size_t n = 130; n <= LEN; n += 87)
+	for (size_t pos = 0; pos <= n; pos += 13)
+	  test (funtab + i, 1, n, pos, n - 2);
+      char *pass = mte_enabled () ? "MTE PASS" : "PASS";
+      printf ("%s %s\n", err_count ? "FAIL" : pass, funtab[i].name);
+      if (err_count)
+	r = -1;
+    }
+  for (int i = 0; argtab[i].name; i++)
+    {
+      err_count = 0;
+      for (int a = 0; a < A / 4; a += 5)
+	for (size_t n = 0; n <= LEN; n += n < 150 ? 1 : 61)
+	  for (unsigned seed = 0; seed < 4; seed++)
+	    test_arg (argtab + i, a, n, seed + n);
+      char *pass = mte_enabled () ? "MTE PASS" : "PASS";
+      printf ("%s %s\n", err_count ? "FAIL" : pass, argtab[i].name);
+      if (err_count)
+	r = -1;
+    }
+  return r;
+}
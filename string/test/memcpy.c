@@ -1,7 +1,7 @@
 /*
  * memcpy test.
  *
- * Copyright (c) 2019-2022, Arm Limited.
+ * Copyright (c) 2019-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -25,6 +25,8 @@ static const struct fun
   F(memcpy, 0)
 #if __aarch64__
   F(__memcpy_aarch64, 1)
+  F(__memcpy_persist, 1)
+  F(__memcpy_preserve, 1)
 # if __ARM_NEON
   F(__memcpy_aarch64_simd, 1)
 # endif
@@ -0,0 +1,114 @@
+/*
+ * memcpy_2d test.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stringlib.h"
+#include "stringtest.h"
+
+#define F(x) {#x, x},
+
+static const struct fun
+{
+  const char *name;
+  void *(*fun) (void *, const void *, size_t, size_t, size_t, size_t);
+} funtab[] = {
+  // clang-format off
+#if __aarch64__
+  F(__memcpy_2d)
+# if __ARM_FEATURE_SVE
+  F(__memcpy_2d_sve)
+# endif
+#endif
+  {0, 0}
+  // clang-format on
+};
+#undef F
+
+#define A 32
+#define MAX_ROWS 9
+#define MAX_WIDTH 600
+#define LEN (MAX_ROWS * (MAX_WIDTH + 64) + 2 * A)
+static unsigned char sbuf[LEN + 2 * A];
+static unsigned char dbuf[LEN + 2 * A];
+static unsigned char wbuf[LEN + 2 * A];
+
+static void *
+alignup (void *p)
+{
+  return (void *) (((uintptr_t) p + A - 1) & -A);
+}
+
+static void
+test (const struct fun *fun, int dalign, int salign, int rows, int width,
+      int dpad, int spad)
+{
+  unsigned char *src = alignup (sbuf);
+  unsigned char *dst = alignup (dbuf);
+  unsigned char *want = wbuf;
+  unsigned char *s = src + salign;
+  unsigned char *d = dst + dalign;
+  size_t sstride = width + spad;
+  size_t dstride = width + dpad;
+  int len = rows * (width + (dpad > spad ? dpad : spad)) + 2 * A;
+  void *p;
+  int i;
+
+  if (err_count >= ERR_LIMIT)
+    return;
+  if (len > LEN || dalign >= A || salign >= A)
+    abort ();
+  for (i = 0; i < len; i++)
+    {
+      src[i] = '?';
+      want[i] = dst[i] = '*';
+    }
+  for (int r = 0; r < rows; r++)
+    for (int j = 0; j < width; j++)
+      {
+	s[r * sstride + j] = 'a' + (r * 7 + j) % 23;
+	want[dalign + r * dstride + j] = 'a' + (r * 7 + j) % 23;
+      }
+
+  p = fun->fun (d, s, rows, width, dstride, sstride);
+  if (p != d)
+    ERR ("%s(%p,..) returned %p\n", fun->name, d, p);
+  for (i = 0; i < len; i++)
+    if (dst[i] != want[i])
+      {
+	ERR ("%s(align %d, align %d, %d rows of %d, strides %zu %zu) failed\n",
+	     fun->name, dalign, salign, rows, width, dstride, sstride);
+	quoteat ("got", dst, len, i);
+	quoteat ("want", want, len, i);
+	break;
+      }
+}
+
+int
+main ()
+{
+  static const int pads[] = { 0, 1, 16, 63 };
+  int r = 0;
+  for (int i = 0; funtab[i].name; i++)
+    {
+      err_count = 0;
+      for (int rows = 0; rows <= MAX_ROWS; rows++)
+	for (int width = 0; width <= MAX_WIDTH; width += width < 300 ? 1 : 37)
+	  for (int p = 0; p < 4; p++)
+	    {
+	      test (funtab + i, (width + p) % A, (width * 3 + rows) % A, rows,
+		    width, pads[p], pads[3 - p]);
+	      test (funtab + i, 0, 0, rows, width, pads[p], pads[p]);
+	    }
+      printf ("%s %s\n", err_count ? "FAIL" : "PASS", funtab[i].name);
+      if (err_count)
+	r = -1;
+    }
+  return r;
+}
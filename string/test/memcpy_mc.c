@@ -0,0 +1,204 @@
+/*
+ * memcpy_mc test.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "stringlib.h"
+#include "stringtest.h"
+
+#define F(x, fixup) {#x, x, fixup},
+
+static const struct fun
+{
+  const char *name;
+  size_t (*fun) (void *, const void *, size_t);
+  int (*fixup) (void *);
+} funtab[] = {
+  // clang-format off
+#if __aarch64__
+  F(__memcpy_mc, __memcpy_mc_fixup)
+#endif
+  {0, 0, 0}
+  // clang-format on
+};
+#undef F
+
+#define A 32
+#define LEN 250000
+static unsigned char sbuf[LEN + 2 * A];
+static unsigned char dbuf[LEN + 2 * A];
+static unsigned char wbuf[LEN + 2 * A];
+
+static int (*fixup) (void *);
+
+static void
+handler (int sig, siginfo_t *si, void *uc)
+{
+  if (!fixup || !fixup (uc))
+    abort ();
+}
+
+static void *
+alignup (void *p)
+{
+  return (void *) (((uintptr_t) p + A - 1) & -A);
+}
+
+static void
+test (const struct fun *fun, int dalign, int salign, int len)
+{
+  unsigned char *src = alignup (sbuf);
+  unsigned char *dst = alignup (dbuf);
+  unsigned char *want = wbuf;
+  unsigned char *s = src + salign;
+  unsigned char *d = dst + dalign;
+  unsigned char *w = want + dalign;
+  size_t r;
+  int i;
+
+  if (err_count >= ERR_LIMIT)
+    return;
+  if (len > LEN || dalign >= A || salign >= A)
+    abort ();
+  for (i = 0; i < len + A; i++)
+    {
+      src[i] = '?';
+      want[i] = dst[i] = '*';
+    }
+  for (i = 0; i < len; i++)
+    s[i] = w[i] = 'a' + i % 23;
+
+  r = fun->fun (d, s, len);
+
+  if (r != len)
+    ERR ("%s(%p,..,%d) returned %zu\n", fun->name, d, len, r);
+  for (i = 0; i < len + A; i++)
+    {
+      if (dst[i] != want[i])
+	{
+	  ERR ("%s(align %d, align %d, %d) failed\n", fun->name, dalign, salign,
+	       len);
+	  quoteat ("got", dst, len + A, i);
+	  quoteat ("want", want, len + A, i);
+	  break;
+	}
+    }
+}
+
+/* Copy the len bytes before map + end from a file mapping where only the
+   first avail bytes can be read, the rest faults with SIGBUS.  */
+static void
+test_fault (const struct fun *fun, unsigned char *map, size_t end,
+	    size_t avail, int len)
+{
+  unsigned char *s = map + end - len;
+  size_t want = avail > end - len ? avail - (end - len) : 0;
+  size_t r;
+
+  if (err_count >= ERR_LIMIT)
+    return;
+  if (want > len)
+    want = len;
+  memset (dbuf, '*', len + A);
+
+  r = fun->fun (dbuf, s, len);
+
+  if (r != want)
+    ERR ("%s(.., map + %zu, %d) returned %zu, want %zu\n", fun->name,
+	 end - len, len, r, want);
+  else if (memcmp (dbuf, s, want) != 0)
+    ERR ("%s(.., map + %zu, %d) copied wrong data\n", fun->name, end - len,
+	 len);
+  else if (dbuf[len] != '*')
+    ERR ("%s(.., map + %zu, %d) wrote past the end\n", fun->name, end - len,
+	 len);
+}
+
+/* Map a file of 4 pages, then truncate it so that reading the last 2 pages
+   of the mapping raises SIGBUS, as when a file is truncated by another
+   process while it is being copied.  */
+static void
+test_truncate (const struct fun *fun)
+{
+  size_t page = sysconf (_SC_PAGESIZE);
+  size_t maplen = 4 * page;
+  size_t avail = 2 * page;
+  char name[] = "/tmp/memcpy_mc.XXXXXX";
+  int fd = mkstemp (name);
+  if (fd < 0)
+    {
+      printf ("mkstemp failed: %m\n");
+      exit (1);
+    }
+  unlink (name);
+  for (size_t i = 0; i < LEN; i++)
+    wbuf[i] = 'a' + i % 23;
+  for (size_t n = 0; n < maplen; n += LEN / 2)
+    if (write (fd, wbuf, maplen - n < LEN / 2 ? maplen - n : LEN / 2) < 0)
+      abort ();
+  unsigned char *map = mmap (0, maplen, PROT_READ, MAP_SHARED, fd, 0);
+  if (map == MAP_FAILED)
+    {
+      printf ("mmap failed: %m\n");
+      exit (1);
+    }
+  /* Truncate to the middle of a page, the rest of that page reads 0.  */
+  if (ftruncate (fd, avail - 100))
+    abort ();
+
+  int len;
+  for (len = 0; len < 300; len++)
+    {
+      test_fault (fun, map, avail, avail, len);
+      test_fault (fun, map, avail + 150, avail, len);
+    }
+  for (; len < LEN && len <= avail; len *= 2)
+    for (int off = 0; off < A; off++)
+      test_fault (fun, map, avail + off, avail, len);
+  if (maplen <= LEN)
+    test_fault (fun, map, maplen, avail, maplen);
+
+  munmap (map, maplen);
+  close (fd);
+}
+
+int
+main ()
+{
+  struct sigaction sa;
+  memset (&sa, 0, sizeof sa);
+  sa.sa_sigaction = handler;
+  sa.sa_flags = SA_SIGINFO;
+  sigaction (SIGBUS, &sa, 0);
+  sigaction (SIGSEGV, &sa, 0);
+
+  int r = 0;
+  for (int i = 0; funtab[i].name; i++)
+    {
+      err_count = 0;
+      fixup = funtab[i].fixup;
+      for (int d = 0; d < A; d++)
+	for (int s = 0; s < A; s++)
+	  {
+	    int n;
+	    for (n = 0; n < 100; n++)
+	      test (funtab + i, d, s, n);
+	    for (; n < LEN; n *= 2)
+	      test (funtab + i, d, s, n);
+	  }
+      test_truncate (funtab + i);
+      printf ("%s %s\n", err_count ? "FAIL" : "PASS", funtab[i].name);
+      if (err_count)
+	r = -1;
+    }
+  return r;
+}
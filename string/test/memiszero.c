@@ -0,0 +1,156 @@
+/*
+ * memiszero test.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mte.h"
+#include "stringlib.h"
+#include "stringtest.h"
+
+#define F(x, mte) {#x, x, mte},
+
+static const struct fun
+{
+  const char *name;
+  int (*fun) (const void *s, size_t n);
+  int test_mte;
+} funtab[] = {
+  // clang-format off
+#if __aarch64__ || __x86_64__
+  F(__memiszero, 1)
+#endif
+#if __aarch64__ && __ARM_FEATURE_SVE
+  F(__memiszero_sve, 1)
+#endif
+  {0, 0, 0}
+  // clang-format on
+};
+#undef F
+
+#define A 32
+#define LEN 250000
+#define PAGE 4096
+#define NPAGES 130
+static unsigned char *sbuf;
+
+static void *
+alignup (void *p)
+{
+  return (void *) (((uintptr_t) p + A - 1) & -A);
+}
+
+static void
+test (const struct fun *fun, int align, int len, int nz)
+{
+  unsigned char *src = alignup (sbuf);
+  unsigned char *s = src + align;
+  int r;
+
+  if (err_count >= ERR_LIMIT)
+    return;
+  if (len > LEN || align >= A || nz >= len)
+    abort ();
+  /* Non-zero bytes around the buffer catch reads out of bounds.  */
+  for (int i = 0; i < len + 2 * A; i++)
+    src[i] = 0xff;
+  memset (s, 0, len);
+  if (nz >= 0)
+    s[nz] = 1 << (nz % 8);
+
+  s = tag_buffer (s, len, fun->test_mte);
+  r = fun->fun (s, len);
+  untag_buffer (s, len, fun->test_mte);
+
+  if (r != (nz < 0))
+    {
+      ERR ("%s(align %d, %d) with byte %d set returned %d\n", fun->name,
+	   align, len, nz, r);
+      quote ("input", s, len);
+    }
+}
+
+#if __aarch64__ || __x86_64__
+static void
+test_pages (void)
+{
+  static unsigned char pagebuf[NPAGES * PAGE];
+  const void *pages[NPAGES];
+  uint64_t bitmap[(NPAGES + 63) / 64 + 1];
+  size_t want = 0;
+
+  memset (pagebuf, 0, sizeof pagebuf);
+  for (int i = 0; i < NPAGES; i++)
+    {
+      /* Use the pages in reverse order.  */
+      pages[i] = pagebuf + (NPAGES - 1 - i) * PAGE;
+      if (i % 3 == 0 || i % 7 == 0)
+	pagebuf[(NPAGES - 1 - i) * PAGE + (i * 37) % PAGE] = i;
+    }
+  memset (bitmap, 0xaa, sizeof bitmap);
+  size_t r = __memiszero_pages (pages, NPAGES, PAGE, bitmap);
+  for (int i = 0; i < NPAGES; i++)
+    {
+      /* Page 0 stays zero since its marker byte is 0.  */
+      int zero = !(i % 3 == 0 || i % 7 == 0) || i == 0;
+      int got = (bitmap[i / 64] >> (i % 64)) & 1;
+      want += zero;
+      if (got != zero)
+	ERR ("__memiszero_pages: bit %d is %d, want %d\n", i, got, zero);
+    }
+  if (bitmap[NPAGES / 64] >> (NPAGES % 64))
+    ERR ("__memiszero_pages: bits above npages are set\n");
+  if (bitmap[(NPAGES + 63) / 64] != 0xaaaaaaaaaaaaaaaa)
+    ERR ("__memiszero_pages: wrote past the end of the bitmap\n");
+  if (r != want)
+    ERR ("__memiszero_pages returned %zu, want %zu\n", r, want);
+  if (__memiszero_pages (pages, 0, PAGE, bitmap) != 0)
+    ERR ("__memiszero_pages with no pages returned non-zero\n");
+}
+#endif
+
+int
+main ()
+{
+  sbuf = mte_mmap (LEN + 3 * A);
+  int r = 0;
+  for (int i = 0; funtab[i].name; i++)
+    {
+      err_count = 0;
+      for (int a = 0; a < A; a++)
+	{
+	  int n;
+	  for (n = 0; n < 200; n++)
+	    {
+	      test (funtab + i, a, n, -1);
+	      for (int nz = 0; nz < n; nz++)
+		test (funtab + i, a, n, nz);
+	    }
+	  for (; n < LEN; n *= 2)
+	    {
+	      test (funtab + i, a, n, -1);
+	      test (funtab + i, a, n, 0);
+	      test (funtab + i, a, n, n / 2);
+	      test (funtab + i, a, n, n - 1);
+	      test (funtab + i, a, n, n - 65);
+	    }
+	}
+      char *pass = funtab[i].test_mte && mte_enabled () ? "MTE PASS" : "PASS";
+      printf ("%s %s\n", err_count ? "FAIL" : pass, funtab[i].name);
+      if (err_count)
+	r = -1;
+    }
+#if __aarch64__ || __x86_64__
+  err_count = 0;
+  test_pages ();
+  printf ("%s __memiszero_pages\n", err_count ? "FAIL" : "PASS");
+  if (err_count)
+    r = -1;
+#endif
+  return r;
+}
@@ -1,7 +1,7 @@
 /*
  * memset test.
  *
- * Copyright (c) 2019-2020, Arm Limited.
+ * Copyright (c) 2019-2026, Arm Limited.
  * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
  */
 
@@ -25,6 +25,8 @@ static const struct fun
   F(memset, 0)
 #if __aarch64__
   F(__memset_aarch64, 1)
+  F(__memset_persist, 1)
+  F(__memset_preserve, 1)
 # if WANT_MOPS
   F(__memset_aarch64_mops, 1)
 # endif
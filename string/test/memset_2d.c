@@ -0,0 +1,101 @@
+/*
+ * memset_2d test.
+ *
+ * Copyright (c) 2026, Arm Limited.
+ * SPDX-License-Identifier: MIT OR Apache-2.0 WITH LLVM-exception
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "stringlib.h"
+#include "stringtest.h"
+
+#define F(x) {#x, x},
+
+static const struct fun
+{
+  const char *name;
+  void *(*fun) (void *, int, size_t, size_t, size_t);
+} funtab[] = {
+  // clang-format off
+#if __aarch64__
+  F(__memset_2d)
+#endif
+  {0, 0}
+  // clang-format on
+};
+#undef F
+
+#define A 32
+#define MAX_ROWS 9
+#define MAX_WIDTH 600
+#define LEN (MAX_ROWS * (MAX_WIDTH + 64) + 2 * A)
+static unsigned char sbuf[LEN + 2 * A];
+static unsigned char wbuf[LEN + 2 * A];
+
+static void *
+alignup (void *p)
+{
+  return (void *) (((uintptr_t) p + A - 1) & -A);
+}
+
+static void
+test (const struct fun *fun, int salign, int c, int rows, int width, int pad)
+{
+  unsigned char *src = alignup (sbuf);
+  unsigned char *want = wbuf;
+  unsigned char *s = src + salign;
+  size_t stride = width + pad;
+  int len = rows * stride + 2 * A;
+  void *p;
+  int i;
+
+  if (err_count >= ERR_LIMIT)
+    return;
+  if (len > LEN || salign >= A)
+    abort ();
+  for (i = 0; i < len; i++)
+    want[i] = src[i] = '?';
+  for (int r = 0; r < rows; r++)
+    for (int j = 0; j < width; j++)
+      want[salign + r * stride + j] = c;
+
+  p = fun->fun (s, c, rows, width, stride);
+  if (p != s)
+    ERR ("%s(%p,..) returned %p\n", fun->name, s, p);
+  for (i = 0; i < len; i++)
+    if (src[i] != want[i])
+      {
+	ERR ("%s(align %d, %d, %d rows of %d, stride %zu) failed\n",
+	     fun->name, salign, c, rows, width, stride);
+	quoteat ("got", src, len, i);
+	quoteat ("want", want, len, i);
+	break;
+      }
+}
+
+int
+main ()
+{
+  static const int pads[] = { 0, 1, 16, 63 };
+  int r = 0;
+  for (int i = 0; funtab[i].name; i++)
+    {
+      err_count = 0;
+      for (int rows = 0; rows <= MAX_ROWS; rows++)
+	for (int width = 0; width <= MAX_WIDTH; width += width < 300 ? 1 : 37)
+	  for (int p = 0; p < 4; p++)
+	    {
+	      test (funtab + i, (width + p) % A, 'a' + p, rows, width,
+		    pads[p]);
+	      test (funtab + i, 0, 0, rows, width, pads[p]);
+	      test (funtab + i, 7, 0xaa + rows, rows, width, pads[p]);
+	    }
+      printf ("%s %s\n", err_count ? "FAIL" : "PASS", funtab[i].name);
+      if (err_count)
+	r = -1;
+    }
+  return r;
+}